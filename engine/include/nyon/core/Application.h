@@ -2,15 +2,50 @@
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include "nyon/EngineConstants.h"
+#include "nyon/utils/FlightRecorder.h"
+#include "nyon/utils/FrameTimingLog.h"
+#include "nyon/utils/WorldInspector.h"
 
 namespace Nyon
 {
+    /**
+     * @brief Run-mode switches, usually parsed from the command line
+     *
+     * --headless      No window, GL context or rendering; each frame runs exactly one fixed step
+     * --frames N      Stop after N frames (0 = until closed)
+     * --scale X       Demo-defined workload multiplier (bricks, balls, blocks, pipes)
+     * --bot           Drive the game with its scripted bot instead of the keyboard
+     * --timing PATH   Write per-frame timings to PATH as CSV
+     * --seed N        Seed for demo random number generators (0 = nondeterministic)
+     * --fps N         Pace windowed frames to N per second (0 = unpaced) and skip idle physics steps
+     * --spike-ms X    Dump the flight recorder when a frame takes longer than X ms (0 = never)
+     * --spike-dir DIR Directory flight recorder dumps are written to
+     * --inspect NAME  Publish each frame to the shared-memory segment NAME for external inspectors
+     */
+    struct LaunchOptions
+    {
+        bool headless = false;
+        uint64_t maxFrames = 0;
+        float scale = 1.0f;
+        bool bot = false;
+        std::string timingPath;
+        uint32_t seed = 0;
+        double targetFps = 0.0;
+        double spikeMs = 50.0;
+        std::string spikeDir = ".";
+        std::string inspectName;
+
+        static LaunchOptions Parse(int argc, char** argv);
+    };
+
     class Application
     {
     public:
-        Application(const char* title, int width, int height);
+        Application(const char* title, int width, int height, const LaunchOptions& options = {});
         virtual ~Application();
 
         void Run();
@@ -19,16 +54,45 @@ namespace Nyon
         static Application& Get() { return *s_Instance; }
         GLFWwindow* GetWindow() const { return m_Window; }
 
+        const LaunchOptions& GetLaunchOptions() const { return m_Options; }
+        bool IsHeadless() const { return m_Options.headless; }
+
+        // Window size, or the requested size when headless
+        void GetWindowSize(int& width, int& height) const;
+
+        // Seconds since start: wall clock when windowed, simulated time when headless
+        double GetTime() const;
+
+        const Utils::FrameTimingLog& GetFrameTimings() const { return m_FrameTimings; }
+
+        // Ring buffer of recent frames, dumped to disk around frame spikes
+        Utils::FlightRecorder& GetFlightRecorder() { return m_FlightRecorder; }
+        const Utils::FlightRecorder& GetFlightRecorder() const { return m_FlightRecorder; }
+
+        // Shared-memory view of each frame for external tools; open only with --inspect
+        Utils::WorldInspector& GetWorldInspector() { return m_WorldInspector; }
+
+        // Frames per second the windowed loop is paced to; 0 disables pacing
+        void SetTargetFrameRate(double fps) { m_Options.targetFps = fps > 0.0 ? fps : 0.0; }
+        double GetTargetFrameRate() const { return m_Options.targetFps; }
+
     protected:
         // Methods that can be overridden by games
         virtual void OnStart() {}
         virtual void OnUpdate(float deltaTime) {} // For backward compatibility - per-frame user logic
         virtual void OnFixedUpdate(float deltaTime) {} // Fixed timestep update for physics
         virtual void OnInterpolateAndRender(float alpha) {} // Render with interpolation
+        virtual void OnRecordFlightFrame(Utils::FlightRecorder::FrameRecord& record) {} // Add game/physics data to a recorded frame
+        virtual void OnPublishInspectorFrame(Utils::WorldInspector::Frame& frame) {} // Add game/physics data to a published frame
 
     private:
         void Init();
         void ProcessInput();
+        void RunHeadless();
+        void FinishTiming();
+        double WaitForNextFrame();
+        void RecordFlightFrame(uint64_t frame, const Utils::FrameTimingLog::Frame& timing);
+        void PublishInspectorFrame(uint64_t frame, const Utils::FrameTimingLog::Frame& timing);
 
     private:
         GLFWwindow* m_Window;
@@ -36,11 +100,20 @@ namespace Nyon
         float m_LastFrameTime;
         const char* m_Title;
         int m_Width, m_Height;
-        
+        LaunchOptions m_Options;
+
         // Variables for fixed timestep game loop with interpolation
         double m_CurrentTime;
         double m_Accumulator;
+        double m_SimulatedTime = 0.0;
+        double m_NextFrameDeadline = 0.0;  // glfwGetTime() the paced frame should end at
+
+        bool m_RecordTiming = false;
+        Utils::FrameTimingLog m_FrameTimings;
+        Utils::FlightRecorder m_FlightRecorder;
+        Utils::WorldInspector m_WorldInspector;
+        uint64_t m_LastAllocationCount = 0;
 
         static Application* s_Instance;
     };
-}
\ No newline at end of file
+}
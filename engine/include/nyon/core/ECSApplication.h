@@ -4,6 +4,7 @@
 #include "nyon/ecs/EntityManager.h"
 #include "nyon/ecs/ComponentStore.h"
 #include "nyon/ecs/SystemManager.h"
+#include <ostream>
 
 // Forward declarations
 namespace Nyon::ECS {
@@ -23,7 +24,7 @@ namespace Nyon
     class ECSApplication : public Application
     {
     public:
-        ECSApplication(const char* title, int width, int height);
+        ECSApplication(const char* title, int width, int height, const LaunchOptions& options = {});
         virtual ~ECSApplication();
         
         // ECS accessors for derived classes and testing
@@ -31,6 +32,11 @@ namespace Nyon
         ECS::ComponentStore& GetComponentStore() { return m_ComponentStore; }
         ECS::SystemManager& GetSystemManager() { return m_SystemManager; }
         
+        /**
+         * @brief Write per-tag memory counters and component pool capacity to out
+         */
+        void ReportMemory(std::ostream& out) const;
+        
     protected:
         
         // Methods that can be overridden by games
@@ -38,10 +44,15 @@ namespace Nyon
         virtual void OnECSUpdate(float deltaTime) {}  // Called after ECS systems update (user logic hook)
         virtual void OnECSFixedUpdate(float deltaTime) {}  // Called during fixed-step update (physics logic hook)
         
+        // Dump ReportMemory() to stderr every interval seconds of simulated time (0 = off; F2 toggles 5 s)
+        void SetMemoryReportInterval(float seconds) { m_MemoryReportInterval = seconds; m_MemoryReportTimer = 0.0f; }
+        
         // Override base Application methods
         void OnStart() override final;
         void OnFixedUpdate(float deltaTime) override final;
         void OnInterpolateAndRender(float alpha) override final;
+        void OnRecordFlightFrame(Utils::FlightRecorder::FrameRecord& record) override final;
+        void OnPublishInspectorFrame(Utils::WorldInspector::Frame& frame) override final;
         
     private:
         ECS::EntityManager m_EntityManager;
@@ -52,5 +63,9 @@ namespace Nyon
         std::unique_ptr<ECS::RenderSystem> m_RenderSystem;  // Separate render system - only called during interpolation
         std::unique_ptr<ECS::DebugRenderSystem> m_DebugRenderSystem;  // Debug overlay renderer
         bool m_DebugOverlayEnabled = false;  // F1 toggle flag
+        float m_MemoryReportInterval = 0.0f; // F2 toggle, seconds between memory dumps
+        float m_MemoryReportTimer = 0.0f;
+        uint64_t m_LastInputSerial = 0;      // Input that may wake an idle physics world
+        Utils::FlightRecorder::PhysicsSample m_FramePhysics; // Physics statistics of the frame's fixed steps so far
     };
 }
\ No newline at end of file
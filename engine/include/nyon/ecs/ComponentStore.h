@@ -10,9 +10,48 @@
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <atomic>
+#include <tuple>
+#include "nyon/utils/ThreadPool.h"
+#include "nyon/utils/MemoryTracker.h"
 
 namespace Nyon::ECS
 {
+    /**
+     * @brief Contiguous slice of a component pool's dense arrays.
+     * 
+     * Produced by ComponentStore::GetChunks() / ForEachChunk(). Valid until the
+     * pool is structurally changed (component added, removed or reordered).
+     */
+    template<typename T>
+    struct ComponentChunk
+    {
+        const EntityID* entities = nullptr;  // Entity IDs of this slice
+        T* components = nullptr;             // Components of this slice
+        size_t offset = 0;                   // Dense index of the first element
+        size_t count = 0;                    // Number of elements
+        
+        size_t size() const { return count; }
+        EntityID GetEntity(size_t i) const { return entities[i]; }
+        T& operator[](size_t i) const { return components[i]; }
+    };
+    
+    /**
+     * @brief Size versus capacity of one component pool.
+     * 
+     * Byte counts cover the dense component, entity ID and active flag arrays;
+     * the index map is charged to MemoryTag::ECS but not broken out here.
+     */
+    struct PoolMemoryStats
+    {
+        const char* typeName = "";     // typeid name of the component type (mangled on GCC/Clang)
+        size_t componentSize = 0;      // sizeof(T)
+        size_t count = 0;              // Live components
+        size_t capacity = 0;           // Reserved component slots
+        size_t usedBytes = 0;          // Bytes holding live components
+        size_t reservedBytes = 0;      // Bytes reserved by the dense arrays
+    };
+    
     /**
      * @brief Storage system for ECS components using true Structure of Arrays pattern.
      * 
@@ -30,21 +69,36 @@ namespace Nyon::ECS
             virtual bool HasComponent(EntityID entity) const = 0;
             virtual EntityID GetEntityAtIndex(size_t index) const = 0;
             virtual size_t GetComponentCount() const = 0;
+            virtual PoolMemoryStats GetMemoryStats() const = 0;
         };
         
         // Template container for specific component types using SoA pattern
         template<typename T>
         struct ComponentContainer : public IComponentContainer
         {
-            std::vector<T> components;           // Dense array of components
+            using ComponentArray = Utils::TrackedVector<T, Utils::MemoryTag::ECS>;
+            
+            ComponentArray components;           // Dense array of components
             std::vector<EntityID> entityIds;     // Parallel array of entity IDs
             std::vector<bool> activeFlags;       // Active flag for each component
-            std::unordered_map<EntityID, size_t> indexMap; // O(1) lookup map
+            Utils::TrackedUnorderedMap<EntityID, size_t, Utils::MemoryTag::ECS> indexMap; // O(1) lookup map
+            
+            // Number of parallel iterations in flight; structural changes while non-zero are bugs.
+            // Always present so the layout does not depend on NDEBUG; only debug builds count.
+            std::atomic<int> iterationDepth{0};
+            
+            void AssertNotIterating() const
+            {
+#ifndef NDEBUG
+                assert(iterationDepth.load() == 0 && "Component pool structurally modified during parallel iteration");
+#endif
+            }
             
             void RemoveComponent(EntityID entity) override
             {
                 auto it = indexMap.find(entity);
                 if (it == indexMap.end()) return;
+                AssertNotIterating();
                 
                 size_t idx = it->second;
                 size_t last = components.size() - 1;
@@ -85,6 +139,19 @@ namespace Nyon::ECS
                 return indexMap.size();
             }
             
+            PoolMemoryStats GetMemoryStats() const override
+            {
+                PoolMemoryStats stats;
+                stats.typeName = typeid(T).name();
+                stats.componentSize = sizeof(T);
+                stats.count = components.size();
+                stats.capacity = components.capacity();
+                stats.usedBytes = components.size() * (sizeof(T) + sizeof(EntityID)) + (activeFlags.size() + 7) / 8;
+                stats.reservedBytes = components.capacity() * sizeof(T) + entityIds.capacity() * sizeof(EntityID) +
+                                      (activeFlags.capacity() + 7) / 8;
+                return stats;
+            }
+            
             // Add component to dense arrays
             void AddComponent(EntityID entity, T&& component)
             {
@@ -98,12 +165,27 @@ namespace Nyon::ECS
                 }
                 
                 // Add new component
+                AssertNotIterating();
                 indexMap[entity] = components.size();
                 components.push_back(std::forward<T>(component));
                 entityIds.push_back(entity);
                 activeFlags.push_back(true);
             }
             
+            // Grow the dense arrays and index map to hold at least capacity components,
+            // keeping geometric growth so repeated small reservations stay amortized
+            void Reserve(size_t capacity)
+            {
+                if (capacity <= components.capacity())
+                    return;
+                AssertNotIterating();
+                capacity = std::max(capacity, components.capacity() * 2);
+                components.reserve(capacity);
+                entityIds.reserve(capacity);
+                activeFlags.reserve(capacity);
+                indexMap.reserve(capacity);
+            }
+            
             // Get component reference by index (for iteration)
             T& GetComponentByIndex(size_t index)
             {
@@ -128,6 +210,50 @@ namespace Nyon::ECS
             {
                 return activeFlags;
             }
+            
+            // Permute dense arrays: listed entities first (in order), the rest keep their relative order
+            void Reorder(const std::vector<EntityID>& order)
+            {
+                AssertNotIterating();
+                
+                std::vector<size_t> permutation;
+                permutation.reserve(components.size());
+                std::vector<bool> placed(components.size(), false);
+                
+                for (EntityID entity : order)
+                {
+                    auto it = indexMap.find(entity);
+                    if (it != indexMap.end() && !placed[it->second])
+                    {
+                        placed[it->second] = true;
+                        permutation.push_back(it->second);
+                    }
+                }
+                for (size_t i = 0; i < components.size(); ++i)
+                {
+                    if (!placed[i])
+                        permutation.push_back(i);
+                }
+                
+                ComponentArray newComponents;
+                std::vector<EntityID> newEntityIds;
+                std::vector<bool> newActiveFlags;
+                newComponents.reserve(components.size());
+                newEntityIds.reserve(components.size());
+                newActiveFlags.reserve(components.size());
+                
+                for (size_t src : permutation)
+                {
+                    indexMap[entityIds[src]] = newComponents.size();
+                    newComponents.push_back(std::move(components[src]));
+                    newEntityIds.push_back(entityIds[src]);
+                    newActiveFlags.push_back(activeFlags[src]);
+                }
+                
+                components = std::move(newComponents);
+                entityIds = std::move(newEntityIds);
+                activeFlags = std::move(newActiveFlags);
+            }
         };
         
     public:
@@ -303,6 +429,115 @@ namespace Nyon::ECS
             }
         }
         
+        /**
+         * @brief Split a component pool into contiguous chunks of its dense arrays.
+         * @tparam T Component type
+         * @param grain Elements per chunk (0 = ThreadPool default)
+         * @return Chunks covering the pool in dense order
+         */
+        template<typename T>
+        std::vector<ComponentChunk<T>> GetChunks(size_t grain = 0)
+        {
+            std::vector<ComponentChunk<T>> chunks;
+            auto* container = FindContainer<T>();
+            if (!container || container->components.empty())
+                return chunks;
+            
+            const size_t count = container->components.size();
+            grain = Utils::ThreadPool::Instance().ResolveGrain(count, grain);
+            for (size_t begin = 0; begin < count; begin += grain)
+            {
+                ComponentChunk<T> chunk;
+                chunk.entities = container->entityIds.data() + begin;
+                chunk.components = container->components.data() + begin;
+                chunk.offset = begin;
+                chunk.count = std::min(grain, count - begin);
+                chunks.push_back(chunk);
+            }
+            return chunks;
+        }
+        
+        /**
+         * @brief Run a function over contiguous chunks of a component pool on the ThreadPool.
+         * 
+         * Chunks are disjoint, so the function may freely write the chunk's components.
+         * Adding, removing or reordering components of T while this runs asserts in debug builds.
+         * @tparam T Component type
+         * @tparam Func Function type that takes (ComponentChunk<T>&)
+         * @param func Function to call for each chunk
+         * @param grain Elements per chunk (0 = ThreadPool default)
+         */
+        template<typename T, typename Func>
+        void ForEachChunk(Func&& func, size_t grain = 0)
+        {
+            auto* container = FindContainer<T>();
+            if (!container || container->components.empty())
+                return;
+            
+            IterationGuard<T> guard(*container);
+            Utils::ThreadPool::Instance().ParallelFor(container->components.size(), [&](size_t begin, size_t end) {
+                ComponentChunk<T> chunk;
+                chunk.entities = container->entityIds.data() + begin;
+                chunk.components = container->components.data() + begin;
+                chunk.offset = begin;
+                chunk.count = end - begin;
+                func(chunk);
+            }, grain);
+        }
+        
+        /**
+         * @brief Parallel version of ForEachComponent over entities that have all listed components.
+         * 
+         * Iterates the dense pool of the first type; entities missing any of the other
+         * types are skipped. Each entity is visited by exactly one worker, but the
+         * function must not touch other entities' components without its own
+         * synchronization. Structural changes to the iterated pools assert in debug builds.
+         * @tparam T Primary component type (drives iteration and load balancing)
+         * @tparam Others Additional required component types
+         * @tparam Func Function type that takes (EntityID, T&, Others&...)
+         * @param func Function to call for each matching entity
+         * @param grain Entities per task (0 = ThreadPool default)
+         */
+        template<typename T, typename... Others, typename Func>
+        void ParallelForEach(Func&& func, size_t grain = 0)
+        {
+            auto* container = FindContainer<T>();
+            if (!container || container->components.empty())
+                return;
+            
+            auto others = std::make_tuple(FindContainer<Others>()...);
+            bool allPresent = true;
+            std::apply([&](auto*... c) { ((allPresent = allPresent && c != nullptr), ...); }, others);
+            if (!allPresent)
+                return;
+            
+            IterationGuard<T, Others...> guard(*container, *std::get<ComponentContainer<Others>*>(others)...);
+            
+            Utils::ThreadPool::Instance().ParallelFor(container->components.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    if (!container->activeFlags[i])
+                        continue;
+                    
+                    EntityID entity = container->entityIds[i];
+                    if constexpr (sizeof...(Others) == 0)
+                    {
+                        func(entity, container->components[i]);
+                    }
+                    else
+                    {
+                        auto components = std::make_tuple(FindInContainer(std::get<ComponentContainer<Others>*>(others), entity)...);
+                        bool hasAll = true;
+                        std::apply([&](auto*... c) { ((hasAll = hasAll && c != nullptr), ...); }, components);
+                        if (hasAll)
+                        {
+                            func(entity, container->components[i], *std::get<Others*>(components)...);
+                        }
+                    }
+                }
+            }, grain);
+        }
+        
         /**
          * @brief Get component count for a specific type (fast O(1)).
          * @tparam T Component type
@@ -318,6 +553,49 @@ namespace Nyon::ECS
             return 0;
         }
         
+        /**
+         * @brief Make room for additional components of a type without reallocating.
+         * 
+         * Bulk spawns reserve once up front so the following AddComponent calls never
+         * grow the dense arrays or rehash the index map one at a time.
+         * @tparam T Component type
+         * @param additional Number of components about to be added
+         */
+        template<typename T>
+        void ReserveComponents(size_t additional)
+        {
+            auto& container = GetOrCreateContainer<T>();
+            container.Reserve(container.components.size() + additional);
+        }
+        
+        /**
+         * @brief Reorder the dense storage of a component type.
+         * 
+         * Entities listed in @p order are moved to the front of the dense arrays in that
+         * order; all other components follow in their previous relative order. Component
+         * references and ForEachComponent order change, entity IDs do not.
+         * @tparam T Component type
+         * @param order Entity IDs in the desired memory order
+         */
+        template<typename T>
+        void ReorderComponents(const std::vector<EntityID>& order)
+        {
+            auto containerIt = m_Containers.find(typeid(T));
+            if (containerIt != m_Containers.end()) {
+                static_cast<ComponentContainer<T>*>(containerIt->second.get())->Reorder(order);
+            }
+        }
+        
+        /**
+         * @brief Size and capacity of every component pool, largest reservation first.
+         */
+        std::vector<PoolMemoryStats> GetPoolMemoryStats() const;
+        
+        /**
+         * @brief Write GetPoolMemoryStats() as a table, flagging pools using under half their capacity.
+         */
+        void ReportPoolMemory(std::ostream& out) const;
+        
         /**
          * @brief Remove all components for a specific entity.
          * @param entity Entity to remove all components from
@@ -328,6 +606,46 @@ namespace Nyon::ECS
         EntityManager& m_EntityManager;
         std::unordered_map<std::type_index, std::unique_ptr<IComponentContainer>> m_Containers;
         
+        // Marks pools as being iterated in parallel for the debug structural-change check
+        template<typename... Ts>
+        struct IterationGuard
+        {
+            explicit IterationGuard(ComponentContainer<Ts>&... c) : containers(&c...)
+            {
+#ifndef NDEBUG
+                std::apply([](auto*... pool) { (pool->iterationDepth++, ...); }, containers);
+#endif
+            }
+            ~IterationGuard()
+            {
+#ifndef NDEBUG
+                std::apply([](auto*... pool) { (pool->iterationDepth--, ...); }, containers);
+#endif
+            }
+            IterationGuard(const IterationGuard&) = delete;
+            IterationGuard& operator=(const IterationGuard&) = delete;
+            
+            std::tuple<ComponentContainer<Ts>*...> containers;
+        };
+        
+        template<typename T>
+        ComponentContainer<T>* FindContainer()
+        {
+            auto it = m_Containers.find(typeid(T));
+            if (it == m_Containers.end())
+                return nullptr;
+            return static_cast<ComponentContainer<T>*>(it->second.get());
+        }
+        
+        template<typename T>
+        static T* FindInContainer(ComponentContainer<T>* container, EntityID entity)
+        {
+            auto it = container->indexMap.find(entity);
+            if (it == container->indexMap.end() || !container->activeFlags[it->second])
+                return nullptr;
+            return &container->components[it->second];
+        }
+        
         template<typename T>
         ComponentContainer<T>& GetOrCreateContainer()
         {
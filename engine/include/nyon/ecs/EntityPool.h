@@ -0,0 +1,94 @@
+#pragma once
+
+#include "nyon/ecs/EntityManager.h"
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace Nyon::ECS
+{
+    class ComponentStore;
+
+    /**
+     * @brief Recycles gameplay entities instead of destroying and recreating them.
+     *
+     * Release() disables an entity rather than destroying it: its physics body is
+     * marked disabled (the pipeline skips it and parks its broad-phase proxy outside
+     * the tree) and its render component is hidden. All components, including polygon
+     * vertex storage, stay allocated. Acquire() hands back a released entity when one
+     * is available (a hit) and only runs the factory for a new entity on a miss.
+     *
+     * Pools are per object kind: every entity in a pool should have been built by the
+     * same factory, so callers only need to reset per-spawn state (position, size,
+     * colour) after Acquire().
+     */
+    class EntityPool
+    {
+    public:
+        // Adds the components of a new pooled entity
+        using Factory = std::function<void(EntityID entity)>;
+
+        struct Stats
+        {
+            uint64_t hits = 0;        // Acquire() served from the pool
+            uint64_t misses = 0;      // Acquire() had to create an entity
+            uint64_t releases = 0;
+            size_t available = 0;     // Released entities waiting for reuse
+            size_t peakAvailable = 0;
+        };
+
+        EntityPool(EntityManager& entityManager, ComponentStore& componentStore, std::string name);
+        ~EntityPool() = default;
+
+        EntityPool(const EntityPool&) = delete;
+        EntityPool& operator=(const EntityPool&) = delete;
+
+        /**
+         * @brief Get an enabled entity, recycled when possible.
+         * @param factory Builds the components when a new entity is needed
+         * @return Entity with its body enabled and awake and its render component visible
+         */
+        EntityID Acquire(const Factory& factory);
+
+        /**
+         * @brief Disable an entity and keep it for reuse. Releasing twice is a no-op.
+         */
+        void Release(EntityID entity);
+
+        /**
+         * @brief Create entities up front so the first Acquire() calls are hits.
+         */
+        void Prewarm(size_t count, const Factory& factory);
+
+        /**
+         * @brief Destroy every released entity held by the pool.
+         */
+        void Clear();
+
+        bool IsPooled(EntityID entity) const { return m_Pooled.count(entity) != 0; }
+        const Stats& GetStats() const { return m_Stats; }
+        void ResetStats();
+
+        /**
+         * @brief Write hit/miss counts and hit rate on one line.
+         */
+        void Report(std::ostream& out) const;
+
+        /**
+         * @brief Enable or disable an entity's body and visibility without pooling it.
+         */
+        static void SetEntityEnabled(ComponentStore& componentStore, EntityID entity, bool enabled);
+
+    private:
+        EntityManager& m_EntityManager;
+        ComponentStore& m_ComponentStore;
+        std::string m_Name;
+
+        std::vector<EntityID> m_Available;
+        std::unordered_set<EntityID> m_Pooled;
+        Stats m_Stats;
+    };
+}
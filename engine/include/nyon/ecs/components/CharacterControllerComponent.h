@@ -0,0 +1,43 @@
+#pragma once
+
+#include "nyon/math/Vector2.h"
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/components/ColliderComponent.h"
+
+namespace Nyon::ECS
+{
+    /**
+     * @brief Kinematic character moved by CharacterControllerSystem with move-and-slide
+     *
+     * The character is a circle of the given radius at TransformComponent::position. It
+     * has no PhysicsBodyComponent: it never enters the contact solver or the island
+     * system, and it collides with the colliders in the physics broad phase through swept
+     * circle casts instead. Characters do not collide with each other.
+     *
+     * Game code writes the desired velocity each step (walk input, jumps); the system
+     * adds gravity while airborne, moves the character, and writes back the velocity
+     * left after sliding along whatever it hit together with the ground state.
+     */
+    struct CharacterControllerComponent
+    {
+        // === Shape and movement settings ===
+        float radius = 16.0f;
+        float skinWidth = 0.5f;            // Gap kept between the character and geometry
+        float stepHeight = 8.0f;           // Ledges up to this height are climbed while grounded
+        float maxSlopeAngle = 0.8727f;     // Steeper surfaces (radians, ~50 degrees) act as walls
+        float groundSnapDistance = 4.0f;   // Ground this far below is probed and snapped to
+        float gravityScale = 1.0f;         // Multiplier on PhysicsWorldComponent::gravity while airborne
+        int maxSlideIterations = 4;        // Cast-and-slide passes per step
+        ColliderComponent::Filter filter;  // Which colliders block the character
+
+        // === Input (set by game code) ===
+        Math::Vector2 velocity = {0.0f, 0.0f};  // Desired velocity in px/s; the achieved velocity is written back
+
+        // === State (written by CharacterControllerSystem) ===
+        bool isGrounded = false;
+        Math::Vector2 groundNormal = {0.0f, 1.0f};
+        EntityID groundEntity = INVALID_ENTITY;
+        bool hitWall = false;              // A surface too steep to walk on blocked the last move
+        bool hitCeiling = false;           // A surface facing down blocked the last move
+    };
+}
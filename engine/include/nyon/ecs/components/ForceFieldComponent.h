@@ -0,0 +1,68 @@
+#pragma once
+
+#include "nyon/math/Vector2.h"
+#include <cstdint>
+
+namespace Nyon::ECS
+{
+    /**
+     * @brief Region that pushes the bodies inside it, applied by PhysicsPipelineSystem
+     *
+     * The volume is a circle or an axis-aligned box centered at the entity's
+     * TransformComponent::position plus offset (or at offset without a transform). Each
+     * sub-step the pipeline gathers the bodies in the volume through the broad phase and
+     * adds the field's force before velocity integration, so fields act like gravity:
+     * - Radial: along the direction from the center to the body (negative strength attracts)
+     * - Directional: along direction, e.g. wind or a conveyor volume
+     * - Vortex: counter-clockwise around the center (negative strength turns clockwise)
+     *
+     * ParticlePipelineSystem pushes particles with the same fields once per step unless
+     * affectsParticles is cleared. For explosions, add a radial field with a short duration; it disables itself
+     * once the time is up.
+     */
+    struct ForceFieldComponent
+    {
+        enum class Type
+        {
+            Radial,
+            Directional,
+            Vortex
+        };
+
+        enum class Volume
+        {
+            Circle,
+            Box
+        };
+
+        enum class Falloff
+        {
+            None,       // Full strength across the volume
+            Linear,     // Full strength at the center, zero at the edge
+            Quadratic   // Square of Linear, for sharper blasts
+        };
+
+        // === Shape ===
+        Type type = Type::Radial;
+        Volume volume = Volume::Circle;
+        Falloff falloff = Falloff::Linear;
+        float radius = 100.0f;                          // Circle volume
+        Math::Vector2 halfExtents = {100.0f, 100.0f};   // Box volume
+        Math::Vector2 offset = {0.0f, 0.0f};            // Volume center relative to the transform
+
+        // === Strength ===
+        float strength = 1000.0f;
+        Math::Vector2 direction = {1.0f, 0.0f};  // Directional fields; normalized when gathered
+        bool massIndependent = true;             // strength is an acceleration in px/s^2; false makes it a force
+
+        // === Filtering ===
+        uint16_t maskBits = 0xFFFF;              // Collider categories the field pushes
+        bool affectsParticles = true;            // Also push entities with a ParticleComponent
+        bool wakeBodies = true;                  // Wake sleeping bodies in the volume
+
+        // === Lifetime ===
+        bool enabled = true;
+        float duration = -1.0f;                  // Seconds until the field disables itself; < 0 = never
+        float elapsed = 0.0f;                    // Seconds applied so far (written by the pipeline)
+    };
+}
@@ -81,6 +81,34 @@ namespace Nyon::ECS
         }
     };
 
+    /**
+     * @brief Parameters for position-based fluid emitters
+     * 
+     * Fluid particles share one rest spacing; density constraints are solved over
+     * neighbours within the smoothing radius (Macklin & Müller, "Position Based Fluids").
+     */
+    struct FluidParams
+    {
+        float particleSpacing = 8.0f;      // rest distance between particles (px); boundary radius is half
+        float smoothingRadius = 20.0f;     // kernel support h (px), typically 2-3x the spacing
+        int solverIterations = 3;          // density constraint iterations per step
+        float relaxation = 5.0f;           // constraint force mixing; higher = softer, more stable
+        float artificialPressure = 0.1f;   // tensile instability correction (reduces clumping)
+        float viscosity = 0.02f;           // XSPH viscosity blend towards neighbour velocities
+        uint32_t maxNeighbours = 64;       // neighbour slots per particle
+        
+        void Reset()
+        {
+            particleSpacing = 8.0f;
+            smoothingRadius = 20.0f;
+            solverIterations = 3;
+            relaxation = 5.0f;
+            artificialPressure = 0.1f;
+            viscosity = 0.02f;
+            maxNeighbours = 64;
+        }
+    };
+
     /**
      * @brief Particle emitter component - defines spawn behaviour
      * 
@@ -118,6 +146,15 @@ namespace Nyon::ECS
         // === Initial condition ranges ===
         ParticleSpawnParams spawnParams;
         
+        // === Simulation mode ===
+        enum class SimulationMode
+        {
+            Ballistic,  // independent particles with restitution collisions
+            Fluid       // position-based fluid: incompressible density constraints
+        } simulationMode = SimulationMode::Ballistic;
+        
+        FluidParams fluid;                   // used when simulationMode == Fluid
+        
         // === Physics settings ===
         bool affectedByPhysicsWorld = true;  // uses PhysicsWorldComponent.gravity
         float gravityScale = 1.0f;           // per-emitter gravity multiplier
@@ -164,6 +201,9 @@ namespace Nyon::ECS
             
             spawnParams.Reset();
             
+            simulationMode = SimulationMode::Ballistic;
+            fluid.Reset();
+            
             affectedByPhysicsWorld = true;
             gravityScale = 1.0f;
             collidesWithBodies = false;
@@ -46,6 +46,7 @@ namespace Nyon::ECS
         bool isStatic = false;                      // Immovable body (infinite mass)
         bool isKinematic = false;                   // Controlled by user, affects dynamic bodies
         bool isBullet = false;                      // Enable continuous collision detection
+        bool isEnabled = true;                      // Disabled bodies are skipped by the pipeline and keep a parked proxy
         
         // === SLEEP MECHANISM ===
         bool isAwake = true;                        // Active simulation state
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "nyon/ecs/System.h"
+#include "nyon/ecs/components/CharacterControllerComponent.h"
+#include "nyon/ecs/components/TransformComponent.h"
+#include "nyon/physics/DynamicTree.h"
+#include "nyon/physics/ShapeCast.h"
+#include <unordered_map>
+#include <vector>
+
+namespace Nyon::ECS
+{
+    class PhysicsPipelineSystem;
+
+    /**
+     * @brief Moves kinematic characters (CharacterControllerComponent) through the physics world
+     *
+     * Each step, per character:
+     * 1. Gravity is added while airborne; on walkable ground the move follows the slope.
+     * 2. Any overlap left by moving geometry is pushed out.
+     * 3. Move-and-slide: the circle is swept along the move with ShapeCast, stops a skin
+     *    width short of the first hit and slides along it. Blocked by a wall while
+     *    grounded, it first tries to step up onto a ledge no higher than stepHeight.
+     * 4. A short downward probe finds the ground and snaps onto it, so characters stay
+     *    glued to slopes and stairs instead of bouncing off them.
+     *
+     * Obstacles come from the PhysicsPipelineSystem broad phase. Each character caches the
+     * candidate colliders around it and re-queries the tree only when it leaves the cached
+     * region or a broad-phase proxy change (GetBroadPhaseChanges) overlaps it. Characters
+     * touch only their own components, so they are updated in parallel on the ThreadPool.
+     *
+     * Add the system after PhysicsPipelineSystem and hand it the pipeline with
+     * SetPhysicsSystem(); without one, characters are not moved.
+     */
+    class CharacterControllerSystem : public System
+    {
+    public:
+        struct Config
+        {
+            bool multiThreading = true;  // Update characters in parallel on the ThreadPool
+            float cacheMargin = 32.0f;   // Padding of the cached query region around each character's move
+        };
+
+        struct Statistics
+        {
+            size_t characters = 0;
+            size_t groundedCharacters = 0;
+            size_t cacheRefreshes = 0;   // Characters that re-queried the broad phase in the last update
+            size_t shapeCasts = 0;       // Circle casts against candidate colliders in the last update
+            float updateTime = 0.0f;     // Milliseconds
+        };
+
+        void Update(float deltaTime) override;
+
+        void SetPhysicsSystem(PhysicsPipelineSystem* physics) { m_Physics = physics; }
+
+        void SetConfig(const Config& config) { m_Config = config; }
+        const Config& GetConfig() const { return m_Config; }
+        const Statistics& GetStatistics() const { return m_Stats; }
+
+        /**
+         * @brief Drop every cached query region (e.g. after editing collider filters or sensor flags)
+         */
+        void InvalidateQueryCaches();
+
+    private:
+        struct QueryCache
+        {
+            Physics::AABB bounds;
+            std::vector<EntityID> candidates;  // Blocking colliders whose proxies overlap bounds
+            bool valid = false;
+        };
+
+        struct Character
+        {
+            EntityID entityId;
+            CharacterControllerComponent* controller;
+            TransformComponent* transform;
+            QueryCache* cache;
+            size_t shapeCasts;
+            bool refreshed;
+        };
+
+        struct CastResult
+        {
+            Physics::ShapeCast::Hit hit;
+            EntityID entityId = INVALID_ENTITY;
+        };
+
+        void MoveCharacter(Character& character, float dt);
+        void RefreshCache(Character& character, const Physics::AABB& region);
+        bool Cast(Character& character, const Math::Vector2& center, const Math::Vector2& translation,
+                  CastResult& result) const;
+        void Depenetrate(Character& character, Math::Vector2& position) const;
+        bool TryStepUp(Character& character, Math::Vector2& position, const Math::Vector2& move) const;
+        bool IsWalkable(const CharacterControllerComponent& controller, const Math::Vector2& normal) const;
+
+        PhysicsPipelineSystem* m_Physics = nullptr;
+        Config m_Config;
+        Statistics m_Stats;
+
+        std::vector<Character> m_Characters;
+        std::unordered_map<EntityID, QueryCache> m_Caches;
+        uint64_t m_LastBroadPhaseSerial = 0;
+
+        // Per-update constants shared by every character
+        Math::Vector2 m_Gravity = {0.0f, 0.0f};
+        Math::Vector2 m_Up = {0.0f, 1.0f};
+        bool m_InvalidateAll = false;    // More than one step ran since the last update
+    };
+}
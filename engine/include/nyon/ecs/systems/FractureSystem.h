@@ -0,0 +1,98 @@
+#pragma once
+
+#include "nyon/ecs/System.h"
+#include "nyon/ecs/EntityPool.h"
+#include "nyon/ecs/components/ColliderComponent.h"
+#include "nyon/physics/FracturePattern.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Nyon::ECS
+{
+    class PhysicsPipelineSystem;
+
+    /**
+     * @brief Breaks polygon bodies into precomputed Voronoi debris
+     *
+     * Patterns are generated with CreatePattern() at load time, one per breakable shape.
+     * Break() then replaces a body by the pieces of its pattern in one bulk operation:
+     * - debris entities come from an EntityPool, so expired pieces are reused together
+     *   with their polygon storage; Prewarm() creates them up front
+     * - the component pools are reserved once for the whole batch
+     * - every piece copies its cached polygon, mass and inertia (marked explicit, so the
+     *   pipeline never recomputes them) and the broken body's velocity at its centroid
+     * - the proxies go into the broad phase as one subtree (PhysicsPipelineSystem::InsertProxies)
+     *
+     * The broken entity is only disabled; the caller destroys it or releases it to its pool.
+     * Pieces return to the debris pool after Config::debrisLifetime.
+     */
+    class FractureSystem : public System
+    {
+    public:
+        using PatternID = uint32_t;
+        static constexpr PatternID INVALID_PATTERN = 0xFFFFFFFF;
+
+        struct Config
+        {
+            float debrisLifetime = 4.0f;   // Seconds before a piece returns to the pool (<= 0 keeps pieces)
+            float burstSpeed = 0.0f;       // Extra speed of each piece away from the broken body's center
+            float defaultDensity = 1.0f;   // For colliders without density (e.g. static bricks)
+        };
+
+        struct Statistics
+        {
+            size_t breaks = 0;             // Break() calls so far
+            size_t piecesSpawned = 0;      // Pieces spawned by the last Break()
+            size_t activeDebris = 0;
+            float lastBreakTime = 0.0f;    // Milliseconds spent in the last Break()
+        };
+
+        void Initialize(EntityManager& entityManager, ComponentStore& componentStore) override;
+        void Update(float deltaTime) override;
+
+        void SetPhysicsSystem(PhysicsPipelineSystem* physics) { m_Physics = physics; }
+
+        void SetConfig(const Config& config) { m_Config = config; }
+        const Config& GetConfig() const { return m_Config; }
+        const Statistics& GetStatistics() const { return m_Stats; }
+
+        /**
+         * @brief Precompute the fracture of a convex polygon
+         * @return Handle for Break(), INVALID_PATTERN if the shape yields no pieces
+         */
+        PatternID CreatePattern(const ColliderComponent::PolygonShape& shape, int pieceCount, uint32_t seed = 1);
+        const Physics::FracturePattern* GetPattern(PatternID pattern) const;
+
+        /**
+         * @brief Create debris entities ahead of the first breaks
+         */
+        void Prewarm(size_t count);
+
+        /**
+         * @brief Replace an entity by the pieces of a pattern
+         * @param entity Body whose collider has the shape the pattern was created from
+         * @param pieces Optional, receives the spawned debris entities
+         * @return Number of pieces spawned
+         */
+        size_t Break(EntityID entity, PatternID pattern, std::vector<EntityID>* pieces = nullptr);
+
+    private:
+        struct Debris
+        {
+            EntityID entity;
+            float age;
+        };
+
+        void BuildDebris(EntityID entity);
+
+        PhysicsPipelineSystem* m_Physics = nullptr;
+        Config m_Config;
+        Statistics m_Stats;
+
+        std::vector<Physics::FracturePattern> m_Patterns;
+        std::unique_ptr<EntityPool> m_Pool;
+        std::vector<Debris> m_Debris;
+        std::vector<EntityID> m_Spawned;
+    };
+}
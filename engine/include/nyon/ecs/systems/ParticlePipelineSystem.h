@@ -4,7 +4,11 @@
 #include "nyon/ecs/components/ParticleComponent.h"
 #include "nyon/ecs/components/ParticleEmitterComponent.h"
 #include "nyon/ecs/components/PhysicsWorldComponent.h"
+#include "nyon/ecs/components/PhysicsBodyComponent.h"
+#include "nyon/ecs/components/ColliderComponent.h"
+#include "nyon/physics/ForceField.h"
 #include "nyon/utils/ThreadPool.h"
+#include "nyon/utils/MemoryTracker.h"
 #include <vector>
 #include <future>
 #include <unordered_map>
@@ -21,13 +25,19 @@ namespace Nyon::ECS
      * - ColliderComponent for collision detection and filtering
      * - ParticleComponent for particle-specific properties (lifetime, color, callbacks)
      * 
+     * This system is the only one that moves particles: PhysicsPipelineSystem leaves
+     * entities with a ParticleComponent out of its bodies, broad phase and islands, so
+     * running both never integrates a particle twice. Force fields with affectsParticles
+     * are applied here instead.
+     * 
      * Implements the complete 6-phase architecture from Section 9.3:
      * Phase 1: Tick emitters (main thread, fast) - spawn new particles
-     * Phase 2: Parallel particle physics update (ThreadPool) - gravity, drag, integration
+     * Phase 2: Parallel particle physics update (ThreadPool) - force fields, gravity, drag, integration
+     *          Fluid emitters instead run a position-based fluid solve over a sorted grid
      * Phase 3: Parallel particle-particle broadphase (spatial hash) - collision detection
      * Phase 4: Particle-body broadphase (optional, future implementation)
      * Phase 5: Lifecycle management (main thread) - call death callbacks
-     * Phase 6: Post-update cleanup (main thread) - remove dead particles
+     * Phase 6: Post-update cleanup (main thread) - destroy dead particle entities
      */
     class ParticlePipelineSystem : public System
     {
@@ -58,6 +68,7 @@ namespace Nyon::ECS
         void ProcessEmitters(float deltaTime);
         
         // Phase 2: Parallel particle physics update
+        void ApplyForceFields(float dt);
         void UpdateParticlePhysicsParallel(size_t startIndex, size_t endIndex, float dt);
         
         // Phase 3: Parallel spatial hash construction and collision detection
@@ -65,7 +76,15 @@ namespace Nyon::ECS
         std::vector<std::pair<int, int>> ComputeCellIndices(size_t startIndex, size_t endIndex, float cellSize);
         void DetectParticleCollisionsParallel();
         void DetectCollisionsBruteForce();
-        void ProcessCollisionPair(size_t i, size_t j);
+        void ProcessCollisionPair(EntityID entityIdA, EntityID entityIdB);
+        
+        // Phase 2b: Position-based fluids (SimulationMode::Fluid emitters)
+        void ClassifyParticles();
+        void SimulateFluids(float dt);
+        void StepFluid(const ParticleEmitterComponent& emitter, const std::vector<EntityID>& particles, float dt);
+        void GatherFluidNeighbours(float smoothingRadius, uint32_t maxNeighbours);
+        void CollectFluidBoundaries(const ParticleEmitterComponent& emitter, float particleRadius);
+        void ResolveFluidBoundaries(Math::Vector2& position, const Math::Vector2& previousPosition, float particleRadius) const;
         
         // Phase 4: Particle-body collisions (TODO - future implementation)
         void DetectParticleBodyCollisions();
@@ -80,6 +99,7 @@ namespace Nyon::ECS
         Math::Vector2 SampleSpawnPosition(const ParticleEmitterComponent& emitter) const;
         
         // Component references
+        EntityManager* m_EntityManager = nullptr;
         ComponentStore* m_ComponentStore = nullptr;
         EntityID m_PhysicsWorldEntity = INVALID_ENTITY;
         Math::Vector2 m_Gravity = {0.0f, -980.0f};
@@ -95,18 +115,42 @@ namespace Nyon::ECS
         bool m_EnableCollisions = true;
         bool m_UseSpatialHash = true;
         
-        // Threading
-        size_t m_NumThreads = 1;
-        
         // Spatial hash data structures
         struct SpatialCell {
-            std::vector<EntityID> particleEntities;  // Store entity IDs, not indices
+            Utils::TrackedVector<EntityID, Utils::MemoryTag::Particles> particleEntities;  // Store entity IDs, not indices
         };
-        std::unordered_map<int, SpatialCell> m_SpatialHash;
+        Utils::TrackedUnorderedMap<int, SpatialCell, Utils::MemoryTag::Particles> m_SpatialHash;
         float m_CellSize = 50.0f;
         
         // Active particle entities (ECS-based)
         std::vector<EntityID> m_ActiveParticles;
+        std::vector<uint8_t> m_IsFluidParticle;  // parallel to m_ActiveParticles, rebuilt each step
+        
+        // Force fields gathered this step and the particles inside the current one
+        std::vector<Physics::ForceField> m_ForceFields;
+        std::vector<PhysicsBodyComponent*> m_ForceFieldBodies;
+        Physics::ForceField::Batch m_ForceFieldBatch;
+        
+        // Fluid solver scratch, structure-of-arrays in grid-cell order
+        struct FluidBoundary
+        {
+            const ColliderComponent* collider;
+            Math::Vector2 position;
+            float cosAngle;
+            float sinAngle;
+            Math::Vector2 aabbMin;
+            Math::Vector2 aabbMax;
+        };
+        std::vector<EntityID> m_FluidEntities;
+        std::vector<Math::Vector2> m_FluidPositions;   // start-of-step positions
+        std::vector<Math::Vector2> m_FluidPredicted;   // predicted positions being projected
+        std::vector<Math::Vector2> m_FluidVelocities;
+        std::vector<Math::Vector2> m_FluidDeltas;
+        std::vector<float> m_FluidLambdas;
+        std::vector<uint64_t> m_FluidCellKeys;         // sorted cell key per particle
+        std::vector<uint32_t> m_FluidNeighbours;       // maxNeighbours slots per particle
+        std::vector<uint32_t> m_FluidNeighbourCounts;
+        std::vector<FluidBoundary> m_FluidBoundaries;
         
         // RNG for sampling
         mutable std::mt19937 m_Rng{std::random_device{}()};
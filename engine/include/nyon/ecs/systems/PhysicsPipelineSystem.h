@@ -8,12 +8,16 @@
 #include "nyon/physics/Island.h"
 #include "nyon/physics/DynamicTree.h"
 #include "nyon/physics/ContactTypes.h"
+#include "nyon/physics/ForceField.h"
+#include "nyon/physics/ManifoldGenerator.h"
 #include "nyon/utils/ThreadPool.h"
+#include "nyon/utils/MemoryTracker.h"
 #include "nyon/EngineConstants.h"
 #include <vector>
 #include <unordered_map>
 #include <future>
 #include <atomic>
+#include <tuple>
 
 namespace Nyon::ECS
 {
@@ -46,11 +50,96 @@ namespace Nyon::ECS
             float maxLinearCorrection = 20.0f; // Maximum linear position correction (increased from 0.2 to handle pixel-scale penetrations up to ~20px per frame)
             bool warmStarting = true;        // Enable warm starting of constraints
             bool useIslandSleeping = true;   // Enable island-based sleeping optimization
+            bool spatialSorting = false;     // Periodically sort awake bodies into Morton (Z-order) memory order
+            int spatialSortInterval = 60;    // Steps between spatial sorts
+            bool simulationLOD = false;      // Step islands far from the LOD focus at reduced rates
+            float lodHalfRateDistance = 2000.0f;    // Islands beyond this distance step every 2nd tick
+            float lodQuarterRateDistance = 4000.0f; // Islands beyond this distance step every 4th tick
+            float lodEighthRateDistance = 8000.0f;  // Islands beyond this distance step every 8th tick
+            float lodHysteresis = 200.0f;    // Extra distance required before an island drops to a lower rate
+            bool deterministic = false;      // Canonical pair/island/proxy orders: identical results across runs and thread counts
+            bool stateHashing = false;       // Hash body state after every step into Statistics::stateHash
+            bool multiThreading = true;      // Run every pipeline phase's data-parallel passes on the ThreadPool
+            bool idleSkipping = false;       // Skip whole steps while every dynamic body sleeps (see RequestStep)
+            bool adaptiveIterations = false; // Iterate each island until its residual is below tolerance (replaces the fixed counts above)
+            int minVelocityIterations = 1;
+            int maxVelocityIterations = 16;
+            float velocityTolerance = 0.5f;  // Largest contact velocity change (px/s) in an iteration that counts as converged
+            int minPositionIterations = 1;
+            int maxPositionIterations = 6;
+            float positionTolerance = 0.25f; // Largest penetration beyond linearSlop (px) that counts as converged
+            bool bucketedNarrowPhase = true; // Group narrow-phase pairs by shape pairing and cull circle pairs in bulk
+            bool freezeSleepingProxies = true; // Sleeping bodies skip refit and queries; their contacts are kept until they wake
         };
         
         void SetConfig(const Config& config) { m_Config = config; }
         const Config& GetConfig() const { return m_Config; }
         
+        /**
+         * @brief Set the point simulation LOD measures island distances from (usually the camera)
+         *
+         * Until a focus is set every island steps at full rate.
+         */
+        void SetLODFocus(const Math::Vector2& focus) { m_LODFocus = focus; m_HasLODFocus = true; }
+        void ClearLODFocus() { m_HasLODFocus = false; }
+        
+        /**
+         * @brief Force the next Update() to run the full pipeline even if the world is idle
+         *
+         * With Config::idleSkipping a step is skipped when no enabled dynamic body is
+         * awake and the body/collider counts are unchanged. Forces and impulses wake
+         * bodies on their own; call this after editing sleeping bodies directly
+         * (teleports, velocity writes) or when input arrived that game logic reacts to.
+         * With Config::freezeSleepingProxies a sleeping body's proxy is not refit, so
+         * wake a body (PhysicsBodyComponent::SetAwake) when teleporting it.
+         */
+        void RequestStep() { m_StepRequested = true; }
+        bool IsIdle() const { return m_Idle; }
+        
+        /**
+         * @brief 64-bit FNV-1a hash of every dynamic body's position, rotation and velocities
+         *
+         * Bodies are hashed in entity ID order from their exact bit patterns, so two peers
+         * stepping the same inputs in deterministic mode produce the same value.
+         */
+        uint64_t ComputeStateHash() const;
+        
+        /**
+         * @brief Append the entities whose broad-phase proxy (fat AABB) overlaps aabb
+         *
+         * Proxies are refit at the start of each step; call SyncBroadPhase() first to
+         * query against the transforms as they are now. Safe to call from several threads
+         * while nothing edits the tree.
+         */
+        void QueryBroadPhase(const Physics::AABB& aabb, std::vector<EntityID>& out) const;
+        
+        /**
+         * @brief Refit broad-phase proxies to the current collider transforms between steps
+         */
+        void SyncBroadPhase();
+        
+        /**
+         * @brief Give freshly spawned or re-enabled colliders their broad-phase proxies in one batch
+         *
+         * Entities without a proxy get new ones and entities with a parked proxy (disabled,
+         * e.g. pooled) are re-linked, each group as a single balanced subtree instead of one
+         * tree insertion per proxy. Entities that already have a live proxy are left to the
+         * next refit. Call after the transforms and colliders are in place.
+         */
+        void InsertProxies(const std::vector<EntityID>& entities);
+        
+        /**
+         * @brief Fat AABBs of proxies created, moved or removed since the last step began
+         *
+         * Covers the tree edits of the last Update() and of SyncBroadPhase() calls since;
+         * proxies inserted by InsertProxies() between steps are also reported by the next step.
+         * The serial goes up by one at the start of every step that runs; idle-skipped
+         * steps leave both unchanged. A cached QueryBroadPhase() result for a region stays
+         * complete while no change overlaps that region.
+         */
+        const std::vector<Physics::AABB>& GetBroadPhaseChanges() const { return m_BroadPhaseChanges; }
+        uint64_t GetBroadPhaseSerial() const { return m_BroadPhaseSerial; }
+        
         // Pipeline statistics
         struct Statistics
         {
@@ -60,6 +149,47 @@ namespace Nyon::ECS
             size_t awakeBodies = 0;
             size_t sleepingBodies = 0;
             float updateTime = 0.0f; // Time spent in last update (milliseconds)
+            size_t spatialSorts = 0;       // Number of spatial sort passes performed
+            float spatialSortTime = 0.0f;  // Time spent in the last spatial sort (milliseconds)
+            size_t lodReducedRateBodies = 0; // Awake bodies assigned a reduced simulation rate
+            size_t lodDeferredBodies = 0;    // Bodies whose integration was skipped this step
+            uint64_t stateHash = 0;          // Body state hash after the last step (Config::stateHashing)
+            uint64_t idleSkippedSteps = 0;   // Steps skipped by Config::idleSkipping since start
+            // Config::adaptiveIterations: islands solved and iterations actually run in the last
+            // update, summed over islands and sub-steps; the max is the busiest single island
+            size_t solverIslands = 0;
+            size_t velocityIterationsTotal = 0;
+            size_t velocityIterationsMax = 0;
+            size_t positionIterationsTotal = 0;
+            size_t positionIterationsMax = 0;
+            // Time per pipeline phase in the last update (milliseconds), summed over sub-steps
+            struct PhaseTimes
+            {
+                float broadPhase = 0.0f;
+                float narrowPhase = 0.0f;
+                float islands = 0.0f;
+                float constraints = 0.0f;   // Constraint initialization
+                float velocitySolve = 0.0f;
+                float positionSolve = 0.0f;
+                float finalize = 0.0f;      // Integration, impulse storage, sleeping, transform write-back
+            } phaseTimes;
+            int subSteps = 0;
+            // Config::bucketedNarrowPhase: pairs per shape pairing in the last narrow phase,
+            // and circle pairs rejected by the bulk overlap test before manifold generation
+            size_t circleCirclePairs = 0;
+            size_t circlePolygonPairs = 0;
+            size_t polygonPolygonPairs = 0;
+            size_t otherShapePairs = 0;
+            size_t circlePairsCulled = 0;
+            // ForceFieldComponents applied in the last update, body pushes summed over
+            // fields and sub-steps, and the time spent (milliseconds, part of velocitySolve)
+            size_t forceFields = 0;
+            size_t forceFieldBodies = 0;
+            float forceFieldTime = 0.0f;
+            // Config::freezeSleepingProxies: proxies of sleeping bodies skipped by refit and
+            // queries, and contacts among them carried over instead of regenerated (last sub-step)
+            size_t frozenProxies = 0;
+            size_t retainedContacts = 0;
             Physics::IslandManager::Statistics islandStats;
         };
         
@@ -112,6 +242,7 @@ namespace Nyon::ECS
             ECS::EntityID entityId;                         // Associated entity ID
             float linearDamping;                            // Linear damping coefficient (from drag)
             float angularDamping;                           // Angular damping coefficient
+            float dtScale;                                  // Ticks of dt to integrate (0 = deferred by simulation LOD)
         };
         
         // Pipeline phases
@@ -128,19 +259,31 @@ namespace Nyon::ECS
         // Multi-threaded helpers
         void ParallelBroadPhase();
         void ParallelNarrowPhase();
+        void BucketedNarrowPhase(bool parallel);
         void ParallelVelocitySolving(float subStepDt);
         void ParallelPositionSolving(float subStepDt);
         
         // Broad phase helpers
-        struct BroadPhaseCallback : public Physics::ITreeQueryCallback
+        // Collects (query index, other entity) hits of a DynamicTree::QueryBatch packet
+        struct BroadPhasePacketCallback
         {
-            PhysicsPipelineSystem* system;
-            uint32_t entityId;
-            std::vector<std::pair<uint32_t, uint32_t>>* localPairs = nullptr;
+            std::vector<std::pair<uint32_t, uint32_t>>* hits;
             
-            bool QueryCallback(uint32_t nodeId, uint32_t userData) override;
+            bool QueryCallback(size_t queryIndex, uint32_t, uint32_t userData)
+            {
+                hits->emplace_back(static_cast<uint32_t>(queryIndex), userData);
+                return true;
+            }
         };
         
+        void GatherBroadPhaseQueries();
+        template<typename PairVector>
+        void QueryBroadPhasePacket(size_t packet, std::vector<std::pair<uint32_t, uint32_t>>& hits,
+                                   std::vector<std::pair<uint32_t, uint32_t>>& sortedHits, PairVector& pairs) const;
+        bool AcceptBroadPhasePair(uint32_t entityId, uint32_t otherEntityId) const;
+        
+        void RemoveStaleProxies();
+        void RefitBroadPhaseProxies();
         void UpdateShapeAABB(uint32_t entityId, ColliderComponent* collider, 
                            const Math::Vector2& position, float angle);
         
@@ -155,14 +298,65 @@ namespace Nyon::ECS
         
         // Constraint solving helpers
         void InitializeVelocityConstraints();
-        void SolveVelocityConstraints();
-        void SolvePositionConstraints();
+        void PrepareSolverBody(EntityID entityId, PhysicsBodyComponent& body, const TransformComponent* transform,
+                               SolverBody& solverBody);
+        void InitializeVelocityConstraint(const ECS::ContactManifold& manifold, size_t indexA, size_t indexB,
+                                          float restitutionThreshold, VelocityConstraint& vc);
+        void GroupConstraintsByIsland();
         void WarmStartConstraints();
-        void IntegrateVelocities(float dt);
-        void IntegrateVelocities(float dt, size_t start, size_t end);  // Parallel version
+        void WarmStartConstraints(size_t begin, size_t end);
+        
+        // Compile-time feature set of the solver and integration loops. WithPolicy() picks
+        // one of the eight instantiations per phase from the world contents and Config, so
+        // a step without motion locks, simulation LOD or adaptive iterations carries no
+        // per-body or per-contact branch (or residual tracking) for them.
+        template<bool MotionLocks, bool SimulationLOD, bool AdaptiveIterations>
+        struct PipelinePolicy
+        {
+            static constexpr bool motionLocks = MotionLocks;              // Some prepared body locks an axis
+            static constexpr bool simulationLOD = SimulationLOD;          // Bodies may integrate a scaled or deferred dt
+            static constexpr bool adaptiveIterations = AdaptiveIterations; // Track residuals and live position separations
+        };
+        
+        // Call func(PipelinePolicy<...>{}) with the policy matching the current step
+        template<typename Func>
+        void WithPolicy(Func&& func);
+        
+        template<typename Policy>
+        float SolveVelocityConstraints(size_t begin, size_t end);  // Returns the largest velocity change (adaptive only)
+        template<typename Policy>
+        float SolvePositionConstraints(size_t begin, size_t end);  // Returns the largest penetration beyond slop
+        template<typename Policy>
+        void SolveVelocityIterations();
+        template<typename Policy>
+        void SolvePositionIterations();
+        template<typename Policy>
+        void IntegrateVelocities(float dt, size_t start, size_t end);
+        template<typename Policy>
         void IntegratePositions(float dt);
+        template<typename Policy>
+        void Integration();
+        template<typename Policy>
+        void UpdateTransformsFromSolver();
+        
+        // Run work(start, end) over [0, count) on the ThreadPool when Config::multiThreading
+        // is set, inline otherwise
+        template<typename Func>
+        void RunParallel(size_t count, Func&& work, size_t grain = 0);
+        size_t IslandGrain() const;
         
         // Utility methods
+        void SpatialSort();
+        void UpdateSimulationLOD();
+        bool CanSkipIdleStep();
+        void PromoteDeferredContacts();
+        void CollectFrozenContacts();
+        void RetainFrozenContacts();
+        bool IsFrozen(uint32_t entityId) const;
+        void GatherForceFields(float deltaTime);
+        void ApplyForceFields();
+        bool IsLODDeferred(uint32_t entityId) const;
+        bool IsParticle(uint32_t entityId) const;
         void PrepareBodiesForUpdate();
         void UpdateTransformsFromSolver();
         
@@ -177,11 +371,41 @@ namespace Nyon::ECS
         // Broad phase
         Physics::DynamicTree m_BroadPhaseTree;
         std::unordered_map<uint32_t, uint32_t> m_ShapeProxyMap;
-        std::vector<std::pair<uint32_t, uint32_t>> m_BroadPhasePairs;
+        std::vector<Physics::AABB> m_BroadPhaseChanges;  // Fat AABBs before and after each tree edit this step
+        std::vector<Physics::AABB> m_InsertedProxyChanges;  // InsertProxies() edits carried into the next step
+        uint64_t m_BroadPhaseSerial = 0;
+        Utils::TrackedVector<std::pair<uint32_t, uint32_t>, Utils::MemoryTag::Physics> m_BroadPhasePairs;
+        // Querying entities with their fat AABBs, queried in DynamicTree::QueryBatch packets;
+        // the pairs of each packet (parallel broad phase) and scratch hits (serial)
+        std::vector<uint32_t> m_BroadPhaseQueryEntities;
+        std::vector<Physics::AABB> m_BroadPhaseQueryBoxes;
+        std::vector<std::vector<std::pair<uint32_t, uint32_t>>> m_BroadPhasePacketPairs;
+        std::vector<std::pair<uint32_t, uint32_t>> m_BroadPhaseHits;
+        std::vector<std::pair<uint32_t, uint32_t>> m_BroadPhaseSortedHits;
         
         // Contact management
-        std::vector<ECS::ContactManifold> m_ContactManifolds;
-        std::unordered_map<uint64_t, size_t> m_ContactMap; // entityId pair -> manifold index
+        Utils::TrackedVector<ECS::ContactManifold, Utils::MemoryTag::Physics> m_ContactManifolds;
+        Utils::TrackedUnorderedMap<uint64_t, size_t, Utils::MemoryTag::Physics> m_ContactMap; // entityId pair -> manifold index
+        // Manifolds of the last step between frozen (and static) bodies, which no query
+        // finds again; appended unchanged after the narrow phase
+        Utils::TrackedVector<ECS::ContactManifold, Utils::MemoryTag::Physics> m_FrozenManifolds;
+        
+        // Bucketed narrow phase: components and pairing per broad-phase pair, pair indices
+        // grouped by pairing, and one reusable manifold slot per pair
+        struct NarrowPhasePair
+        {
+            const ColliderComponent* colliderA = nullptr;  // Null when a component is missing
+            const ColliderComponent* colliderB = nullptr;
+            const TransformComponent* transformA = nullptr;
+            const TransformComponent* transformB = nullptr;
+            Physics::ManifoldGenerator::PairKind kind = Physics::ManifoldGenerator::PairKind::Other;
+        };
+        static constexpr size_t PAIR_KIND_COUNT = static_cast<size_t>(Physics::ManifoldGenerator::PairKind::Count);
+        Utils::TrackedVector<NarrowPhasePair, Utils::MemoryTag::Physics> m_NarrowPhasePairs;
+        std::vector<uint32_t> m_PairBuckets[PAIR_KIND_COUNT];
+        Physics::ManifoldGenerator::CirclePairBatch m_CirclePairBatch;
+        std::vector<uint8_t> m_CircleOverlaps;
+        Utils::TrackedVector<ECS::ContactManifold, Utils::MemoryTag::Physics> m_NarrowPhaseSlots;
         
         // Impulse cache for warm starting (keyed by entity pair + feature ID)
         struct ImpulseData
@@ -189,22 +413,105 @@ namespace Nyon::ECS
             float normalImpulse = 0.0f;
             float tangentImpulse = 0.0f;
         };
-        std::unordered_map<uint64_t, ImpulseData> m_ImpulseCache;
+        using ImpulseCache = Utils::TrackedUnorderedMap<uint64_t, ImpulseData, Utils::MemoryTag::Physics>;
+        ImpulseCache m_ImpulseCache;
         
         // Island management
         std::unique_ptr<Physics::IslandManager> m_IslandManager;
         std::vector<uint32_t> m_ActiveEntities;
         
         // Solver data
-        std::vector<SolverBody> m_SolverBodies;
-        std::unordered_map<uint32_t, size_t> m_EntityToSolverIndex;
-        std::vector<VelocityConstraint> m_VelocityConstraints;
+        Utils::TrackedVector<SolverBody, Utils::MemoryTag::Physics> m_SolverBodies;
+        Utils::TrackedUnorderedMap<uint32_t, size_t, Utils::MemoryTag::Physics> m_EntityToSolverIndex;
+        Utils::TrackedVector<VelocityConstraint, Utils::MemoryTag::Physics> m_VelocityConstraints;
+        
+        // Enabled bodies in solver order with their components, gathered once per sub-step
+        // so later phases can walk them in parallel without component lookups
+        struct PreparedBody
+        {
+            EntityID entityId;
+            PhysicsBodyComponent* body;
+            TransformComponent* transform;  // Null when the body has no transform
+        };
+        std::vector<PreparedBody> m_PreparedBodies;
+        bool m_HasMotionLocks = false;  // Some prepared body locks translation or rotation
+        
+        // Constraint initialization: manifold index and solver indices of each constraint
+        struct ConstraintSource
+        {
+            size_t manifold;
+            size_t indexA;
+            size_t indexB;
+        };
+        std::vector<ConstraintSource> m_ConstraintSources;
+        
+        // Broad phase refit: each collider and whether its proxy escaped its fat AABB
+        struct RefitShape
+        {
+            EntityID entityId;
+            ColliderComponent* collider;
+            const TransformComponent* transform;
+            bool needsUpdate;
+        };
+        std::vector<RefitShape> m_RefitShapes;
+        
+        // Impulse cache entries of the last step in constraint order, written in parallel
+        std::vector<std::pair<uint64_t, ImpulseData>> m_ImpulseEntries;
+        std::vector<size_t> m_ImpulseOffsets;
+        
+        // Constraint islands: [begin, end) ranges of m_VelocityConstraints whose dynamic
+        // bodies form one connected group. Groups share no body the solver writes, so
+        // they are warm started and solved independently (and in parallel).
+        // m_PositionSolveStart holds body poses before IntegratePositions so adaptive
+        // position iterations see live separations.
+        std::vector<std::pair<size_t, size_t>> m_ConstraintIslandRanges;
+        std::vector<std::pair<Math::Vector2, float>> m_PositionSolveStart;
+        std::vector<uint32_t> m_IslandParents;       // Union-find over solver bodies
+        std::vector<uint32_t> m_IslandOfRoot;        // Island number of each union-find root
+        std::vector<uint32_t> m_ConstraintIsland;    // Island number of each constraint
+        std::vector<size_t> m_IslandOffsets;
+        std::vector<int> m_IslandIterations;         // Iterations each island ran (adaptive statistics)
+        Utils::TrackedVector<VelocityConstraint, Utils::MemoryTag::Physics> m_GroupedConstraints;
+        
+        // Force fields gathered once per update; bodies in the current field's volume
+        // (solver indices) with their positions and masses for ForceField::Accumulate
+        std::vector<Physics::ForceField> m_ForceFields;
+        std::vector<EntityID> m_ForceFieldCandidates;
+        std::vector<uint32_t> m_ForceFieldBodies;
+        Physics::ForceField::Batch m_ForceFieldBatch;
+        
+        // Transforms before the sub-steps, restored as previousPosition/previousRotation
+        std::vector<std::tuple<EntityID, Math::Vector2, float>> m_PreSubstepTransforms;
+        
+        // Spatial sorting
+        uint32_t m_StepsSinceSpatialSort = 0;
+        
+        // Particle bodies belong to ParticlePipelineSystem; set per update so IsParticle() is free without them
+        bool m_HasParticles = false;
+        
+        // Idle skipping: body/collider counts of the last full step
+        bool m_Idle = false;
+        bool m_StepRequested = false;
+        size_t m_LastBodyCount = 0;
+        size_t m_LastColliderCount = 0;
+        
+        // Simulation LOD: per-body rate level and ticks accumulated since the body last stepped
+        struct LODState
+        {
+            uint32_t level = 0;        // Rate divisor is 1 << level
+            uint32_t pendingTicks = 0; // Ticks of dt to integrate when the body next steps
+            bool due = true;           // Whether the body steps this tick
+            size_t island = 0;         // Island the rate was chosen for
+        };
+        std::unordered_map<uint32_t, LODState> m_LODStates;
+        Math::Vector2 m_LODFocus{0.0f, 0.0f};
+        bool m_HasLODFocus = false;
+        uint64_t m_LODTick = 0;
         
         // Note: Fixed timestep accumulation is managed by Application::Run()
         // Physics updates run at FIXED_TIMESTEP (60 FPS) with sub-stepping for high speeds
         
-        // Multi-threading
-        bool m_UseMultiThreading = true;
+        // Multi-threading (enabled through Config::multiThreading)
         size_t m_NumThreads = 0;
     };
 }
\ No newline at end of file
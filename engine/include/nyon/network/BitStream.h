@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace Nyon::Network
+{
+    /**
+     * @brief Map a signed value to unsigned so small magnitudes of either sign stay small
+     */
+    inline uint32_t ZigZagEncode(int32_t value)
+    {
+        return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    }
+
+    inline int32_t ZigZagDecode(uint32_t value)
+    {
+        return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+    }
+
+    /**
+     * @brief Appends values of arbitrary bit width to a byte buffer, LSB first
+     *
+     * Bits accumulate in a 64-bit scratch word and are flushed a byte at a time.
+     * Truncate() rolls the stream back to an earlier bit count, which lets callers
+     * try writing a record and drop it if it does not fit a packet budget.
+     */
+    class BitWriter
+    {
+    public:
+        void WriteBits(uint32_t value, uint32_t bitCount)
+        {
+            if (bitCount == 0)
+                return;
+            if (bitCount < 32)
+                value &= (1u << bitCount) - 1u;
+
+            m_Scratch |= static_cast<uint64_t>(value) << m_ScratchBits;
+            m_ScratchBits += bitCount;
+            m_BitCount += bitCount;
+            while (m_ScratchBits >= 8)
+            {
+                m_Buffer.push_back(static_cast<uint8_t>(m_Scratch));
+                m_Scratch >>= 8;
+                m_ScratchBits -= 8;
+            }
+        }
+
+        void WriteBool(bool value) { WriteBits(value ? 1u : 0u, 1); }
+
+        /**
+         * @brief Write a value as a 5-bit length prefix followed by its significant bits
+         *
+         * Zero costs 6 bits; a value below 2^n costs 5 + n bits.
+         */
+        void WriteVarBits(uint32_t value)
+        {
+            uint32_t length = 1;
+            while (length < 32 && (value >> length) != 0)
+                length++;
+            WriteBits(length - 1, 5);
+            WriteBits(value, length);
+        }
+
+        void WriteSigned(int32_t value) { WriteVarBits(ZigZagEncode(value)); }
+
+        /**
+         * @brief Drop everything written after the first bitCount bits
+         */
+        void Truncate(size_t bitCount)
+        {
+            if (bitCount >= m_BitCount)
+                return;
+
+            size_t wholeBytes = bitCount / 8;
+            uint32_t partialBits = static_cast<uint32_t>(bitCount % 8);
+            uint64_t partial = 0;
+            if (partialBits > 0)
+            {
+                uint8_t byte = wholeBytes < m_Buffer.size() ? m_Buffer[wholeBytes] : static_cast<uint8_t>(m_Scratch);
+                partial = byte & ((1u << partialBits) - 1u);
+            }
+
+            m_Buffer.resize(wholeBytes);
+            m_Scratch = partial;
+            m_ScratchBits = partialBits;
+            m_BitCount = bitCount;
+        }
+
+        void Clear()
+        {
+            m_Buffer.clear();
+            m_Scratch = 0;
+            m_ScratchBits = 0;
+            m_BitCount = 0;
+        }
+
+        size_t GetBitCount() const { return m_BitCount; }
+        size_t GetByteCount() const { return (m_BitCount + 7) / 8; }
+
+        /**
+         * @brief Flush the partial byte and return the packed bytes
+         */
+        const std::vector<uint8_t>& Finish()
+        {
+            if (m_ScratchBits > 0)
+            {
+                m_Buffer.push_back(static_cast<uint8_t>(m_Scratch));
+                m_Scratch = 0;
+                m_ScratchBits = 0;
+            }
+            return m_Buffer;
+        }
+
+    private:
+        std::vector<uint8_t> m_Buffer;
+        uint64_t m_Scratch = 0;
+        uint32_t m_ScratchBits = 0;
+        size_t m_BitCount = 0;
+    };
+
+    /**
+     * @brief Reads values written by BitWriter
+     *
+     * Reading past the end returns zeros and sets the overflow flag, so decoders
+     * can read a whole record and check IsOverflowed() once.
+     */
+    class BitReader
+    {
+    public:
+        BitReader(const uint8_t* data, size_t size)
+            : m_Data(data), m_Size(size)
+        {
+        }
+
+        uint32_t ReadBits(uint32_t bitCount)
+        {
+            if (bitCount == 0)
+                return 0;
+
+            while (m_ScratchBits < bitCount)
+            {
+                uint64_t byte = 0;
+                if (m_Position < m_Size)
+                    byte = m_Data[m_Position];
+                else
+                    m_Overflow = true;
+                m_Position++;
+                m_Scratch |= byte << m_ScratchBits;
+                m_ScratchBits += 8;
+            }
+
+            uint32_t value = static_cast<uint32_t>(m_Scratch & ((bitCount < 32) ? ((1ull << bitCount) - 1ull) : 0xFFFFFFFFull));
+            m_Scratch >>= bitCount;
+            m_ScratchBits -= bitCount;
+            return value;
+        }
+
+        bool ReadBool() { return ReadBits(1) != 0; }
+
+        uint32_t ReadVarBits()
+        {
+            uint32_t length = ReadBits(5) + 1;
+            return ReadBits(length);
+        }
+
+        int32_t ReadSigned() { return ZigZagDecode(ReadVarBits()); }
+
+        bool IsOverflowed() const { return m_Overflow; }
+
+    private:
+        const uint8_t* m_Data;
+        size_t m_Size;
+        size_t m_Position = 0;
+        uint64_t m_Scratch = 0;
+        uint32_t m_ScratchBits = 0;
+        bool m_Overflow = false;
+    };
+}
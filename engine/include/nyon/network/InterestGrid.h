@@ -0,0 +1,149 @@
+#pragma once
+
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/components/TransformComponent.h"
+#include "nyon/math/Vector2.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Nyon::Network
+{
+    struct InterestConfig
+    {
+        float cellSize = 256.0f;       // px; about the typical query radius works well
+        float looseness = 0.25f;       // Fraction of a cell an entity may stray past its cell before it is re-binned
+        bool multiThreading = true;    // Run UpdateConsumers() on the ThreadPool
+    };
+
+    /**
+     * @brief Interest-management index: which entities are near each agent or client
+     *
+     * A loose uniform grid over the positions of every entity with a TransformComponent.
+     * Update() syncs it with the transform pool each tick; an entity only changes cells
+     * once it is more than looseness * cellSize outside its cell, so entities jittering
+     * on a border do not churn the grid. Queries visit the cells their region overlaps
+     * (grown by that margin) and test the stored positions exactly.
+     *
+     * Consumers (AI agents, network clients) each own a circle or box region. One call to
+     * UpdateConsumers() re-queries all of them, in parallel, and reports per consumer the
+     * entities now inside (sorted by ID), those that entered and those that left since the
+     * previous call. Destroyed entities leave on the next Update()/UpdateConsumers().
+     */
+    class InterestGrid
+    {
+    public:
+        explicit InterestGrid(ECS::ComponentStore& componentStore, const InterestConfig& config = {});
+
+        /**
+         * @brief Add new transforms, drop removed ones and move entities that left their cell
+         */
+        void Update();
+
+        /**
+         * @brief Append the entities within radius of center (inclusive), in grid order
+         */
+        void QueryRadius(const Math::Vector2& center, float radius, std::vector<ECS::EntityID>& out) const;
+
+        /**
+         * @brief Append the entities inside [min, max] (inclusive), in grid order
+         */
+        void QueryBox(const Math::Vector2& min, const Math::Vector2& max, std::vector<ECS::EntityID>& out) const;
+
+        uint32_t AddConsumer();
+        void RemoveConsumer(uint32_t consumerId);
+        void SetConsumerRadius(uint32_t consumerId, const Math::Vector2& center, float radius);
+        void SetConsumerBox(uint32_t consumerId, const Math::Vector2& min, const Math::Vector2& max);
+
+        /**
+         * @brief Re-query every consumer's region and compute its enter and leave sets
+         *
+         * Call after Update(). Each consumer writes only its own sets, so they are
+         * computed in parallel; the results are the same for any thread count.
+         */
+        void UpdateConsumers();
+
+        // Results of the last UpdateConsumers(), sorted by entity ID
+        const std::vector<ECS::EntityID>& GetMembers(uint32_t consumerId) const { return m_Consumers[consumerId].members; }
+        const std::vector<ECS::EntityID>& GetEntered(uint32_t consumerId) const { return m_Consumers[consumerId].entered; }
+        const std::vector<ECS::EntityID>& GetLeft(uint32_t consumerId) const { return m_Consumers[consumerId].left; }
+
+        struct Statistics
+        {
+            size_t entities = 0;          // Entities in the grid
+            size_t occupiedCells = 0;
+            size_t rebinnedEntities = 0;  // Entities that changed cells (or were added) in the last Update()
+            size_t consumers = 0;
+            size_t members = 0;           // Summed over consumers, last UpdateConsumers()
+            size_t entered = 0;
+            size_t left = 0;
+            float updateTime = 0.0f;      // Last Update() (milliseconds)
+            float consumerTime = 0.0f;    // Last UpdateConsumers() (milliseconds)
+        };
+
+        const Statistics& GetStatistics() const { return m_Stats; }
+        const InterestConfig& GetConfig() const { return m_Config; }
+
+    private:
+        static constexpr uint32_t NO_CELL = 0xFFFFFFFF;
+
+        // Positions and IDs of one cell's entities, scanned by queries
+        struct Cell
+        {
+            int32_t x = 0;
+            int32_t y = 0;
+            std::vector<float> positionX;
+            std::vector<float> positionY;
+            std::vector<ECS::EntityID> entityIds;
+        };
+
+        struct EntityRecord
+        {
+            uint32_t cell = NO_CELL;
+            uint32_t slot = 0;
+            uint32_t stamp = 0;           // Update() that last saw the entity's transform
+        };
+
+        struct Consumer
+        {
+            bool active = false;
+            bool box = false;
+            Math::Vector2 center{0.0f, 0.0f};
+            float radius = 0.0f;
+            Math::Vector2 min{0.0f, 0.0f};
+            Math::Vector2 max{0.0f, 0.0f};
+            std::vector<ECS::EntityID> members;
+            std::vector<ECS::EntityID> entered;
+            std::vector<ECS::EntityID> left;
+            std::vector<ECS::EntityID> scratch;
+        };
+
+        static uint64_t CellKey(int32_t x, int32_t y)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+        }
+
+        int32_t CellCoordinate(float value) const;
+        bool InsideLooseCell(const Cell& cell, const Math::Vector2& position) const;
+        uint32_t FindOrCreateCell(int32_t x, int32_t y);
+        void Insert(ECS::EntityID entityId, const Math::Vector2& position);
+        void Remove(ECS::EntityID entityId);
+
+        // Call visit(cell) for each existing cell whose loose bounds overlap [min, max]
+        template<typename Visit>
+        void ForEachCell(const Math::Vector2& min, const Math::Vector2& max, Visit&& visit) const;
+
+        ECS::ComponentStore& m_ComponentStore;
+        InterestConfig m_Config;
+        float m_InverseCellSize = 0.0f;
+        Statistics m_Stats;
+
+        std::vector<Cell> m_Cells;
+        std::unordered_map<uint64_t, uint32_t> m_CellIndex;  // CellKey -> index into m_Cells
+        std::vector<EntityRecord> m_Entities;                 // Indexed by entity ID
+        size_t m_EntityCount = 0;
+        uint32_t m_Stamp = 0;
+
+        std::vector<Consumer> m_Consumers;
+    };
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/components/TransformComponent.h"
+#include "nyon/ecs/components/PhysicsBodyComponent.h"
+#include "nyon/network/BitStream.h"
+#include "nyon/math/Vector2.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Nyon::Network
+{
+    /**
+     * @brief Entity state as sent over the wire, in fixed-point units
+     *
+     * Positions and velocities are integers in units of the configured resolution,
+     * rotation is a 16-bit fraction of a full turn. Deltas between two states are
+     * exact, so the client reconstructs bit-identical values.
+     */
+    struct QuantizedState
+    {
+        enum Field : uint32_t
+        {
+            PositionX,
+            PositionY,
+            Rotation,        // [0, 65535] = [0, 2*pi)
+            VelocityX,
+            VelocityY,
+            AngularVelocity,
+            FIELD_COUNT
+        };
+
+        std::array<int32_t, FIELD_COUNT> fields{};
+
+        bool operator==(const QuantizedState& other) const { return fields == other.fields; }
+        bool operator!=(const QuantizedState& other) const { return fields != other.fields; }
+    };
+
+    /**
+     * @brief Dequantized entity state seen by a client
+     */
+    struct ReplicatedState
+    {
+        Math::Vector2 position{0.0f, 0.0f};
+        float rotation = 0.0f;
+        Math::Vector2 velocity{0.0f, 0.0f};
+        float angularVelocity = 0.0f;
+    };
+
+    struct ReplicationConfig
+    {
+        float positionResolution = 1.0f / 32.0f;         // px per quantization step
+        float velocityResolution = 1.0f / 16.0f;         // px/s per step
+        float angularVelocityResolution = 1.0f / 1024.0f; // rad/s per step
+        size_t packetBudgetBytes = 1200;                 // Per client per tick; 0 = unlimited
+        float relevanceRadius = 1000.0f;                 // Distance at which relevance halves
+        float cullDistance = 0.0f;                       // Entities farther from the focus are not sent; 0 = never cull
+        ECS::EntityID maxEntityId = 65535;               // Higher IDs are not replicated; clients reject packets naming one
+    };
+
+    // Packets a baseline may lag behind the packet that references it (4-bit offset on the wire)
+    static constexpr uint32_t REPLICATION_BASELINE_WINDOW = 16;
+
+    QuantizedState QuantizeState(const ECS::TransformComponent& transform, const ECS::PhysicsBodyComponent* body,
+                                 const ReplicationConfig& config);
+    ReplicatedState DequantizeState(const QuantizedState& state, const ReplicationConfig& config);
+
+    /**
+     * @brief Server side of snapshot replication
+     *
+     * Each tick CaptureSnapshot() quantizes every entity with a TransformComponent and
+     * an ID up to maxEntityId (velocities come from PhysicsBodyComponent when present). WritePacket() then
+     * builds one bit-packed packet per client:
+     *
+     * - entities whose state equals the client's baseline are skipped entirely
+     * - the rest accumulate priority every tick from their relevance to the client's
+     *   focus (usually its camera) and are written highest priority first until the
+     *   packet budget is spent
+     * - each entity is delta-encoded against the last state the client acknowledged
+     *   for it, or sent in full when there is none within the baseline window
+     * - destroyed entities the client knows about are listed until a packet carrying
+     *   the removal is acknowledged; removals are found by diffing consecutive
+     *   snapshots, so ticks without any cost nothing per client
+     *
+     * Acknowledge() promotes the states sent in a packet to that client's baselines.
+     */
+    class ReplicationServer
+    {
+    public:
+        ReplicationServer(ECS::ComponentStore& componentStore, const ReplicationConfig& config = {});
+
+        uint32_t AddClient();
+        void RemoveClient(uint32_t clientId);
+        void SetClientFocus(uint32_t clientId, const Math::Vector2& focus);
+
+        /**
+         * @brief Quantize the current world state; call once per tick before WritePacket()
+         */
+        void CaptureSnapshot();
+
+        /**
+         * @brief Encode the next packet for a client into out (replacing its contents)
+         * @return Sequence number of the packet, to be acknowledged by the client
+         */
+        uint32_t WritePacket(uint32_t clientId, std::vector<uint8_t>& out);
+
+        /**
+         * @brief Mark a packet as received by the client
+         */
+        void Acknowledge(uint32_t clientId, uint32_t sequence);
+
+        struct Statistics
+        {
+            size_t snapshotEntities = 0;   // Entities captured by the last snapshot
+            size_t changedEntities = 0;    // Entities differing from the client's baseline in the last packet
+            size_t sentEntities = 0;       // Entities written to the last packet
+            size_t deltaEntities = 0;      // Of those, delta-encoded against a baseline
+            size_t removedEntities = 0;    // Removals written to the last packet
+            size_t packetBytes = 0;        // Size of the last packet
+        };
+
+        const Statistics& GetStatistics() const { return m_Stats; }
+        const ReplicationConfig& GetConfig() const { return m_Config; }
+
+    private:
+        struct Baseline
+        {
+            QuantizedState state;
+            uint32_t sequence = 0;         // 0 = the client has no acknowledged state
+        };
+
+        struct SentPacket
+        {
+            uint32_t sequence = 0;
+            bool acknowledged = false;
+            std::vector<std::pair<ECS::EntityID, QuantizedState>> entities;
+            std::vector<ECS::EntityID> removals;
+        };
+
+        struct ClientState
+        {
+            bool active = false;
+            uint32_t nextSequence = 1;
+            Math::Vector2 focus{0.0f, 0.0f};
+            std::vector<Baseline> baselines;     // Indexed by entity ID
+            std::vector<uint32_t> lastSent;      // Sequence an entity was last written in, indexed by entity ID
+            std::vector<float> priority;         // Accumulated send priority, indexed by entity ID
+            std::vector<ECS::EntityID> pendingRemovals;  // Removed entities the client may still hold, sorted
+            std::array<SentPacket, REPLICATION_BASELINE_WINDOW> history;
+        };
+
+        struct Candidate
+        {
+            float priority;
+            ECS::EntityID entityId;
+        };
+
+        // Sent to the client and not yet acknowledged as removed
+        static bool IsKnown(const ClientState& client, ECS::EntityID entityId);
+
+        ECS::ComponentStore& m_ComponentStore;
+        ReplicationConfig m_Config;
+        Statistics m_Stats;
+
+        // Current snapshot, indexed by entity ID
+        std::vector<QuantizedState> m_Snapshot;
+        std::vector<uint8_t> m_Present;
+        std::vector<ECS::EntityID> m_SnapshotEntities;   // Sorted
+        std::vector<ECS::EntityID> m_PreviousEntities;   // m_SnapshotEntities of the previous capture
+        std::vector<ECS::EntityID> m_RemovedEntities;    // In the previous capture but not this one
+
+        std::vector<ClientState> m_Clients;
+        std::vector<Candidate> m_Candidates;
+        BitWriter m_Writer;
+    };
+
+    /**
+     * @brief Client side of snapshot replication
+     *
+     * Keeps the last REPLICATION_BASELINE_WINDOW received states of every entity so
+     * any baseline the server may reference is available.
+     */
+    class ReplicationClient
+    {
+    public:
+        explicit ReplicationClient(const ReplicationConfig& config = {});
+
+        /**
+         * @brief Decode and apply a packet
+         * @return False if the packet is stale or malformed, including entity IDs above
+         *         maxEntityId (it is then ignored and must not be acknowledged)
+         */
+        bool ReadPacket(const uint8_t* data, size_t size);
+
+        uint32_t GetLastSequence() const { return m_LastSequence; }
+        size_t GetEntityCount() const { return m_EntityCount; }
+
+        bool HasEntity(ECS::EntityID entityId) const;
+        bool GetQuantizedState(ECS::EntityID entityId, QuantizedState& state) const;
+        bool GetState(ECS::EntityID entityId, ReplicatedState& state) const;
+
+    private:
+        struct HistoryEntry
+        {
+            uint32_t sequence = 0;
+            QuantizedState state;
+        };
+
+        struct EntityRecord
+        {
+            bool present = false;
+            uint32_t latestSequence = 0;
+            std::array<HistoryEntry, REPLICATION_BASELINE_WINDOW> history;
+        };
+
+        struct DecodedEntity
+        {
+            ECS::EntityID entityId;
+            QuantizedState state;
+        };
+
+        ReplicationConfig m_Config;
+        std::vector<EntityRecord> m_Entities; // Indexed by entity ID
+        size_t m_EntityCount = 0;
+        uint32_t m_LastSequence = 0;
+        std::vector<DecodedEntity> m_Decoded;
+        std::vector<ECS::EntityID> m_Removed;
+    };
+}
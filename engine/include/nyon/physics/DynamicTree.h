@@ -1,9 +1,11 @@
 #pragma once
 
 #include "nyon/math/Vector2.h"
+#include "nyon/utils/MemoryTracker.h"
 #include <vector>
 #include <algorithm>
 #include <limits>
+#include <cmath>
 #include <cstdint>
 
 namespace Nyon::Physics
@@ -148,9 +150,11 @@ namespace Nyon::Physics
         uint32_t userData;         // User data (entity/shape ID)
         int32_t height;            // Node height for balancing (now int32_t)
         bool moved;                // Whether node moved significantly
+        bool enabled;              // Leaf is linked into the tree (false = parked proxy)
+        bool frozen;               // Leaf belongs to a sleeping body (see SetProxyFrozen)
         
         TreeNode() : parent(NULL_NODE), child1(NULL_NODE), child2(NULL_NODE), 
-                     userData(0), height(0), moved(false) {}
+                     userData(0), height(0), moved(false), enabled(true), frozen(false) {}
         
         bool IsLeaf() const { return child1 == NULL_NODE; }
     };
@@ -172,23 +176,83 @@ namespace Nyon::Physics
         void DestroyProxy(uint32_t proxyId);
         bool MoveProxy(uint32_t proxyId, const AABB& aabb, const Math::Vector2& displacement);
         
+        // Unlink a proxy from the tree but keep its node, so EnableProxy can re-insert
+        // it without a new allocation. Disabled proxies are never returned by queries.
+        void DisableProxy(uint32_t proxyId);
+        void EnableProxy(uint32_t proxyId, const AABB& aabb);
+        bool IsProxyEnabled(uint32_t proxyId) const;
+        
+        // Mark a proxy whose body sleeps. A frozen proxy stays linked and is still returned
+        // by queries; the flag tells the owner not to refit it or query from it. Touches
+        // only the proxy's own node, like ClearMoved.
+        void SetProxyFrozen(uint32_t proxyId, bool frozen);
+        bool IsProxyFrozen(uint32_t proxyId) const;
+        
+        // Batch versions for bulk spawns: the leaves are built into one balanced subtree
+        // (median splits) that is linked into the tree with a single insertion.
+        void CreateProxies(const AABB* aabbs, const uint32_t* userData, size_t count, uint32_t* proxyIds);
+        void EnableProxies(const uint32_t* proxyIds, const AABB* aabbs, size_t count);
+        
         // Tree operations
         void Rebuild(bool fullRebuild = false);
         void Validate() const;
         
-        // Queries
+        // Queries. Callbacks are any type with the member functions below; they are called
+        // directly (no virtual dispatch) and traversal runs on an explicit stack.
+        
+        /**
+         * @brief Report every leaf whose fat AABB overlaps aabb
+         *
+         * callback->QueryCallback(nodeId, userData) returns false to stop the query.
+         * Leaves are reported in depth-first order, child1 before child2.
+         */
         template<typename T>
-        void Query(const AABB& aabb, T* callback) const
-        {
-            QueryInternal(aabb, callback, m_root);
-        }
+        void Query(const AABB& aabb, T* callback) const;
+        
+        /**
+         * @brief Query many AABBs with one traversal per packet of PACKET_SIZE boxes
+         *
+         * Each node is tested only against the boxes that overlapped its parent, so the
+         * overlap tests are those of separate Query() calls while the nodes are loaded
+         * once per packet; coherent boxes (e.g. in spatial order) share most nodes.
+         * callback->QueryCallback(queryIndex, nodeId, userData) returns false to stop
+         * that query only. Each query sees its leaves in the same order as Query().
+         */
+        template<typename T>
+        void QueryBatch(const AABB* aabbs, size_t count, T* callback) const;
         
+        /**
+         * @brief Cast the segment origin + t * direction, t in [0, maxFraction]
+         *
+         * callback->RayCastCallback(fraction, nodeId, userData) gets the fraction at which
+         * the ray enters the leaf's fat AABB and returns the new maxFraction: 0 stops the
+         * cast, a fraction clips the ray (closest-hit casts return their hit), and a
+         * negative value leaves it unchanged. Children are visited nearest first and
+         * subtrees entered beyond maxFraction are skipped, so clipping prunes early.
+         */
         template<typename T>
         void RayCast(const Math::Vector2& origin, const Math::Vector2& direction, 
-                     float maxFraction, T* callback) const
+                     float maxFraction, T* callback) const;
+        
+        struct RayCastInput
         {
-            RayCastInternal(origin, direction, maxFraction, callback, m_root);
-        }
+            Math::Vector2 origin;
+            Math::Vector2 direction;
+            float maxFraction = 1.0f;
+        };
+        
+        /**
+         * @brief Cast many rays with one traversal per packet of PACKET_SIZE rays
+         *
+         * callback->RayCastCallback(rayIndex, fraction, nodeId, userData) follows the
+         * RayCast() contract for its own ray. Packets of rays with similar origins and
+         * directions share the nodes they load; the packet descends into the child its
+         * rays enter first.
+         */
+        template<typename T>
+        void RayCastBatch(const RayCastInput* rays, size_t count, T* callback) const;
+        
+        static constexpr size_t PACKET_SIZE = 64;  // Queries per packet, one bit each in a mask
         
         // Accessors
         const AABB& GetFatAABB(uint32_t proxyId) const;
@@ -206,7 +270,7 @@ namespace Nyon::Physics
         static constexpr float AABB_MULTIPLIER = 2.0f;     // AABB multiplier for movement
         static constexpr int NODE_CAPACITY_INCREMENT = 16; // Node pool growth increment
         
-        std::vector<TreeNode> m_nodes;     // Node pool
+        Utils::TrackedVector<TreeNode, Utils::MemoryTag::BroadPhase> m_nodes; // Node pool
         uint32_t m_root;                   // Root node index
         uint32_t m_nodeCount;              // Number of allocated nodes
         uint32_t m_proxyCount;             // Number of proxies
@@ -215,6 +279,9 @@ namespace Nyon::Physics
         // Internal operations
         uint32_t AllocateNode();
         void FreeNode(uint32_t nodeId);
+        void ReserveNodes(uint32_t count);
+        uint32_t BuildSubtree(uint32_t* leaves, size_t count);
+        void InsertSubtree(std::vector<uint32_t>& leaves);
         void InsertLeaf(uint32_t leaf);
         void RemoveLeaf(uint32_t leaf);
         uint32_t Balance(uint32_t index);
@@ -222,64 +289,66 @@ namespace Nyon::Physics
         void ValidateStructure(uint32_t index) const;
         void ValidateMetrics(uint32_t index) const;
         
-        // Query implementations
-        template<typename T>
-        void QueryInternal(const AABB& aabb, T* callback, uint32_t nodeId) const
+        // Depth-first traversal stack. The tree is height balanced, so traversals stay
+        // far below the fixed capacity; deeper trees spill to the heap instead of failing.
+        template<typename Entry, size_t Capacity = 256>
+        class TraversalStack
         {
-            if (nodeId == TreeNode::NULL_NODE)
-                return;
-                
-            const TreeNode& node = m_nodes[nodeId];
-            
-            if (aabb.Overlaps(node.aabb))
+        public:
+            void Push(const Entry& entry)
             {
-                if (node.IsLeaf())
-                {
-                    // Leaf node - call callback
-                    if (!callback->QueryCallback(nodeId, node.userData))
-                        return; // Stop querying
-                }
+                if (m_count < Capacity)
+                    m_entries[m_count] = entry;
                 else
-                {
-                    // Internal node - recurse
-                    QueryInternal(aabb, callback, node.child1);
-                    QueryInternal(aabb, callback, node.child2);
-                }
+                    m_spill.push_back(entry);
+                ++m_count;
             }
-        }
-        
-        template<typename T>
-        void RayCastInternal(const Math::Vector2& origin, const Math::Vector2& direction,
-                           float maxFraction, T* callback, uint32_t nodeId) const
-        {
-            if (nodeId == TreeNode::NULL_NODE)
-                return;
-                
-            const TreeNode& node = m_nodes[nodeId];
             
-            float hitFraction;
-            if (node.aabb.RayCast(origin, direction, maxFraction, hitFraction))
+            Entry Pop()
             {
-                if (node.IsLeaf())
-                {
-                    // Leaf node - call callback
-                    if (!callback->RayCastCallback(hitFraction, nodeId, node.userData))
-                        return; // Stop ray casting
-                }
-                else
-                {
-                    // Internal node - recurse
-                    RayCastInternal(origin, direction, maxFraction, callback, node.child1);
-                    RayCastInternal(origin, direction, maxFraction, callback, node.child2);
-                }
+                --m_count;
+                if (m_count < Capacity)
+                    return m_entries[m_count];
+                Entry entry = m_spill.back();
+                m_spill.pop_back();
+                return entry;
             }
-        }
+            
+            bool Empty() const { return m_count == 0; }
+            
+        private:
+            Entry m_entries[Capacity];
+            std::vector<Entry> m_spill;
+            size_t m_count = 0;
+        };
+        
+        // A ray with its reciprocal direction, for slab tests without divisions
+        struct RaySegment
+        {
+            Math::Vector2 origin;
+            Math::Vector2 invDirection;
+            bool parallelX;
+            bool parallelY;
+        };
+        
+        static RaySegment MakeRaySegment(const Math::Vector2& origin, const Math::Vector2& direction);
+        
+        // AABB::RayCast with the entry fraction clamped to 0 for rays starting inside the box
+        static bool RayEntersBox(const AABB& box, const RaySegment& ray, float maxFraction, float& entryFraction);
+        
+        static uint32_t LowestBit(uint64_t mask);
+        
+        template<typename T>
+        void QueryPacket(const AABB* aabbs, size_t begin, size_t count, T* callback) const;
+        template<typename T>
+        void RayCastPacket(const RayCastInput* rays, size_t begin, size_t count, T* callback) const;
     };
     
     /**
      * @brief Query callback interface for tree queries.
      * 
-     * Interface for custom query callbacks used with DynamicTree queries.
+     * Optional base for runtime-polymorphic callbacks; DynamicTree::Query takes any
+     * type with a matching QueryCallback.
      */
     struct ITreeQueryCallback
     {
@@ -290,11 +359,317 @@ namespace Nyon::Physics
     /**
      * @brief Ray cast callback interface for tree ray casts.
      * 
-     * Interface for custom ray cast callbacks used with DynamicTree ray casts.
+     * Optional base for runtime-polymorphic callbacks; returns the new maxFraction
+     * as described at DynamicTree::RayCast.
      */
     struct ITreeRayCastCallback
     {
         virtual ~ITreeRayCastCallback() = default;
-        virtual bool RayCastCallback(float fraction, uint32_t nodeId, uint32_t userData) = 0;
+        virtual float RayCastCallback(float fraction, uint32_t nodeId, uint32_t userData) = 0;
     };
+
+    // ========================================================================
+    // Traversal templates
+    // ========================================================================
+    
+    template<typename T>
+    void DynamicTree::Query(const AABB& aabb, T* callback) const
+    {
+        if (m_root == TreeNode::NULL_NODE)
+            return;
+        
+        // Children are tested before they are pushed, so only overlapping nodes are stacked
+        if (!aabb.Overlaps(m_nodes[m_root].aabb))
+            return;
+        TraversalStack<uint32_t> stack;
+        stack.Push(m_root);
+        while (!stack.Empty())
+        {
+            uint32_t nodeId = stack.Pop();
+            const TreeNode& node = m_nodes[nodeId];
+            if (node.IsLeaf())
+            {
+                if (!callback->QueryCallback(nodeId, node.userData))
+                    return;
+                continue;
+            }
+            
+            if (aabb.Overlaps(m_nodes[node.child2].aabb))
+                stack.Push(node.child2);
+            if (aabb.Overlaps(m_nodes[node.child1].aabb))
+                stack.Push(node.child1);
+        }
+    }
+    
+    template<typename T>
+    void DynamicTree::QueryBatch(const AABB* aabbs, size_t count, T* callback) const
+    {
+        for (size_t begin = 0; begin < count; begin += PACKET_SIZE)
+        {
+            QueryPacket(aabbs, begin, std::min(PACKET_SIZE, count - begin), callback);
+        }
+    }
+    
+    template<typename T>
+    void DynamicTree::QueryPacket(const AABB* aabbs, size_t begin, size_t count, T* callback) const
+    {
+        if (m_root == TreeNode::NULL_NODE || count == 0)
+            return;
+        
+        // Bit i stands for query begin + i; live clears the queries whose callback stopped
+        uint64_t live = count == 64 ? ~0ull : (1ull << count) - 1;
+        uint64_t rootHits = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (aabbs[begin + i].Overlaps(m_nodes[m_root].aabb))
+                rootHits |= 1ull << i;
+        }
+        
+        struct Entry
+        {
+            uint32_t nodeId;
+            uint64_t mask;   // Queries overlapping the node
+        };
+        TraversalStack<Entry> stack;
+        if (rootHits != 0)
+            stack.Push({m_root, rootHits});
+        while (!stack.Empty())
+        {
+            Entry entry = stack.Pop();
+            const TreeNode& node = m_nodes[entry.nodeId];
+            if (node.IsLeaf())
+            {
+                for (uint64_t hits = entry.mask & live; hits != 0; hits &= hits - 1)
+                {
+                    uint32_t i = LowestBit(hits);
+                    if (!callback->QueryCallback(begin + i, entry.nodeId, node.userData))
+                        live &= ~(1ull << i);
+                }
+                continue;
+            }
+            
+            // Both children in one pass over the queries
+            const AABB& box1 = m_nodes[node.child1].aabb;
+            const AABB& box2 = m_nodes[node.child2].aabb;
+            uint64_t hits1 = 0;
+            uint64_t hits2 = 0;
+            for (uint64_t mask = entry.mask & live; mask != 0; mask &= mask - 1)
+            {
+                uint32_t i = LowestBit(mask);
+                const AABB& query = aabbs[begin + i];
+                hits1 |= static_cast<uint64_t>(query.Overlaps(box1)) << i;
+                hits2 |= static_cast<uint64_t>(query.Overlaps(box2)) << i;
+            }
+            if (hits2 != 0)
+                stack.Push({node.child2, hits2});
+            if (hits1 != 0)
+                stack.Push({node.child1, hits1});
+        }
+    }
+    
+    template<typename T>
+    void DynamicTree::RayCast(const Math::Vector2& origin, const Math::Vector2& direction,
+                              float maxFraction, T* callback) const
+    {
+        if (m_root == TreeNode::NULL_NODE)
+            return;
+        
+        const RaySegment ray = MakeRaySegment(origin, direction);
+        struct Entry
+        {
+            uint32_t nodeId;
+            float fraction;  // Where the ray enters the node
+        };
+        Entry root{m_root, 0.0f};
+        if (!RayEntersBox(m_nodes[m_root].aabb, ray, maxFraction, root.fraction))
+            return;
+        
+        TraversalStack<Entry> stack;
+        stack.Push(root);
+        while (!stack.Empty())
+        {
+            Entry entry = stack.Pop();
+            // A hit since this node was pushed may have clipped the ray short of it
+            if (entry.fraction > maxFraction)
+                continue;
+            
+            const TreeNode& node = m_nodes[entry.nodeId];
+            if (node.IsLeaf())
+            {
+                float result = callback->RayCastCallback(entry.fraction, entry.nodeId, node.userData);
+                if (result == 0.0f)
+                    return;
+                if (result > 0.0f)
+                    maxFraction = std::min(maxFraction, result);
+                continue;
+            }
+            
+            // Push the farther child first so the nearer one is searched first
+            Entry first{node.child1, 0.0f};
+            Entry second{node.child2, 0.0f};
+            bool hitFirst = RayEntersBox(m_nodes[first.nodeId].aabb, ray, maxFraction, first.fraction);
+            bool hitSecond = RayEntersBox(m_nodes[second.nodeId].aabb, ray, maxFraction, second.fraction);
+            if (hitFirst && hitSecond && second.fraction < first.fraction)
+                std::swap(first, second);
+            else if (!hitFirst)
+            {
+                first = second;
+                hitFirst = hitSecond;
+                hitSecond = false;
+            }
+            if (hitSecond)
+                stack.Push(second);
+            if (hitFirst)
+                stack.Push(first);
+        }
+    }
+    
+    template<typename T>
+    void DynamicTree::RayCastBatch(const RayCastInput* rays, size_t count, T* callback) const
+    {
+        for (size_t begin = 0; begin < count; begin += PACKET_SIZE)
+        {
+            RayCastPacket(rays, begin, std::min(PACKET_SIZE, count - begin), callback);
+        }
+    }
+    
+    template<typename T>
+    void DynamicTree::RayCastPacket(const RayCastInput* rays, size_t begin, size_t count, T* callback) const
+    {
+        if (m_root == TreeNode::NULL_NODE || count == 0)
+            return;
+        
+        RaySegment segments[PACKET_SIZE];
+        float maxFractions[PACKET_SIZE];
+        for (size_t i = 0; i < count; ++i)
+        {
+            segments[i] = MakeRaySegment(rays[begin + i].origin, rays[begin + i].direction);
+            maxFractions[i] = rays[begin + i].maxFraction;
+        }
+        
+        // Rays of the packet entering a node, and the nearest of their entry fractions
+        auto enter = [&](uint32_t nodeId, uint64_t mask, float& nearest) {
+            uint64_t hits = 0;
+            nearest = std::numeric_limits<float>::max();
+            for (; mask != 0; mask &= mask - 1)
+            {
+                uint32_t i = LowestBit(mask);
+                float fraction;
+                if (RayEntersBox(m_nodes[nodeId].aabb, segments[i], maxFractions[i], fraction))
+                {
+                    hits |= 1ull << i;
+                    nearest = std::min(nearest, fraction);
+                }
+            }
+            return hits;
+        };
+        
+        uint64_t live = count == 64 ? ~0ull : (1ull << count) - 1;
+        struct Entry
+        {
+            uint32_t nodeId;
+            uint64_t mask;   // Rays that entered the node when it was pushed
+        };
+        float nearest;
+        uint64_t rootHits = enter(m_root, live, nearest);
+        if (rootHits == 0)
+            return;
+        
+        TraversalStack<Entry> stack;
+        stack.Push({m_root, rootHits});
+        while (!stack.Empty())
+        {
+            Entry entry = stack.Pop();
+            const TreeNode& node = m_nodes[entry.nodeId];
+            if (node.IsLeaf())
+            {
+                // Re-test each ray: hits since the push may have clipped it
+                for (uint64_t mask = entry.mask & live; mask != 0; mask &= mask - 1)
+                {
+                    uint32_t i = LowestBit(mask);
+                    float fraction;
+                    if (!RayEntersBox(node.aabb, segments[i], maxFractions[i], fraction))
+                        continue;
+                    float result = callback->RayCastCallback(begin + i, fraction, entry.nodeId, node.userData);
+                    if (result == 0.0f)
+                        live &= ~(1ull << i);
+                    else if (result > 0.0f)
+                        maxFractions[i] = std::min(maxFractions[i], result);
+                }
+                continue;
+            }
+            
+            float nearestFirst, nearestSecond;
+            Entry first{node.child1, enter(node.child1, entry.mask & live, nearestFirst)};
+            Entry second{node.child2, enter(node.child2, entry.mask & live, nearestSecond)};
+            if (nearestSecond < nearestFirst)
+                std::swap(first, second);
+            if (second.mask != 0)
+                stack.Push(second);
+            if (first.mask != 0)
+                stack.Push(first);
+        }
+    }
+    
+    inline DynamicTree::RaySegment DynamicTree::MakeRaySegment(const Math::Vector2& origin, const Math::Vector2& direction)
+    {
+        RaySegment ray;
+        ray.origin = origin;
+        ray.parallelX = std::abs(direction.x) < std::numeric_limits<float>::epsilon();
+        ray.parallelY = std::abs(direction.y) < std::numeric_limits<float>::epsilon();
+        ray.invDirection = {ray.parallelX ? 0.0f : 1.0f / direction.x, ray.parallelY ? 0.0f : 1.0f / direction.y};
+        return ray;
+    }
+    
+    inline bool DynamicTree::RayEntersBox(const AABB& box, const RaySegment& ray, float maxFraction, float& entryFraction)
+    {
+        float tmin = -std::numeric_limits<float>::max();
+        float tmax = std::numeric_limits<float>::max();
+        
+        if (ray.parallelX)
+        {
+            if (ray.origin.x < box.lowerBound.x || ray.origin.x > box.upperBound.x)
+                return false;
+        }
+        else
+        {
+            float t1 = (box.lowerBound.x - ray.origin.x) * ray.invDirection.x;
+            float t2 = (box.upperBound.x - ray.origin.x) * ray.invDirection.x;
+            tmin = std::max(tmin, std::min(t1, t2));
+            tmax = std::min(tmax, std::max(t1, t2));
+        }
+        
+        if (ray.parallelY)
+        {
+            if (ray.origin.y < box.lowerBound.y || ray.origin.y > box.upperBound.y)
+                return false;
+        }
+        else
+        {
+            float t1 = (box.lowerBound.y - ray.origin.y) * ray.invDirection.y;
+            float t2 = (box.upperBound.y - ray.origin.y) * ray.invDirection.y;
+            tmin = std::max(tmin, std::min(t1, t2));
+            tmax = std::min(tmax, std::max(t1, t2));
+        }
+        
+        if (tmin > tmax || tmax < 0.0f || tmin > maxFraction)
+            return false;
+        entryFraction = std::max(tmin, 0.0f);
+        return true;
+    }
+    
+    inline uint32_t DynamicTree::LowestBit(uint64_t mask)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<uint32_t>(__builtin_ctzll(mask));
+#else
+        uint32_t index = 0;
+        while ((mask & 1ull) == 0)
+        {
+            mask >>= 1;
+            ++index;
+        }
+        return index;
+#endif
+    }
 }
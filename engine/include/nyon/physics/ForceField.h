@@ -0,0 +1,73 @@
+#pragma once
+
+#include "nyon/math/Vector2.h"
+#include "nyon/physics/DynamicTree.h"
+#include "nyon/ecs/components/ForceFieldComponent.h"
+#include <vector>
+
+namespace Nyon::Physics
+{
+    /**
+     * @brief World-space snapshot of a ForceFieldComponent, evaluated over batches of bodies
+     *
+     * FromComponent() folds the field's type, volume and falloff into per-field
+     * coefficients, so Accumulate() runs one loop with no data-dependent branches for
+     * every kind of field. Used by PhysicsPipelineSystem once per field and sub-step, and by
+     * ParticlePipelineSystem once per field and step.
+     */
+    struct ForceField
+    {
+        // Body positions and masses laid out for Accumulate, with the forces it adds
+        struct Batch
+        {
+            std::vector<float> x, y, mass;
+            std::vector<float> forceX, forceY;
+
+            void Clear()
+            {
+                x.clear(); y.clear(); mass.clear();
+                forceX.clear(); forceY.clear();
+            }
+
+            void Push(const Math::Vector2& position, float bodyMass)
+            {
+                x.push_back(position.x); y.push_back(position.y); mass.push_back(bodyMass);
+                forceX.push_back(0.0f); forceY.push_back(0.0f);
+            }
+
+            size_t Size() const { return x.size(); }
+        };
+
+        Math::Vector2 center = {0.0f, 0.0f};
+        AABB bounds;                          // Of the volume, for the broad-phase query
+        uint16_t maskBits = 0xFFFF;
+        bool affectsParticles = true;
+        bool wakeBodies = true;
+
+        // Inside test: |dx| <= halfX, |dy| <= halfY and dx^2 + dy^2 <= radiusSq (unused limits are infinite)
+        float halfX = 0.0f;
+        float halfY = 0.0f;
+        float radiusSq = 0.0f;
+        // Falloff weight: constant + linear * u + quadratic * u^2, u = 1 - min(distance / extent, 1)
+        float invExtent = 0.0f;
+        float constant = 1.0f;
+        float linear = 0.0f;
+        float quadratic = 0.0f;
+        // Direction: radial * (d / |d|) + vortex * perp(d / |d|) + directional
+        float radial = 0.0f;
+        float vortex = 0.0f;
+        Math::Vector2 directional = {0.0f, 0.0f};
+        // Mass scale: massScale * mass + (1 - massScale)
+        float massScale = 1.0f;
+
+        /**
+         * @param origin World position the component's offset is relative to
+         */
+        static ForceField FromComponent(const ECS::ForceFieldComponent& component, const Math::Vector2& origin);
+
+        /**
+         * @brief Add the field's force on batch entries [begin, end) to their forceX/forceY
+         */
+        void Accumulate(Batch& batch, size_t begin, size_t end) const;
+    };
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "nyon/math/Vector2.h"
+#include "nyon/physics/DynamicTree.h"
+#include "nyon/ecs/components/ColliderComponent.h"
+#include <cstdint>
+#include <vector>
+
+namespace Nyon::Physics
+{
+    /**
+     * @brief Voronoi fracture of a convex polygon, computed once and reused for every break.
+     *
+     * Seeds are scattered inside the polygon and each Voronoi cell is the polygon clipped
+     * by the bisectors to every other seed. Pieces keep everything a spawn needs ready
+     * made: the polygon (with normals) centered on its centroid, where that centroid sits
+     * in the source shape's frame, and the area, inertia and bounds of the piece, so
+     * breaking an object copies data instead of running geometry. Used by FractureSystem.
+     */
+    class FracturePattern
+    {
+    public:
+        struct Piece
+        {
+            ECS::ColliderComponent::PolygonShape shape;  // Vertices relative to the piece centroid
+            Math::Vector2 offset = {0.0f, 0.0f};         // Piece centroid in the source shape's frame
+            float area = 0.0f;
+            float inertiaPerUnitMass = 0.0f;             // About the centroid
+            AABB localBounds;                            // Of shape, unrotated
+        };
+
+        FracturePattern() = default;
+
+        /**
+         * @brief Split a convex polygon into up to pieceCount Voronoi cells
+         * @param seed Seeds the scatter, so a (shape, count, seed) triple always gives the same pieces
+         */
+        static FracturePattern Generate(const ECS::ColliderComponent::PolygonShape& source, int pieceCount, uint32_t seed);
+
+        const std::vector<Piece>& GetPieces() const { return m_Pieces; }
+        size_t GetPieceCount() const { return m_Pieces.size(); }
+        bool IsEmpty() const { return m_Pieces.empty(); }
+
+    private:
+        std::vector<Piece> m_Pieces;
+    };
+}
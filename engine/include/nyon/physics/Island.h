@@ -67,6 +67,18 @@ namespace Nyon::Physics
          */
         const std::vector<Island>& GetSleepingIslands() const { return m_SleepingIslands; }
         
+        /**
+         * @brief Get every island found by the last update, awake or sleeping
+         * @return Vector of all islands
+         */
+        const std::vector<Island>& GetIslands() const { return m_AllIslands; }
+        
+        /**
+         * @brief Index into GetIslands() of the island holding a body
+         * @return SIZE_MAX when the body was not part of the last update
+         */
+        size_t GetIslandIndex(ECS::EntityID bodyId) const;
+        
         /**
          * @brief Wake up an island containing a specific body
          * @param bodyId Body that triggered wake-up
@@ -80,6 +92,14 @@ namespace Nyon::Physics
          */
         bool IsBodyAwake(ECS::EntityID bodyId) const;
         
+        /**
+         * @brief Seed island flood fills in entity ID order instead of hash order
+         *
+         * Island indices and body order within islands then depend only on the contacts,
+         * not on the unordered_map layout.
+         */
+        void SetDeterministic(bool deterministic) { m_Deterministic = deterministic; }
+        
         /**
          * @brief Get statistics about island distribution
          */
@@ -108,6 +128,8 @@ namespace Nyon::Physics
         void WakeSleepingIslands();
         bool ShouldIslandSleep(const Island& island) const;
         void RestoreIslandSleepState(Island& island);
+        bool IsStaticBody(ECS::EntityID bodyId) const;
+        bool IsBodyMarkedAwake(ECS::EntityID bodyId) const;  // PhysicsBodyComponent::isAwake
         
         // Helper methods
         bool AreBodiesConnected(ECS::EntityID bodyA, ECS::EntityID bodyB) const;
@@ -131,6 +153,8 @@ namespace Nyon::Physics
         std::unordered_set<ECS::EntityID> m_VisitedBodies;
         std::unordered_map<ECS::EntityID, size_t> m_BodyIslandMap; // bodyId -> island index
         
+        bool m_Deterministic = false;
+        
         // Cross-frame sleep state: preserves sleep timers and awake state when islands are rebuilt
         std::unordered_map<ECS::EntityID, std::pair<float, bool>> m_BodySleepState;
         
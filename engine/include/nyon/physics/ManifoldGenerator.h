@@ -4,6 +4,8 @@
 #include "nyon/ecs/components/ColliderComponent.h"
 #include "nyon/ecs/components/PhysicsWorldComponent.h"
 #include "nyon/ecs/components/TransformComponent.h"
+#include <cstdint>
+#include <vector>
 
 namespace Nyon::Physics
 {
@@ -12,10 +14,53 @@ namespace Nyon::Physics
      * 
      * Supports circle–circle, circle–polygon, and polygon–polygon using SAT-style tests,
      * leveraging the polygon face normals stored on ColliderComponent::PolygonShape.
+     *
+     * PhysicsPipelineSystem's narrow phase groups pairs by ClassifyPair() so each group
+     * runs one kernel over many pairs; circle pairs are first culled in bulk through
+     * FindCircleOverlaps() on a structure-of-arrays batch.
      */
     class ManifoldGenerator
     {
     public:
+        // Shape pairings with a dedicated fast path; everything else is Other
+        enum class PairKind : uint8_t
+        {
+            CircleCircle,
+            CirclePolygon,
+            PolygonPolygon,
+            Other,
+            Count
+        };
+
+        // Circle pair centers and radii laid out for FindCircleOverlaps
+        struct CirclePairBatch
+        {
+            std::vector<float> ax, ay, ra;
+            std::vector<float> bx, by, rb;
+
+            void Clear()
+            {
+                ax.clear(); ay.clear(); ra.clear();
+                bx.clear(); by.clear(); rb.clear();
+            }
+
+            void Push(const Math::Vector2& centerA, float radiusA, const Math::Vector2& centerB, float radiusB)
+            {
+                ax.push_back(centerA.x); ay.push_back(centerA.y); ra.push_back(radiusA);
+                bx.push_back(centerB.x); by.push_back(centerB.y); rb.push_back(radiusB);
+            }
+
+            size_t Size() const { return ax.size(); }
+        };
+
+        static PairKind ClassifyPair(const Nyon::ECS::ColliderComponent& colliderA,
+                                     const Nyon::ECS::ColliderComponent& colliderB);
+
+        /**
+         * @brief Set overlaps[i] to 1 when circle pair i of the batch touches, using the same test as CircleCircle
+         */
+        static void FindCircleOverlaps(const CirclePairBatch& batch, std::vector<uint8_t>& overlaps);
+
         static ECS::ContactManifold GenerateManifold(uint32_t entityIdA,
                                                      uint32_t entityIdB,
                                                      uint32_t shapeIdA,
@@ -25,36 +70,38 @@ namespace Nyon::Physics
                                                      const Nyon::ECS::TransformComponent& transformA,
                                                      const Nyon::ECS::TransformComponent& transformB);
 
+        /**
+         * @brief GenerateManifold writing into an existing manifold, reusing its point storage
+         */
+        static void GenerateManifoldInto(uint32_t entityIdA,
+                                         uint32_t entityIdB,
+                                         uint32_t shapeIdA,
+                                         uint32_t shapeIdB,
+                                         const Nyon::ECS::ColliderComponent& colliderA,
+                                         const Nyon::ECS::ColliderComponent& colliderB,
+                                         const Nyon::ECS::TransformComponent& transformA,
+                                         const Nyon::ECS::TransformComponent& transformB,
+                                         ECS::ContactManifold& manifold);
+
     private:
-        static ECS::ContactManifold CircleCircle(uint32_t entityIdA,
-                                                 uint32_t entityIdB,
-                                                 uint32_t shapeIdA,
-                                                 uint32_t shapeIdB,
-                                                 const Nyon::ECS::ColliderComponent::CircleShape& circleA,
-                                                 const Nyon::ECS::ColliderComponent::CircleShape& circleB,
-                                                 const Nyon::ECS::TransformComponent& transformA,
-                                                 const Nyon::ECS::TransformComponent& transformB,
-                                                 ECS::ContactManifold& manifold);
+        // Fill manifold in place; ids are already set by GenerateManifoldInto
+        static void CircleCircle(const Nyon::ECS::ColliderComponent::CircleShape& circleA,
+                                 const Nyon::ECS::ColliderComponent::CircleShape& circleB,
+                                 const Nyon::ECS::TransformComponent& transformA,
+                                 const Nyon::ECS::TransformComponent& transformB,
+                                 ECS::ContactManifold& manifold);
 
-        static ECS::ContactManifold CirclePolygon(uint32_t entityIdA,
-                                                   uint32_t entityIdB,
-                                                   uint32_t shapeIdA,
-                                                   uint32_t shapeIdB,
-                                                   const Nyon::ECS::ColliderComponent::CircleShape& circle,
-                                                   const Nyon::ECS::ColliderComponent::PolygonShape& polygon,
-                                                   const Nyon::ECS::TransformComponent& circleTransform,
-                                                   const Nyon::ECS::TransformComponent& polyTransform,
-                                                   ECS::ContactManifold& manifold);
+        static void CirclePolygon(const Nyon::ECS::ColliderComponent::CircleShape& circle,
+                                  const Nyon::ECS::ColliderComponent::PolygonShape& polygon,
+                                  const Nyon::ECS::TransformComponent& circleTransform,
+                                  const Nyon::ECS::TransformComponent& polyTransform,
+                                  ECS::ContactManifold& manifold);
 
-        static ECS::ContactManifold PolygonPolygon(uint32_t entityIdA,
-                                                   uint32_t entityIdB,
-                                                   uint32_t shapeIdA,
-                                                   uint32_t shapeIdB,
-                                                   const Nyon::ECS::ColliderComponent::PolygonShape& polyA,
-                                                   const Nyon::ECS::ColliderComponent::PolygonShape& polyB,
-                                                   const Nyon::ECS::TransformComponent& transformA,
-                                                   const Nyon::ECS::TransformComponent& transformB,
-                                                   ECS::ContactManifold& manifold);
+        static void PolygonPolygon(const Nyon::ECS::ColliderComponent::PolygonShape& polyA,
+                                   const Nyon::ECS::ColliderComponent::PolygonShape& polyB,
+                                   const Nyon::ECS::TransformComponent& transformA,
+                                   const Nyon::ECS::TransformComponent& transformB,
+                                   ECS::ContactManifold& manifold);
         
         static ECS::ContactManifold CircleCapsule(uint32_t entityIdA,
                                                   uint32_t entityIdB,
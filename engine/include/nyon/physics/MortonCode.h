@@ -0,0 +1,45 @@
+#pragma once
+
+#include "nyon/math/Vector2.h"
+#include <cstdint>
+#include <algorithm>
+
+namespace Nyon::Physics
+{
+    /**
+     * @brief Spread the low 16 bits of a value so there is a zero bit between each
+     */
+    inline uint32_t ExpandBits16(uint32_t v)
+    {
+        v &= 0x0000FFFF;
+        v = (v | (v << 8)) & 0x00FF00FF;
+        v = (v | (v << 4)) & 0x0F0F0F0F;
+        v = (v | (v << 2)) & 0x33333333;
+        v = (v | (v << 1)) & 0x55555555;
+        return v;
+    }
+
+    /**
+     * @brief Interleave two 16-bit cell coordinates into a 32-bit Z-order key
+     */
+    inline uint32_t MortonEncode(uint32_t x, uint32_t y)
+    {
+        return ExpandBits16(x) | (ExpandBits16(y) << 1);
+    }
+
+    /**
+     * @brief Z-order key of a point quantized to a 65536x65536 grid over [min, max]
+     *
+     * Points close in space get close keys, so sorting by key lays out spatial
+     * neighbours next to each other in memory.
+     */
+    inline uint32_t MortonEncode(const Math::Vector2& point, const Math::Vector2& min, const Math::Vector2& max)
+    {
+        constexpr float GRID_MAX = 65535.0f;
+        float extentX = std::max(max.x - min.x, 1e-6f);
+        float extentY = std::max(max.y - min.y, 1e-6f);
+        float fx = std::clamp((point.x - min.x) / extentX, 0.0f, 1.0f) * GRID_MAX;
+        float fy = std::clamp((point.y - min.y) / extentY, 0.0f, 1.0f) * GRID_MAX;
+        return MortonEncode(static_cast<uint32_t>(fx), static_cast<uint32_t>(fy));
+    }
+}
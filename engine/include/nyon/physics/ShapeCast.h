@@ -0,0 +1,45 @@
+#pragma once
+
+#include "nyon/math/Vector2.h"
+#include "nyon/ecs/components/ColliderComponent.h"
+
+namespace Nyon::Physics
+{
+    /**
+     * @brief Swept circle and circle overlap queries against collider shapes.
+     *
+     * Every shape is handled as a set of rounded segments: circles and capsules directly,
+     * segments, polygon edges and chain links with their rounding radius. A circle of
+     * radius r hits a rounded segment of radius R where its center hits the segment
+     * inflated to R + r, so a circle cast is a ray cast against those capsules. Polygon
+     * interiors are covered by the overlap test. Used by CharacterControllerSystem.
+     */
+    class ShapeCast
+    {
+    public:
+        struct Hit
+        {
+            float fraction = 1.0f;                 // Fraction of the translation travelled before contact
+            Math::Vector2 point = {0.0f, 0.0f};    // Contact point on the collider surface
+            Math::Vector2 normal = {0.0f, 1.0f};   // Surface normal at the contact, pointing at the circle
+        };
+
+        /**
+         * @brief Sweep a circle from center by translation against a collider at (position, rotation)
+         *
+         * A circle that already touches the shape reports fraction 0 only while the
+         * translation points into the surface, so overlapping circles can still move away.
+         * @return Whether the circle hits the shape within the translation
+         */
+        static bool CastCircle(const ECS::ColliderComponent& collider, const Math::Vector2& position, float rotation,
+                               const Math::Vector2& center, float radius, const Math::Vector2& translation, Hit& hit);
+
+        /**
+         * @brief Deepest penetration of a circle into a collider at (position, rotation)
+         * @param normal Direction that pushes the circle out of the shape
+         * @return Whether the circle overlaps the shape
+         */
+        static bool CircleOverlap(const ECS::ColliderComponent& collider, const Math::Vector2& position, float rotation,
+                                  const Math::Vector2& center, float radius, Math::Vector2& normal, float& depth);
+    };
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "nyon/utils/FrameTimingLog.h"
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Nyon::Utils
+{
+    /**
+     * @brief Always-on ring buffer of recent frames that is written to disk around frame spikes
+     *
+     * Every frame Application records its phase timings plus whatever the game fills in
+     * through Application::OnRecordFlightFrame (ECSApplication adds physics phase timings
+     * and counters). Every snapshotInterval frames, and on the frame after a spike, a
+     * compact snapshot of body states is kept as well. All storage is allocated up front
+     * or reused, so recording costs a struct copy per frame.
+     *
+     * When a frame takes longer than spikeThresholdMs the recorder waits postSpikeFrames
+     * more frames, then writes the whole ring (frames before and after the spike) and
+     * the snapshots it covers to a .nfr file. ReadDump() and PrintReport() load and
+     * summarize such a file; tools/flight-report wraps them for offline use.
+     */
+    class FlightRecorder
+    {
+    public:
+        struct Config
+        {
+            bool enabled = true;
+            size_t capacityFrames = 600;     // ~10 s at 60 fps
+            double spikeThresholdMs = 50.0;  // Frames slower than this trigger a dump (0 = never)
+            uint32_t postSpikeFrames = 30;   // Frames after the spike included in the dump
+            uint32_t warmupFrames = 10;      // Startup frames never treated as spikes
+            uint32_t snapshotInterval = 60;  // Frames between body snapshots (0 = only after spikes)
+            size_t maxSnapshotBodies = 4096; // Bodies kept per snapshot
+            uint32_t maxDumps = 4;           // Dumps written per run
+            std::string directory = ".";     // Where nyon-spike-<frame>.nfr files go
+        };
+
+        // Filled by ECSApplication from PhysicsPipelineSystem statistics, summed over the frame's fixed steps
+        struct PhysicsSample
+        {
+            float updateMs = 0.0f;
+            float broadPhaseMs = 0.0f;
+            float narrowPhaseMs = 0.0f;
+            float islandMs = 0.0f;
+            float constraintMs = 0.0f;       // Constraint initialization
+            float velocityMs = 0.0f;
+            float positionMs = 0.0f;
+            float finalizeMs = 0.0f;         // Impulse storage, sleeping, transform write-back
+            uint32_t steps = 0;              // Pipeline updates run (including idle-skipped ones)
+            uint32_t subSteps = 0;
+            uint32_t pairs = 0;              // Counters are from the frame's last step
+            uint32_t contacts = 0;
+            uint32_t constraints = 0;
+            uint32_t islands = 0;
+            uint32_t awakeBodies = 0;
+            uint32_t sleepingBodies = 0;
+            uint32_t particles = 0;
+        };
+
+        struct FrameRecord
+        {
+            uint64_t frame = 0;
+            double time = 0.0;               // Application::GetTime() at the end of the frame
+            FrameTimingLog::Frame timing;
+            PhysicsSample physics;
+            uint64_t allocations = 0;        // Tracked allocations during the frame, all tags
+            uint64_t trackedBytes = 0;       // Tracked live bytes at the end of the frame
+        };
+
+        struct BodyState
+        {
+            uint32_t entityId = 0;
+            uint32_t flags = 0;              // FLAG_* bits
+            float x = 0.0f, y = 0.0f;
+            float rotation = 0.0f;
+            float vx = 0.0f, vy = 0.0f;
+            float angularVelocity = 0.0f;
+        };
+
+        static constexpr uint32_t FLAG_STATIC = 1u << 0;
+        static constexpr uint32_t FLAG_AWAKE = 1u << 1;
+        static constexpr uint32_t FLAG_DISABLED = 1u << 2;
+
+        struct Snapshot
+        {
+            uint64_t frame = 0;
+            uint32_t totalBodies = 0;        // Bodies in the world; bodies.size() may be capped
+            std::vector<BodyState> bodies;
+        };
+
+        // Contents of a .nfr file
+        struct Dump
+        {
+            uint64_t spikeFrame = 0;
+            double thresholdMs = 0.0;
+            std::vector<FrameRecord> frames;  // Oldest first
+            std::vector<Snapshot> snapshots;  // Oldest first
+        };
+
+        FlightRecorder();
+
+        void SetConfig(const Config& config);
+        const Config& GetConfig() const { return m_Config; }
+
+        bool IsEnabled() const { return m_Config.enabled; }
+
+        /**
+         * @brief Whether the frame about to be recorded should fill a snapshot
+         */
+        bool WantsSnapshot(uint64_t frame) const;
+
+        /**
+         * @brief Reuse the oldest snapshot slot for frame; fill bodies (up to maxSnapshotBodies)
+         * @return Slot with bodies cleared but capacity kept
+         */
+        Snapshot& BeginSnapshot(uint64_t frame, uint32_t totalBodies);
+
+        /**
+         * @brief Append a frame, detect spikes and write a pending dump once its post-spike frames are in
+         */
+        void Record(const FrameRecord& record);
+
+        /**
+         * @brief Write a pending dump now (call on shutdown)
+         */
+        void Flush();
+
+        size_t GetFrameCount() const { return m_Count; }
+        uint32_t GetDumpCount() const { return m_DumpCount; }
+        const std::string& GetLastDumpPath() const { return m_LastDumpPath; }
+
+        /**
+         * @brief Copy the current ring contents in dump form, oldest frame first
+         */
+        Dump Capture(uint64_t spikeFrame) const;
+
+        static bool WriteDump(const std::string& path, const Dump& dump);
+        static bool ReadDump(const std::string& path, Dump& dump);
+
+        /**
+         * @brief Write the spike frame's breakdown against the median of the frames before it,
+         *        the frames around it, and the nearest body snapshot
+         */
+        static void PrintReport(const Dump& dump, std::ostream& out);
+
+    private:
+        void WritePendingDump();
+
+        Config m_Config;
+        std::vector<FrameRecord> m_Frames;    // Ring, capacityFrames long
+        size_t m_Head = 0;                    // Next slot to write
+        size_t m_Count = 0;
+        uint64_t m_Recorded = 0;              // Frames recorded since SetConfig
+        std::vector<Snapshot> m_Snapshots;    // Ring of snapshot slots
+        size_t m_SnapshotHead = 0;
+
+        bool m_DumpPending = false;
+        uint64_t m_SpikeFrame = 0;
+        uint32_t m_FramesSinceSpike = 0;
+        uint32_t m_DumpCount = 0;
+        std::string m_LastDumpPath;
+    };
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Nyon::Utils
+{
+    /**
+     * @brief Per-frame timing samples with CSV export and a percentile summary
+     *
+     * Application fills one Frame per loop iteration when timing is requested
+     * (--timing, or always in headless runs) so demos can be profiled at scale
+     * without an external profiler attached.
+     */
+    class FrameTimingLog
+    {
+    public:
+        struct Frame
+        {
+            double frameMs = 0.0;    // Whole loop iteration
+            double fixedMs = 0.0;    // All OnFixedUpdate calls of the frame
+            double updateMs = 0.0;   // OnUpdate
+            double renderMs = 0.0;   // OnInterpolateAndRender + buffer swap
+            double waitMs = 0.0;     // Frame pacing sleep/spin (--fps)
+            double cpuMs = 0.0;      // Process CPU time over the frame, all threads
+            uint32_t fixedSteps = 0;
+
+            // Input events applied by this frame's fixed steps (latencies are the worst event)
+            uint32_t inputEvents = 0;
+            double inputToSimMs = 0.0;      // Event receipt -> fixed step that applied it
+            double inputToPresentMs = 0.0;  // Event receipt -> buffer swap returned
+        };
+
+        void Reserve(size_t frames) { m_Frames.reserve(frames); }
+        void Record(const Frame& frame) { m_Frames.push_back(frame); }
+        void Clear() { m_Frames.clear(); }
+
+        const std::vector<Frame>& GetFrames() const { return m_Frames; }
+
+        /**
+         * @brief Write frame,frame_ms,fixed_ms,update_ms,render_ms,wait_ms,cpu_ms,fixed_steps,
+         *        input_events,input_sim_ms,input_present_ms rows
+         * @return False if the file could not be opened
+         */
+        bool WriteCsv(const std::string& path) const;
+
+        /**
+         * @brief Write frame count and mean/p50/p95/p99/max of frame, fixed-step and CPU
+         *        time, CPU utilization, and input latency over the frames that applied input
+         */
+        void PrintSummary(std::ostream& out, const char* label) const;
+
+    private:
+        std::vector<Frame> m_Frames;
+    };
+}
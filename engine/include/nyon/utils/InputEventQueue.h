@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nyon::Utils
+{
+    /**
+     * @brief One key or mouse button transition with the time it was received
+     */
+    struct InputEvent
+    {
+        enum class Device : uint8_t
+        {
+            Key,
+            MouseButton
+        };
+
+        Device device = Device::Key;
+        int code = 0;            // GLFW key or mouse button
+        int action = 0;          // GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT
+        double timestamp = 0.0;  // Seconds on the glfwGetTime() clock
+    };
+
+    /**
+     * @brief Bounded single-producer/single-consumer ring of input events
+     *
+     * The producer (GLFW callbacks) and the consumer (the fixed step) only touch
+     * their own index plus an acquire load of the other one, so neither side ever
+     * blocks. When the ring is full new events are dropped and counted rather than
+     * overwriting ones the simulation has not seen yet.
+     */
+    class InputEventQueue
+    {
+    public:
+        static constexpr size_t CAPACITY = 256;  // Power of two
+
+        // Producer side
+        bool Push(const InputEvent& event);
+
+        // Consumer side
+        bool Peek(InputEvent& event) const;
+        bool Pop(InputEvent& event);
+        void Clear();
+
+        size_t Size() const;
+        bool Empty() const { return Size() == 0; }
+        uint64_t GetDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+    private:
+        static constexpr size_t MASK = CAPACITY - 1;
+        static_assert((CAPACITY & MASK) == 0, "InputEventQueue capacity must be a power of two");
+
+        std::array<InputEvent, CAPACITY> m_Events;
+        alignas(64) std::atomic<size_t> m_Head{0};  // Next slot to read, written by the consumer
+        alignas(64) std::atomic<size_t> m_Tail{0};  // Next slot to write, written by the producer
+        std::atomic<uint64_t> m_Dropped{0};
+    };
+}
@@ -1,16 +1,56 @@
 #pragma once
 
 #include <GLFW/glfw3.h>
-#include <unordered_set>
+#include <cstdint>
+#include "nyon/utils/InputEventQueue.h"
 
 namespace Nyon::Utils
 {
+    /**
+     * @brief Key/mouse state sampled per fixed step from timestamped events
+     *
+     * GLFW callbacks only push timestamped events into a lock-free queue. Each
+     * fixed step calls BeginFixedStep() with the wall-clock time the step ends at
+     * and applies exactly the events received up to then, so presses land in the
+     * step that covers them instead of being smeared over every step of a frame.
+     * Edge queries (IsKeyPressed/IsKeyUp) are relative to the previous step.
+     */
     class InputManager
     {
     public:
+        // Events applied since the last TakeLatencySample()
+        struct LatencySample
+        {
+            uint32_t events = 0;
+            double oldestTimestamp = 0.0;  // glfwGetTime() of the oldest applied event
+            double maxToSimMs = 0.0;       // Longest wait from receipt to the step that applied it
+        };
+
         static void Init(GLFWwindow* window);
+        
+        // Previous state := current, then apply every queued event (frame-based loops)
         static void Update();
         
+        /**
+         * @brief Advance input by one fixed step.
+         * @param stepEndTime Wall-clock time (glfwGetTime) the step simulates up to
+         * @param now Current wall-clock time, for latency measurement
+         *
+         * Applies queued events timestamped at or before stepEndTime. An event that
+         * would undo a transition already made in this step (the release of a tap
+         * shorter than a step) is held for the next step, so no press is missed.
+         */
+        static void BeginFixedStep(double stepEndTime, double now);
+        
+        // Queue an event as if it came from the window (replays, tests, remote input)
+        static bool QueueEvent(const InputEvent& event);
+        
+        static LatencySample TakeLatencySample();
+        
+        // Incremented whenever a key or button changes state (events or synthetic input)
+        static uint64_t GetInputSerial() { return s_InputSerial; }
+        static uint64_t GetDroppedEventCount() { return s_Events.GetDroppedCount(); }
+        
         // Keyboard input
         static bool IsKeyPressed(int key);
         static bool IsKeyDown(int key);
@@ -22,17 +62,30 @@ namespace Nyon::Utils
         static bool IsMouseUp(int button);
         static void GetMousePosition(double& x, double& y);
         
+        // Synthetic input for bots and headless runs. Once used, input queries work
+        // without a window; states persist until set again or changed by the device.
+        static void SetKeyState(int key, bool down);
+        static void SetMouseButtonState(int button, bool down);
+        static void SetMousePosition(double x, double y);
+        
     private:
+        static bool IsAvailable() { return s_Window != nullptr || s_Synthetic; }
+        static void ApplyEvents(double untilTime, double now);
+        
         static GLFWwindow* s_Window;
         static bool s_CurrentKeys[GLFW_KEY_LAST];
         static bool s_PreviousKeys[GLFW_KEY_LAST];
         static bool s_CurrentMouseButtons[GLFW_MOUSE_BUTTON_LAST];
         static bool s_PreviousMouseButtons[GLFW_MOUSE_BUTTON_LAST];
         
-        // Callback-based input tracking
-        static std::unordered_set<int> s_ActiveKeys;
-        static std::unordered_set<int> s_ActiveMouseButtons;
-        static bool s_InputDirty;
+        // Callback-fed event queue
+        static InputEventQueue s_Events;
+        static LatencySample s_Latency;
+        static uint64_t s_InputSerial;
+        static bool s_Synthetic;
+        static bool s_HasSyntheticMouse;
+        static double s_SyntheticMouseX;
+        static double s_SyntheticMouseY;
         
         // GLFW callback handlers
         static void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
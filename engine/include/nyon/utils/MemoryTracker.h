@@ -0,0 +1,148 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace Nyon::Utils
+{
+    /**
+     * @brief Subsystem an allocation is charged to
+     */
+    enum class MemoryTag : uint8_t
+    {
+        General,
+        ECS,          // Component pools and their index maps
+        Physics,      // Solver bodies, constraints, manifolds, impulse cache
+        BroadPhase,   // DynamicTree node pool
+        Particles,    // Particle spatial hash
+        Rendering,    // Persistent-mapped GPU buffers (driver memory, recorded explicitly)
+        COUNT
+    };
+
+    const char* GetMemoryTagName(MemoryTag tag);
+
+    /**
+     * @brief Process-wide per-tag allocation counters
+     *
+     * Engine-owned containers charge their heap usage to a tag through
+     * TrackingAllocator; memory allocated outside the C++ heap (GPU buffers)
+     * is recorded explicitly with RecordAllocation()/RecordFree(). Counters
+     * are relaxed atomics, so recording is safe from worker threads and costs
+     * a few uncontended atomic adds per allocation.
+     *
+     * Allocation rates are measured between calls to Sample(); call it once
+     * per reporting period (ECSApplication does so for its periodic dump).
+     */
+    class MemoryTracker
+    {
+    public:
+        struct TagStats
+        {
+            size_t currentBytes = 0;      // Live bytes
+            size_t peakBytes = 0;         // High-water mark since start or ResetPeaks()
+            uint64_t allocations = 0;     // Allocations since start
+            uint64_t bytesAllocated = 0;  // Bytes allocated since start
+            double allocationsPerSecond = 0.0; // Over the last Sample() period
+            double bytesPerSecond = 0.0;       // Over the last Sample() period
+        };
+
+        static void RecordAllocation(MemoryTag tag, size_t bytes);
+        static void RecordFree(MemoryTag tag, size_t bytes);
+
+        static TagStats GetStats(MemoryTag tag);
+        static size_t GetTotalCurrentBytes();
+
+        /**
+         * @brief Close the current rate period and start a new one
+         */
+        static void Sample();
+
+        /**
+         * @brief Lower every peak to the tag's current usage
+         */
+        static void ResetPeaks();
+
+        /**
+         * @brief Write a per-tag table of current, peak and rate counters
+         */
+        static void Report(std::ostream& out);
+
+    private:
+        struct Counters
+        {
+            std::atomic<size_t> currentBytes{0};
+            std::atomic<size_t> peakBytes{0};
+            std::atomic<uint64_t> allocations{0};
+            std::atomic<uint64_t> bytesAllocated{0};
+        };
+
+        struct RateSample
+        {
+            uint64_t allocations = 0;
+            uint64_t bytesAllocated = 0;
+            double allocationsPerSecond = 0.0;
+            double bytesPerSecond = 0.0;
+        };
+
+        static std::array<Counters, static_cast<size_t>(MemoryTag::COUNT)> s_Counters;
+        static std::array<RateSample, static_cast<size_t>(MemoryTag::COUNT)> s_Rates;
+        static double s_LastSampleTime;
+    };
+
+    /**
+     * @brief STL allocator that charges its allocations to a MemoryTag
+     *
+     * Stateless, so containers using it swap and move like their std::allocator
+     * counterparts; only the container's own type changes.
+     */
+    template<typename T, MemoryTag Tag>
+    class TrackingAllocator
+    {
+    public:
+        using value_type = T;
+
+        template<typename U>
+        struct rebind
+        {
+            using other = TrackingAllocator<U, Tag>;
+        };
+
+        TrackingAllocator() noexcept = default;
+
+        template<typename U>
+        TrackingAllocator(const TrackingAllocator<U, Tag>&) noexcept {}
+
+        T* allocate(size_t count)
+        {
+            T* ptr = std::allocator<T>().allocate(count);
+            MemoryTracker::RecordAllocation(Tag, count * sizeof(T));
+            return ptr;
+        }
+
+        void deallocate(T* ptr, size_t count) noexcept
+        {
+            MemoryTracker::RecordFree(Tag, count * sizeof(T));
+            std::allocator<T>().deallocate(ptr, count);
+        }
+
+        template<typename U>
+        bool operator==(const TrackingAllocator<U, Tag>&) const noexcept { return true; }
+        template<typename U>
+        bool operator!=(const TrackingAllocator<U, Tag>&) const noexcept { return false; }
+    };
+
+    template<typename T, MemoryTag Tag>
+    using TrackedVector = std::vector<T, TrackingAllocator<T, Tag>>;
+
+    template<typename Key, typename Value, MemoryTag Tag, typename Hash = std::hash<Key>>
+    using TrackedUnorderedMap = std::unordered_map<Key, Value, Hash, std::equal_to<Key>,
+                                                   TrackingAllocator<std::pair<const Key, Value>, Tag>>;
+}
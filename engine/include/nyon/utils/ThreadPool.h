@@ -9,6 +9,8 @@
 #include <future>
 #include <atomic>
 #include <cassert>
+#include <string>
+#include <algorithm>
 
 namespace Nyon::Utils {
 
@@ -20,7 +22,35 @@ namespace Nyon::Utils {
  */
 class ThreadPool {
 public:
+    /**
+     * @brief Worker placement options
+     *
+     * Defaults keep workers unpinned and size the pool to one worker per
+     * physical core, so SMT siblings are not oversubscribed.
+     */
+    struct Config
+    {
+        size_t numThreads = 0;                  // 0 = derive from CPU topology
+        bool physicalCoresOnly = true;          // Ignore SMT siblings when deriving the default count
+        bool pinWorkers = false;                // Pin each worker to its own physical core (Linux only)
+        size_t reservedCores = 0;               // Physical cores kept free for main/render threads
+        std::string threadNamePrefix = "nyon-worker"; // Visible in profilers (truncated to 15 chars)
+    };
+
+    /**
+     * @brief Logical CPU layout of the cores this process may run on
+     *
+     * Each entry of physicalCores lists the logical CPU ids (SMT siblings)
+     * sharing one physical core, ordered by package then core id.
+     */
+    struct CpuTopology
+    {
+        std::vector<std::vector<int>> physicalCores;
+        size_t logicalCount = 0;
+    };
+
     explicit ThreadPool(size_t numThreads = 0);
+    explicit ThreadPool(const Config& config);
     ~ThreadPool();
 
     // Non-copyable, non-movable
@@ -35,6 +65,29 @@ public:
     template<typename F, typename... Args>
     auto Submit(F&& f, Args&&... args) -> std::future<typename std::invoke_result<F, Args...>::type>;
 
+    /**
+     * @brief Split [0, count) into contiguous chunks and run them on the pool
+     * @param count Number of elements
+     * @param func Called as func(begin, end) once per chunk
+     * @param grain Elements per chunk (0 = about four chunks per worker)
+     *
+     * The calling thread processes the first chunk itself and blocks until all
+     * chunks are done. Called from a worker thread, every chunk runs inline so
+     * nested parallel loops cannot deadlock the pool.
+     */
+    template<typename Func>
+    void ParallelFor(size_t count, Func&& func, size_t grain = 0);
+
+    /**
+     * @brief Chunk size ParallelFor() uses for a given element count and grain
+     */
+    size_t ResolveGrain(size_t count, size_t grain) const;
+
+    /**
+     * @brief Whether the calling thread is a worker of a ThreadPool
+     */
+    static bool IsWorkerThread() { return tls_IsWorkerThread; }
+
     /**
      * @brief Wait for all tasks to complete
      * 
@@ -48,6 +101,42 @@ public:
      */
     size_t GetThreadCount() const { return m_Workers.size(); }
 
+    /**
+     * @brief Get the configuration the pool was created with
+     */
+    const Config& GetConfig() const { return m_Config; }
+
+    /**
+     * @brief Get the logical CPU each worker is pinned to (-1 = unpinned)
+     */
+    const std::vector<int>& GetWorkerCpus() const { return m_WorkerCpus; }
+
+    /**
+     * @brief Pin the calling thread to one of the reserved cores
+     * @param slot Reserved core index (0 = main thread, 1 = render thread, ...)
+     * @return True if the affinity was applied
+     */
+    bool PinCurrentThreadToReservedCore(size_t slot) const;
+
+    /**
+     * @brief Detect the CPU topology available to this process
+     *
+     * Reads /sys/devices/system/cpu on Linux; elsewhere every logical CPU is
+     * reported as its own physical core.
+     */
+    static CpuTopology DetectTopology();
+
+    /**
+     * @brief Pin the calling thread to a single logical CPU
+     * @return True on success, false if unsupported or rejected by the OS
+     */
+    static bool SetCurrentThreadAffinity(int cpu);
+
+    /**
+     * @brief Name the calling thread for debuggers and profilers
+     */
+    static void SetCurrentThreadName(const std::string& name);
+
     /**
      * @brief Get instance count of pending tasks
      */
@@ -63,14 +152,23 @@ public:
      */
     static void Initialize(size_t numThreads = 0);
 
+    /**
+     * @brief Initialize singleton with explicit worker placement options
+     */
+    static void Initialize(const Config& config);
+
     /**
      * @brief Shutdown singleton
      */
     static void Shutdown();
 
 private:
-    void WorkerThread();
+    void WorkerThread(size_t index);
 
+    Config m_Config;
+    CpuTopology m_Topology;
+    std::vector<int> m_WorkerCpus;
+    std::vector<int> m_ReservedCpus;
     std::vector<std::thread> m_Workers;
     std::queue<std::function<void()>> m_Tasks;
     mutable std::mutex m_QueueMutex;
@@ -108,4 +206,48 @@ auto ThreadPool::Submit(F&& f, Args&&... args) -> std::future<typename std::invo
     return result;
 }
 
+template<typename Func>
+void ThreadPool::ParallelFor(size_t count, Func&& func, size_t grain) {
+    if (count == 0) {
+        return;
+    }
+
+    grain = ResolveGrain(count, grain);
+    const size_t chunkCount = (count + grain - 1) / grain;
+
+    if (chunkCount == 1 || tls_IsWorkerThread) {
+        for (size_t begin = 0; begin < count; begin += grain) {
+            func(begin, std::min(begin + grain, count));
+        }
+        return;
+    }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(chunkCount - 1);
+    for (size_t chunk = 1; chunk < chunkCount; ++chunk) {
+        size_t begin = chunk * grain;
+        size_t end = std::min(begin + grain, count);
+        futures.push_back(Submit([&func, begin, end]() { func(begin, end); }));
+    }
+
+    // The caller takes the first chunk; wait for the rest even if it throws,
+    // since the submitted tasks reference func.
+    try {
+        func(0, std::min(grain, count));
+    } catch (...) {
+        for (auto& future : futures) {
+            future.wait();
+        }
+        throw;
+    }
+
+    // Likewise when a worker chunk throws: get() would rethrow before later chunks finish
+    for (auto& future : futures) {
+        future.wait();
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
 } // namespace Nyon::Utils
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "nyon/utils/FlightRecorder.h"
+#include "nyon/utils/FrameTimingLog.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Nyon::Utils
+{
+    /**
+     * @brief Read-only view of the running world in POSIX shared memory, for external tools
+     *
+     * Once opened, Application publishes one frame per loop iteration: frame timings, the
+     * physics sample ECSApplication also gives the flight recorder, body states from the
+     * transform and physics body pools, and touching contact points. The game writes
+     * straight into the mapping through Frame, so publishing costs the stores themselves
+     * and an inspector process can watch a live game without console logging.
+     *
+     * Segment layout (native structs, so reader and game must share a build; Header
+     * carries the struct sizes and Reader::Attach() rejects a mismatch):
+     *
+     *   0                         Header
+     *   bufferOffset[i]           FrameHeader of buffer i (i = 0, 1)
+     *   bufferOffset[i] + bodiesOffset    BodyState[maxBodies]
+     *   bufferOffset[i] + contactsOffset  ContactRecord[maxContacts]
+     *
+     * Publishing is a seqlock over two buffers. The writer fills the buffer that is not
+     * Header::latest: it makes FrameHeader::sequence odd, writes, makes it even again and
+     * then points latest at it. A reader loads latest, then the sequence (retrying while
+     * odd), copies, and re-checks the sequence; an unchanged even value means the copy
+     * is consistent. The buffer a reader copies is only rewritten two frames later, so
+     * retries are rare. The writer never waits for readers.
+     */
+    class WorldInspector
+    {
+    public:
+        static constexpr uint32_t MAGIC = 0x4957594E;  // "NYWI"
+        static constexpr uint32_t VERSION = 1;
+        static constexpr uint32_t NO_FRAME = 0xFFFFFFFF;
+
+        struct Config
+        {
+            std::string name = "/nyon-inspector";  // shm_open() name; a leading '/' is added if missing
+            uint32_t maxBodies = 8192;             // Body states per frame
+            uint32_t maxContacts = 8192;           // Contact points per frame
+            bool publishBodies = true;
+            bool publishContacts = true;
+        };
+
+        using BodyState = FlightRecorder::BodyState;          // FlightRecorder::FLAG_* bits
+        using PhysicsSample = FlightRecorder::PhysicsSample;
+
+        // One touching contact point
+        struct ContactRecord
+        {
+            uint32_t entityIdA = 0;
+            uint32_t entityIdB = 0;
+            float x = 0.0f, y = 0.0f;
+            float normalX = 0.0f, normalY = 0.0f;  // From A to B
+            float separation = 0.0f;               // Negative = penetration
+            float normalImpulse = 0.0f;
+        };
+
+        struct Header
+        {
+            uint32_t magic = 0;
+            uint32_t version = 0;
+            uint32_t headerSize = 0;
+            uint32_t frameHeaderSize = 0;
+            uint32_t bodySize = 0;
+            uint32_t contactSize = 0;
+            uint32_t maxBodies = 0;
+            uint32_t maxContacts = 0;
+            uint64_t bodiesOffset = 0;             // Within a buffer
+            uint64_t contactsOffset = 0;
+            uint64_t bufferOffset[2] = { 0, 0 };   // Within the segment
+            uint64_t bufferSize = 0;
+            uint64_t totalSize = 0;
+            uint64_t publisherPid = 0;
+            std::atomic<uint32_t> latest{NO_FRAME};  // Buffer holding the newest complete frame
+        };
+
+        struct FrameHeader
+        {
+            std::atomic<uint64_t> sequence{0};     // Odd while the buffer is being written
+            uint64_t frame = 0;
+            double time = 0.0;                     // Application::GetTime()
+            FrameTimingLog::Frame timing;
+            PhysicsSample physics;
+            uint32_t bodyCount = 0;                // Records written
+            uint32_t totalBodies = 0;              // Records offered; more than bodyCount when capped
+            uint32_t contactCount = 0;
+            uint32_t totalContacts = 0;
+        };
+
+        // The frame being written, pointing into shared memory
+        struct Frame
+        {
+            FrameHeader* header = nullptr;
+            BodyState* bodies = nullptr;
+            ContactRecord* contacts = nullptr;
+            uint32_t maxBodies = 0;                // 0 when the section is not published
+            uint32_t maxContacts = 0;
+
+            // Count the record and store it while there is room
+            void AddBody(const BodyState& body)
+            {
+                if (header->bodyCount < maxBodies)
+                    bodies[header->bodyCount++] = body;
+                header->totalBodies++;
+            }
+
+            void AddContact(const ContactRecord& contact)
+            {
+                if (header->contactCount < maxContacts)
+                    contacts[header->contactCount++] = contact;
+                header->totalContacts++;
+            }
+        };
+
+        // A consistent copy of one published frame
+        struct Snapshot
+        {
+            uint64_t frame = 0;
+            double time = 0.0;
+            FrameTimingLog::Frame timing;
+            PhysicsSample physics;
+            uint32_t totalBodies = 0;
+            uint32_t totalContacts = 0;
+            std::vector<BodyState> bodies;
+            std::vector<ContactRecord> contacts;
+            uint32_t attempts = 0;                 // Copies taken before one was consistent
+        };
+
+        WorldInspector() = default;
+        ~WorldInspector();
+        WorldInspector(const WorldInspector&) = delete;
+        WorldInspector& operator=(const WorldInspector&) = delete;
+
+        /**
+         * @brief Create (or replace) the segment and map it
+         * @return false when shared memory is unavailable or the segment cannot be created
+         */
+        bool Open(const Config& config);
+
+        /**
+         * @brief Unmap and unlink the segment; attached readers keep their mapping
+         */
+        void Close();
+
+        bool IsOpen() const { return m_Header != nullptr; }
+        const Config& GetConfig() const { return m_Config; }
+        uint64_t GetPublishedFrames() const { return m_Published; }
+
+        /**
+         * @brief Start writing the back buffer; readers keep seeing the previous frame
+         */
+        Frame BeginFrame(uint64_t frame, double time);
+
+        /**
+         * @brief Finish the frame from BeginFrame() and make it the latest
+         */
+        void EndFrame();
+
+        /**
+         * @brief Read side, usable from any process
+         */
+        class Reader
+        {
+        public:
+            Reader() = default;
+            ~Reader();
+            Reader(const Reader&) = delete;
+            Reader& operator=(const Reader&) = delete;
+
+            /**
+             * @brief Map an existing segment read-only
+             * @return false when it is missing or was written by a build with a different layout
+             */
+            bool Attach(const std::string& name);
+            void Detach();
+            bool IsAttached() const { return m_Header != nullptr; }
+            const Header* GetHeader() const { return m_Header; }
+
+            /**
+             * @brief Copy the newest complete frame
+             * @return false before the first frame, or when the writer lapped every attempt
+             */
+            bool ReadLatest(Snapshot& snapshot, uint32_t maxAttempts = 16) const;
+
+        private:
+            const Header* m_Header = nullptr;
+            size_t m_Size = 0;
+        };
+
+        /**
+         * @brief Write the frame's timings and counters, a body summary and a contact summary
+         */
+        static void PrintSnapshot(const Snapshot& snapshot, std::ostream& out);
+
+    private:
+        Config m_Config;
+        Header* m_Header = nullptr;
+        size_t m_Size = 0;
+        uint32_t m_Writing = NO_FRAME;   // Buffer between BeginFrame() and EndFrame()
+        uint64_t m_Published = 0;
+    };
+}
@@ -1,7 +1,14 @@
 #include "nyon/core/Application.h"
 #include "nyon/graphics/Renderer2D.h"
 #include "nyon/utils/InputManager.h"
+#include "nyon/utils/MemoryTracker.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
 #include <iostream>
+#include <thread>
 
 // Debug logging macro - only output in debug builds
 #ifdef _DEBUG
@@ -14,14 +21,81 @@ namespace Nyon
 {
     Application* Application::s_Instance = nullptr;
 
-    Application::Application(const char* title, int width, int height)
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        double ElapsedMs(Clock::time_point start, Clock::time_point end)
+        {
+            return std::chrono::duration<double, std::milli>(end - start).count();
+        }
+
+        // Process CPU time over all threads (worker pool included)
+        double CpuMs(std::clock_t start, std::clock_t end)
+        {
+            return 1000.0 * static_cast<double>(end - start) / CLOCKS_PER_SEC;
+        }
+    }
+
+    LaunchOptions LaunchOptions::Parse(int argc, char** argv)
+    {
+        LaunchOptions options;
+        for (int i = 1; i < argc; ++i)
+        {
+            const char* arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (std::strcmp(arg, "--headless") == 0)
+                options.headless = true;
+            else if (std::strcmp(arg, "--bot") == 0)
+                options.bot = true;
+            else if (std::strcmp(arg, "--frames") == 0 && hasValue)
+                options.maxFrames = std::strtoull(argv[++i], nullptr, 10);
+            else if (std::strcmp(arg, "--scale") == 0 && hasValue)
+                options.scale = std::max(0.01f, static_cast<float>(std::atof(argv[++i])));
+            else if (std::strcmp(arg, "--timing") == 0 && hasValue)
+                options.timingPath = argv[++i];
+            else if (std::strcmp(arg, "--seed") == 0 && hasValue)
+                options.seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            else if (std::strcmp(arg, "--fps") == 0 && hasValue)
+                options.targetFps = std::max(0.0, std::atof(argv[++i]));
+            else if (std::strcmp(arg, "--spike-ms") == 0 && hasValue)
+                options.spikeMs = std::max(0.0, std::atof(argv[++i]));
+            else if (std::strcmp(arg, "--spike-dir") == 0 && hasValue)
+                options.spikeDir = argv[++i];
+            else if (std::strcmp(arg, "--inspect") == 0 && hasValue)
+                options.inspectName = argv[++i];
+            else
+                std::cerr << "Ignoring unknown argument: " << arg << std::endl;
+        }
+        return options;
+    }
+
+    Application::Application(const char* title, int width, int height, const LaunchOptions& options)
         : m_Window(nullptr), m_Running(true), m_LastFrameTime(0.0f), 
-          m_Title(title), m_Width(width), m_Height(height)
+          m_Title(title), m_Width(width), m_Height(height), m_Options(options)
     {
 #ifdef _DEBUG
         std::cerr << "[DEBUG] Application constructor called" << std::endl;
 #endif
         s_Instance = this;
+        m_RecordTiming = m_Options.headless || !m_Options.timingPath.empty();
+
+        Utils::FlightRecorder::Config recorderConfig;
+        recorderConfig.spikeThresholdMs = m_Options.spikeMs;
+        recorderConfig.directory = m_Options.spikeDir;
+        m_FlightRecorder.SetConfig(recorderConfig);
+
+        if (!m_Options.inspectName.empty())
+        {
+            Utils::WorldInspector::Config inspectorConfig;
+            inspectorConfig.name = m_Options.inspectName;
+            if (m_WorldInspector.Open(inspectorConfig))
+                std::cout << "[INSPECT] Publishing frames to shared memory " << m_WorldInspector.GetConfig().name << std::endl;
+            else
+                std::cerr << "Failed to open shared memory " << m_Options.inspectName << " for the world inspector" << std::endl;
+        }
+        if (m_Options.headless)
+            return;  // No window, GL context or renderer
         Init();
     }
 
@@ -31,6 +105,9 @@ namespace Nyon
         std::cerr << "[DEBUG] Application destructor called" << std::endl;
 #endif
         
+        if (m_Options.headless)
+            return;
+
         // Shutdown Renderer2D
         Graphics::Renderer2D::Shutdown();
         
@@ -38,6 +115,22 @@ namespace Nyon
         glfwTerminate();
     }
 
+    void Application::GetWindowSize(int& width, int& height) const
+    {
+        if (m_Window != nullptr)
+        {
+            glfwGetWindowSize(m_Window, &width, &height);
+            return;
+        }
+        width = m_Width;
+        height = m_Height;
+    }
+
+    double Application::GetTime() const
+    {
+        return m_Options.headless ? m_SimulatedTime : glfwGetTime();
+    }
+
     void Application::Init()
     {
 #ifdef _DEBUG
@@ -93,6 +186,12 @@ namespace Nyon
         
         // Call OnStart once before the main loop
         OnStart();
+
+        if (m_Options.headless)
+        {
+            RunHeadless();
+            return;
+        }
         
         m_CurrentTime = glfwGetTime();
         m_Accumulator = 0.0;
@@ -100,8 +199,23 @@ namespace Nyon
         std::cerr << "[DEBUG] Initial current time: " << m_CurrentTime << std::endl;
 #endif
 
+        uint64_t frameCount = 0;
         while (!glfwWindowShouldClose(m_Window) && m_Running)
         {
+            if (m_Options.maxFrames > 0 && frameCount >= m_Options.maxFrames)
+                break;
+
+            Utils::FrameTimingLog::Frame timing;
+            auto frameStart = Clock::now();
+            std::clock_t cpuStart = std::clock();
+
+            // --- INPUT PROCESSING ---
+            // Callbacks only queue timestamped events; each fixed step below applies the
+            // ones it covers. Polling before reading the clock keeps every queued event
+            // at or before newTime.
+            glfwPollEvents();
+            ProcessInput();
+
             double newTime = glfwGetTime();
             double frameTime = newTime - m_CurrentTime;
             m_CurrentTime = newTime;
@@ -112,26 +226,27 @@ namespace Nyon
 
             m_Accumulator += frameTime;
 
-            // --- INPUT PROCESSING ---
-            // Save previous input state first, then poll GLFW events to get current state.
-            // This ensures IsKeyPressed/IsMousePressed detect transitions correctly.
-            Utils::InputManager::Update();
-            glfwPollEvents();
-            ProcessInput();
-
             // --- PHYSICS UPDATE LOOP ---
-            // Consumes time from the accumulator in fixed chunks
+            // Consumes time from the accumulator in fixed chunks. The simulation trails
+            // the wall clock by the accumulator, so each step ends at newTime - remaining.
+            auto fixedStart = Clock::now();
             while (m_Accumulator >= Nyon::FIXED_TIMESTEP_D)
             {
+                double stepEndTime = m_CurrentTime - (m_Accumulator - Nyon::FIXED_TIMESTEP_D);
+                Utils::InputManager::BeginFixedStep(stepEndTime, glfwGetTime());
                 OnFixedUpdate(static_cast<float>(Nyon::FIXED_TIMESTEP_D));
                 
                 // Advance simulation time
                 m_Accumulator -= Nyon::FIXED_TIMESTEP_D;
+                m_SimulatedTime += Nyon::FIXED_TIMESTEP_D;
+                timing.fixedSteps++;
             }
+            auto updateStart = Clock::now();
 
             // --- PER-FRAME UPDATE ---
             // Called once per frame after all physics ticks have been processed
             OnUpdate(static_cast<float>(frameTime));
+            auto renderStart = Clock::now();
 
             // --- RENDER ---
             // Calculate 'alpha': how far are we into the *next* physics frame?
@@ -141,12 +256,144 @@ namespace Nyon
             OnInterpolateAndRender(static_cast<float>(alpha));
 
             glfwSwapBuffers(m_Window);
+
+            Utils::InputManager::LatencySample input = Utils::InputManager::TakeLatencySample();
+
+            // --- PACING ---
+            auto waitStart = Clock::now();
+            timing.waitMs = WaitForNextFrame();
+
+            // Timings always feed the flight recorder; the log keeps them only on request
+            if (input.events > 0)
+            {
+                timing.inputEvents = input.events;
+                timing.inputToSimMs = input.maxToSimMs;
+                timing.inputToPresentMs = (glfwGetTime() - input.oldestTimestamp) * 1000.0;
+            }
+            auto frameEnd = Clock::now();
+            timing.fixedMs = ElapsedMs(fixedStart, updateStart);
+            timing.updateMs = ElapsedMs(updateStart, renderStart);
+            timing.renderMs = ElapsedMs(renderStart, waitStart);
+            timing.frameMs = ElapsedMs(frameStart, frameEnd);
+            timing.cpuMs = CpuMs(cpuStart, std::clock());
+            if (m_RecordTiming)
+                m_FrameTimings.Record(timing);
+            PublishInspectorFrame(frameCount, timing);
+            RecordFlightFrame(frameCount++, timing);
         }
+        FinishTiming();
 #ifdef _DEBUG
         std::cerr << "[DEBUG] Application::Run() ended" << std::endl;
 #endif
     }
 
+    void Application::RunHeadless()
+    {
+        // Headless frames are not paced: each runs exactly one fixed step, so the
+        // simulation is independent of how long the frame took to compute
+        if (m_Options.maxFrames > 0)
+            m_FrameTimings.Reserve(static_cast<size_t>(m_Options.maxFrames));
+
+        uint64_t frameCount = 0;
+        while (m_Running && (m_Options.maxFrames == 0 || frameCount < m_Options.maxFrames))
+        {
+            Utils::FrameTimingLog::Frame timing;
+            auto frameStart = Clock::now();
+            std::clock_t cpuStart = std::clock();
+
+            Utils::InputManager::Update();
+
+            OnFixedUpdate(Nyon::FIXED_TIMESTEP);
+            m_SimulatedTime += Nyon::FIXED_TIMESTEP_D;
+            timing.fixedSteps = 1;
+            auto updateStart = Clock::now();
+
+            OnUpdate(Nyon::FIXED_TIMESTEP);
+            auto frameEnd = Clock::now();
+
+            timing.fixedMs = ElapsedMs(frameStart, updateStart);
+            timing.updateMs = ElapsedMs(updateStart, frameEnd);
+            timing.frameMs = ElapsedMs(frameStart, frameEnd);
+            timing.cpuMs = CpuMs(cpuStart, std::clock());
+            m_FrameTimings.Record(timing);
+            PublishInspectorFrame(frameCount, timing);
+            RecordFlightFrame(frameCount++, timing);
+        }
+        FinishTiming();
+    }
+
+    double Application::WaitForNextFrame()
+    {
+        if (m_Options.targetFps <= 0.0)
+            return 0.0;
+
+        // Sleep coarsely, then spin the last stretch: OS sleeps overshoot by up to a
+        // millisecond or more, which would show up as frame time jitter
+        constexpr double SPIN_MARGIN = 0.002;
+        double budget = 1.0 / m_Options.targetFps;
+        double start = glfwGetTime();
+
+        m_NextFrameDeadline += budget;
+        if (m_NextFrameDeadline < start || m_NextFrameDeadline > start + budget)
+            m_NextFrameDeadline = start + budget;  // Missed the deadline or first frame: don't try to catch up
+
+        double remaining = m_NextFrameDeadline - start;
+        if (remaining > SPIN_MARGIN)
+            std::this_thread::sleep_for(std::chrono::duration<double>(remaining - SPIN_MARGIN));
+        while (glfwGetTime() < m_NextFrameDeadline)
+            std::this_thread::yield();
+
+        return (glfwGetTime() - start) * 1000.0;
+    }
+
+    void Application::RecordFlightFrame(uint64_t frame, const Utils::FrameTimingLog::Frame& timing)
+    {
+        if (!m_FlightRecorder.IsEnabled())
+            return;
+
+        Utils::FlightRecorder::FrameRecord record;
+        record.frame = frame;
+        record.time = GetTime();
+        record.timing = timing;
+
+        uint64_t allocations = 0;
+        for (size_t tag = 0; tag < static_cast<size_t>(Utils::MemoryTag::COUNT); ++tag)
+            allocations += Utils::MemoryTracker::GetStats(static_cast<Utils::MemoryTag>(tag)).allocations;
+        record.allocations = allocations - m_LastAllocationCount;
+        record.trackedBytes = Utils::MemoryTracker::GetTotalCurrentBytes();
+        m_LastAllocationCount = allocations;
+
+        OnRecordFlightFrame(record);
+        m_FlightRecorder.Record(record);
+    }
+
+    void Application::PublishInspectorFrame(uint64_t frame, const Utils::FrameTimingLog::Frame& timing)
+    {
+        if (!m_WorldInspector.IsOpen())
+            return;
+
+        Utils::WorldInspector::Frame published = m_WorldInspector.BeginFrame(frame, GetTime());
+        published.header->timing = timing;
+        OnPublishInspectorFrame(published);
+        m_WorldInspector.EndFrame();
+    }
+
+    void Application::FinishTiming()
+    {
+        m_FlightRecorder.Flush();
+        if (!m_RecordTiming)
+            return;
+
+        m_FrameTimings.PrintSummary(std::cout, m_Title);
+        if (!m_Options.timingPath.empty())
+        {
+            if (m_FrameTimings.WriteCsv(m_Options.timingPath))
+                std::cout << "[TIMING] Wrote " << m_Options.timingPath << std::endl;
+            else
+                std::cerr << "Failed to write frame timings to " << m_Options.timingPath << std::endl;
+        }
+    }
+
     void Application::ProcessInput()
     {
         if (m_Window != nullptr && glfwGetKey(m_Window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
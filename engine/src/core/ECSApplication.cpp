@@ -2,10 +2,14 @@
 #include "nyon/ecs/systems/InputSystem.h"
 #include "nyon/ecs/systems/RenderSystem.h"
 #include "nyon/ecs/systems/PhysicsPipelineSystem.h"
+#include "nyon/ecs/systems/CharacterControllerSystem.h"
+#include "nyon/ecs/systems/FractureSystem.h"
 #include "nyon/ecs/systems/DebugRenderSystem.h"
 #include "nyon/ecs/systems/ParticleRenderSystem.h"
 #include "nyon/ecs/systems/CameraSystem.h"
+#include "nyon/ecs/systems/ParticlePipelineSystem.h"
 #include "nyon/utils/InputManager.h"
+#include "nyon/utils/MemoryTracker.h"
 #include <glm/gtc/matrix_transform.hpp>
 #include <iostream>
 
@@ -18,8 +22,28 @@
 
 namespace Nyon
 {
-    ECSApplication::ECSApplication(const char* title, int width, int height)
-        : Application(title, width, height)
+    namespace
+    {
+        Utils::FlightRecorder::BodyState MakeBodyState(ECS::EntityID entity, const ECS::PhysicsBodyComponent& body,
+                                                       const ECS::TransformComponent& transform)
+        {
+            using Recorder = Utils::FlightRecorder;
+            Recorder::BodyState state;
+            state.entityId = entity;
+            state.flags = (body.isStatic ? Recorder::FLAG_STATIC : 0u) | (body.isAwake ? Recorder::FLAG_AWAKE : 0u) |
+                          (body.isEnabled ? 0u : Recorder::FLAG_DISABLED);
+            state.x = transform.position.x;
+            state.y = transform.position.y;
+            state.rotation = transform.rotation;
+            state.vx = body.velocity.x;
+            state.vy = body.velocity.y;
+            state.angularVelocity = body.angularVelocity;
+            return state;
+        }
+    }
+
+    ECSApplication::ECSApplication(const char* title, int width, int height, const LaunchOptions& options)
+        : Application(title, width, height, options)
         , m_ComponentStore(m_EntityManager)
         , m_SystemManager(m_EntityManager, m_ComponentStore)
         , m_ECSInitialized(false)
@@ -48,6 +72,22 @@ namespace Nyon
         m_SystemManager.AddSystem(std::make_unique<ECS::InputSystem>());
         m_SystemManager.AddSystem(std::make_unique<ECS::CameraSystem>());  // Unified camera management
         m_SystemManager.AddSystem(std::make_unique<ECS::PhysicsPipelineSystem>());
+        // Kinematic characters move after the physics step, against its broad phase
+        m_SystemManager.AddSystem(std::make_unique<ECS::CharacterControllerSystem>());
+        m_SystemManager.GetSystem<ECS::CharacterControllerSystem>()->SetPhysicsSystem(
+            m_SystemManager.GetSystem<ECS::PhysicsPipelineSystem>());
+        m_SystemManager.AddSystem(std::make_unique<ECS::FractureSystem>());
+        m_SystemManager.GetSystem<ECS::FractureSystem>()->SetPhysicsSystem(
+            m_SystemManager.GetSystem<ECS::PhysicsPipelineSystem>());
+        
+        // Paced runs also skip physics steps while the whole world sleeps
+        if (GetLaunchOptions().targetFps > 0.0)
+        {
+            auto* physicsSystem = m_SystemManager.GetSystem<ECS::PhysicsPipelineSystem>();
+            auto config = physicsSystem->GetConfig();
+            config.idleSkipping = true;
+            physicsSystem->SetConfig(config);
+        }
         // RenderSystem is NOT added to SystemManager - it's called separately during interpolation
         // Debug renderer has been completely disabled per user request
 
@@ -81,23 +121,152 @@ namespace Nyon
                 std::cerr << "[DEBUG] Debug overlay " << (m_DebugOverlayEnabled ? "enabled" : "disabled") << "\n";
             }
             f1PrevState = f1CurrState;
-            
+
+            // F2 toggles the periodic memory report
+            static bool f2PrevState = false;
+            bool f2CurrState = Nyon::Utils::InputManager::IsKeyDown(GLFW_KEY_F2);
+            if (f2CurrState && !f2PrevState) {
+                SetMemoryReportInterval(m_MemoryReportInterval > 0.0f ? 0.0f : 5.0f);
+                std::cerr << "[DEBUG] Memory report " << (m_MemoryReportInterval > 0.0f ? "enabled" : "disabled") << "\n";
+            }
+            f2PrevState = f2CurrState;
+
+            // Simulation LOD measures island distances from the active camera
+            auto* physicsSystem = m_SystemManager.GetSystem<ECS::PhysicsPipelineSystem>();
+            auto* cameraSystem = m_SystemManager.GetSystem<ECS::CameraSystem>();
+            if (physicsSystem && cameraSystem)
+            {
+                if (const auto* activeCamera = cameraSystem->GetActiveCamera())
+                    physicsSystem->SetLODFocus(activeCamera->camera.position);
+            }
+
+            // Game logic reacting to new input may edit sleeping bodies directly
+            uint64_t inputSerial = Utils::InputManager::GetInputSerial();
+            if (physicsSystem && inputSerial != m_LastInputSerial)
+            {
+                physicsSystem->RequestStep();
+                m_LastInputSerial = inputSerial;
+            }
+
             // Update only non-render ECS systems (physics, input, etc.)
             // DebugRenderSystem::Update() is called during OnInterpolateAndRender so that it draws
             // after RenderSystem::BeginScene, ensuring its shapes are not wiped by camera setup.
             NYON_DEBUG_LOG("[DEBUG] Calling SystemManager.Update() - should update PhysicsPipelineSystem");
             m_SystemManager.Update(deltaTime);
+            if (physicsSystem)
+            {
+                const auto& stats = physicsSystem->GetStatistics();
+                const auto& phases = stats.phaseTimes;
+                m_FramePhysics.updateMs += stats.updateTime;
+                m_FramePhysics.broadPhaseMs += phases.broadPhase;
+                m_FramePhysics.narrowPhaseMs += phases.narrowPhase;
+                m_FramePhysics.islandMs += phases.islands;
+                m_FramePhysics.constraintMs += phases.constraints;
+                m_FramePhysics.velocityMs += phases.velocitySolve;
+                m_FramePhysics.positionMs += phases.positionSolve;
+                m_FramePhysics.finalizeMs += phases.finalize;
+                m_FramePhysics.steps++;
+                m_FramePhysics.subSteps += static_cast<uint32_t>(stats.subSteps);
+                m_FramePhysics.pairs = static_cast<uint32_t>(stats.broadPhasePairs);
+                m_FramePhysics.contacts = static_cast<uint32_t>(stats.narrowPhaseContacts);
+                m_FramePhysics.constraints = static_cast<uint32_t>(stats.activeConstraints);
+                m_FramePhysics.islands = static_cast<uint32_t>(stats.islandStats.totalIslands);
+                m_FramePhysics.awakeBodies = static_cast<uint32_t>(stats.awakeBodies);
+                m_FramePhysics.sleepingBodies = static_cast<uint32_t>(stats.sleepingBodies);
+            }
             
             // Call game-specific fixed-step physics logic
             OnECSFixedUpdate(deltaTime);
             
             // Call game-specific ECS update (user logic after physics)
             OnECSUpdate(deltaTime);
+
+            if (m_MemoryReportInterval > 0.0f)
+            {
+                m_MemoryReportTimer += deltaTime;
+                if (m_MemoryReportTimer >= m_MemoryReportInterval)
+                {
+                    m_MemoryReportTimer = 0.0f;
+                    ReportMemory(std::cerr);
+                }
+            }
         }
         
         NYON_DEBUG_LOG("[DEBUG] ECSApplication::OnFixedUpdate() completed");
     }
     
+    void ECSApplication::ReportMemory(std::ostream& out) const
+    {
+        Utils::MemoryTracker::Sample();
+        Utils::MemoryTracker::Report(out);
+        m_ComponentStore.ReportPoolMemory(out);
+    }
+    
+    void ECSApplication::OnRecordFlightFrame(Utils::FlightRecorder::FrameRecord& record)
+    {
+        record.physics = m_FramePhysics;
+        m_FramePhysics = Utils::FlightRecorder::PhysicsSample();
+        if (const auto* particles = m_SystemManager.GetSystem<ECS::ParticlePipelineSystem>())
+            record.physics.particles = static_cast<uint32_t>(particles->GetActiveParticles().size());
+
+        auto& recorder = GetFlightRecorder();
+        if (!m_ECSInitialized || !recorder.WantsSnapshot(record.frame))
+            return;
+
+        auto& snapshot = recorder.BeginSnapshot(record.frame,
+            static_cast<uint32_t>(m_ComponentStore.GetComponentCount<ECS::PhysicsBodyComponent>()));
+        size_t maxBodies = recorder.GetConfig().maxSnapshotBodies;
+        m_ComponentStore.ForEachComponent<ECS::PhysicsBodyComponent>([&](ECS::EntityID entity, const ECS::PhysicsBodyComponent& body) {
+            if (snapshot.bodies.size() >= maxBodies || !m_ComponentStore.HasComponent<ECS::TransformComponent>(entity))
+                return;
+            snapshot.bodies.push_back(MakeBodyState(entity, body, m_ComponentStore.GetComponent<ECS::TransformComponent>(entity)));
+        });
+    }
+    
+    void ECSApplication::OnPublishInspectorFrame(Utils::WorldInspector::Frame& frame)
+    {
+        // Runs before OnRecordFlightFrame() takes and resets the frame's physics sample
+        frame.header->physics = m_FramePhysics;
+        if (const auto* particles = m_SystemManager.GetSystem<ECS::ParticlePipelineSystem>())
+            frame.header->physics.particles = static_cast<uint32_t>(particles->GetActiveParticles().size());
+        if (!m_ECSInitialized)
+            return;
+
+        // Bodies and contact points are written straight into the shared buffer
+        if (frame.maxBodies > 0)
+        {
+            m_ComponentStore.ForEachComponent<ECS::PhysicsBodyComponent>([&](ECS::EntityID entity, const ECS::PhysicsBodyComponent& body) {
+                if (m_ComponentStore.HasComponent<ECS::TransformComponent>(entity))
+                    frame.AddBody(MakeBodyState(entity, body, m_ComponentStore.GetComponent<ECS::TransformComponent>(entity)));
+            });
+        }
+        if (frame.maxContacts > 0)
+        {
+            const auto& worlds = m_ComponentStore.GetEntitiesWithComponent<ECS::PhysicsWorldComponent>();
+            if (worlds.empty())
+                return;
+            const auto& world = m_ComponentStore.GetComponent<ECS::PhysicsWorldComponent>(worlds[0]);
+            for (const auto& manifold : world.contactManifolds)
+            {
+                if (!manifold.touching)
+                    continue;
+                for (const auto& point : manifold.points)
+                {
+                    Utils::WorldInspector::ContactRecord contact;
+                    contact.entityIdA = manifold.entityIdA;
+                    contact.entityIdB = manifold.entityIdB;
+                    contact.x = point.position.x;
+                    contact.y = point.position.y;
+                    contact.normalX = manifold.normal.x;
+                    contact.normalY = manifold.normal.y;
+                    contact.separation = point.separation;
+                    contact.normalImpulse = point.normalImpulse;
+                    frame.AddContact(contact);
+                }
+            }
+        }
+    }
+    
     void ECSApplication::OnInterpolateAndRender(float alpha)
     {
         if (m_ECSInitialized && m_RenderSystem)
@@ -1,4 +1,5 @@
 #include "nyon/ecs/ComponentStore.h"
+#include <iomanip>
 
 namespace Nyon::ECS
 {
@@ -14,4 +15,32 @@ namespace Nyon::ECS
             pair.second->RemoveComponent(entity);
         }
     }
+    
+    std::vector<PoolMemoryStats> ComponentStore::GetPoolMemoryStats() const
+    {
+        std::vector<PoolMemoryStats> pools;
+        pools.reserve(m_Containers.size());
+        for (const auto& pair : m_Containers)
+        {
+            pools.push_back(pair.second->GetMemoryStats());
+        }
+        std::sort(pools.begin(), pools.end(), [](const PoolMemoryStats& a, const PoolMemoryStats& b) {
+            return a.reservedBytes > b.reservedBytes;
+        });
+        return pools;
+    }
+    
+    void ComponentStore::ReportPoolMemory(std::ostream& out) const
+    {
+        std::ios_base::fmtflags flags = out.flags();
+        out << std::fixed << std::setprecision(1);
+        for (const auto& pool : GetPoolMemoryStats())
+        {
+            bool bloated = pool.capacity > 64 && pool.count * 2 < pool.capacity;
+            out << "[MEMORY] pool " << pool.typeName << ": " << pool.count << "/" << pool.capacity
+                << " x " << pool.componentSize << " B, " << (pool.usedBytes / 1024.0) << "/"
+                << (pool.reservedBytes / 1024.0) << " KiB" << (bloated ? " (under half used)" : "") << "\n";
+        }
+        out.flags(flags);
+    }
 }
\ No newline at end of file
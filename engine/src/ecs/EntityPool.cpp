@@ -0,0 +1,114 @@
+#include "nyon/ecs/EntityPool.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/components/PhysicsBodyComponent.h"
+#include "nyon/ecs/components/RenderComponent.h"
+#include <algorithm>
+#include <iomanip>
+
+namespace Nyon::ECS
+{
+    EntityPool::EntityPool(EntityManager& entityManager, ComponentStore& componentStore, std::string name)
+        : m_EntityManager(entityManager), m_ComponentStore(componentStore), m_Name(std::move(name))
+    {
+    }
+
+    EntityID EntityPool::Acquire(const Factory& factory)
+    {
+        // Skip entities destroyed behind the pool's back
+        while (!m_Available.empty())
+        {
+            EntityID entity = m_Available.back();
+            m_Available.pop_back();
+            m_Pooled.erase(entity);
+            if (!m_EntityManager.IsEntityValid(entity))
+                continue;
+
+            SetEntityEnabled(m_ComponentStore, entity, true);
+            ++m_Stats.hits;
+            m_Stats.available = m_Available.size();
+            return entity;
+        }
+
+        EntityID entity = m_EntityManager.CreateEntity();
+        factory(entity);
+        ++m_Stats.misses;
+        m_Stats.available = 0;
+        return entity;
+    }
+
+    void EntityPool::Release(EntityID entity)
+    {
+        if (!m_EntityManager.IsEntityValid(entity) || !m_Pooled.insert(entity).second)
+            return;
+
+        SetEntityEnabled(m_ComponentStore, entity, false);
+        m_Available.push_back(entity);
+        ++m_Stats.releases;
+        m_Stats.available = m_Available.size();
+        m_Stats.peakAvailable = std::max(m_Stats.peakAvailable, m_Stats.available);
+    }
+
+    void EntityPool::Prewarm(size_t count, const Factory& factory)
+    {
+        m_Available.reserve(m_Available.size() + count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            EntityID entity = m_EntityManager.CreateEntity();
+            factory(entity);
+            SetEntityEnabled(m_ComponentStore, entity, false);
+            m_Pooled.insert(entity);
+            m_Available.push_back(entity);
+        }
+        m_Stats.available = m_Available.size();
+        m_Stats.peakAvailable = std::max(m_Stats.peakAvailable, m_Stats.available);
+    }
+
+    void EntityPool::Clear()
+    {
+        for (EntityID entity : m_Available)
+        {
+            m_EntityManager.DestroyEntity(entity, m_ComponentStore);
+        }
+        m_Available.clear();
+        m_Pooled.clear();
+        m_Stats.available = 0;
+    }
+
+    void EntityPool::ResetStats()
+    {
+        m_Stats = Stats();
+        m_Stats.available = m_Available.size();
+        m_Stats.peakAvailable = m_Stats.available;
+    }
+
+    void EntityPool::Report(std::ostream& out) const
+    {
+        uint64_t acquires = m_Stats.hits + m_Stats.misses;
+        double hitRate = acquires > 0 ? 100.0 * static_cast<double>(m_Stats.hits) / static_cast<double>(acquires) : 0.0;
+
+        std::ios_base::fmtflags flags = out.flags();
+        out << std::fixed << std::setprecision(1);
+        out << "[POOL] " << m_Name << ": " << m_Stats.hits << " hits, " << m_Stats.misses << " misses ("
+            << hitRate << "% hit rate), " << m_Stats.releases << " releases, "
+            << m_Stats.available << " available (peak " << m_Stats.peakAvailable << ")\n";
+        out.flags(flags);
+    }
+
+    void EntityPool::SetEntityEnabled(ComponentStore& componentStore, EntityID entity, bool enabled)
+    {
+        if (componentStore.HasComponent<PhysicsBodyComponent>(entity))
+        {
+            auto& body = componentStore.GetComponent<PhysicsBodyComponent>(entity);
+            body.isEnabled = enabled;
+            body.velocity = {0.0f, 0.0f};
+            body.angularVelocity = 0.0f;
+            body.ClearForces();
+            body.SetAwake(true);
+        }
+
+        if (componentStore.HasComponent<RenderComponent>(entity))
+        {
+            componentStore.GetComponent<RenderComponent>(entity).visible = enabled;
+        }
+    }
+}
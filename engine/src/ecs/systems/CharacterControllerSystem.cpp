@@ -0,0 +1,351 @@
+#include "nyon/ecs/systems/CharacterControllerSystem.h"
+#include "nyon/ecs/systems/PhysicsPipelineSystem.h"
+#include "nyon/ecs/components/ColliderComponent.h"
+#include "nyon/ecs/components/PhysicsWorldComponent.h"
+#include "nyon/utils/ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace Nyon::ECS
+{
+    namespace
+    {
+        bool ContainsAABB(const Physics::AABB& outer, const Physics::AABB& inner)
+        {
+            return outer.Contains(inner.lowerBound) && outer.Contains(inner.upperBound);
+        }
+
+        Physics::AABB Inflate(const Physics::AABB& aabb, float margin)
+        {
+            return {aabb.lowerBound - Math::Vector2{margin, margin}, aabb.upperBound + Math::Vector2{margin, margin}};
+        }
+    }
+
+    void CharacterControllerSystem::Update(float deltaTime)
+    {
+        auto startTime = std::chrono::high_resolution_clock::now();
+        m_Stats = Statistics();
+        if (!m_Physics || !m_ComponentStore)
+            return;
+
+        m_Characters.clear();
+        m_ComponentStore->ForEachComponent<CharacterControllerComponent>([&](EntityID entityId, CharacterControllerComponent& controller) {
+                if (!m_ComponentStore->HasComponent<TransformComponent>(entityId))
+                    return;
+                m_Characters.push_back({entityId, &controller, &m_ComponentStore->GetComponent<TransformComponent>(entityId),
+                                        &m_Caches[entityId], 0, false});
+        });
+        if (m_Characters.empty())
+        {
+            m_Caches.clear();
+            return;
+        }
+
+        // Caches of removed characters; erasing them leaves the pointers above valid
+        if (m_Caches.size() > m_Characters.size())
+        {
+            for (auto it = m_Caches.begin(); it != m_Caches.end();)
+            {
+                if (m_ComponentStore->HasComponent<CharacterControllerComponent>(it->first))
+                    ++it;
+                else
+                    it = m_Caches.erase(it);
+            }
+        }
+
+        // Bring the proxies up to the transforms the last step produced. The change list
+        // covers the steps since the previous update only if at most one step ran.
+        m_Physics->SyncBroadPhase();
+        uint64_t serial = m_Physics->GetBroadPhaseSerial();
+        m_InvalidateAll = serial > m_LastBroadPhaseSerial + 1;
+        m_LastBroadPhaseSerial = serial;
+
+        m_Gravity = {0.0f, 0.0f};
+        m_ComponentStore->ForEachComponent<PhysicsWorldComponent>([&](EntityID, const PhysicsWorldComponent& world) {
+                m_Gravity = world.gravity;
+        });
+        m_Up = m_Gravity.LengthSquared() > 1e-6f ? -m_Gravity.Normalize() : Math::Vector2{0.0f, 1.0f};
+
+        auto work = [this, deltaTime](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
+            {
+                MoveCharacter(m_Characters[i], deltaTime);
+            }
+        };
+        if (m_Config.multiThreading)
+            Utils::ThreadPool::Instance().ParallelFor(m_Characters.size(), work);
+        else
+            work(0, m_Characters.size());
+
+        m_Stats.characters = m_Characters.size();
+        for (const Character& character : m_Characters)
+        {
+            m_Stats.groundedCharacters += character.controller->isGrounded ? 1 : 0;
+            m_Stats.cacheRefreshes += character.refreshed ? 1 : 0;
+            m_Stats.shapeCasts += character.shapeCasts;
+        }
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        m_Stats.updateTime = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    }
+
+    void CharacterControllerSystem::InvalidateQueryCaches()
+    {
+        for (auto& [entityId, cache] : m_Caches)
+        {
+            cache.valid = false;
+        }
+    }
+
+    void CharacterControllerSystem::MoveCharacter(Character& character, float dt)
+    {
+        auto& controller = *character.controller;
+        auto& transform = *character.transform;
+        const Math::Vector2 right = {m_Up.y, -m_Up.x};
+
+        Math::Vector2 position = transform.position;
+        transform.previousPosition = position;
+        Math::Vector2 velocity = controller.velocity;
+        const bool wasGrounded = controller.isGrounded;
+        controller.hitWall = false;
+        controller.hitCeiling = false;
+
+        // On walkable ground without a jump, walk along the surface; otherwise fall
+        bool rising;
+        if (wasGrounded && Math::Vector2::Dot(velocity, m_Up) <= 0.0f)
+        {
+            Math::Vector2 tangent = {controller.groundNormal.y, -controller.groundNormal.x};
+            velocity = tangent * Math::Vector2::Dot(velocity, right);
+            rising = false;
+        }
+        else
+        {
+            velocity += m_Gravity * (controller.gravityScale * dt);
+            rising = Math::Vector2::Dot(velocity, m_Up) > 0.0f;
+        }
+        Math::Vector2 move = velocity * dt;
+
+        // Everything this step can touch: the swept circle plus step-up and ground probe room
+        Physics::AABB region(position, position);
+        region.Combine(position + move);
+        region = Inflate(region, controller.radius + controller.skinWidth +
+                                 std::max(controller.stepHeight, controller.groundSnapDistance));
+
+        QueryCache& cache = *character.cache;
+        if (cache.valid)
+        {
+            if (m_InvalidateAll || !ContainsAABB(cache.bounds, region))
+            {
+                cache.valid = false;
+            }
+            else
+            {
+                for (const Physics::AABB& change : m_Physics->GetBroadPhaseChanges())
+                {
+                    if (change.Overlaps(cache.bounds))
+                    {
+                        cache.valid = false;
+                        break;
+                    }
+                }
+            }
+        }
+        if (!cache.valid)
+            RefreshCache(character, region);
+
+        // Moving geometry may have pushed into the character since the last step
+        Depenetrate(character, position);
+
+        // Move and slide
+        for (int iteration = 0; iteration < controller.maxSlideIterations; ++iteration)
+        {
+            float length = move.Length();
+            if (length < 1e-4f)
+                break;
+
+            CastResult result;
+            if (!Cast(character, position, move, result))
+            {
+                position += move;
+                break;
+            }
+
+            float travel = std::max(0.0f, result.hit.fraction * length - controller.skinWidth);
+            position += move * (travel / length);
+            Math::Vector2 rest = move * (1.0f - travel / length);
+            Math::Vector2 normal = result.hit.normal;
+
+            if (!IsWalkable(controller, normal))
+            {
+                float normalUp = Math::Vector2::Dot(normal, m_Up);
+                if (normalUp < -0.1f)
+                {
+                    controller.hitCeiling = true;
+                }
+                else
+                {
+                    controller.hitWall = true;
+                    if (wasGrounded && !rising && controller.stepHeight > 0.0f && TryStepUp(character, position, rest))
+                        break;
+
+                    // A grounded character treats steep slopes as vertical walls rather than riding up them
+                    Math::Vector2 flat = normal - m_Up * normalUp;
+                    if (wasGrounded && normalUp > 0.0f && flat.LengthSquared() > 1e-6f)
+                        normal = flat.Normalize();
+                }
+            }
+
+            float into = Math::Vector2::Dot(rest, normal);
+            if (into < 0.0f)
+                rest -= normal * into;
+            float velocityInto = Math::Vector2::Dot(velocity, normal);
+            if (velocityInto < 0.0f)
+                velocity -= normal * velocityInto;
+            move = rest;
+        }
+
+        // Ground probe: find walkable ground just below and snap onto it
+        controller.isGrounded = false;
+        controller.groundEntity = INVALID_ENTITY;
+        if (!rising)
+        {
+            float probeLength = controller.groundSnapDistance + controller.skinWidth;
+            CastResult ground;
+            if (Cast(character, position, m_Up * -probeLength, ground) && IsWalkable(controller, ground.hit.normal))
+            {
+                position -= m_Up * std::max(0.0f, ground.hit.fraction * probeLength - controller.skinWidth);
+                controller.isGrounded = true;
+                controller.groundNormal = ground.hit.normal;
+                controller.groundEntity = ground.entityId;
+                // Grounded characters keep only their walking speed
+                velocity = right * Math::Vector2::Dot(velocity, right);
+            }
+        }
+        if (!controller.isGrounded)
+        {
+            controller.groundNormal = m_Up;
+        }
+
+        controller.velocity = velocity;
+        transform.position = position;
+    }
+
+    void CharacterControllerSystem::RefreshCache(Character& character, const Physics::AABB& region)
+    {
+        QueryCache& cache = *character.cache;
+        cache.bounds = Inflate(region, m_Config.cacheMargin);
+        cache.candidates.clear();
+        m_Physics->QueryBroadPhase(cache.bounds, cache.candidates);
+
+        // Keep solid colliders the character's filter accepts. Other characters are left
+        // out: they are written concurrently and characters do not collide.
+        const auto& filter = character.controller->filter;
+        cache.candidates.erase(std::remove_if(cache.candidates.begin(), cache.candidates.end(), [&](EntityID entityId) {
+                if (entityId == character.entityId ||
+                    !m_ComponentStore->HasComponent<ColliderComponent>(entityId) ||
+                    !m_ComponentStore->HasComponent<TransformComponent>(entityId) ||
+                    m_ComponentStore->HasComponent<CharacterControllerComponent>(entityId))
+                    return true;
+                const auto& collider = m_ComponentStore->GetComponent<ColliderComponent>(entityId);
+                return collider.IsSensor() || !filter.ShouldCollide(collider.filter);
+        }), cache.candidates.end());
+
+        cache.valid = true;
+        character.refreshed = true;
+    }
+
+    bool CharacterControllerSystem::Cast(Character& character, const Math::Vector2& center, const Math::Vector2& translation,
+                                         CastResult& result) const
+    {
+        const float radius = character.controller->radius;
+        bool hit = false;
+        Physics::ShapeCast::Hit candidateHit;
+        for (EntityID entityId : character.cache->candidates)
+        {
+            const auto& collider = m_ComponentStore->GetComponent<ColliderComponent>(entityId);
+            const auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
+            ++character.shapeCasts;
+            if (Physics::ShapeCast::CastCircle(collider, transform.position, transform.rotation, center, radius,
+                                               translation, candidateHit) &&
+                (!hit || candidateHit.fraction < result.hit.fraction))
+            {
+                result.hit = candidateHit;
+                result.entityId = entityId;
+                hit = true;
+            }
+        }
+        return hit;
+    }
+
+    void CharacterControllerSystem::Depenetrate(Character& character, Math::Vector2& position) const
+    {
+        const auto& controller = *character.controller;
+        for (int pass = 0; pass < 4; ++pass)
+        {
+            float deepest = 0.0f;
+            Math::Vector2 pushNormal;
+            for (EntityID entityId : character.cache->candidates)
+            {
+                const auto& collider = m_ComponentStore->GetComponent<ColliderComponent>(entityId);
+                const auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
+                Math::Vector2 normal;
+                float depth;
+                if (Physics::ShapeCast::CircleOverlap(collider, transform.position, transform.rotation, position,
+                                                      controller.radius, normal, depth) && depth > deepest)
+                {
+                    deepest = depth;
+                    pushNormal = normal;
+                }
+            }
+            if (deepest <= 0.0f)
+                return;
+            position += pushNormal * (deepest + controller.skinWidth);
+        }
+    }
+
+    bool CharacterControllerSystem::TryStepUp(Character& character, Math::Vector2& position, const Math::Vector2& move) const
+    {
+        const auto& controller = *character.controller;
+        const Math::Vector2 right = {m_Up.y, -m_Up.x};
+        CastResult result;
+
+        // Up by at most stepHeight
+        float climb = controller.stepHeight;
+        if (Cast(character, position, m_Up * controller.stepHeight, result))
+            climb = std::max(0.0f, result.hit.fraction * controller.stepHeight - controller.skinWidth);
+        if (climb <= controller.skinWidth)
+            return false;
+        Math::Vector2 raised = position + m_Up * climb;
+
+        // Across, keeping only the horizontal part of the blocked move
+        Math::Vector2 forward = right * Math::Vector2::Dot(move, right);
+        float forwardLength = forward.Length();
+        if (forwardLength < 1e-4f)
+            return false;
+        Math::Vector2 advanced = raised + forward;
+        if (Cast(character, raised, forward, result))
+        {
+            float travel = std::max(0.0f, result.hit.fraction * forwardLength - controller.skinWidth);
+            if (travel < 1e-3f)
+                return false;
+            advanced = raised + forward * (travel / forwardLength);
+        }
+
+        // Down onto the ledge; landing back at the starting height means there was none
+        float dropLength = climb + controller.skinWidth;
+        if (!Cast(character, advanced, m_Up * -dropLength, result) || !IsWalkable(controller, result.hit.normal))
+            return false;
+        float fall = std::max(0.0f, result.hit.fraction * dropLength - controller.skinWidth);
+        if (fall >= climb - 1e-3f)
+            return false;
+
+        position = advanced - m_Up * fall;
+        return true;
+    }
+
+    bool CharacterControllerSystem::IsWalkable(const CharacterControllerComponent& controller, const Math::Vector2& normal) const
+    {
+        return Math::Vector2::Dot(normal, m_Up) >= std::cos(controller.maxSlopeAngle);
+    }
+}
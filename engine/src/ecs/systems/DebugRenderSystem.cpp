@@ -75,6 +75,8 @@ namespace Nyon::ECS
         for (auto entityId : bodyEntities)
         {
             const auto& body = m_ComponentStore->GetComponent<PhysicsBodyComponent>(entityId);
+            if (!body.isEnabled)
+                continue;
             const ColliderComponent* collider = nullptr;
             
             if (m_ComponentStore->HasComponent<ColliderComponent>(entityId))
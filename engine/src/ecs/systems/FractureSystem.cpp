@@ -0,0 +1,200 @@
+#include "nyon/ecs/systems/FractureSystem.h"
+#include "nyon/ecs/systems/PhysicsPipelineSystem.h"
+#include "nyon/ecs/components/PhysicsBodyComponent.h"
+#include "nyon/ecs/components/RenderComponent.h"
+#include "nyon/ecs/components/TransformComponent.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace Nyon::ECS
+{
+    void FractureSystem::Initialize(EntityManager& entityManager, ComponentStore& componentStore)
+    {
+        System::Initialize(entityManager, componentStore);
+        m_Pool = std::make_unique<EntityPool>(entityManager, componentStore, "debris");
+    }
+
+    void FractureSystem::Update(float deltaTime)
+    {
+        if (!m_Pool)
+            return;
+
+        // Pieces destroyed behind the system's back are dropped along with expired ones
+        for (size_t i = 0; i < m_Debris.size();)
+        {
+            Debris& debris = m_Debris[i];
+            debris.age += deltaTime;
+            bool alive = m_EntityManager->IsEntityValid(debris.entity);
+            if (alive && (m_Config.debrisLifetime <= 0.0f || debris.age < m_Config.debrisLifetime))
+            {
+                ++i;
+                continue;
+            }
+            if (alive)
+                m_Pool->Release(debris.entity);
+            debris = m_Debris.back();
+            m_Debris.pop_back();
+        }
+        m_Stats.activeDebris = m_Debris.size();
+    }
+
+    FractureSystem::PatternID FractureSystem::CreatePattern(const ColliderComponent::PolygonShape& shape, int pieceCount,
+                                                            uint32_t seed)
+    {
+        Physics::FracturePattern pattern = Physics::FracturePattern::Generate(shape, pieceCount, seed);
+        if (pattern.IsEmpty())
+            return INVALID_PATTERN;
+        m_Patterns.push_back(std::move(pattern));
+        return static_cast<PatternID>(m_Patterns.size() - 1);
+    }
+
+    const Physics::FracturePattern* FractureSystem::GetPattern(PatternID pattern) const
+    {
+        return pattern < m_Patterns.size() ? &m_Patterns[pattern] : nullptr;
+    }
+
+    void FractureSystem::Prewarm(size_t count)
+    {
+        if (!m_Pool)
+            return;
+        m_ComponentStore->ReserveComponents<TransformComponent>(count);
+        m_ComponentStore->ReserveComponents<PhysicsBodyComponent>(count);
+        m_ComponentStore->ReserveComponents<ColliderComponent>(count);
+        m_ComponentStore->ReserveComponents<RenderComponent>(count);
+        m_Pool->Prewarm(count, [this](EntityID entity) { BuildDebris(entity); });
+        m_Debris.reserve(m_Debris.size() + count);
+    }
+
+    void FractureSystem::BuildDebris(EntityID entity)
+    {
+        // Break() overwrites every per-piece field; the polygon only reserves typical cell sizes
+        ColliderComponent::PolygonShape shape;
+        shape.vertices.reserve(8);
+        shape.normals.reserve(8);
+        ColliderComponent collider(shape);
+
+        m_ComponentStore->AddComponent(entity, TransformComponent());
+        m_ComponentStore->AddComponent(entity, PhysicsBodyComponent());
+        m_ComponentStore->AddComponent(entity, std::move(collider));
+        m_ComponentStore->AddComponent(entity, RenderComponent());
+    }
+
+    size_t FractureSystem::Break(EntityID entity, PatternID patternId, std::vector<EntityID>* pieces)
+    {
+        auto startTime = std::chrono::high_resolution_clock::now();
+        const Physics::FracturePattern* pattern = GetPattern(patternId);
+        if (!m_Pool || !pattern || !m_ComponentStore->HasComponent<TransformComponent>(entity) ||
+            !m_ComponentStore->HasComponent<ColliderComponent>(entity))
+            return 0;
+
+        // Copy the broken body's state: acquiring debris may grow the pools it lives in
+        const auto& parentTransform = m_ComponentStore->GetComponent<TransformComponent>(entity);
+        const Math::Vector2 position = parentTransform.position;
+        const float rotation = parentTransform.rotation;
+        const auto& parentCollider = m_ComponentStore->GetComponent<ColliderComponent>(entity);
+        const ColliderComponent::Material material = parentCollider.material;
+        const ColliderComponent::Filter filter = parentCollider.filter;
+        const float density = material.density > 0.0f ? material.density : m_Config.defaultDensity;
+
+        Math::Vector2 velocity = {0.0f, 0.0f};
+        float angularVelocity = 0.0f;
+        PhysicsBodyComponent bodyTemplate;
+        if (m_ComponentStore->HasComponent<PhysicsBodyComponent>(entity))
+        {
+            const auto& parentBody = m_ComponentStore->GetComponent<PhysicsBodyComponent>(entity);
+            velocity = parentBody.velocity;
+            angularVelocity = parentBody.angularVelocity;
+            bodyTemplate.friction = parentBody.friction;
+            bodyTemplate.restitution = parentBody.restitution;
+            bodyTemplate.drag = parentBody.drag;
+            bodyTemplate.angularDamping = parentBody.angularDamping;
+        }
+        Math::Vector3 color = {1.0f, 1.0f, 1.0f};
+        int layer = 0;
+        if (m_ComponentStore->HasComponent<RenderComponent>(entity))
+        {
+            const auto& parentRender = m_ComponentStore->GetComponent<RenderComponent>(entity);
+            color = parentRender.color;
+            layer = parentRender.layer;
+        }
+        EntityPool::SetEntityEnabled(*m_ComponentStore, entity, false);
+
+        // Pool misses add components; make room for all of them at once
+        const auto& pieceData = pattern->GetPieces();
+        size_t available = m_Pool->GetStats().available;
+        if (pieceData.size() > available)
+        {
+            size_t misses = pieceData.size() - available;
+            m_ComponentStore->ReserveComponents<TransformComponent>(misses);
+            m_ComponentStore->ReserveComponents<PhysicsBodyComponent>(misses);
+            m_ComponentStore->ReserveComponents<ColliderComponent>(misses);
+            m_ComponentStore->ReserveComponents<RenderComponent>(misses);
+        }
+
+        const float c = std::cos(rotation);
+        const float s = std::sin(rotation);
+        m_Spawned.clear();
+        m_Spawned.reserve(pieceData.size());
+        m_Debris.reserve(m_Debris.size() + pieceData.size());
+        for (const Physics::FracturePattern::Piece& piece : pieceData)
+        {
+            EntityID debris = m_Pool->Acquire([this](EntityID e) { BuildDebris(e); });
+            Math::Vector2 arm = {piece.offset.x * c - piece.offset.y * s, piece.offset.x * s + piece.offset.y * c};
+
+            auto& transform = m_ComponentStore->GetComponent<TransformComponent>(debris);
+            transform.position = position + arm;
+            transform.previousPosition = transform.position;
+            transform.rotation = rotation;
+            transform.previousRotation = rotation;
+
+            // Rigid motion of the broken body evaluated at the piece centroid
+            auto& body = m_ComponentStore->GetComponent<PhysicsBodyComponent>(debris);
+            body.isStatic = false;
+            body.isKinematic = false;
+            body.friction = bodyTemplate.friction;
+            body.restitution = bodyTemplate.restitution;
+            body.drag = bodyTemplate.drag;
+            body.angularDamping = bodyTemplate.angularDamping;
+            body.centerOfMass = {0.0f, 0.0f};
+            body.velocity = velocity + Math::Vector2::Cross(angularVelocity, arm);
+            if (m_Config.burstSpeed > 0.0f && arm.LengthSquared() > 1e-6f)
+                body.velocity = body.velocity + arm.Normalize() * m_Config.burstSpeed;
+            body.angularVelocity = angularVelocity;
+            body.SetMass(piece.area * density);
+            body.SetInertia(piece.inertiaPerUnitMass * body.mass);
+
+            auto& collider = m_ComponentStore->GetComponent<ColliderComponent>(debris);
+            collider.type = ColliderComponent::ShapeType::Polygon;
+            if (auto* polygon = std::get_if<ColliderComponent::PolygonShape>(&collider.shape))
+                *polygon = piece.shape;
+            else
+                collider.shape = piece.shape;
+            collider.material = material;
+            collider.filter = filter;
+            collider.isSensor = false;
+
+            auto& render = m_ComponentStore->GetComponent<RenderComponent>(debris);
+            render.shapeType = RenderComponent::ShapeType::Rectangle;
+            render.size = piece.localBounds.upperBound - piece.localBounds.lowerBound;
+            render.origin = {-piece.localBounds.lowerBound.x, -piece.localBounds.lowerBound.y};
+            render.color = color;
+            render.layer = layer;
+
+            m_Spawned.push_back(debris);
+            m_Debris.push_back({debris, 0.0f});
+        }
+
+        if (m_Physics)
+            m_Physics->InsertProxies(m_Spawned);
+        if (pieces)
+            pieces->insert(pieces->end(), m_Spawned.begin(), m_Spawned.end());
+
+        m_Stats.breaks++;
+        m_Stats.piecesSpawned = m_Spawned.size();
+        m_Stats.activeDebris = m_Debris.size();
+        auto endTime = std::chrono::high_resolution_clock::now();
+        m_Stats.lastBreakTime = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+        return m_Spawned.size();
+    }
+}
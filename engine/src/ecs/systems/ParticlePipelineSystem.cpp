@@ -1,23 +1,26 @@
 #include "nyon/ecs/systems/ParticlePipelineSystem.h"
 #include "nyon/ecs/components/ParticleComponent.h"
 #include "nyon/ecs/components/ParticleEmitterComponent.h"
+#include "nyon/ecs/components/ForceFieldComponent.h"
 #include "nyon/ecs/components/PhysicsBodyComponent.h"
 #include "nyon/ecs/components/ColliderComponent.h"
 #include "nyon/ecs/components/TransformComponent.h"
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <numeric>
 
 namespace Nyon::ECS
 {
     ParticlePipelineSystem::ParticlePipelineSystem()
     {
-        // Initialize thread count from ThreadPool
+        // Parallel phases run through ThreadPool::ParallelFor
         Utils::ThreadPool::Initialize();
-        m_NumThreads = Utils::ThreadPool::Instance().GetThreadCount();
     }
 
     void ParticlePipelineSystem::Initialize(EntityManager& entityManager, ComponentStore& componentStore)
     {
+        m_EntityManager = &entityManager;
         m_ComponentStore = &componentStore;
         
         // Find physics world for gravity (NO HARDCODED GRAVITY)
@@ -50,32 +53,18 @@ namespace Nyon::ECS
             return;
 
         const size_t particleCount = m_ActiveParticles.size();
+        ClassifyParticles();
+        ApplyForceFields(deltaTime);
         
         // ====================================================================
         // PHASE 2: Parallel Particle Physics Update (ThreadPool)
         // ====================================================================
-        std::vector<std::future<void>> physicsFutures;
-        size_t batchSize = (particleCount + m_NumThreads - 1) / m_NumThreads;
-
-        for (size_t t = 0; t < m_NumThreads; ++t)
-        {
-            size_t start = t * batchSize;
-            size_t end = std::min(start + batchSize, particleCount);
-            
-            if (start >= particleCount) break;
-
-            physicsFutures.push_back(
-                Utils::ThreadPool::Instance().Submit([this, start, end, deltaTime]() {
-                    UpdateParticlePhysicsParallel(start, end, deltaTime);
-                })
-            );
-        }
-
-        // Wait for all physics updates to complete
-        for (auto& future : physicsFutures)
-        {
-            future.get();
-        }
+        Utils::ThreadPool::Instance().ParallelFor(particleCount, [this, deltaTime](size_t start, size_t end) {
+            UpdateParticlePhysicsParallel(start, end, deltaTime);
+        });
+        
+        // Fluid emitters: density constraints replace ballistic integration and collisions
+        SimulateFluids(deltaTime);
         
         // ====================================================================
         // PHASE 3: Parallel Particle-Particle Broadphase (Spatial Hash)
@@ -137,9 +126,12 @@ namespace Nyon::ECS
             float previousAlpha = particle.alpha;
             float previousSizeScale = particle.sizeScale;
             
+            // Fluid particles are moved by SimulateFluids(); only their lifecycle ticks here
+            const bool isFluid = m_IsFluidParticle[i] != 0;
+            
             // Check if particle should sleep (respect PhysicsWorldComponent.enableSleep)
-            bool shouldSleep = false;
-            if (m_EnableSleep)
+            bool shouldSleep = isFluid;
+            if (!isFluid && m_EnableSleep)
             {
                 float speedSq = body.velocity.LengthSquared();
                 shouldSleep = (speedSq < 0.01f); // Near zero velocity
@@ -186,7 +178,8 @@ namespace Nyon::ECS
             }
             
             // Update TransformComponent.previousPosition
-            transform.previousPosition = previousPosition;
+            if (!isFluid)
+                transform.previousPosition = previousPosition;
             
             // Tick ParticleComponent.age
             if (particle.lifetime > 0.0f)
@@ -216,14 +209,59 @@ namespace Nyon::ECS
         }
     }
 
-    void ParticlePipelineSystem::ProcessCollisionPair(size_t i, size_t j)
+    void ParticlePipelineSystem::ApplyForceFields(float dt)
+    {
+        // PhysicsPipelineSystem skips particle bodies, so fields reach particles only here.
+        // The pipeline ticks field durations; expired fields are ignored
+        m_ForceFields.clear();
+        m_ComponentStore->ForEachComponent<ForceFieldComponent>([&](EntityID entityId, const ForceFieldComponent& component) {
+            if (!component.enabled || !component.affectsParticles ||
+                (component.duration >= 0.0f && component.elapsed >= component.duration))
+                return;
+
+            Math::Vector2 origin = {0.0f, 0.0f};
+            if (m_ComponentStore->HasComponent<TransformComponent>(entityId))
+                origin = m_ComponentStore->GetComponent<TransformComponent>(entityId).position;
+            m_ForceFields.push_back(Physics::ForceField::FromComponent(component, origin));
+        });
+
+        for (const Physics::ForceField& field : m_ForceFields)
+        {
+            m_ForceFieldBodies.clear();
+            m_ForceFieldBatch.Clear();
+            for (EntityID entityId : m_ActiveParticles)
+            {
+                if (!m_ComponentStore->HasComponent<PhysicsBodyComponent>(entityId) ||
+                    !m_ComponentStore->HasComponent<TransformComponent>(entityId))
+                    continue;
+                auto& body = m_ComponentStore->GetComponent<PhysicsBodyComponent>(entityId);
+                const Math::Vector2& position = m_ComponentStore->GetComponent<TransformComponent>(entityId).position;
+                if (body.inverseMass <= 0.0f || !field.bounds.Contains(position))
+                    continue;
+                if (field.maskBits != 0xFFFF && m_ComponentStore->HasComponent<ColliderComponent>(entityId) &&
+                    (m_ComponentStore->GetComponent<ColliderComponent>(entityId).filter.categoryBits & field.maskBits) == 0)
+                    continue;
+                m_ForceFieldBodies.push_back(&body);
+                m_ForceFieldBatch.Push(position, 1.0f / body.inverseMass);
+            }
+
+            // Each particle appears once per field, so chunks write their velocities without locks
+            Utils::ThreadPool::Instance().ParallelFor(m_ForceFieldBodies.size(), [this, &field, dt](size_t start, size_t end) {
+                field.Accumulate(m_ForceFieldBatch, start, end);
+                for (size_t i = start; i < end; ++i)
+                {
+                    PhysicsBodyComponent& body = *m_ForceFieldBodies[i];
+                    body.velocity += Math::Vector2(m_ForceFieldBatch.forceX[i], m_ForceFieldBatch.forceY[i]) * (body.inverseMass * dt);
+                }
+            });
+        }
+    }
+
+    void ParticlePipelineSystem::ProcessCollisionPair(EntityID entityIdA, EntityID entityIdB)
     {
         // THREAD SAFETY: This method is called from multiple threads in parallel.
         // Race conditions are prevented by ensuring each pair is processed exactly once.
         
-        EntityID entityIdA = m_ActiveParticles[i];
-        EntityID entityIdB = m_ActiveParticles[j];
-        
         if (!m_ComponentStore->HasComponent<TransformComponent>(entityIdA) ||
             !m_ComponentStore->HasComponent<TransformComponent>(entityIdB) ||
             !m_ComponentStore->HasComponent<PhysicsBodyComponent>(entityIdA) ||
@@ -296,9 +334,13 @@ namespace Nyon::ECS
         
         for (size_t i = 0; i < particleCount; ++i)
         {
+            if (m_IsFluidParticle[i])
+                continue;
+            
             for (size_t j = i + 1; j < particleCount; ++j)
             {
-                ProcessCollisionPair(i, j);
+                if (!m_IsFluidParticle[j])
+                    ProcessCollisionPair(m_ActiveParticles[i], m_ActiveParticles[j]);
             }
         }
     }
@@ -313,33 +355,16 @@ namespace Nyon::ECS
         m_CellSize = cellSize;
 
         const size_t particleCount = m_ActiveParticles.size();
-        std::vector<std::vector<std::pair<int, int>>> threadResults(m_NumThreads);
-        std::vector<std::future<void>> futures;
+        auto& pool = Utils::ThreadPool::Instance();
+        const size_t grain = pool.ResolveGrain(particleCount, 0);
+        std::vector<std::vector<std::pair<int, int>>> chunkResults((particleCount + grain - 1) / grain);
 
-        size_t batchSize = (particleCount + m_NumThreads - 1) / m_NumThreads;
+        pool.ParallelFor(particleCount, [this, grain, cellSize, &chunkResults](size_t start, size_t end) {
+            chunkResults[start / grain] = ComputeCellIndices(start, end, cellSize);
+        }, grain);
 
-        for (size_t t = 0; t < m_NumThreads; ++t)
-        {
-            size_t start = t * batchSize;
-            size_t end = std::min(start + batchSize, particleCount);
-            
-            if (start >= particleCount) break;
-
-            futures.push_back(
-                Utils::ThreadPool::Instance().Submit([this, t, start, end, cellSize, &threadResults]() {
-                    threadResults[t] = ComputeCellIndices(start, end, cellSize);
-                })
-            );
-        }
-
-        // Wait for all threads to finish computing
-        for (auto& future : futures)
-        {
-            future.get();
-        }
-
-        // Merge results into spatial hash (single-threaded merge is fast)
-        for (const auto& results : threadResults)
+        // Merge results into spatial hash in chunk order (single-threaded merge is fast)
+        for (const auto& results : chunkResults)
         {
             for (const auto& [cellKey, particleIdx] : results)
             {
@@ -359,7 +384,8 @@ namespace Nyon::ECS
         {
             EntityID entityId = m_ActiveParticles[i];
             
-            if (!m_ComponentStore->HasComponent<TransformComponent>(entityId))
+            // Fluid particles resolve contacts through their density constraints
+            if (m_IsFluidParticle[i] || !m_ComponentStore->HasComponent<TransformComponent>(entityId))
                 continue;
                 
             const auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
@@ -475,35 +501,12 @@ namespace Nyon::ECS
         }
         
         // Now process collision pairs in parallel (embarrassingly parallel)
-        std::vector<std::future<void>> collisionFutures;
-        const size_t pairCount = collisionPairs.size();
-        
-        if (pairCount == 0) return;
-        
-        size_t pairBatchSize = (pairCount + m_NumThreads - 1) / m_NumThreads;
-        
-        for (size_t t = 0; t < m_NumThreads; ++t)
-        {
-            size_t pairStart = t * pairBatchSize;
-            size_t pairEnd = std::min(pairStart + pairBatchSize, pairCount);
-            
-            if (pairStart >= pairCount) break;
-
-            collisionFutures.push_back(
-                Utils::ThreadPool::Instance().Submit([this, pairStart, pairEnd, &collisionPairs]() {
-                    for (size_t p = pairStart; p < pairEnd; ++p)
-                    {
-                        ProcessCollisionPair(collisionPairs[p].first, collisionPairs[p].second);
-                    }
-                })
-            );
-        }
-
-        // Wait for all collision detection to complete
-        for (auto& future : collisionFutures)
-        {
-            future.get();
-        }
+        Utils::ThreadPool::Instance().ParallelFor(collisionPairs.size(), [this, &collisionPairs](size_t pairStart, size_t pairEnd) {
+            for (size_t p = pairStart; p < pairEnd; ++p)
+            {
+                ProcessCollisionPair(collisionPairs[p].first, collisionPairs[p].second);
+            }
+        });
     }
     
     void ParticlePipelineSystem::ProcessParticleLifecycle(float deltaTime)
@@ -539,7 +542,7 @@ namespace Nyon::ECS
     void ParticlePipelineSystem::CleanupDeadParticles()
     {
         // PHASE 6: Post-Update Cleanup (Main Thread)
-        // Remove dead particles from active list and update emitter counts
+        // Destroy dead particles with their components and update emitter counts
         
         // Remove dead particles from active list
         auto it = m_ActiveParticles.begin();
@@ -564,7 +567,11 @@ namespace Nyon::ECS
                         }
                     }
                     
-                    // Mark for destruction (actual removal happens in EntityManager)
+                    // Nothing else owns particle entities, so they go with their components
+                    if (m_EntityManager)
+                    {
+                        m_EntityManager->DestroyEntity(entityId, *m_ComponentStore);
+                    }
                     it = m_ActiveParticles.erase(it);
                     continue;
                 }
@@ -640,7 +647,7 @@ namespace Nyon::ECS
         if (!m_ComponentStore || !m_ComponentStore->HasComponent<ParticleEmitterComponent>(emitterEntityId))
             return;
         
-        const auto& emitter = m_ComponentStore->GetComponent<ParticleEmitterComponent>(emitterEntityId);
+        auto& emitter = m_ComponentStore->GetComponent<ParticleEmitterComponent>(emitterEntityId);
         const auto& params = emitter.spawnParams;
         
         // Sample random values from ranges
@@ -677,17 +684,67 @@ namespace Nyon::ECS
             colorDist(m_Rng) * (params.colorEndMax.z - params.colorEndMin.z) + params.colorEndMin.z
         };
         
-        // Note: Actual entity creation would happen here if we had EntityManager access
-        // For now, this is handled by demo/game code which creates the full ECS entity
+        if (!m_EntityManager)
+            return;
         
-        // Call onSpawn callback if set (would be called after entity creation)
-        if (emitter.onSpawn)
+        // Fluid particles share the emitter's rest spacing so the density constraint has one scale
+        const bool isFluid = emitter.simulationMode == ParticleEmitterComponent::SimulationMode::Fluid;
+        if (isFluid)
+        {
+            radius = emitter.fluid.particleSpacing * 0.5f;
+            mass = 1.0f;
+        }
+        
+        // Emission offsets are relative to the emitter entity's transform when it has one
+        Math::Vector2 worldPosition = spawnPosition;
+        if (m_ComponentStore->HasComponent<TransformComponent>(emitterEntityId))
         {
-            // emitter.onSpawn(particleEntity);  // Would pass actual entity ID
+            worldPosition += m_ComponentStore->GetComponent<TransformComponent>(emitterEntityId).position;
         }
         
-        // Increment emitter count (would be done after successful creation)
-        // const_cast<ParticleEmitterComponent&>(emitter).currentCount++;
+        std::uniform_real_distribution<float> dragDist(params.minDrag, params.maxDrag);
+        std::uniform_real_distribution<float> restitutionDist(params.minRestitution, params.maxRestitution);
+        std::uniform_real_distribution<float> frictionDist(params.minFriction, params.maxFriction);
+        
+        EntityID particleEntity = m_EntityManager->CreateEntity();
+        
+        TransformComponent transform(worldPosition);
+        
+        PhysicsBodyComponent body;
+        body.SetMass(mass);
+        body.velocity = velocity;
+        body.drag = dragDist(m_Rng);
+        
+        ColliderComponent::CircleShape circle;
+        circle.radius = radius;
+        ColliderComponent collider(circle);
+        collider.material.restitution = restitutionDist(m_Rng);
+        collider.material.friction = frictionDist(m_Rng);
+        collider.filter.categoryBits = emitter.collisionCategory;
+        collider.filter.maskBits = emitter.collisionMask;
+        
+        ParticleComponent particle;
+        particle.lifetime = (params.maxLifetime < 0.0f) ? -1.0f : lifetime;
+        particle.alphaStart = params.alphaStart;
+        particle.alphaEnd = params.alphaEnd;
+        particle.alpha = params.alphaStart;
+        particle.prevAlpha = params.alphaStart;
+        particle.colorStart = colorStart;
+        particle.colorEnd = colorEnd;
+        particle.emitterEntityId = emitterEntityId;
+        
+        m_ComponentStore->AddComponent(particleEntity, std::move(transform));
+        m_ComponentStore->AddComponent(particleEntity, std::move(body));
+        m_ComponentStore->AddComponent(particleEntity, std::move(collider));
+        m_ComponentStore->AddComponent(particleEntity, std::move(particle));
+        m_ActiveParticles.push_back(particleEntity);
+        
+        emitter.currentCount++;
+        
+        if (emitter.onSpawn)
+        {
+            emitter.onSpawn(particleEntity);
+        }
     }
     
     void ParticlePipelineSystem::DetectParticleBodyCollisions()
@@ -713,8 +770,14 @@ namespace Nyon::ECS
         
         // For each particle, check if it collides with any body
         // Note: This is a simplified implementation - full implementation would use DynamicTree broadphase
-        for (EntityID particleId : m_ActiveParticles)
+        for (size_t particleIndex = 0; particleIndex < m_ActiveParticles.size(); ++particleIndex)
         {
+            EntityID particleId = m_ActiveParticles[particleIndex];
+            
+            // Fluid particles are confined by colliders inside the fluid solve
+            if (m_IsFluidParticle[particleIndex])
+                continue;
+            
             if (!m_ComponentStore->HasComponent<ParticleComponent>(particleId) ||
                 !m_ComponentStore->HasComponent<TransformComponent>(particleId) ||
                 !m_ComponentStore->HasComponent<ColliderComponent>(particleId))
@@ -739,7 +802,7 @@ namespace Nyon::ECS
                 
                 // Iterate over all physics bodies
                 m_ComponentStore->ForEachComponent<PhysicsBodyComponent>([&](EntityID bodyId, PhysicsBodyComponent& body) {
-                    if (bodyId == particleId) return; // Skip self
+                    if (bodyId == particleId || !body.isEnabled) return; // Skip self and pooled bodies
                     
                     if (!m_ComponentStore->HasComponent<TransformComponent>(bodyId) ||
                         !m_ComponentStore->HasComponent<ColliderComponent>(bodyId))
@@ -748,6 +811,11 @@ namespace Nyon::ECS
                     const auto& bodyTransform = m_ComponentStore->GetComponent<TransformComponent>(bodyId);
                     const auto& bodyCollider = m_ComponentStore->GetComponent<ColliderComponent>(bodyId);
                     
+                    // Only the circle-circle test is implemented here
+                    if (collider.GetType() != ColliderComponent::ShapeType::Circle ||
+                        bodyCollider.GetType() != ColliderComponent::ShapeType::Circle)
+                        return;
+                    
                     // Check collision filter
                     uint16_t bodyCategory = bodyCollider.filter.categoryBits;
                     uint16_t bodyMask = bodyCollider.filter.maskBits;
@@ -775,4 +843,459 @@ namespace Nyon::ECS
             }
         }
     }
+    // ========================================================================
+    // POSITION-BASED FLUIDS
+    // ========================================================================
+
+    namespace
+    {
+        constexpr float FLUID_PI = 3.14159265359f;
+
+        // 2D poly6 kernel, used for density
+        inline float FluidPoly6(float rSq, float h)
+        {
+            float hSq = h * h;
+            if (rSq >= hSq)
+                return 0.0f;
+            float diff = hSq - rSq;
+            return 4.0f / (FLUID_PI * hSq * hSq * hSq * hSq) * diff * diff * diff;
+        }
+
+        // Gradient of the 2D spiky kernel, used for constraint gradients
+        inline Math::Vector2 FluidSpikyGradient(const Math::Vector2& r, float h)
+        {
+            float rLength = r.Length();
+            if (rLength >= h || rLength < 1e-6f)
+                return {0.0f, 0.0f};
+            float diff = h - rLength;
+            float scale = -30.0f / (FLUID_PI * h * h * h * h * h) * diff * diff / rLength;
+            return r * scale;
+        }
+
+        // Row-major cell key: cells of one row sort contiguously by x, so the 3x3
+        // neighbourhood is three contiguous key ranges in the sorted particle array
+        inline uint64_t FluidCellKey(int cellX, int cellY)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(cellY) ^ 0x80000000u) << 32) |
+                   static_cast<uint64_t>(static_cast<uint32_t>(cellX) ^ 0x80000000u);
+        }
+
+        // Rest density of a square lattice at the given spacing
+        float FluidRestDensity(float spacing, float h)
+        {
+            float density = 0.0f;
+            int extent = static_cast<int>(std::ceil(h / spacing));
+            for (int y = -extent; y <= extent; ++y)
+            {
+                for (int x = -extent; x <= extent; ++x)
+                {
+                    float dx = x * spacing;
+                    float dy = y * spacing;
+                    density += FluidPoly6(dx * dx + dy * dy, h);
+                }
+            }
+            return density;
+        }
+    }
+
+    void ParticlePipelineSystem::ClassifyParticles()
+    {
+        m_IsFluidParticle.assign(m_ActiveParticles.size(), 0);
+
+        // Particles of one emitter are usually spawned together, so cache the last lookup
+        EntityID lastEmitter = INVALID_ENTITY;
+        bool lastIsFluid = false;
+        for (size_t i = 0; i < m_ActiveParticles.size(); ++i)
+        {
+            EntityID entityId = m_ActiveParticles[i];
+            if (!m_ComponentStore->HasComponent<ParticleComponent>(entityId))
+                continue;
+
+            EntityID emitterId = m_ComponentStore->GetComponent<ParticleComponent>(entityId).emitterEntityId;
+            if (emitterId != lastEmitter)
+            {
+                lastEmitter = emitterId;
+                lastIsFluid = emitterId != INVALID_ENTITY &&
+                    m_ComponentStore->HasComponent<ParticleEmitterComponent>(emitterId) &&
+                    m_ComponentStore->GetComponent<ParticleEmitterComponent>(emitterId).simulationMode ==
+                        ParticleEmitterComponent::SimulationMode::Fluid;
+            }
+            m_IsFluidParticle[i] = lastIsFluid ? 1 : 0;
+        }
+    }
+
+    void ParticlePipelineSystem::SimulateFluids(float dt)
+    {
+        if (dt <= 0.0f || std::find(m_IsFluidParticle.begin(), m_IsFluidParticle.end(), 1) == m_IsFluidParticle.end())
+            return;
+
+        // Group fluid particles by emitter; each emitter is an independent fluid body
+        std::vector<std::pair<EntityID, std::vector<EntityID>>> groups;
+        std::unordered_map<EntityID, size_t> groupIndex;
+        for (size_t i = 0; i < m_ActiveParticles.size(); ++i)
+        {
+            if (!m_IsFluidParticle[i])
+                continue;
+
+            EntityID emitterId = m_ComponentStore->GetComponent<ParticleComponent>(m_ActiveParticles[i]).emitterEntityId;
+            auto [it, inserted] = groupIndex.emplace(emitterId, groups.size());
+            if (inserted)
+                groups.emplace_back(emitterId, std::vector<EntityID>{});
+            groups[it->second].second.push_back(m_ActiveParticles[i]);
+        }
+
+        for (const auto& [emitterId, particles] : groups)
+        {
+            StepFluid(m_ComponentStore->GetComponent<ParticleEmitterComponent>(emitterId), particles, dt);
+        }
+    }
+
+    void ParticlePipelineSystem::StepFluid(const ParticleEmitterComponent& emitter,
+                                           const std::vector<EntityID>& particles, float dt)
+    {
+        const auto& params = emitter.fluid;
+        const float h = std::max(params.smoothingRadius, 1e-3f);
+        const float spacing = std::max(params.particleSpacing, 1e-3f);
+        const float particleRadius = spacing * 0.5f;
+        const float restDensity = FluidRestDensity(spacing, h);
+        const float invRestDensity = 1.0f / restDensity;
+        // Constraint gradients scale with 1/h, so the relaxation is given relative to h^2
+        const float epsilon = params.relaxation / (h * h);
+        const float correctionW = FluidPoly6(0.04f * h * h, h); // s_corr reference at |r| = 0.2h
+        auto& pool = Utils::ThreadPool::Instance();
+
+        Math::Vector2 gravity{0.0f, 0.0f};
+        if (emitter.affectedByPhysicsWorld)
+        {
+            gravity = m_Gravity * emitter.gravityScale;
+        }
+
+        // --- Gather into SoA and predict positions ---
+        const size_t count = particles.size();
+        std::vector<Math::Vector2> positions(count);
+        std::vector<Math::Vector2> velocities(count);
+        std::vector<uint64_t> keys(count);
+        pool.ParallelFor(count, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
+            {
+                positions[i] = m_ComponentStore->GetComponent<TransformComponent>(particles[i]).position;
+                velocities[i] = m_ComponentStore->GetComponent<PhysicsBodyComponent>(particles[i]).velocity + gravity * dt;
+                Math::Vector2 predicted = positions[i] + velocities[i] * dt;
+                keys[i] = FluidCellKey(static_cast<int>(std::floor(predicted.x / h)),
+                                       static_cast<int>(std::floor(predicted.y / h)));
+            }
+        });
+
+        // Sort by cell so neighbourhoods are contiguous in memory
+        std::vector<uint32_t> order(count);
+        std::iota(order.begin(), order.end(), 0u);
+        std::sort(order.begin(), order.end(), [&keys](uint32_t a, uint32_t b) {
+            return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+        });
+
+        m_FluidEntities.resize(count);
+        m_FluidPositions.resize(count);
+        m_FluidPredicted.resize(count);
+        m_FluidVelocities.resize(count);
+        m_FluidDeltas.assign(count, Math::Vector2{0.0f, 0.0f});
+        m_FluidLambdas.assign(count, 0.0f);
+        m_FluidCellKeys.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint32_t source = order[i];
+            m_FluidEntities[i] = particles[source];
+            m_FluidPositions[i] = positions[source];
+            m_FluidVelocities[i] = velocities[source];
+            m_FluidPredicted[i] = positions[source] + velocities[source] * dt;
+            m_FluidCellKeys[i] = keys[source];
+        }
+
+        GatherFluidNeighbours(h, std::max(params.maxNeighbours, 1u));
+        if (emitter.collidesWithBodies)
+        {
+            CollectFluidBoundaries(emitter, particleRadius);
+        }
+        else
+        {
+            m_FluidBoundaries.clear();
+        }
+
+        const uint32_t maxNeighbours = std::max(params.maxNeighbours, 1u);
+
+        // --- Density constraint iterations (Jacobi: every pass reads the previous pass) ---
+        for (int iteration = 0; iteration < std::max(params.solverIterations, 1); ++iteration)
+        {
+            pool.ParallelFor(count, [&](size_t start, size_t end) {
+                for (size_t i = start; i < end; ++i)
+                {
+                    const Math::Vector2 pi = m_FluidPredicted[i];
+                    float density = FluidPoly6(0.0f, h);
+                    Math::Vector2 gradientI{0.0f, 0.0f};
+                    float gradientSumSq = 0.0f;
+
+                    const uint32_t* neighbours = &m_FluidNeighbours[i * maxNeighbours];
+                    for (uint32_t n = 0; n < m_FluidNeighbourCounts[i]; ++n)
+                    {
+                        Math::Vector2 r = pi - m_FluidPredicted[neighbours[n]];
+                        density += FluidPoly6(r.LengthSquared(), h);
+                        Math::Vector2 gradient = FluidSpikyGradient(r, h) * invRestDensity;
+                        gradientI += gradient;
+                        gradientSumSq += gradient.LengthSquared();
+                    }
+                    gradientSumSq += gradientI.LengthSquared();
+
+                    // Only resist compression; free surfaces are not pulled inwards
+                    float constraint = std::max(density * invRestDensity - 1.0f, 0.0f);
+                    m_FluidLambdas[i] = -constraint / (gradientSumSq + epsilon);
+                }
+            });
+
+            pool.ParallelFor(count, [&](size_t start, size_t end) {
+                for (size_t i = start; i < end; ++i)
+                {
+                    const Math::Vector2 pi = m_FluidPredicted[i];
+                    Math::Vector2 delta{0.0f, 0.0f};
+
+                    const uint32_t* neighbours = &m_FluidNeighbours[i * maxNeighbours];
+                    for (uint32_t n = 0; n < m_FluidNeighbourCounts[i]; ++n)
+                    {
+                        uint32_t j = neighbours[n];
+                        Math::Vector2 r = pi - m_FluidPredicted[j];
+
+                        // Artificial pressure keeps particles from clustering at the surface
+                        float correction = 0.0f;
+                        if (params.artificialPressure > 0.0f && correctionW > 0.0f)
+                        {
+                            float ratio = FluidPoly6(r.LengthSquared(), h) / correctionW;
+                            correction = -params.artificialPressure * ratio * ratio * ratio * ratio;
+                        }
+                        delta += FluidSpikyGradient(r, h) * (m_FluidLambdas[i] + m_FluidLambdas[j] + correction);
+                    }
+                    delta *= invRestDensity;
+
+                    // Near-coincident particles have huge kernel gradients; limiting the
+                    // correction to a particle radius per iteration keeps them from exploding
+                    float deltaSq = delta.LengthSquared();
+                    if (deltaSq > particleRadius * particleRadius)
+                        delta *= particleRadius / std::sqrt(deltaSq);
+                    m_FluidDeltas[i] = delta;
+                }
+            });
+
+            pool.ParallelFor(count, [&](size_t start, size_t end) {
+                for (size_t i = start; i < end; ++i)
+                {
+                    m_FluidPredicted[i] += m_FluidDeltas[i];
+                    if (!m_FluidBoundaries.empty())
+                        ResolveFluidBoundaries(m_FluidPredicted[i], m_FluidPositions[i], particleRadius);
+                }
+            });
+        }
+
+        // --- Velocity update with XSPH viscosity, then scatter back to components ---
+        pool.ParallelFor(count, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
+            {
+                m_FluidDeltas[i] = (m_FluidPredicted[i] - m_FluidPositions[i]) * (1.0f / dt);
+            }
+        });
+
+        pool.ParallelFor(count, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
+            {
+                Math::Vector2 velocity = m_FluidDeltas[i];
+                if (params.viscosity > 0.0f)
+                {
+                    Math::Vector2 blend{0.0f, 0.0f};
+                    const uint32_t* neighbours = &m_FluidNeighbours[i * maxNeighbours];
+                    for (uint32_t n = 0; n < m_FluidNeighbourCounts[i]; ++n)
+                    {
+                        uint32_t j = neighbours[n];
+                        Math::Vector2 r = m_FluidPredicted[i] - m_FluidPredicted[j];
+                        blend += (m_FluidDeltas[j] - m_FluidDeltas[i]) * (FluidPoly6(r.LengthSquared(), h) * invRestDensity);
+                    }
+                    velocity += blend * params.viscosity;
+                }
+
+                if (m_MaxLinearSpeed > 0.0f)
+                {
+                    float speedSq = velocity.LengthSquared();
+                    if (speedSq > m_MaxLinearSpeed * m_MaxLinearSpeed)
+                        velocity *= m_MaxLinearSpeed / std::sqrt(speedSq);
+                }
+
+                EntityID entityId = m_FluidEntities[i];
+                auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
+                transform.previousPosition = m_FluidPositions[i];
+                transform.position = m_FluidPredicted[i];
+                m_ComponentStore->GetComponent<PhysicsBodyComponent>(entityId).velocity = velocity;
+            }
+        });
+    }
+
+    void ParticlePipelineSystem::GatherFluidNeighbours(float smoothingRadius, uint32_t maxNeighbours)
+    {
+        const size_t count = m_FluidPredicted.size();
+        const float hSq = smoothingRadius * smoothingRadius;
+        m_FluidNeighbours.resize(count * maxNeighbours);
+        m_FluidNeighbourCounts.assign(count, 0);
+
+        // Each particle writes only its own slots, so the gather is lock-free
+        Utils::ThreadPool::Instance().ParallelFor(count, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
+            {
+                const Math::Vector2 pi = m_FluidPredicted[i];
+                int cellX = static_cast<int>(std::floor(pi.x / smoothingRadius));
+                int cellY = static_cast<int>(std::floor(pi.y / smoothingRadius));
+                uint32_t* slots = &m_FluidNeighbours[i * maxNeighbours];
+                uint32_t found = 0;
+
+                for (int dy = -1; dy <= 1 && found < maxNeighbours; ++dy)
+                {
+                    auto first = std::lower_bound(m_FluidCellKeys.begin(), m_FluidCellKeys.end(), FluidCellKey(cellX - 1, cellY + dy));
+                    auto last = std::upper_bound(first, m_FluidCellKeys.end(), FluidCellKey(cellX + 1, cellY + dy));
+                    for (auto it = first; it != last && found < maxNeighbours; ++it)
+                    {
+                        size_t j = static_cast<size_t>(it - m_FluidCellKeys.begin());
+                        if (j != i && (pi - m_FluidPredicted[j]).LengthSquared() < hSq)
+                            slots[found++] = static_cast<uint32_t>(j);
+                    }
+                }
+                m_FluidNeighbourCounts[i] = found;
+            }
+        });
+    }
+
+    void ParticlePipelineSystem::CollectFluidBoundaries(const ParticleEmitterComponent& emitter, float particleRadius)
+    {
+        m_FluidBoundaries.clear();
+
+        // Bounds of the fluid this step, padded by the particle radius
+        Math::Vector2 fluidMin = m_FluidPositions.front();
+        Math::Vector2 fluidMax = fluidMin;
+        for (size_t i = 0; i < m_FluidPredicted.size(); ++i)
+        {
+            for (const auto& p : { m_FluidPositions[i], m_FluidPredicted[i] })
+            {
+                fluidMin.x = std::min(fluidMin.x, p.x);
+                fluidMin.y = std::min(fluidMin.y, p.y);
+                fluidMax.x = std::max(fluidMax.x, p.x);
+                fluidMax.y = std::max(fluidMax.y, p.y);
+            }
+        }
+        fluidMin -= Math::Vector2{particleRadius, particleRadius};
+        fluidMax += Math::Vector2{particleRadius, particleRadius};
+
+        // Circle and polygon colliders of non-particle entities act as one-way boundaries
+        m_ComponentStore->ForEachComponent<ColliderComponent>([&](EntityID entityId, const ColliderComponent& collider) {
+            if (collider.IsSensor() ||
+                m_ComponentStore->HasComponent<ParticleComponent>(entityId) ||
+                !m_ComponentStore->HasComponent<TransformComponent>(entityId))
+                return;
+
+            if (collider.GetType() != ColliderComponent::ShapeType::Circle &&
+                collider.GetType() != ColliderComponent::ShapeType::Polygon)
+                return;
+
+            if ((emitter.collisionCategory & collider.filter.maskBits) == 0 ||
+                (collider.filter.categoryBits & emitter.collisionMask) == 0)
+                return;
+
+            if (m_ComponentStore->HasComponent<PhysicsBodyComponent>(entityId) &&
+                !m_ComponentStore->GetComponent<PhysicsBodyComponent>(entityId).isEnabled)
+                return;
+
+            const auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
+            FluidBoundary boundary;
+            boundary.collider = &collider;
+            boundary.position = transform.position;
+            boundary.cosAngle = std::cos(transform.rotation);
+            boundary.sinAngle = std::sin(transform.rotation);
+            collider.CalculateAABB(transform.position, transform.rotation, boundary.aabbMin, boundary.aabbMax);
+            boundary.aabbMin -= Math::Vector2{particleRadius, particleRadius};
+            boundary.aabbMax += Math::Vector2{particleRadius, particleRadius};
+
+            if (boundary.aabbMax.x < fluidMin.x || boundary.aabbMin.x > fluidMax.x ||
+                boundary.aabbMax.y < fluidMin.y || boundary.aabbMin.y > fluidMax.y)
+                return;
+
+            m_FluidBoundaries.push_back(boundary);
+        });
+    }
+
+    void ParticlePipelineSystem::ResolveFluidBoundaries(Math::Vector2& position, const Math::Vector2& previousPosition,
+                                                        float particleRadius) const
+    {
+        for (const auto& boundary : m_FluidBoundaries)
+        {
+            if (position.x < boundary.aabbMin.x || position.x > boundary.aabbMax.x ||
+                position.y < boundary.aabbMin.y || position.y > boundary.aabbMax.y)
+                continue;
+
+            // Work in the collider's local frame
+            auto toLocal = [&boundary](const Math::Vector2& world) {
+                Math::Vector2 offset = world - boundary.position;
+                return Math::Vector2{
+                    offset.x * boundary.cosAngle + offset.y * boundary.sinAngle,
+                    -offset.x * boundary.sinAngle + offset.y * boundary.cosAngle
+                };
+            };
+            Math::Vector2 local = toLocal(position);
+
+            if (boundary.collider->GetType() == ColliderComponent::ShapeType::Circle)
+            {
+                const auto& circle = boundary.collider->GetCircle();
+                Math::Vector2 d = local - circle.center;
+                float minDistance = circle.radius + particleRadius;
+                float distSq = d.LengthSquared();
+                if (distSq >= minDistance * minDistance)
+                    continue;
+                float dist = std::sqrt(distSq);
+                d = dist > 1e-6f ? d * (1.0f / dist) : Math::Vector2{0.0f, 1.0f};
+                local = circle.center + d * minDistance;
+            }
+            else
+            {
+                // Convex polygon: push out through the face the particle entered by (the face
+                // its start-of-step position was furthest outside of). Least penetration alone
+                // can push a particle at a junction of two colliders out the far side.
+                const auto& polygon = boundary.collider->GetPolygon();
+                if (polygon.normals.size() != polygon.vertices.size() || polygon.vertices.size() < 3)
+                    continue;
+
+                Math::Vector2 previousLocal = toLocal(previousPosition);
+                float maxSeparation = std::numeric_limits<float>::lowest();
+                float maxPreviousSeparation = std::numeric_limits<float>::lowest();
+                size_t leastPenetrationFace = 0;
+                size_t entryFace = 0;
+                for (size_t f = 0; f < polygon.normals.size(); ++f)
+                {
+                    float separation = Math::Vector2::Dot(polygon.normals[f], local - polygon.vertices[f]);
+                    if (separation > maxSeparation)
+                    {
+                        maxSeparation = separation;
+                        leastPenetrationFace = f;
+                    }
+                    float previousSeparation = Math::Vector2::Dot(polygon.normals[f], previousLocal - polygon.vertices[f]);
+                    if (previousSeparation > maxPreviousSeparation)
+                    {
+                        maxPreviousSeparation = previousSeparation;
+                        entryFace = f;
+                    }
+                }
+
+                float skin = particleRadius + polygon.radius;
+                if (maxSeparation >= skin)
+                    continue;
+                size_t face = maxPreviousSeparation > 0.0f ? entryFace : leastPenetrationFace;
+                float separation = Math::Vector2::Dot(polygon.normals[face], local - polygon.vertices[face]);
+                local += polygon.normals[face] * (skin - separation);
+            }
+
+            position = boundary.position + Math::Vector2{
+                local.x * boundary.cosAngle - local.y * boundary.sinAngle,
+                local.x * boundary.sinAngle + local.y * boundary.cosAngle
+            };
+        }
+    }
 }
@@ -1,12 +1,54 @@
 #include "nyon/ecs/systems/PhysicsPipelineSystem.h"
 #include "nyon/physics/ManifoldGenerator.h"
+#include "nyon/physics/MortonCode.h"
+#include "nyon/ecs/components/ParticleComponent.h"
 #include <chrono>
+#include <functional>
 #include <algorithm>
 #include <iostream>
-#include <mutex>
+#include <limits>
+#include <numeric>
 
 namespace Nyon::ECS
 {
+    template<typename Func>
+    void PhysicsPipelineSystem::RunParallel(size_t count, Func&& work, size_t grain)
+    {
+        if (count == 0)
+            return;
+        if (m_Config.multiThreading)
+            Utils::ThreadPool::Instance().ParallelFor(count, work, grain);
+        else
+            work(0, count);
+    }
+
+    template<typename Func>
+    void PhysicsPipelineSystem::WithPolicy(Func&& func)
+    {
+        // Simulation LOD only scales dt while LOD states exist (see PrepareSolverBody)
+        const unsigned mask = (m_HasMotionLocks ? 1u : 0u)
+                            | (!m_LODStates.empty() ? 2u : 0u)
+                            | (m_Config.adaptiveIterations ? 4u : 0u);
+        switch (mask)
+        {
+        case 0: func(PipelinePolicy<false, false, false>{}); break;
+        case 1: func(PipelinePolicy<true, false, false>{}); break;
+        case 2: func(PipelinePolicy<false, true, false>{}); break;
+        case 3: func(PipelinePolicy<true, true, false>{}); break;
+        case 4: func(PipelinePolicy<false, false, true>{}); break;
+        case 5: func(PipelinePolicy<true, false, true>{}); break;
+        case 6: func(PipelinePolicy<false, true, true>{}); break;
+        default: func(PipelinePolicy<true, true, true>{}); break;
+        }
+    }
+
+    size_t PhysicsPipelineSystem::IslandGrain() const
+    {
+        // Islands vary widely in size, so hand them out in small chunks
+        size_t threads = std::max<size_t>(1, Utils::ThreadPool::Instance().GetThreadCount());
+        return std::max<size_t>(1, m_ConstraintIslandRanges.size() / (threads * 8));
+    }
+
     void PhysicsPipelineSystem::Initialize(EntityManager& entityManager, ComponentStore& componentStore)
     {
         m_ComponentStore = &componentStore;
@@ -67,12 +109,54 @@ namespace Nyon::ECS
         }
 
         auto startTime = std::chrono::high_resolution_clock::now();
+        m_Stats.phaseTimes = Statistics::PhaseTimes();
+        m_Stats.subSteps = 0;
+        m_HasParticles = m_ComponentStore->GetComponentCount<ParticleComponent>() > 0;
+
+        // Nothing can move while every body sleeps; the proxies, contacts and islands
+        // of the last full step stay valid until something wakes or is added
+        if (CanSkipIdleStep())
+        {
+            m_Stats.idleSkippedSteps++;
+            auto endTime = std::chrono::high_resolution_clock::now();
+            m_Stats.updateTime = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+            return;
+        }
+        m_StepRequested = false;
+        m_BroadPhaseChanges.swap(m_InsertedProxyChanges);
+        m_InsertedProxyChanges.clear();
+        ++m_BroadPhaseSerial;
+        m_Stats.solverIslands = 0;
+        m_Stats.velocityIterationsTotal = 0;
+        m_Stats.velocityIterationsMax = 0;
+        m_Stats.positionIterationsTotal = 0;
+        m_Stats.positionIterationsMax = 0;
+        m_Stats.circleCirclePairs = 0;
+        m_Stats.circlePolygonPairs = 0;
+        m_Stats.polygonPolygonPairs = 0;
+        m_Stats.otherShapePairs = 0;
+        m_Stats.circlePairsCulled = 0;
+        m_Stats.forceFieldBodies = 0;
+        m_Stats.forceFieldTime = 0.0f;
+        m_LastBodyCount = m_ComponentStore->GetComponentCount<PhysicsBodyComponent>();
+        m_LastColliderCount = m_ComponentStore->GetComponentCount<ColliderComponent>();
+
+        // Periodically re-sort the body pools so spatial neighbours are adjacent in memory
+        if (m_Config.spatialSorting && ++m_StepsSinceSpatialSort >= static_cast<uint32_t>(std::max(1, m_Config.spatialSortInterval)))
+        {
+            SpatialSort();
+            m_StepsSinceSpatialSort = 0;
+        }
+
+        // Choose which islands step this tick and how much time they have accumulated
+        UpdateSimulationLOD();
+        GatherForceFields(deltaTime);
 
         // === IMPLEMENT SUB-STEPPING FOR HIGH-SPEED BODIES ===
         // Check if any dynamic body exceeds speed threshold
         float maxSpeedSquared = 0.0f;
         m_ComponentStore->ForEachComponent<PhysicsBodyComponent>([&](EntityID entityId, const PhysicsBodyComponent& body) {
-                if (!body.isStatic) {
+                if (!body.isStatic && body.isEnabled && !IsParticle(entityId)) {
                     float speedSq = body.velocity.LengthSquared();
                     if (speedSq > maxSpeedSquared) {
                         maxSpeedSquared = speedSq;
@@ -88,73 +172,115 @@ namespace Nyon::ECS
         }
         
         float subStepDt = deltaTime / numSubSteps;
+        m_Stats.subSteps = numSubSteps;
 
         // Save pre-substep positions for correct rendering interpolation.
         // With sub-stepping, UpdateTransformsFromSolver runs multiple times and would
         // overwrite previousPosition with mid-frame positions, breaking the render interpolation.
         // By saving before the loop and restoring after, we ensure previousPosition always
         // refers to the start of this physics frame.
-        std::unordered_map<uint32_t, std::pair<Math::Vector2, float>> preSubstepTransforms;
-        for (const auto& solverBody : m_SolverBodies)
-        {
-            if (m_ComponentStore->HasComponent<TransformComponent>(solverBody.entityId))
+        m_PreSubstepTransforms.resize(m_SolverBodies.size());
+        RunParallel(m_SolverBodies.size(), [this](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
             {
-                const auto& transform = m_ComponentStore->GetComponent<TransformComponent>(solverBody.entityId);
-                preSubstepTransforms[solverBody.entityId] = {transform.position, transform.rotation};
+                EntityID entityId = m_SolverBodies[i].entityId;
+                if (m_ComponentStore->HasComponent<TransformComponent>(entityId))
+                {
+                    const auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
+                    m_PreSubstepTransforms[i] = {entityId, transform.position, transform.rotation};
+                }
+                else
+                {
+                    m_PreSubstepTransforms[i] = {INVALID_ENTITY, {0.0f, 0.0f}, 0.0f};
+                }
             }
-        }
+        });
 
         // Execute physics pipeline with sub-stepping
         for (int step = 0; step < numSubSteps; ++step) {
-            // Collect active entities for each sub-step
+            // Collect active entities for each sub-step.
+            // Bodies deferred by simulation LOD neither query the broad phase nor integrate
             m_ActiveEntities.clear();
             m_ComponentStore->ForEachComponent<PhysicsBodyComponent>([&](EntityID entityId, const PhysicsBodyComponent& body) {
-                    if (!body.isStatic) {
+                    if (!body.isStatic && body.isEnabled && !IsLODDeferred(entityId) && !IsParticle(entityId)) {
                         m_ActiveEntities.push_back(entityId);
                     }
                     });
 
             // Execute pipeline phases for this sub-step
+            auto& phases = m_Stats.phaseTimes;
+            auto phaseStart = std::chrono::high_resolution_clock::now();
+            auto endPhase = [&phaseStart](float& total) {
+                auto now = std::chrono::high_resolution_clock::now();
+                total += std::chrono::duration<float, std::milli>(now - phaseStart).count();
+                phaseStart = now;
+            };
+
             PrepareBodiesForUpdate();
             
             // Use multi-threaded pipeline if enabled and beneficial
-            if (m_UseMultiThreading && m_ActiveEntities.size() > 1) {
+            bool parallelDetection = m_Config.multiThreading && m_ActiveEntities.size() > 1;
+            if (parallelDetection) {
                 ParallelBroadPhase();
-                ParallelNarrowPhase();
             } else {
                 BroadPhaseDetection();
+            }
+            endPhase(phases.broadPhase);
+            if (m_Config.bucketedNarrowPhase) {
+                BucketedNarrowPhase(parallelDetection);
+            } else if (parallelDetection) {
+                ParallelNarrowPhase();
+            } else {
                 NarrowPhaseDetection();
             }
             
+            RetainFrozenContacts();
+            PromoteDeferredContacts();
+            endPhase(phases.narrowPhase);
             IslandDetection();
+            endPhase(phases.islands);
             ConstraintInitialization();
+            endPhase(phases.constraints);
+            ApplyForceFields();
             
-            if (m_UseMultiThreading && m_VelocityConstraints.size() > 1) {
+            if (m_Config.multiThreading && m_VelocityConstraints.size() > 1) {
                 ParallelVelocitySolving(subStepDt);
+                endPhase(phases.velocitySolve);
                 ParallelPositionSolving(subStepDt);
             } else {
                 VelocitySolving(subStepDt);
+                endPhase(phases.velocitySolve);
                 PositionSolving(subStepDt);
             }
+            endPhase(phases.positionSolve);
             
             Integration();
             StoreImpulses();
             UpdateSleeping();
             UpdateTransformsFromSolver();
+            endPhase(phases.finalize);
         }
 
         // Restore pre-substep positions as previousPosition for correct rendering interpolation.
         // After the sub-step loop, transform.position holds the final physics position.
         // We set previousPosition to the position before this frame's physics step began,
         // so the renderer can interpolate between "before physics" and "after physics".
-        for (const auto& [entityId, posRot] : preSubstepTransforms)
-        {
-            if (m_ComponentStore->HasComponent<TransformComponent>(entityId))
+        RunParallel(m_PreSubstepTransforms.size(), [this](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
             {
-                auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
-                transform.previousPosition = posRot.first;
-                transform.previousRotation = posRot.second;
+                const auto& [entityId, position, rotation] = m_PreSubstepTransforms[i];
+                if (entityId != INVALID_ENTITY && m_ComponentStore->HasComponent<TransformComponent>(entityId))
+                {
+                    auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
+                    transform.previousPosition = position;
+                    transform.previousRotation = rotation;
+                }
             }
+        });
+
+        if (m_Config.stateHashing)
+        {
+            m_Stats.stateHash = ComputeStateHash();
         }
 
         auto endTime = std::chrono::high_resolution_clock::now();
@@ -162,165 +288,538 @@ namespace Nyon::ECS
         m_Stats.updateTime = duration.count();
     }
 
-    void PhysicsPipelineSystem::PrepareBodiesForUpdate()
+    bool PhysicsPipelineSystem::CanSkipIdleStep()
     {
-        m_SolverBodies.clear();
-        m_EntityToSolverIndex.clear();
+        bool requested = m_StepRequested;
+        bool wasIdle = m_Idle;
+        m_Idle = false;
+        if (!m_Config.idleSkipping || requested)
+            return false;
 
-        size_t solverIndex = 0;
-        m_ComponentStore->ForEachComponent<PhysicsBodyComponent>([&](EntityID entityId, PhysicsBodyComponent& body) {
-                // Always include all bodies in the solver regardless of sleep state.
-                // Sleep state only controls whether velocity/position integration occurs.
+        if (m_ComponentStore->GetComponentCount<PhysicsBodyComponent>() != m_LastBodyCount ||
+            m_ComponentStore->GetComponentCount<ColliderComponent>() != m_LastColliderCount)
+            return false;
 
-                // === COMPUTE MASS PROPERTIES FROM COLLIDER SHAPE ===
-                // This ensures inertia is correctly computed from shape geometry
-                if (!body.isStatic && m_ComponentStore->HasComponent<ColliderComponent>(entityId))
-                {
-                    const auto& collider = m_ComponentStore->GetComponent<ColliderComponent>(entityId);
+        bool anyAwake = false;
+        m_ComponentStore->ForEachComponent<PhysicsBodyComponent>([&](EntityID entityId, const PhysicsBodyComponent& body) {
+                anyAwake = anyAwake || (!body.isStatic && body.isEnabled && body.isAwake && !IsParticle(entityId));
+                });
+        if (anyAwake)
+            return false;
 
-                    // Calculate mass from area and density ONLY if not explicitly set
-                    if (!body.massIsExplicit)
-                    {
-                        float area = collider.CalculateArea();
-                        float density = collider.material.density;
-                        float calculatedMass = area * density;
-
-                        // Only update mass if it hasn't been explicitly set (i.e., still default 1.0)
-                        // or if the calculated mass is significantly different
-                        if (body.mass <= 0.0f || std::abs(body.mass - calculatedMass) > 0.01f)
-                        {
-                            body.SetMass(calculatedMass);
-                        }
-                    }
+        // A field that wakes bodies may have sleeping bodies in its volume
+        bool anyWakingField = false;
+        m_ComponentStore->ForEachComponent<ForceFieldComponent>([&](EntityID, const ForceFieldComponent& field) {
+                anyWakingField = anyWakingField || (field.enabled && field.wakeBodies);
+                });
+        if (anyWakingField)
+            return false;
 
-                    // Calculate and set inertia from shape geometry ONLY if not explicitly set
-                    if (!body.inertiaIsExplicit)
-                    {
-                        float unitInertia = collider.CalculateInertiaPerUnitMass();
-                        float calculatedInertia = unitInertia * body.mass;
-
-                        // Only update inertia if it hasn't been explicitly set (i.e., still default 1.0)
-                        // or if the calculated inertia is significantly different
-                        if (body.inertia <= 0.0f || std::abs(body.inertia - calculatedInertia) > 0.01f)
-                        {
-                            body.SetInertia(calculatedInertia);
-                        }
-                    }
-                }
+        // The last full step may have moved bodies slightly before they slept;
+        // settle interpolation once so idle frames render exactly the rest pose
+        if (!wasIdle)
+        {
+            m_ComponentStore->ForEachComponent<PhysicsBodyComponent>([&](EntityID entityId, const PhysicsBodyComponent& body) {
+                    if (body.isStatic || IsParticle(entityId) || !m_ComponentStore->HasComponent<TransformComponent>(entityId))
+                        return;
+                    auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
+                    transform.previousPosition = transform.position;
+                    transform.previousRotation = transform.rotation;
+                    });
+        }
+        m_Idle = true;
+        return true;
+    }
 
-                SolverBody solverBody;
-                solverBody.entityId = entityId;
-                solverBody.isStatic = body.isStatic;
-                solverBody.isAwake = body.isStatic || m_IslandManager->IsBodyAwake(entityId);
-                solverBody.invMass = body.inverseMass;
-                solverBody.invInertia = body.inverseInertia;
-                solverBody.localCenter = body.centerOfMass;
+    uint64_t PhysicsPipelineSystem::ComputeStateHash() const
+    {
+        constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+        constexpr uint64_t FNV_PRIME = 1099511628211ull;
 
-                // Get transform
-                if (m_ComponentStore->HasComponent<TransformComponent>(entityId))
-                {
-                    const auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
-                    solverBody.position = transform.position;
-                    solverBody.angle = transform.rotation;
-                    solverBody.prevPosition = transform.previousPosition;
-                    solverBody.prevAngle = transform.previousRotation;
-                }
+        uint64_t hash = FNV_OFFSET_BASIS;
+        if (!m_ComponentStore)
+            return hash;
 
-                // Get current velocities
-                solverBody.velocity = body.velocity;
-                solverBody.angularVelocity = body.angularVelocity;
+        auto mix = [&hash](const void* data, size_t size) {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash ^= bytes[i];
+                hash *= FNV_PRIME;
+            }
+        };
 
-                // Initialize forces from ECS component (user-applied forces, gravity, etc.)
-                solverBody.force = body.force;
-                solverBody.torque = body.torque;
+        // Pool order changes with spatial sorting and removals; entity IDs do not
+        std::vector<EntityID> bodies;
+        m_ComponentStore->ForEachComponent<PhysicsBodyComponent>([&](EntityID entityId, const PhysicsBodyComponent& body) {
+                if (!body.isStatic && body.isEnabled && !IsParticle(entityId))
+                    bodies.push_back(entityId);
+                });
+        std::sort(bodies.begin(), bodies.end());
 
-                // Copy damping coefficients from physics body
-                solverBody.linearDamping = body.drag;           // Use existing drag field
-                solverBody.angularDamping = body.angularDamping; // Use existing angularDamping field
+        for (EntityID entityId : bodies)
+        {
+            const auto& body = m_ComponentStore->GetComponent<PhysicsBodyComponent>(entityId);
+            mix(&entityId, sizeof(entityId));
+            mix(&body.velocity.x, sizeof(float));
+            mix(&body.velocity.y, sizeof(float));
+            mix(&body.angularVelocity, sizeof(float));
 
-                // Enforce motion locks early in the solver so collisions do not cause unwanted rotation.
-                // This keeps the body stable when lockRotation is enabled (e.g., player character).
-                if (body.motionLocks.lockRotation)
-                {
-                    solverBody.angularVelocity = 0.0f;
-                    solverBody.torque = 0.0f;
-                    solverBody.invInertia = 0.0f;
-                }
+            if (m_ComponentStore->HasComponent<TransformComponent>(entityId))
+            {
+                const auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
+                mix(&transform.position.x, sizeof(float));
+                mix(&transform.position.y, sizeof(float));
+                mix(&transform.rotation, sizeof(float));
+            }
+        }
+        return hash;
+    }
+
+    void PhysicsPipelineSystem::SpatialSort()
+    {
+        auto sortStart = std::chrono::high_resolution_clock::now();
+
+        // Collect awake dynamic bodies and the bounds of their positions
+        std::vector<std::pair<EntityID, Math::Vector2>> awakeBodies;
+        Math::Vector2 boundsMin{ std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+        Math::Vector2 boundsMax{ std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+
+        m_ComponentStore->ForEachComponent<PhysicsBodyComponent>([&](EntityID entityId, const PhysicsBodyComponent& body) {
+                if (body.isStatic || !body.isAwake || IsParticle(entityId) ||
+                    !m_ComponentStore->HasComponent<TransformComponent>(entityId))
+                    return;
+
+                const auto& position = m_ComponentStore->GetComponent<TransformComponent>(entityId).position;
+                boundsMin.x = std::min(boundsMin.x, position.x);
+                boundsMin.y = std::min(boundsMin.y, position.y);
+                boundsMax.x = std::max(boundsMax.x, position.x);
+                boundsMax.y = std::max(boundsMax.y, position.y);
+                awakeBodies.emplace_back(entityId, position);
+                });
+
+        if (awakeBodies.size() < 2)
+            return;
+
+        // Sort by Z-order key; entity ID breaks ties so the order is deterministic
+        std::vector<std::pair<uint32_t, EntityID>> keys;
+        keys.reserve(awakeBodies.size());
+        for (const auto& [entityId, position] : awakeBodies)
+        {
+            keys.emplace_back(Physics::MortonEncode(position, boundsMin, boundsMax), entityId);
+        }
+        std::sort(keys.begin(), keys.end());
+
+        std::vector<EntityID> order;
+        order.reserve(keys.size());
+        for (const auto& key : keys)
+        {
+            order.push_back(key.second);
+        }
+
+        // Permute every pool the pipeline walks per body. Sleeping and static bodies
+        // follow the awake ones. Solver arrays are rebuilt from the body pool order in
+        // PrepareBodiesForUpdate() and broad-phase proxies store entity IDs, so both
+        // pick up the new order without remapping.
+        m_ComponentStore->ReorderComponents<PhysicsBodyComponent>(order);
+        m_ComponentStore->ReorderComponents<ColliderComponent>(order);
+        m_ComponentStore->ReorderComponents<TransformComponent>(order);
+
+        auto sortEnd = std::chrono::high_resolution_clock::now();
+        m_Stats.spatialSortTime = std::chrono::duration<float, std::milli>(sortEnd - sortStart).count();
+        m_Stats.spatialSorts++;
+    }
 
-                // Enforce translation motion locks on solver body velocity at setup.
-                // This ensures the solver starts with correct velocities in locked axes.
-                // Post-solver enforcement happens in Integration() and UpdateTransformsFromSolver().
-                if (body.motionLocks.lockTranslationX)
+    void PhysicsPipelineSystem::UpdateSimulationLOD()
+    {
+        m_Stats.lodReducedRateBodies = 0;
+        m_Stats.lodDeferredBodies = 0;
+
+        if (!m_Config.simulationLOD || !m_HasLODFocus)
+        {
+            // Bodies still holding accumulated time catch up on this tick, then LOD state is dropped
+            for (auto it = m_LODStates.begin(); it != m_LODStates.end();)
+            {
+                if (it->second.due)
                 {
-                    solverBody.velocity.x = 0.0f;
+                    it = m_LODStates.erase(it);
                 }
-                if (body.motionLocks.lockTranslationY)
+                else
                 {
-                    solverBody.velocity.y = 0.0f;
+                    it->second.pendingTicks++;
+                    it->second.due = true;
+                    ++it;
                 }
+            }
+            return;
+        }
 
-                // Clear ECS-side forces so they don't accumulate across frames
-                body.ClearForces();
+        m_LODTick++;
+
+        auto levelForDistance = [this](float distance) -> uint32_t {
+            if (distance > m_Config.lodEighthRateDistance) return 3;
+            if (distance > m_Config.lodQuarterRateDistance) return 2;
+            if (distance > m_Config.lodHalfRateDistance) return 1;
+            return 0;
+        };
+
+        // Islands from the previous step decide the rate: an island is one solver problem,
+        // so all of its bodies must step on the same ticks. Bodies not in an awake island
+        // (sleeping, or new this step) get no state and step every tick.
+        std::unordered_map<uint32_t, LODState> states;
+        const auto& islands = m_IslandManager->GetIslands();
+        for (size_t islandIndex = 0; islandIndex < islands.size(); ++islandIndex)
+        {
+            const auto& island = islands[islandIndex];
+            if (!island.isAwake)
+                continue;
 
-                m_SolverBodies.push_back(solverBody);
-                m_EntityToSolverIndex[entityId] = solverIndex++;
-        });
+            Math::Vector2 boundsMin{ std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+            Math::Vector2 boundsMax{ std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+            bool hasBounds = false;
+            uint32_t previousLevel = 0;
+            for (auto bodyId : island.bodyIds)
+            {
+                if (!m_ComponentStore->HasComponent<TransformComponent>(bodyId))
+                    continue;
+
+                const auto& position = m_ComponentStore->GetComponent<TransformComponent>(bodyId).position;
+                boundsMin.x = std::min(boundsMin.x, position.x);
+                boundsMin.y = std::min(boundsMin.y, position.y);
+                boundsMax.x = std::max(boundsMax.x, position.x);
+                boundsMax.y = std::max(boundsMax.y, position.y);
+                hasBounds = true;
+
+                auto previous = m_LODStates.find(bodyId);
+                if (previous != m_LODStates.end())
+                    previousLevel = std::max(previousLevel, previous->second.level);
+            }
+
+            if (!hasBounds)
+                continue;
+
+            // Distance from the focus to the island bounds, so its nearest body sets the rate
+            Math::Vector2 closest{
+                std::clamp(m_LODFocus.x, boundsMin.x, boundsMax.x),
+                std::clamp(m_LODFocus.y, boundsMin.y, boundsMax.y)
+            };
+            float distance = (m_LODFocus - closest).Length();
+
+            // Drop to a lower rate only once clearly past the threshold, so islands near a
+            // boundary do not flip between rates every tick
+            uint32_t level = levelForDistance(distance);
+            if (level > previousLevel)
+                level = std::max(previousLevel, levelForDistance(distance - m_Config.lodHysteresis));
+
+            // An island that got closer steps right away, flushing its accumulated time in one
+            // step. Otherwise all islands of a level share the same ticks: deferred bodies
+            // generate no contacts, so an island can split while deferred and its pieces
+            // must still step together.
+            uint32_t divisor = 1u << level;
+            bool due = level < previousLevel || (m_LODTick % divisor) == 0;
+
+            for (auto bodyId : island.bodyIds)
+            {
+                LODState state;
+                state.level = level;
+                state.due = due;
+                state.island = islandIndex;
+
+                auto previous = m_LODStates.find(bodyId);
+                state.pendingTicks = (previous != m_LODStates.end() && !previous->second.due)
+                    ? previous->second.pendingTicks + 1 : 1;
+                states[bodyId] = state;
+
+                if (level > 0)
+                    m_Stats.lodReducedRateBodies++;
+                if (!due)
+                    m_Stats.lodDeferredBodies++;
+            }
+        }
+
+        m_LODStates.swap(states);
     }
 
-    void PhysicsPipelineSystem::BroadPhaseDetection()
+    void PhysicsPipelineSystem::PromoteDeferredContacts()
     {
-        m_BroadPhasePairs.clear();
+        if (m_LODStates.empty())
+            return;
 
-        // DON'T clear m_ShapeProxyMap - we need to preserve proxy IDs across frames
-        // Only remove proxies for entities that no longer have colliders
-        std::vector<uint32_t> entitiesToRemove;
-        for (const auto& [entityId, proxyId] : m_ShapeProxyMap)
+        // A stepping body touched a deferred one: step the deferred body's whole island now
+        // with its accumulated time instead of letting the stepping body push into a frozen one.
+        std::vector<size_t> promotedIslands;
+        for (const auto& manifold : m_ContactManifolds)
         {
-            if (!m_ComponentStore->HasComponent<ColliderComponent>(entityId))
+            for (uint32_t entityId : { manifold.entityIdA, manifold.entityIdB })
             {
-                entitiesToRemove.push_back(entityId);
+                auto it = m_LODStates.find(entityId);
+                if (it != m_LODStates.end() && !it->second.due)
+                    promotedIslands.push_back(it->second.island);
             }
         }
 
-        for (uint32_t entityId : entitiesToRemove)
+        if (promotedIslands.empty())
+            return;
+
+        for (auto& solverBody : m_SolverBodies)
         {
-            uint32_t proxyId = m_ShapeProxyMap[entityId];
-            m_BroadPhaseTree.DestroyProxy(proxyId);
-            m_ShapeProxyMap.erase(entityId);
+            if (solverBody.dtScale != 0.0f)
+                continue;
+
+            auto it = m_LODStates.find(solverBody.entityId);
+            if (it == m_LODStates.end() ||
+                std::find(promotedIslands.begin(), promotedIslands.end(), it->second.island) == promotedIslands.end())
+                continue;
+
+            it->second.due = true;
+            solverBody.dtScale = static_cast<float>(it->second.pendingTicks);
+            if (m_Stats.lodDeferredBodies > 0)
+                m_Stats.lodDeferredBodies--;
         }
+    }
 
-        // Update broad phase tree and collect potential pairs
-        m_ComponentStore->ForEachComponent<ColliderComponent>([&](EntityID entityId, ColliderComponent& collider) {
-                if (!m_ComponentStore->HasComponent<TransformComponent>(entityId))
-                return;
+    bool PhysicsPipelineSystem::IsLODDeferred(uint32_t entityId) const
+    {
+        if (m_LODStates.empty())
+            return false;
 
-                const auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
+        auto it = m_LODStates.find(entityId);
+        return it != m_LODStates.end() && !it->second.due;
+    }
 
-                // Update shape AABB in broad phase tree
-                UpdateShapeAABB(entityId, &collider, transform.position, transform.rotation);
-                });
+    bool PhysicsPipelineSystem::IsParticle(uint32_t entityId) const
+    {
+        return m_HasParticles && m_ComponentStore->HasComponent<ParticleComponent>(entityId);
+    }
 
-        // Query broad phase for overlapping pairs using DynamicTree
-        // This is O(n log n) instead of O(n²) brute force
+    void PhysicsPipelineSystem::CollectFrozenContacts()
+    {
+        // Manifolds of a frozen body with bodies that are frozen, static or deferred: nobody
+        // queries for them this step, so keep last step's copy. The islands stay linked (a
+        // sleeping stack still wakes as one) and the constraints keep their warm-start
+        // impulses for the wake.
+        m_FrozenManifolds.clear();
+        if (!m_Config.freezeSleepingProxies)
+            return;
 
-        for (const auto& [entityId, proxyId] : m_ShapeProxyMap)
+        // Bodies that lost their proxy (removed colliders) end the contact
+        auto notQuerying = [this](uint32_t entityId) {
+            auto it = m_ShapeProxyMap.find(entityId);
+            if (it == m_ShapeProxyMap.end())
+                return false;
+            if (m_BroadPhaseTree.IsProxyFrozen(it->second) || IsLODDeferred(entityId))
+                return true;
+            return !m_ComponentStore->HasComponent<PhysicsBodyComponent>(entityId) ||
+                   m_ComponentStore->GetComponent<PhysicsBodyComponent>(entityId).isStatic;
+        };
+        for (const auto& manifold : m_ContactManifolds)
         {
-            // Only query for dynamic bodies (static bodies don't initiate collision checks)
-            if (!m_ComponentStore->HasComponent<PhysicsBodyComponent>(entityId))
-                continue;
+            if ((IsFrozen(manifold.entityIdA) || IsFrozen(manifold.entityIdB)) &&
+                notQuerying(manifold.entityIdA) && notQuerying(manifold.entityIdB))
+            {
+                m_FrozenManifolds.push_back(manifold);
+            }
+        }
+    }
 
-            const auto& body = m_ComponentStore->GetComponent<PhysicsBodyComponent>(entityId);
-            if (body.isStatic)
-                continue;
+    void PhysicsPipelineSystem::RetainFrozenContacts()
+    {
+        m_Stats.retainedContacts = m_FrozenManifolds.size();
+        if (m_FrozenManifolds.empty())
+            return;
+
+        // Frozen pairs were never queried, so none of these is already in the narrow phase output
+        PhysicsWorldComponent* world = nullptr;
+        if (m_PhysicsWorldEntity != INVALID_ENTITY && m_ComponentStore) {
+            world = &m_ComponentStore->GetComponent<PhysicsWorldComponent>(m_PhysicsWorldEntity);
+        }
+        for (const auto& manifold : m_FrozenManifolds)
+        {
+            uint64_t key = (static_cast<uint64_t>(std::min(manifold.entityIdA, manifold.entityIdB)) << 32) |
+                static_cast<uint64_t>(std::max(manifold.entityIdA, manifold.entityIdB));
+            m_ContactMap[key] = m_ContactManifolds.size();
+            m_ContactManifolds.push_back(manifold);
+            if (world)
+                world->contactManifolds.push_back(manifold);
+        }
+        m_Stats.narrowPhaseContacts = m_ContactManifolds.size();
+    }
+
+    bool PhysicsPipelineSystem::IsFrozen(uint32_t entityId) const
+    {
+        auto it = m_ShapeProxyMap.find(entityId);
+        return it != m_ShapeProxyMap.end() && m_BroadPhaseTree.IsProxyFrozen(it->second);
+    }
+
+    void PhysicsPipelineSystem::PrepareBodiesForUpdate()
+    {
+        // Always include all bodies in the solver regardless of sleep state.
+        // Sleep state only controls whether velocity/position integration occurs.
+        // Disabled (pooled) bodies and particles are left out entirely.
+        m_PreparedBodies.clear();
+        m_HasMotionLocks = false;
+        m_ComponentStore->ForEachComponent<PhysicsBodyComponent>([&](EntityID entityId, PhysicsBodyComponent& body) {
+                if (!body.isEnabled || IsParticle(entityId))
+                    return;
+                const auto& locks = body.motionLocks;
+                m_HasMotionLocks |= locks.lockTranslationX || locks.lockTranslationY || locks.lockRotation;
+                TransformComponent* transform = m_ComponentStore->HasComponent<TransformComponent>(entityId)
+                    ? &m_ComponentStore->GetComponent<TransformComponent>(entityId) : nullptr;
+                m_PreparedBodies.push_back({entityId, &body, transform});
+        });
+
+        // Each solver body only reads and writes its own components
+        m_SolverBodies.resize(m_PreparedBodies.size());
+        RunParallel(m_PreparedBodies.size(), [this](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
+            {
+                const PreparedBody& prepared = m_PreparedBodies[i];
+                PrepareSolverBody(prepared.entityId, *prepared.body, prepared.transform, m_SolverBodies[i]);
+            }
+        });
+
+        m_EntityToSolverIndex.clear();
+        for (size_t i = 0; i < m_PreparedBodies.size(); ++i)
+        {
+            m_EntityToSolverIndex[m_PreparedBodies[i].entityId] = i;
+        }
+    }
+
+    void PhysicsPipelineSystem::PrepareSolverBody(EntityID entityId, PhysicsBodyComponent& body,
+                                                  const TransformComponent* transform, SolverBody& solverBody)
+    {
+        // === COMPUTE MASS PROPERTIES FROM COLLIDER SHAPE ===
+        // This ensures inertia is correctly computed from shape geometry
+        if (!body.isStatic && m_ComponentStore->HasComponent<ColliderComponent>(entityId))
+        {
+            const auto& collider = m_ComponentStore->GetComponent<ColliderComponent>(entityId);
+
+            // Calculate mass from area and density ONLY if not explicitly set
+            if (!body.massIsExplicit)
+            {
+                float area = collider.CalculateArea();
+                float density = collider.material.density;
+                float calculatedMass = area * density;
+
+                // Only update mass if it hasn't been explicitly set (i.e., still default 1.0)
+                // or if the calculated mass is significantly different
+                if (body.mass <= 0.0f || std::abs(body.mass - calculatedMass) > 0.01f)
+                {
+                    body.SetMass(calculatedMass);
+                }
+            }
 
-            // Get the fat AABB for this proxy
-            const auto& fatAABB = m_BroadPhaseTree.GetFatAABB(proxyId);
+            // Calculate and set inertia from shape geometry ONLY if not explicitly set
+            if (!body.inertiaIsExplicit)
+            {
+                float unitInertia = collider.CalculateInertiaPerUnitMass();
+                float calculatedInertia = unitInertia * body.mass;
 
-            // Query the tree for overlapping proxies
-            BroadPhaseCallback callback;
-            callback.system = this;
-            callback.entityId = entityId;
-            m_BroadPhaseTree.Query(fatAABB, &callback);
+                // Only update inertia if it hasn't been explicitly set (i.e., still default 1.0)
+                // or if the calculated inertia is significantly different
+                if (body.inertia <= 0.0f || std::abs(body.inertia - calculatedInertia) > 0.01f)
+                {
+                    body.SetInertia(calculatedInertia);
+                }
+            }
+        }
+
+        solverBody = SolverBody();
+        solverBody.entityId = entityId;
+        solverBody.isStatic = body.isStatic;
+        // The component flag mirrors the island state after UpdateSleeping() and
+        // also picks up wakes from SetAwake(), forces and impulses since then
+        solverBody.isAwake = body.isStatic || body.isAwake;
+        solverBody.invMass = body.inverseMass;
+        solverBody.invInertia = body.inverseInertia;
+        solverBody.localCenter = body.centerOfMass;
+
+        // Get transform
+        if (transform)
+        {
+            solverBody.position = transform->position;
+            solverBody.angle = transform->rotation;
+            solverBody.prevPosition = transform->previousPosition;
+            solverBody.prevAngle = transform->previousRotation;
+        }
+
+        // Get current velocities
+        solverBody.velocity = body.velocity;
+        solverBody.angularVelocity = body.angularVelocity;
+
+        // Initialize forces from ECS component (user-applied forces, gravity, etc.)
+        solverBody.force = body.force;
+        solverBody.torque = body.torque;
+
+        // Copy damping coefficients from physics body
+        solverBody.linearDamping = body.drag;           // Use existing drag field
+        solverBody.angularDamping = body.angularDamping; // Use existing angularDamping field
+
+        // Simulation LOD: deferred bodies skip integration, due bodies integrate
+        // every tick accumulated since they last stepped
+        solverBody.dtScale = 1.0f;
+        if (!m_LODStates.empty())
+        {
+            auto lodIt = m_LODStates.find(entityId);
+            if (lodIt != m_LODStates.end())
+                solverBody.dtScale = lodIt->second.due ? static_cast<float>(lodIt->second.pendingTicks) : 0.0f;
+        }
+
+        // Enforce motion locks early in the solver so collisions do not cause unwanted rotation.
+        // This keeps the body stable when lockRotation is enabled (e.g., player character).
+        if (body.motionLocks.lockRotation)
+        {
+            solverBody.angularVelocity = 0.0f;
+            solverBody.torque = 0.0f;
+            solverBody.invInertia = 0.0f;
+        }
+
+        // Enforce translation motion locks on solver body velocity at setup.
+        // This ensures the solver starts with correct velocities in locked axes.
+        // Post-solver enforcement happens in Integration() and UpdateTransformsFromSolver().
+        if (body.motionLocks.lockTranslationX)
+        {
+            solverBody.velocity.x = 0.0f;
+        }
+        if (body.motionLocks.lockTranslationY)
+        {
+            solverBody.velocity.y = 0.0f;
+        }
+
+        // Clear ECS-side forces so they don't accumulate across frames
+        body.ClearForces();
+    }
+
+    void PhysicsPipelineSystem::BroadPhaseDetection()
+    {
+        m_BroadPhasePairs.clear();
+
+        RemoveStaleProxies();
+
+        // Update broad phase tree and collect potential pairs
+        RefitBroadPhaseProxies();
+        CollectFrozenContacts();
+
+        // Query broad phase for overlapping pairs using DynamicTree
+        // This is O(n log n) instead of O(n²) brute force
+
+        // Only dynamic bodies query (static bodies don't initiate collision checks).
+        // Walking m_ActiveEntities follows the dense body pool order, so spatially
+        // sorted pools yield spatially coherent pair lists for the narrow phase, and
+        // coherent packets for the batched tree traversal.
+        GatherBroadPhaseQueries();
+        size_t packetCount = (m_BroadPhaseQueryEntities.size() + Physics::DynamicTree::PACKET_SIZE - 1) /
+                             Physics::DynamicTree::PACKET_SIZE;
+        for (size_t packet = 0; packet < packetCount; ++packet)
+        {
+            QueryBroadPhasePacket(packet, m_BroadPhaseHits, m_BroadPhaseSortedHits, m_BroadPhasePairs);
+        }
+
+        // Tree traversal order depends on the tree's shape; sorting makes the pair list
+        // (and so constraint order) a function of the contacts alone
+        if (m_Config.deterministic)
+        {
+            std::sort(m_BroadPhasePairs.begin(), m_BroadPhasePairs.end());
         }
 
         m_Stats.broadPhasePairs = m_BroadPhasePairs.size();
@@ -370,6 +869,7 @@ namespace Nyon::ECS
     {
         if (m_Config.useIslandSleeping)
         {
+            m_IslandManager->SetDeterministic(m_Config.deterministic);
             m_IslandManager->UpdateIslands(Nyon::FIXED_TIMESTEP, m_ActiveEntities);
             m_Stats.islandStats = m_IslandManager->GetStatistics();
         }
@@ -377,143 +877,394 @@ namespace Nyon::ECS
 
     void PhysicsPipelineSystem::ConstraintInitialization()
     {
-        m_VelocityConstraints.clear();
+        // Pair manifolds with their solver bodies; manifolds whose bodies left the solver get no constraint
+        m_ConstraintSources.clear();
+        for (size_t m = 0; m < m_ContactManifolds.size(); ++m)
+        {
+            auto itA = m_EntityToSolverIndex.find(m_ContactManifolds[m].entityIdA);
+            auto itB = m_EntityToSolverIndex.find(m_ContactManifolds[m].entityIdB);
+            if (itA != m_EntityToSolverIndex.end() && itB != m_EntityToSolverIndex.end())
+            {
+                m_ConstraintSources.push_back({m, itA->second, itB->second});
+            }
+        }
 
-        // Create velocity constraints from contact manifolds
-        for (const auto& manifold : m_ContactManifolds)
+        // Use world restitution threshold instead of hardcoded value
+        float restitutionThreshold = 0.0f;
+        if (m_PhysicsWorldEntity != INVALID_ENTITY && m_ComponentStore)
         {
-            VelocityConstraint vc;
-            vc.normal = manifold.normal;
-            vc.tangent = Math::Vector2{-manifold.normal.y, manifold.normal.x};
-            
-            // Convert ECS::ContactPoint to ContactPointConstraint (solver-only data)
-            vc.points.reserve(manifold.points.size());
-            for (const auto& ecsPoint : manifold.points)
+            restitutionThreshold = m_ComponentStore->GetComponent<PhysicsWorldComponent>(m_PhysicsWorldEntity).restitutionThreshold;
+        }
+
+        // Constraints are independent of each other; resizing keeps the point storage
+        // of last step's constraints
+        m_VelocityConstraints.resize(m_ConstraintSources.size());
+        RunParallel(m_ConstraintSources.size(), [this, restitutionThreshold](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
             {
-                ContactPointConstraint constraintPoint;
-                constraintPoint.position = ecsPoint.position;
-                constraintPoint.normal = ecsPoint.normal;
-                constraintPoint.separation = ecsPoint.separation;
-                constraintPoint.normalImpulse = ecsPoint.normalImpulse;
-                constraintPoint.tangentImpulse = ecsPoint.tangentImpulse;
-                constraintPoint.normalMass = ecsPoint.normalMass;
-                constraintPoint.tangentMass = ecsPoint.tangentMass;
-                constraintPoint.velocityBias = ecsPoint.velocityBias;
-                constraintPoint.featureId = ecsPoint.featureId;
-                vc.points.push_back(constraintPoint);
+                const ConstraintSource& source = m_ConstraintSources[i];
+                InitializeVelocityConstraint(m_ContactManifolds[source.manifold], source.indexA, source.indexB,
+                                             restitutionThreshold, m_VelocityConstraints[i]);
             }
+        });
 
-            // Get solver indices
-            auto itA = m_EntityToSolverIndex.find(manifold.entityIdA);
-            auto itB = m_EntityToSolverIndex.find(manifold.entityIdB);
+        m_Stats.activeConstraints = m_VelocityConstraints.size();
 
-            if (itA != m_EntityToSolverIndex.end() && itB != m_EntityToSolverIndex.end())
+        if (m_Config.adaptiveIterations || m_Config.multiThreading)
+        {
+            GroupConstraintsByIsland();
+        }
+        else
+        {
+            m_ConstraintIslandRanges.clear();
+        }
+    }
+
+    void PhysicsPipelineSystem::InitializeVelocityConstraint(const ECS::ContactManifold& manifold, size_t indexA, size_t indexB,
+                                                             float restitutionThreshold, VelocityConstraint& vc)
+    {
+        vc.normal = manifold.normal;
+        vc.tangent = Math::Vector2{-manifold.normal.y, manifold.normal.x};
+        
+        // Convert ECS::ContactPoint to ContactPointConstraint (solver-only data)
+        vc.points.clear();
+        for (const auto& ecsPoint : manifold.points)
+        {
+            ContactPointConstraint constraintPoint;
+            constraintPoint.position = ecsPoint.position;
+            constraintPoint.normal = ecsPoint.normal;
+            constraintPoint.separation = ecsPoint.separation;
+            constraintPoint.normalImpulse = ecsPoint.normalImpulse;
+            constraintPoint.tangentImpulse = ecsPoint.tangentImpulse;
+            constraintPoint.normalMass = ecsPoint.normalMass;
+            constraintPoint.tangentMass = ecsPoint.tangentMass;
+            constraintPoint.velocityBias = ecsPoint.velocityBias;
+            constraintPoint.featureId = ecsPoint.featureId;
+            vc.points.push_back(constraintPoint);
+        }
+
+        vc.indexA = static_cast<uint32_t>(indexA);
+        vc.indexB = static_cast<uint32_t>(indexB);
+
+        const auto& bodyA = m_SolverBodies[vc.indexA];
+        const auto& bodyB = m_SolverBodies[vc.indexB];
+
+        vc.invMassA = bodyA.invMass;
+        vc.invMassB = bodyB.invMass;
+        vc.invIA = bodyA.invInertia;
+        vc.invIB = bodyB.invInertia;
+
+        // === COMPUTE FRICTION AND RESTITUTION FROM MATERIALS ===
+        // Look up both colliders to get material properties
+        const auto& colliderA = m_ComponentStore->GetComponent<ColliderComponent>(manifold.entityIdA);
+        const auto& colliderB = m_ComponentStore->GetComponent<ColliderComponent>(manifold.entityIdB);
+
+        // Mix friction using geometric mean (standard approach)
+        vc.friction = std::sqrt(colliderA.material.friction * colliderB.material.friction);
+
+        // Mix restitution using maximum (standard approach)
+        vc.restitution = std::max(colliderA.material.restitution, colliderB.material.restitution);
+
+        // Precompute world centroids for this constraint (used by all points)
+        float initCosA = std::cos(bodyA.angle);
+        float initSinA = std::sin(bodyA.angle);
+        Math::Vector2 initWorldCentroidA = bodyA.position + Math::Vector2{
+            bodyA.localCenter.x * initCosA - bodyA.localCenter.y * initSinA,
+            bodyA.localCenter.x * initSinA + bodyA.localCenter.y * initCosA
+        };
+
+        float initCosB = std::cos(bodyB.angle);
+        float initSinB = std::sin(bodyB.angle);
+        Math::Vector2 initWorldCentroidB = bodyB.position + Math::Vector2{
+            bodyB.localCenter.x * initCosB - bodyB.localCenter.y * initSinB,
+            bodyB.localCenter.x * initSinB + bodyB.localCenter.y * initCosB
+        };
+
+        // Compute effective mass for each contact point
+        for (auto& point : vc.points)
+        {
+            // Moment arms from body centers of mass to contact point
+            Math::Vector2 rA = point.position - initWorldCentroidA;
+            Math::Vector2 rB = point.position - initWorldCentroidB;
+
+            // Cross products with normal (scalar, since 2D)
+            float rAcrossN = Math::Vector2::Cross(rA, vc.normal);
+            float rBcrossN = Math::Vector2::Cross(rB, vc.normal);
+
+            // Effective mass = sum of translational and rotational contributions
+            float kNormal = vc.invMassA + vc.invMassB
+                + vc.invIA * rAcrossN * rAcrossN
+                + vc.invIB * rBcrossN * rBcrossN;
+
+            point.normalMass = (kNormal > 1e-6f) ? (1.0f / kNormal) : 0.0f;
+
+            // Tangent mass (for friction)
+            float rAcrossT = Math::Vector2::Cross(rA, vc.tangent);
+            float rBcrossT = Math::Vector2::Cross(rB, vc.tangent);
+            float kTangent = vc.invMassA + vc.invMassB
+                + vc.invIA * rAcrossT * rAcrossT
+                + vc.invIB * rBcrossT * rBcrossT;
+            point.tangentMass = (kTangent > 1e-6f) ? (1.0f / kTangent) : 0.0f;
+
+            // Compute velocity bias for restitution (bounce)
+            Math::Vector2 vA = bodyA.velocity;
+            Math::Vector2 vB = bodyB.velocity;
+            float wA = bodyA.angularVelocity;
+            float wB = bodyB.angularVelocity;
+
+            // Relative velocity at contact point
+            Math::Vector2 relVel = vB + Math::Vector2::Cross(wB, rB)
+                - vA - Math::Vector2::Cross(wA, rA);
+            float vRel = Math::Vector2::Dot(relVel, vc.normal);
+
+            if (vRel < -restitutionThreshold)
+            {
+                point.velocityBias = -vc.restitution * vRel;
+            }
+            else
+            {
+                point.velocityBias = 0.0f;
+            }
+
+            // Restore cached impulses for warm starting
+            uint64_t cacheKey = MakeImpulseCacheKey(manifold.entityIdA, manifold.entityIdB, point.featureId);
+            auto cacheIt = m_ImpulseCache.find(cacheKey);
+            if (cacheIt != m_ImpulseCache.end())
+            {
+                point.normalImpulse = cacheIt->second.normalImpulse;
+                point.tangentImpulse = cacheIt->second.tangentImpulse;
+            }
+        }
+    }
+
+    void PhysicsPipelineSystem::GroupConstraintsByIsland()
+    {
+        m_ConstraintIslandRanges.clear();
+        const size_t constraintCount = m_VelocityConstraints.size();
+        if (constraintCount == 0)
+            return;
+
+        // Union the dynamic bodies of every constraint. Static bodies are never written
+        // by the solver and do not join islands, so no two islands share a body that is
+        // written and each can be solved on its own.
+        m_IslandParents.resize(m_SolverBodies.size());
+        std::iota(m_IslandParents.begin(), m_IslandParents.end(), 0u);
+        auto findRoot = [this](uint32_t i) {
+            while (m_IslandParents[i] != i)
+            {
+                m_IslandParents[i] = m_IslandParents[m_IslandParents[i]];
+                i = m_IslandParents[i];
+            }
+            return i;
+        };
+        for (const auto& constraint : m_VelocityConstraints)
+        {
+            if (m_SolverBodies[constraint.indexA].isStatic || m_SolverBodies[constraint.indexB].isStatic)
+                continue;
+            uint32_t rootA = findRoot(constraint.indexA);
+            uint32_t rootB = findRoot(constraint.indexB);
+            if (rootA != rootB)
+                m_IslandParents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+        }
+
+        // Number islands by their first constraint, then counting sort. Order within an
+        // island is preserved, and since islands are independent, solving them one after
+        // the other gives the same result as the ungrouped Gauss-Seidel sweep.
+        constexpr uint32_t UNASSIGNED = std::numeric_limits<uint32_t>::max();
+        m_IslandOfRoot.assign(m_SolverBodies.size(), UNASSIGNED);
+        m_ConstraintIsland.resize(constraintCount);
+        m_IslandOffsets.clear();
+        for (size_t c = 0; c < constraintCount; ++c)
+        {
+            const auto& constraint = m_VelocityConstraints[c];
+            uint32_t root = findRoot(m_SolverBodies[constraint.indexA].isStatic ? constraint.indexB : constraint.indexA);
+            if (m_IslandOfRoot[root] == UNASSIGNED)
+            {
+                m_IslandOfRoot[root] = static_cast<uint32_t>(m_IslandOffsets.size());
+                m_IslandOffsets.push_back(0);
+            }
+            m_ConstraintIsland[c] = m_IslandOfRoot[root];
+            ++m_IslandOffsets[m_IslandOfRoot[root]];
+        }
+
+        for (size_t island = 0, offset = 0; island < m_IslandOffsets.size(); ++island)
+        {
+            size_t count = m_IslandOffsets[island];
+            m_ConstraintIslandRanges.emplace_back(offset, offset + count);
+            m_IslandOffsets[island] = offset;
+            offset += count;
+        }
+
+        // Swap rather than move so both buffers keep their point storage for next step
+        m_GroupedConstraints.resize(constraintCount);
+        for (size_t c = 0; c < constraintCount; ++c)
+        {
+            std::swap(m_GroupedConstraints[m_IslandOffsets[m_ConstraintIsland[c]]++], m_VelocityConstraints[c]);
+        }
+        m_VelocityConstraints.swap(m_GroupedConstraints);
+    }
+
+    template<typename Policy>
+    void PhysicsPipelineSystem::SolveVelocityIterations()
+    {
+        if (m_ConstraintIslandRanges.empty())
+        {
+            for (int i = 0; i < m_Config.velocityIterations; ++i)
+            {
+                SolveVelocityConstraints<Policy>(0, m_VelocityConstraints.size());
+            }
+            return;
+        }
+
+        // Islands run side by side on the ThreadPool. With adaptive iterations each one
+        // stops on its own once an iteration changes no contact velocity by more than the
+        // tolerance; islands are independent, so this matches interleaving their iterations.
+        constexpr bool adaptive = Policy::adaptiveIterations;
+        const int minIterations = adaptive ? std::max(1, m_Config.minVelocityIterations) : m_Config.velocityIterations;
+        const int maxIterations = adaptive ? std::max(minIterations, m_Config.maxVelocityIterations) : m_Config.velocityIterations;
+        m_IslandIterations.resize(m_ConstraintIslandRanges.size());
+        RunParallel(m_ConstraintIslandRanges.size(), [&](size_t start, size_t end) {
+            for (size_t island = start; island < end; ++island)
             {
-                vc.indexA = itA->second;
-                vc.indexB = itB->second;
-
-                const auto& bodyA = m_SolverBodies[vc.indexA];
-                const auto& bodyB = m_SolverBodies[vc.indexB];
-
-                vc.invMassA = bodyA.invMass;
-                vc.invMassB = bodyB.invMass;
-                vc.invIA = bodyA.invInertia;
-                vc.invIB = bodyB.invInertia;
-
-                // === COMPUTE FRICTION AND RESTITUTION FROM MATERIALS ===
-                // Look up both colliders to get material properties
-                const auto& colliderA = m_ComponentStore->GetComponent<ColliderComponent>(manifold.entityIdA);
-                const auto& colliderB = m_ComponentStore->GetComponent<ColliderComponent>(manifold.entityIdB);
-
-                // Mix friction using geometric mean (standard approach)
-                vc.friction = std::sqrt(colliderA.material.friction * colliderB.material.friction);
-
-                // Mix restitution using maximum (standard approach)
-                vc.restitution = std::max(colliderA.material.restitution, colliderB.material.restitution);
-
-                // Precompute world centroids for this constraint (used by all points)
-                float initCosA = std::cos(bodyA.angle);
-                float initSinA = std::sin(bodyA.angle);
-                Math::Vector2 initWorldCentroidA = bodyA.position + Math::Vector2{
-                    bodyA.localCenter.x * initCosA - bodyA.localCenter.y * initSinA,
-                    bodyA.localCenter.x * initSinA + bodyA.localCenter.y * initCosA
-                };
-
-                float initCosB = std::cos(bodyB.angle);
-                float initSinB = std::sin(bodyB.angle);
-                Math::Vector2 initWorldCentroidB = bodyB.position + Math::Vector2{
-                    bodyB.localCenter.x * initCosB - bodyB.localCenter.y * initSinB,
-                    bodyB.localCenter.x * initSinB + bodyB.localCenter.y * initCosB
-                };
-
-                // Compute effective mass for each contact point
-                for (auto& point : vc.points)
+                const auto [begin, last] = m_ConstraintIslandRanges[island];
+                int iterations = 0;
+                while (iterations < maxIterations)
                 {
-                    // Moment arms from body centers of mass to contact point
-                    Math::Vector2 rA = point.position - initWorldCentroidA;
-                    Math::Vector2 rB = point.position - initWorldCentroidB;
-
-                    // Cross products with normal (scalar, since 2D)
-                    float rAcrossN = Math::Vector2::Cross(rA, vc.normal);
-                    float rBcrossN = Math::Vector2::Cross(rB, vc.normal);
-
-                    // Effective mass = sum of translational and rotational contributions
-                    float kNormal = vc.invMassA + vc.invMassB
-                        + vc.invIA * rAcrossN * rAcrossN
-                        + vc.invIB * rBcrossN * rBcrossN;
-
-                    point.normalMass = (kNormal > 1e-6f) ? (1.0f / kNormal) : 0.0f;
-
-                    // Tangent mass (for friction)
-                    float rAcrossT = Math::Vector2::Cross(rA, vc.tangent);
-                    float rBcrossT = Math::Vector2::Cross(rB, vc.tangent);
-                    float kTangent = vc.invMassA + vc.invMassB
-                        + vc.invIA * rAcrossT * rAcrossT
-                        + vc.invIB * rBcrossT * rBcrossT;
-                    point.tangentMass = (kTangent > 1e-6f) ? (1.0f / kTangent) : 0.0f;
-
-                    // Compute velocity bias for restitution (bounce)
-                    Math::Vector2 vA = bodyA.velocity;
-                    Math::Vector2 vB = bodyB.velocity;
-                    float wA = bodyA.angularVelocity;
-                    float wB = bodyB.angularVelocity;
-
-                    // Relative velocity at contact point
-                    Math::Vector2 relVel = vB + Math::Vector2::Cross(wB, rB)
-                        - vA - Math::Vector2::Cross(wA, rA);
-                    float vRel = Math::Vector2::Dot(relVel, vc.normal);
-
-                    // Use world restitution threshold instead of hardcoded value
-                    float restitutionThreshold = 0.0f;
-                    if (m_PhysicsWorldEntity != INVALID_ENTITY && m_ComponentStore)
-                    {
-                        restitutionThreshold = m_ComponentStore->GetComponent<PhysicsWorldComponent>(m_PhysicsWorldEntity).restitutionThreshold;
-                    }
+                    float residual = SolveVelocityConstraints<Policy>(begin, last);
+                    ++iterations;
+                    if (adaptive && iterations >= minIterations && residual <= m_Config.velocityTolerance)
+                        break;
+                }
+                m_IslandIterations[island] = iterations;
+            }
+        }, IslandGrain());
 
-                    if (vRel < -restitutionThreshold)
-                    {
-                        point.velocityBias = -vc.restitution * vRel;
-                    }
-                    else
-                    {
-                        point.velocityBias = 0.0f;
-                    }
+        if constexpr (adaptive)
+        {
+            for (int iterations : m_IslandIterations)
+            {
+                m_Stats.velocityIterationsTotal += static_cast<size_t>(iterations);
+                m_Stats.velocityIterationsMax = std::max(m_Stats.velocityIterationsMax, static_cast<size_t>(iterations));
+            }
+            m_Stats.solverIslands += m_ConstraintIslandRanges.size();
+        }
+    }
 
-                    // Restore cached impulses for warm starting
-                    uint64_t cacheKey = MakeImpulseCacheKey(manifold.entityIdA, manifold.entityIdB, point.featureId);
-                    auto cacheIt = m_ImpulseCache.find(cacheKey);
-                    if (cacheIt != m_ImpulseCache.end())
-                    {
-                        point.normalImpulse = cacheIt->second.normalImpulse;
-                        point.tangentImpulse = cacheIt->second.tangentImpulse;
-                    }
+    template<typename Policy>
+    void PhysicsPipelineSystem::SolvePositionIterations()
+    {
+        if (m_ConstraintIslandRanges.empty())
+        {
+            for (int i = 0; i < m_Config.positionIterations; ++i)
+            {
+                SolvePositionConstraints<Policy>(0, m_VelocityConstraints.size());
+            }
+            return;
+        }
+
+        constexpr bool adaptive = Policy::adaptiveIterations;
+        const int minIterations = adaptive ? std::max(1, m_Config.minPositionIterations) : m_Config.positionIterations;
+        const int maxIterations = adaptive ? std::max(minIterations, m_Config.maxPositionIterations) : m_Config.positionIterations;
+        m_IslandIterations.resize(m_ConstraintIslandRanges.size());
+        RunParallel(m_ConstraintIslandRanges.size(), [&](size_t start, size_t end) {
+            for (size_t island = start; island < end; ++island)
+            {
+                const auto [begin, last] = m_ConstraintIslandRanges[island];
+                int iterations = 0;
+                while (iterations < maxIterations)
+                {
+                    float residual = SolvePositionConstraints<Policy>(begin, last);
+                    ++iterations;
+                    if (adaptive && iterations >= minIterations && residual <= m_Config.positionTolerance)
+                        break;
                 }
+                m_IslandIterations[island] = iterations;
+            }
+        }, IslandGrain());
 
-                m_VelocityConstraints.push_back(vc);
+        if constexpr (adaptive)
+        {
+            for (int iterations : m_IslandIterations)
+            {
+                m_Stats.positionIterationsTotal += static_cast<size_t>(iterations);
+                m_Stats.positionIterationsMax = std::max(m_Stats.positionIterationsMax, static_cast<size_t>(iterations));
             }
         }
+    }
 
-        m_Stats.activeConstraints = m_VelocityConstraints.size();
+    void PhysicsPipelineSystem::GatherForceFields(float deltaTime)
+    {
+        m_ForceFields.clear();
+        m_ComponentStore->ForEachComponent<ForceFieldComponent>([&](EntityID entityId, ForceFieldComponent& component) {
+                if (!component.enabled)
+                    return;
+                if (component.duration >= 0.0f && component.elapsed >= component.duration)
+                {
+                    component.enabled = false;
+                    return;
+                }
+                component.elapsed += deltaTime;
+
+                Math::Vector2 origin = {0.0f, 0.0f};
+                if (m_ComponentStore->HasComponent<TransformComponent>(entityId))
+                    origin = m_ComponentStore->GetComponent<TransformComponent>(entityId).position;
+                m_ForceFields.push_back(Physics::ForceField::FromComponent(component, origin));
+                });
+        m_Stats.forceFields = m_ForceFields.size();
+    }
+
+    void PhysicsPipelineSystem::ApplyForceFields()
+    {
+        if (m_ForceFields.empty())
+            return;
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+        for (const Physics::ForceField& field : m_ForceFields)
+        {
+            // Bodies in the volume's bounds from the broad phase; woken here, since the
+            // island manager is not thread safe
+            m_ForceFieldCandidates.clear();
+            QueryBroadPhase(field.bounds, m_ForceFieldCandidates);
+            m_ForceFieldBodies.clear();
+            m_ForceFieldBatch.Clear();
+            for (EntityID entityId : m_ForceFieldCandidates)
+            {
+                auto it = m_EntityToSolverIndex.find(entityId);
+                if (it == m_EntityToSolverIndex.end())
+                    continue;
+                SolverBody& solverBody = m_SolverBodies[it->second];
+                if (solverBody.isStatic || solverBody.invMass <= 0.0f || solverBody.dtScale <= 0.0f)
+                    continue;
+                if (field.maskBits != 0xFFFF &&
+                    (m_ComponentStore->GetComponent<ColliderComponent>(entityId).filter.categoryBits & field.maskBits) == 0)
+                    continue;
+                if (!solverBody.isAwake)
+                {
+                    if (!field.wakeBodies)
+                        continue;
+                    m_PreparedBodies[it->second].body->SetAwake(true);
+                    if (m_IslandManager)
+                        m_IslandManager->WakeIslandContaining(entityId);
+                    solverBody.isAwake = true;
+                }
+                m_ForceFieldBodies.push_back(static_cast<uint32_t>(it->second));
+                m_ForceFieldBatch.Push(solverBody.position, 1.0f / solverBody.invMass);
+            }
+
+            // Each body appears once per field, so chunks add their forces without locks
+            RunParallel(m_ForceFieldBodies.size(), [this, &field](size_t start, size_t end) {
+                field.Accumulate(m_ForceFieldBatch, start, end);
+                for (size_t i = start; i < end; ++i)
+                {
+                    SolverBody& solverBody = m_SolverBodies[m_ForceFieldBodies[i]];
+                    solverBody.force.x += m_ForceFieldBatch.forceX[i];
+                    solverBody.force.y += m_ForceFieldBatch.forceY[i];
+                }
+            });
+            m_Stats.forceFieldBodies += m_ForceFieldBodies.size();
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        m_Stats.forceFieldTime += std::chrono::duration<float, std::milli>(endTime - startTime).count();
     }
 
     void PhysicsPipelineSystem::VelocitySolving(float dt)
@@ -530,35 +1281,44 @@ namespace Nyon::ECS
             }
         }
         
-        // 2. Integrate velocities from forces
-        IntegrateVelocities(dt);
-        
-        // 3. Warm start with this frame's post-integration velocities
-        if (m_Config.warmStarting)
-        {
-            WarmStartConstraints();
-        }
-        
-        // 4. Solve velocity constraints iteratively
-        for (int i = 0; i < m_Config.velocityIterations; ++i)
-        {
-            SolveVelocityConstraints();
-        }
-    }
+        WithPolicy([this, dt](auto policy) {
+            using Policy = decltype(policy);
 
-    void PhysicsPipelineSystem::PositionSolving(float dt)
-    {
+            // 2. Integrate velocities from forces
+            IntegrateVelocities<Policy>(dt, 0, m_SolverBodies.size());
 
+            // 3. Warm start with this frame's post-integration velocities
+            if (m_Config.warmStarting)
+            {
+                WarmStartConstraints();
+            }
 
-        IntegratePositions(dt);
+            // 4. Solve velocity constraints iteratively
+            SolveVelocityIterations<Policy>();
+        });
+    }
 
-        // Solve position constraints for stabilization
-        for (int i = 0; i < m_Config.positionIterations; ++i)
+    void PhysicsPipelineSystem::PositionSolving(float dt)
+    {
+        if (m_Config.adaptiveIterations)
         {
-
-            SolvePositionConstraints();
+            m_PositionSolveStart.resize(m_SolverBodies.size());
+            RunParallel(m_SolverBodies.size(), [this](size_t start, size_t end) {
+                for (size_t i = start; i < end; ++i)
+                {
+                    m_PositionSolveStart[i] = {m_SolverBodies[i].position, m_SolverBodies[i].angle};
+                }
+            });
         }
 
+        WithPolicy([this, dt](auto policy) {
+            using Policy = decltype(policy);
+            IntegratePositions<Policy>(dt);
+
+            // Solve position constraints for stabilization
+            SolvePositionIterations<Policy>();
+        });
+
         // Debug: Log corrected positions
 
         for (size_t i = 0; i < std::min(m_SolverBodies.size(), (size_t)3); ++i)
@@ -570,72 +1330,77 @@ namespace Nyon::ECS
 
     void PhysicsPipelineSystem::Integration()
     {
-        // Update body components with solved velocities and positions
-        for (const auto& solverBody : m_SolverBodies)
-        {
-            if (m_ComponentStore->HasComponent<PhysicsBodyComponent>(solverBody.entityId))
+        WithPolicy([this](auto policy) { Integration<decltype(policy)>(); });
+    }
+
+    template<typename Policy>
+    void PhysicsPipelineSystem::Integration()
+    {
+        // Update body components with solved velocities; solver body i is prepared body i
+        RunParallel(m_SolverBodies.size(), [this](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
             {
-                auto& body = m_ComponentStore->GetComponent<PhysicsBodyComponent>(solverBody.entityId);
+                const auto& solverBody = m_SolverBodies[i];
+                auto& body = *m_PreparedBodies[i].body;
 
                 // === ENFORCE MOTION LOCKS ===
                 Math::Vector2 lockedVelocity = solverBody.velocity;
                 float lockedAngularVelocity = solverBody.angularVelocity;
 
-                if (body.motionLocks.lockTranslationX)
-                    lockedVelocity.x = 0.0f;
-                if (body.motionLocks.lockTranslationY)
-                    lockedVelocity.y = 0.0f;
-                if (body.motionLocks.lockRotation)
-                    lockedAngularVelocity = 0.0f;
+                if constexpr (Policy::motionLocks)
+                {
+                    if (body.motionLocks.lockTranslationX)
+                        lockedVelocity.x = 0.0f;
+                    if (body.motionLocks.lockTranslationY)
+                        lockedVelocity.y = 0.0f;
+                    if (body.motionLocks.lockRotation)
+                        lockedAngularVelocity = 0.0f;
+                }
 
                 body.velocity = lockedVelocity;
                 body.angularVelocity = lockedAngularVelocity;
 
                 // Damping is already applied in ConstraintSolverSystem - no additional damping here
             }
-        }
+        });
     }
 
     void PhysicsPipelineSystem::StoreImpulses()
     {
-        // Store accumulated impulses for warm starting next frame
-        std::unordered_map<uint64_t, bool> activeKeys; // Track which contacts are still active
-
-        for (const auto& constraint : m_VelocityConstraints)
+        // Store accumulated impulses for warm starting next frame. Entries are written in
+        // parallel into slots at each constraint's point offset, then merged into the cache
+        // in constraint order, so duplicate keys resolve the same way for any thread count.
+        // The cache is rebuilt from the active contacts, which evicts stale entries without
+        // walking the map in hash order.
+        const size_t constraintCount = m_VelocityConstraints.size();
+        m_ImpulseOffsets.resize(constraintCount + 1);
+        m_ImpulseOffsets[0] = 0;
+        for (size_t c = 0; c < constraintCount; ++c)
         {
-            uint32_t entityIdA = m_SolverBodies[constraint.indexA].entityId;
-            uint32_t entityIdB = m_SolverBodies[constraint.indexB].entityId;
-
-            for (const auto& point : constraint.points)
-            {
-                // Create cache key from entity pair + feature ID
-                uint64_t cacheKey = MakeImpulseCacheKey(entityIdA, entityIdB, point.featureId);
-
-                // Store impulses
-                m_ImpulseCache[cacheKey] = {
-                    point.normalImpulse,
-                    point.tangentImpulse
-                };
-
-                // Mark this key as active
-                activeKeys[cacheKey] = true;
-            }
+            m_ImpulseOffsets[c + 1] = m_ImpulseOffsets[c] + m_VelocityConstraints[c].points.size();
         }
 
-        // Evict stale cache entries (contacts that no longer exist)
-        // Only evict if the contact is not in the active set
-        std::vector<uint64_t> keysToRemove;
-        for (const auto& [key, impulse] : m_ImpulseCache)
-        {
-            if (activeKeys.find(key) == activeKeys.end())
+        m_ImpulseEntries.resize(m_ImpulseOffsets[constraintCount]);
+        RunParallel(constraintCount, [this](size_t start, size_t end) {
+            for (size_t c = start; c < end; ++c)
             {
-                keysToRemove.push_back(key);
+                const auto& constraint = m_VelocityConstraints[c];
+                uint32_t entityIdA = m_SolverBodies[constraint.indexA].entityId;
+                uint32_t entityIdB = m_SolverBodies[constraint.indexB].entityId;
+                size_t slot = m_ImpulseOffsets[c];
+                for (const auto& point : constraint.points)
+                {
+                    // Create cache key from entity pair + feature ID
+                    m_ImpulseEntries[slot++] = {MakeImpulseCacheKey(entityIdA, entityIdB, point.featureId),
+                                                {point.normalImpulse, point.tangentImpulse}};
+                }
             }
-        }
+        });
 
-        for (uint64_t key : keysToRemove)
+        m_ImpulseCache.clear();
+        for (const auto& [cacheKey, impulses] : m_ImpulseEntries)
         {
-            m_ImpulseCache.erase(key);
+            m_ImpulseCache[cacheKey] = impulses;
         }
     }
 
@@ -644,56 +1409,59 @@ namespace Nyon::ECS
         if (!m_Config.useIslandSleeping)
             return;
 
-        // Update body sleeping states based on island manager
-        m_ComponentStore->ForEachComponent<PhysicsBodyComponent>([&](EntityID entityId, PhysicsBodyComponent& body) {
-                if (body.isStatic)
-                    return;
-
-                // Bodies that explicitly disallow sleeping should always remain awake.
-                if (!body.allowSleep)
-                {
-                    body.SetAwake(true);
-                    if (m_IslandManager)
-                        m_IslandManager->WakeIslandContaining(entityId);
-                    return;
-                }
+        // Bodies that explicitly disallow sleeping should always remain awake. Their
+        // islands are woken first, since that changes what the other bodies read below.
+        for (const PreparedBody& prepared : m_PreparedBodies)
+        {
+            if (!prepared.body->isStatic && !prepared.body->allowSleep)
+            {
+                prepared.body->SetAwake(true);
+                if (m_IslandManager)
+                    m_IslandManager->WakeIslandContaining(prepared.entityId);
+            }
+        }
 
-                body.isAwake = m_IslandManager->IsBodyAwake(entityId);
-                });
+        // Update body sleeping states based on island manager
+        RunParallel(m_PreparedBodies.size(), [this](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
+            {
+                const PreparedBody& prepared = m_PreparedBodies[i];
+                if (!prepared.body->isStatic && prepared.body->allowSleep)
+                    prepared.body->isAwake = m_IslandManager->IsBodyAwake(prepared.entityId);
+            }
+        });
 
         m_Stats.awakeBodies = m_Stats.islandStats.awakeBodies;
         m_Stats.sleepingBodies = m_Stats.islandStats.sleepingBodies;
     }
 
+    void PhysicsPipelineSystem::UpdateTransformsFromSolver()
+    {
+        WithPolicy([this](auto policy) { UpdateTransformsFromSolver<decltype(policy)>(); });
+    }
+
+    template<typename Policy>
     void PhysicsPipelineSystem::UpdateTransformsFromSolver()
     {
         // Update transform components from solver results
         // ONLY update dynamic bodies - static bodies should NOT be overwritten!
-        for (const auto& solverBody : m_SolverBodies)
-        {
-            if (solverBody.isStatic)
-                continue;  // Skip static bodies - their transforms are set at creation time
-
-            if (m_ComponentStore->HasComponent<TransformComponent>(solverBody.entityId))
+        RunParallel(m_SolverBodies.size(), [this](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
             {
-                auto& transform = m_ComponentStore->GetComponent<TransformComponent>(solverBody.entityId);
+                const auto& solverBody = m_SolverBodies[i];
+                const PreparedBody& prepared = m_PreparedBodies[i];
+                if (solverBody.isStatic || !prepared.transform)
+                    continue;  // Skip static bodies - their transforms are set at creation time
 
-                // Get motion locks from physics body if it exists
-                bool hasLocks = false;
-                PhysicsBodyComponent::MotionLocks locks{};
-                if (m_ComponentStore->HasComponent<PhysicsBodyComponent>(solverBody.entityId))
-                {
-                    const auto& body = m_ComponentStore->GetComponent<PhysicsBodyComponent>(solverBody.entityId);
-                    locks = body.motionLocks;
-                    hasLocks = true;
-                }
+                auto& transform = *prepared.transform;
 
                 // Current (post-integration) state with motion locks enforced
                 Math::Vector2 lockedPosition = solverBody.position;
                 float lockedAngle = solverBody.angle;
 
-                if (hasLocks)
+                if constexpr (Policy::motionLocks)
                 {
+                    const auto& locks = prepared.body->motionLocks;
                     if (locks.lockTranslationX)
                         lockedPosition.x = transform.position.x; // Keep previous X
                     if (locks.lockTranslationY)
@@ -705,68 +1473,288 @@ namespace Nyon::ECS
                 transform.position = lockedPosition;
                 transform.rotation = lockedAngle;
             }
-        }
+        });
+    }
 
-        // Debug: Log positions every N frames
+    void PhysicsPipelineSystem::GatherBroadPhaseQueries()
+    {
+        m_BroadPhaseQueryEntities.clear();
+        m_BroadPhaseQueryBoxes.clear();
+        m_Stats.frozenProxies = 0;
+        for (uint32_t entityId : m_ActiveEntities)
+        {
+            auto proxyIt = m_ShapeProxyMap.find(entityId);
+            if (proxyIt == m_ShapeProxyMap.end())
+                continue;
+            // Frozen bodies are found by the queries of their awake neighbours instead
+            if (m_BroadPhaseTree.IsProxyFrozen(proxyIt->second))
+            {
+                m_Stats.frozenProxies++;
+                continue;
+            }
+            m_BroadPhaseQueryEntities.push_back(entityId);
+            m_BroadPhaseQueryBoxes.push_back(m_BroadPhaseTree.GetFatAABB(proxyIt->second));
+        }
+    }
 
-        for (size_t i = 0; i < std::min(m_SolverBodies.size(), (size_t)3); ++i)
+    template<typename PairVector>
+    void PhysicsPipelineSystem::QueryBroadPhasePacket(size_t packet, std::vector<std::pair<uint32_t, uint32_t>>& hits,
+                                                      std::vector<std::pair<uint32_t, uint32_t>>& sortedHits,
+                                                      PairVector& pairs) const
+    {
+        constexpr size_t PACKET_SIZE = Physics::DynamicTree::PACKET_SIZE;
+        const size_t begin = packet * PACKET_SIZE;
+        const size_t count = std::min(PACKET_SIZE, m_BroadPhaseQueryEntities.size() - begin);
+
+        hits.clear();
+        BroadPhasePacketCallback callback{&hits};
+        m_BroadPhaseTree.QueryBatch(m_BroadPhaseQueryBoxes.data() + begin, count, &callback);
+
+        // Hits arrive leaf by leaf; regroup them by query (counting sort, stable), so the
+        // pairs come out exactly as one Query() per entity in m_ActiveEntities order
+        size_t offsets[PACKET_SIZE + 1] = {};
+        for (const auto& hit : hits)
         {
-            const auto& body = m_SolverBodies[i];
+            ++offsets[hit.first + 1];
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            offsets[i + 1] += offsets[i];
+        }
+        sortedHits.resize(hits.size());
+        for (const auto& hit : hits)
+        {
+            sortedHits[offsets[hit.first]++] = hit;
+        }
 
+        for (const auto& [query, otherEntityId] : sortedHits)
+        {
+            uint32_t entityId = m_BroadPhaseQueryEntities[begin + query];
+            if (AcceptBroadPhasePair(entityId, otherEntityId))
+                pairs.emplace_back(entityId, otherEntityId);
         }
     }
 
-    // BroadPhaseCallback implementation
-    bool PhysicsPipelineSystem::BroadPhaseCallback::QueryCallback(uint32_t nodeId, uint32_t userData)
+    bool PhysicsPipelineSystem::AcceptBroadPhasePair(uint32_t entityId, uint32_t otherEntityId) const
     {
-        uint32_t otherEntityId = userData;
-
         // Avoid self-collision (only skip when both entities would generate the same pair)
         if (otherEntityId == entityId)
         {
-            return true;
+            return false;
         }
 
         // Check if both entities have colliders and are not filtered
-        if (system->m_ComponentStore->HasComponent<ColliderComponent>(entityId) &&
-                system->m_ComponentStore->HasComponent<ColliderComponent>(otherEntityId))
+        if (!m_ComponentStore->HasComponent<ColliderComponent>(entityId) ||
+            !m_ComponentStore->HasComponent<ColliderComponent>(otherEntityId))
         {
-            const auto& colliderA = system->m_ComponentStore->GetComponent<ColliderComponent>(entityId);
-            const auto& colliderB = system->m_ComponentStore->GetComponent<ColliderComponent>(otherEntityId);
+            std::cerr << "[BROAD-Q] MISSING COLLIDER querying=" << entityId 
+                      << " other=" << otherEntityId << std::endl;
+            return false;
+        }
+
+        const auto& colliderA = m_ComponentStore->GetComponent<ColliderComponent>(entityId);
+        const auto& colliderB = m_ComponentStore->GetComponent<ColliderComponent>(otherEntityId);
+        if (!colliderA.filter.ShouldCollide(colliderB.filter))
+        {
+            return false;
+        }
+
+        // Deduplicate: static bodies never query, so add pair with static without ID check.
+        // For dynamic-dynamic pairs, only let the lower-ID entity emit to avoid double-pair.
+        bool otherIsStatic = false;
+        if (m_ComponentStore->HasComponent<PhysicsBodyComponent>(otherEntityId))
+        {
+            const auto& otherBody = m_ComponentStore->GetComponent<PhysicsBodyComponent>(otherEntityId);
+            otherIsStatic = otherBody.isStatic;
+        }
+        // Deferred (simulation LOD) and frozen (sleeping) bodies do not query, so the
+        // stepping body emits the pair.
+        return otherIsStatic || entityId < otherEntityId || IsLODDeferred(otherEntityId) || IsFrozen(otherEntityId);
+    }
+
+    void PhysicsPipelineSystem::RemoveStaleProxies()
+    {
+        // DON'T clear m_ShapeProxyMap - we need to preserve proxy IDs across frames
+        // Only remove proxies for entities that no longer have colliders
+        std::vector<uint32_t> entitiesToRemove;
+        for (const auto& [entityId, proxyId] : m_ShapeProxyMap)
+        {
+            if (!m_ComponentStore->HasComponent<ColliderComponent>(entityId))
+            {
+                entitiesToRemove.push_back(entityId);
+            }
+        }
+
+        // Freed proxy slots are reused by later CreateProxy calls, so the destroy order
+        // shapes the tree; take it from entity IDs rather than hash order
+        if (m_Config.deterministic)
+        {
+            std::sort(entitiesToRemove.begin(), entitiesToRemove.end());
+        }
+
+        for (uint32_t entityId : entitiesToRemove)
+        {
+            uint32_t proxyId = m_ShapeProxyMap[entityId];
+            if (m_BroadPhaseTree.IsProxyEnabled(proxyId))
+                m_BroadPhaseChanges.push_back(m_BroadPhaseTree.GetFatAABB(proxyId));
+            m_BroadPhaseTree.DestroyProxy(proxyId);
+            m_ShapeProxyMap.erase(entityId);
+        }
+    }
+
+    void PhysicsPipelineSystem::RefitBroadPhaseProxies()
+    {
+        m_RefitShapes.clear();
+        m_ComponentStore->ForEachComponent<ColliderComponent>([&](EntityID entityId, ColliderComponent& collider) {
+                if (IsParticle(entityId) || !m_ComponentStore->HasComponent<TransformComponent>(entityId))
+                    return;
+                m_RefitShapes.push_back({entityId, &collider, &m_ComponentStore->GetComponent<TransformComponent>(entityId), true});
+        });
 
-            // Check filter settings
-            if (colliderA.filter.ShouldCollide(colliderB.filter))
+        // Compute AABBs in parallel. A proxy whose shape is still inside its fat AABB
+        // needs nothing from the tree beyond clearing its moved flag (what MoveProxy
+        // would do), which touches only that proxy's node.
+        RunParallel(m_RefitShapes.size(), [this](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
             {
-                // Deduplicate: static bodies never query, so add pair with static without ID check.
-                // For dynamic-dynamic pairs, only let the lower-ID entity emit to avoid double-pair.
-                bool otherIsStatic = false;
-                if (system->m_ComponentStore->HasComponent<PhysicsBodyComponent>(otherEntityId))
+                RefitShape& shape = m_RefitShapes[i];
+                auto it = m_ShapeProxyMap.find(shape.entityId);
+                if (it == m_ShapeProxyMap.end() || !m_BroadPhaseTree.IsProxyEnabled(it->second))
+                    continue;
+                const PhysicsBodyComponent* body = m_ComponentStore->HasComponent<PhysicsBodyComponent>(shape.entityId)
+                    ? &m_ComponentStore->GetComponent<PhysicsBodyComponent>(shape.entityId) : nullptr;
+                if (body && !body->isEnabled)
+                    continue;
+
+                // A sleeping body does not move, so its proxy is refit once more when it
+                // falls asleep and then left alone until the body wakes
+                bool sleeping = m_Config.freezeSleepingProxies && body && !body->isStatic && !body->isAwake;
+                if (m_BroadPhaseTree.IsProxyFrozen(it->second) != sleeping)
+                    m_BroadPhaseTree.SetProxyFrozen(it->second, sleeping);
+                else if (sleeping)
                 {
-                    const auto& otherBody = system->m_ComponentStore->GetComponent<PhysicsBodyComponent>(otherEntityId);
-                    otherIsStatic = otherBody.isStatic;
+                    shape.needsUpdate = false;
+                    continue;
                 }
-                if (otherIsStatic || entityId < otherEntityId)
+
+                Math::Vector2 min, max;
+                shape.collider->CalculateAABB(shape.transform->position, shape.transform->rotation, min, max);
+                const Physics::AABB& fatAABB = m_BroadPhaseTree.GetFatAABB(it->second);
+                if (fatAABB.Contains({min.x, min.y}) && fatAABB.Contains({max.x, max.y}))
                 {
-                    if (localPairs) {
-                        localPairs->emplace_back(entityId, otherEntityId);
-                    } else {
-                        system->m_BroadPhasePairs.emplace_back(entityId, otherEntityId);
-                    }
+                    m_BroadPhaseTree.ClearMoved(it->second);
+                    shape.needsUpdate = false;
                 }
             }
+        });
+
+        // Tree edits stay serial and in collider order, so the tree ends up exactly as
+        // if every proxy had been moved one after the other
+        for (const RefitShape& shape : m_RefitShapes)
+        {
+            if (shape.needsUpdate)
+            {
+                UpdateShapeAABB(shape.entityId, shape.collider, shape.transform->position, shape.transform->rotation);
+            }
         }
-        else
+    }
+
+    void PhysicsPipelineSystem::SyncBroadPhase()
+    {
+        if (!m_ComponentStore)
+            return;
+        RemoveStaleProxies();
+        RefitBroadPhaseProxies();
+    }
+
+    void PhysicsPipelineSystem::InsertProxies(const std::vector<EntityID>& entities)
+    {
+        if (!m_ComponentStore)
+            return;
+
+        std::vector<uint32_t> newEntities;
+        std::vector<Physics::AABB> newAABBs;
+        std::vector<uint32_t> parkedProxies;
+        std::vector<Physics::AABB> parkedAABBs;
+        for (EntityID entityId : entities)
         {
-            std::cerr << "[BROAD-Q] MISSING COLLIDER querying=" << entityId 
-                      << " other=" << otherEntityId << std::endl;
+            if (!m_ComponentStore->HasComponent<ColliderComponent>(entityId) ||
+                !m_ComponentStore->HasComponent<TransformComponent>(entityId) ||
+                m_ComponentStore->HasComponent<ParticleComponent>(entityId))
+                continue;
+            if (m_ComponentStore->HasComponent<PhysicsBodyComponent>(entityId) &&
+                !m_ComponentStore->GetComponent<PhysicsBodyComponent>(entityId).isEnabled)
+                continue;
+
+            const auto& collider = m_ComponentStore->GetComponent<ColliderComponent>(entityId);
+            const auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
+            Math::Vector2 min, max;
+            collider.CalculateAABB(transform.position, transform.rotation, min, max);
+            Physics::AABB aabb({min.x, min.y}, {max.x, max.y});
+
+            auto it = m_ShapeProxyMap.find(entityId);
+            if (it == m_ShapeProxyMap.end())
+            {
+                newEntities.push_back(entityId);
+                newAABBs.push_back(aabb);
+            }
+            else if (!m_BroadPhaseTree.IsProxyEnabled(it->second))
+            {
+                parkedProxies.push_back(it->second);
+                parkedAABBs.push_back(aabb);
+            }
+        }
+
+        std::vector<uint32_t> proxyIds(newEntities.size());
+        m_BroadPhaseTree.CreateProxies(newAABBs.data(), newEntities.data(), newEntities.size(), proxyIds.data());
+        m_BroadPhaseTree.EnableProxies(parkedProxies.data(), parkedAABBs.data(), parkedProxies.size());
+
+        for (size_t i = 0; i < newEntities.size(); ++i)
+        {
+            m_ShapeProxyMap[newEntities[i]] = proxyIds[i];
+        }
+        proxyIds.insert(proxyIds.end(), parkedProxies.begin(), parkedProxies.end());
+        for (uint32_t proxyId : proxyIds)
+        {
+            const Physics::AABB& fatAABB = m_BroadPhaseTree.GetFatAABB(proxyId);
+            m_BroadPhaseChanges.push_back(fatAABB);
+            m_InsertedProxyChanges.push_back(fatAABB);
         }
+    }
 
-        return true; // Continue querying
+    void PhysicsPipelineSystem::QueryBroadPhase(const Physics::AABB& aabb, std::vector<EntityID>& out) const
+    {
+        struct Collector
+        {
+            std::vector<EntityID>* out;
+            bool QueryCallback(uint32_t, uint32_t userData)
+            {
+                out->push_back(userData);
+                return true;
+            }
+        } collector{&out};
+        m_BroadPhaseTree.Query(aabb, &collector);
     }
 
     void PhysicsPipelineSystem::UpdateShapeAABB(uint32_t entityId, ColliderComponent* collider,
             const Math::Vector2& position, float angle)
     {
+        const PhysicsBodyComponent* body = m_ComponentStore->HasComponent<PhysicsBodyComponent>(entityId)
+            ? &m_ComponentStore->GetComponent<PhysicsBodyComponent>(entityId) : nullptr;
+        auto it = m_ShapeProxyMap.find(entityId);
+
+        // Disabled bodies keep their node parked outside the tree so re-enabling
+        // is a single insert rather than a fresh allocation
+        if (body != nullptr && !body->isEnabled)
+        {
+            if (it != m_ShapeProxyMap.end() && m_BroadPhaseTree.IsProxyEnabled(it->second))
+            {
+                m_BroadPhaseChanges.push_back(m_BroadPhaseTree.GetFatAABB(it->second));
+                m_BroadPhaseTree.DisableProxy(it->second);
+            }
+            return;
+        }
+
         Math::Vector2 min, max;
         collider->CalculateAABB(position, angle, min, max);
 
@@ -776,23 +1764,30 @@ namespace Nyon::ECS
 
         // No manual padding - MoveProxy/CreateProxy will apply AABB_EXTENSION internally
 
-
-        auto it = m_ShapeProxyMap.find(entityId);
         if (it != m_ShapeProxyMap.end())
         {
+            if (!m_BroadPhaseTree.IsProxyEnabled(it->second))
+            {
+                m_BroadPhaseTree.EnableProxy(it->second, aabb);
+                m_BroadPhaseChanges.push_back(m_BroadPhaseTree.GetFatAABB(it->second));
+                return;
+            }
+
             // Update existing proxy with velocity-based displacement hint
             Math::Vector2 displacement = {0.0f, 0.0f};
-            if (m_ComponentStore->HasComponent<PhysicsBodyComponent>(entityId)) {
-                const auto& body = m_ComponentStore->GetComponent<PhysicsBodyComponent>(entityId);
-                displacement = body.velocity * Nyon::FIXED_TIMESTEP;
+            if (body != nullptr) {
+                displacement = body->velocity * Nyon::FIXED_TIMESTEP;
             }
+            m_BroadPhaseChanges.push_back(m_BroadPhaseTree.GetFatAABB(it->second));
             m_BroadPhaseTree.MoveProxy(it->second, aabb, displacement);
+            m_BroadPhaseChanges.push_back(m_BroadPhaseTree.GetFatAABB(it->second));
         }
         else
         {
             // Create new proxy
             uint32_t proxyId = m_BroadPhaseTree.CreateProxy(aabb, entityId);
             m_ShapeProxyMap[entityId] = proxyId;
+            m_BroadPhaseChanges.push_back(m_BroadPhaseTree.GetFatAABB(proxyId));
         }
     }
 
@@ -855,13 +1850,31 @@ namespace Nyon::ECS
     }
 
     void PhysicsPipelineSystem::WarmStartConstraints()
+    {
+        if (m_ConstraintIslandRanges.empty())
+        {
+            WarmStartConstraints(0, m_VelocityConstraints.size());
+            return;
+        }
+
+        // Islands share no dynamic body, so each is warm started independently
+        RunParallel(m_ConstraintIslandRanges.size(), [this](size_t start, size_t end) {
+            for (size_t island = start; island < end; ++island)
+            {
+                WarmStartConstraints(m_ConstraintIslandRanges[island].first, m_ConstraintIslandRanges[island].second);
+            }
+        }, IslandGrain());
+    }
+
+    void PhysicsPipelineSystem::WarmStartConstraints(size_t begin, size_t end)
     {
         // Warm starting with CLAMPED impulses to prevent explosions
         // Only apply a fraction of the stored impulse to avoid instability
         constexpr float WARM_START_FACTOR = 0.5f;  // Apply only 50% of stored impulse
         
-        for (auto& constraint : m_VelocityConstraints)
+        for (size_t c = begin; c < end; ++c)
         {
+            auto& constraint = m_VelocityConstraints[c];
             const auto& bodyA = m_SolverBodies[constraint.indexA];
             const auto& bodyB = m_SolverBodies[constraint.indexB];
 
@@ -923,10 +1936,13 @@ namespace Nyon::ECS
         return pairKey ^ (static_cast<uint64_t>(featureId) << 32);
     }
 
-    void PhysicsPipelineSystem::SolveVelocityConstraints()
+    template<typename Policy>
+    float PhysicsPipelineSystem::SolveVelocityConstraints(size_t begin, size_t end)
     {
-        for (auto& constraint : m_VelocityConstraints)
+        float maxVelocityChange = 0.0f;
+        for (size_t c = begin; c < end; ++c)
         {
+            auto& constraint = m_VelocityConstraints[c];
             auto& bodyA = m_SolverBodies[constraint.indexA];
             auto& bodyB = m_SolverBodies[constraint.indexB];
 
@@ -963,6 +1979,11 @@ namespace Nyon::ECS
                 float oldImpulse = point.normalImpulse;
                 point.normalImpulse = std::max(oldImpulse + impulse, 0.0f);
                 impulse = point.normalImpulse - oldImpulse;
+                if constexpr (Policy::adaptiveIterations)
+                {
+                    if (point.normalMass > 0.0f)
+                        maxVelocityChange = std::max(maxVelocityChange, std::abs(impulse) / point.normalMass);
+                }
 
                 // Apply impulse
                 Math::Vector2 P = constraint.normal * impulse;
@@ -992,6 +2013,11 @@ namespace Nyon::ECS
                 point.tangentImpulse = std::clamp(oldTangentImpulse + tangentImpulse,
                         -maxFriction, maxFriction);
                 tangentImpulse = point.tangentImpulse - oldTangentImpulse;
+                if constexpr (Policy::adaptiveIterations)
+                {
+                    if (point.tangentMass > 0.0f)
+                        maxVelocityChange = std::max(maxVelocityChange, std::abs(tangentImpulse) / point.tangentMass);
+                }
 
                 // Apply tangent impulse
                 Math::Vector2 Pt = constraint.tangent * tangentImpulse;
@@ -1008,19 +2034,44 @@ namespace Nyon::ECS
                 }
             }
         }
+        return maxVelocityChange;
     }
 
-    void PhysicsPipelineSystem::SolvePositionConstraints()
+    template<typename Policy>
+    float PhysicsPipelineSystem::SolvePositionConstraints(size_t begin, size_t end)
     {
-        for (const auto& constraint : m_VelocityConstraints)
+        float maxPenetration = 0.0f;
+        for (size_t c = begin; c < end; ++c)
         {
+            const auto& constraint = m_VelocityConstraints[c];
             auto& bodyA = m_SolverBodies[constraint.indexA];
             auto& bodyB = m_SolverBodies[constraint.indexB];
 
             for (const auto& point : constraint.points)
             {
-                if (point.separation < -m_Config.linearSlop)
+                // The narrow phase separation is measured before IntegratePositions. With
+                // adaptive iterations it is advanced by how far both bodies have moved since
+                // (small-angle approximation), so repeated iterations stop correcting once
+                // the overlap is gone instead of reapplying the same push.
+                float separation = point.separation;
+                if constexpr (Policy::adaptiveIterations)
+                {
+                    if (constraint.indexA < m_PositionSolveStart.size() && constraint.indexB < m_PositionSolveStart.size())
+                    {
+                        const auto& [startPosA, startAngleA] = m_PositionSolveStart[constraint.indexA];
+                        const auto& [startPosB, startAngleB] = m_PositionSolveStart[constraint.indexB];
+                        Math::Vector2 rA = point.position - startPosA;
+                        Math::Vector2 rB = point.position - startPosB;
+                        Math::Vector2 dA = (bodyA.position - startPosA) + Math::Vector2::Cross(bodyA.angle - startAngleA, rA);
+                        Math::Vector2 dB = (bodyB.position - startPosB) + Math::Vector2::Cross(bodyB.angle - startAngleB, rB);
+                        separation += Math::Vector2::Dot(dB - dA, constraint.normal);
+                    }
+                }
+
+                if (separation < -m_Config.linearSlop)
                 {
+                    maxPenetration = std::max(maxPenetration, -separation - m_Config.linearSlop);
+
                     // Recompute centroids from CURRENT body state (updated by any previous
                     // point correction in this constraint, ensuring correct moment arms).
                     float cosA = std::cos(bodyA.angle);
@@ -1041,7 +2092,7 @@ namespace Nyon::ECS
                     Math::Vector2 rB = point.position - worldCentroidB;
 
                     // Position correction
-                    float C = m_Config.baumgarte * (-point.separation - m_Config.linearSlop);
+                    float C = m_Config.baumgarte * (-separation - m_Config.linearSlop);
                     C = std::clamp(C, 0.0f, m_Config.maxLinearCorrection);
 
                     // Effective mass including rotational inertia
@@ -1077,13 +2128,10 @@ namespace Nyon::ECS
                 }
             }
         }
+        return maxPenetration;
     }
 
-    void PhysicsPipelineSystem::IntegrateVelocities(float dt)
-    {
-        IntegrateVelocities(dt, 0, m_SolverBodies.size());
-    }
-
+    template<typename Policy>
     void PhysicsPipelineSystem::IntegrateVelocities(float dt, size_t start, size_t end)
     {
         // Respect global/world speed limits if available
@@ -1103,20 +2151,29 @@ namespace Nyon::ECS
             if (body.isStatic || !body.isAwake)
                 continue;
 
+            // Without simulation LOD every dtScale is 1
+            float bodyDt = dt;
+            if constexpr (Policy::simulationLOD)
+            {
+                if (body.dtScale == 0.0f)
+                    continue;
+                bodyDt *= body.dtScale;
+            }
+
             // Integrate linear velocity
-            body.velocity += (body.force * body.invMass) * dt;
+            body.velocity += (body.force * body.invMass) * bodyDt;
 
             // Integrate angular velocity
-            body.angularVelocity += (body.torque * body.invInertia) * dt;
+            body.angularVelocity += (body.torque * body.invInertia) * bodyDt;
 
             // Apply damping — standard Box2D formula, unconditionally stable
             if (body.linearDamping > 0.0f)
             {
-                body.velocity *= 1.0f / (1.0f + body.linearDamping * dt);
+                body.velocity *= 1.0f / (1.0f + body.linearDamping * bodyDt);
             }
             if (body.angularDamping > 0.0f)
             {
-                body.angularVelocity *= 1.0f / (1.0f + body.angularDamping * dt);
+                body.angularVelocity *= 1.0f / (1.0f + body.angularDamping * bodyDt);
             }
 
             // Clamp velocities to prevent excessive tunneling
@@ -1133,23 +2190,35 @@ namespace Nyon::ECS
         }
     }
 
+    template<typename Policy>
     void PhysicsPipelineSystem::IntegratePositions(float dt)
     {
-        for (auto& body : m_SolverBodies)
-        {
-            if (body.isStatic || !body.isAwake)
-                continue;
+        RunParallel(m_SolverBodies.size(), [this, dt](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
+            {
+                auto& body = m_SolverBodies[i];
+                if (body.isStatic || !body.isAwake)
+                    continue;
+
+                float bodyDt = dt;
+                if constexpr (Policy::simulationLOD)
+                {
+                    if (body.dtScale == 0.0f)
+                        continue;
+                    bodyDt *= body.dtScale;
+                }
 
-            // Store previous position for interpolation
-            body.prevPosition = body.position;
-            body.prevAngle = body.angle;
+                // Store previous position for interpolation
+                body.prevPosition = body.position;
+                body.prevAngle = body.angle;
 
-            // Integrate position
-            body.position += body.velocity * dt;
+                // Integrate position
+                body.position += body.velocity * bodyDt;
 
-            // Integrate angle
-            body.angle += body.angularVelocity * dt;
-        }
+                // Integrate angle
+                body.angle += body.angularVelocity * bodyDt;
+            }
+        });
     }
 
     // ========================================================================
@@ -1160,70 +2229,36 @@ namespace Nyon::ECS
     {
         m_BroadPhasePairs.clear();
 
-        // DON'T clear m_ShapeProxyMap - we need to preserve proxy IDs across frames
-        // Only remove proxies for entities that no longer have colliders
-        std::vector<uint32_t> entitiesToRemove;
-        for (const auto& [entityId, proxyId] : m_ShapeProxyMap)
-        {
-            if (!m_ComponentStore->HasComponent<ColliderComponent>(entityId))
-            {
-                entitiesToRemove.push_back(entityId);
-            }
-        }
-
-        for (uint32_t entityId : entitiesToRemove)
-        {
-            uint32_t proxyId = m_ShapeProxyMap[entityId];
-            m_BroadPhaseTree.DestroyProxy(proxyId);
-            m_ShapeProxyMap.erase(entityId);
-        }
+        RemoveStaleProxies();
 
         // Update broad phase tree and collect potential pairs
-        m_ComponentStore->ForEachComponent<ColliderComponent>([&](EntityID entityId, ColliderComponent& collider) {
-                if (!m_ComponentStore->HasComponent<TransformComponent>(entityId))
-                return;
-
-                const auto& transform = m_ComponentStore->GetComponent<TransformComponent>(entityId);
-
-                // Update shape AABB in broad phase tree
-                UpdateShapeAABB(entityId, &collider, transform.position, transform.rotation);
-                });
-
-        // Query the tree for overlapping proxies in parallel
-        std::vector<std::future<std::vector<std::pair<uint32_t, uint32_t>>>> futures;
+        RefitBroadPhaseProxies();
+        CollectFrozenContacts();
+
+        // Query the tree in parallel, one packet of dynamic bodies (in dense body pool
+        // order) per task; packets keep their own pairs and are joined in order
+        GatherBroadPhaseQueries();
+        size_t packetCount = (m_BroadPhaseQueryEntities.size() + Physics::DynamicTree::PACKET_SIZE - 1) /
+                             Physics::DynamicTree::PACKET_SIZE;
+        m_BroadPhasePacketPairs.resize(packetCount);
+        RunParallel(packetCount, [this](size_t start, size_t end) {
+            std::vector<std::pair<uint32_t, uint32_t>> hits, sortedHits;
+            for (size_t packet = start; packet < end; ++packet)
+            {
+                m_BroadPhasePacketPairs[packet].clear();
+                QueryBroadPhasePacket(packet, hits, sortedHits, m_BroadPhasePacketPairs[packet]);
+            }
+        }, 1);
 
-        for (const auto& [entityId, proxyId] : m_ShapeProxyMap)
+        for (size_t packet = 0; packet < packetCount; ++packet)
         {
-            // Only query for dynamic bodies
-            if (!m_ComponentStore->HasComponent<PhysicsBodyComponent>(entityId))
-                continue;
-
-            const auto& body = m_ComponentStore->GetComponent<PhysicsBodyComponent>(entityId);
-            if (body.isStatic)
-                continue;
-
-            // Submit query task to thread pool
-            futures.push_back(Utils::ThreadPool::Instance().Submit([this, entityId, proxyId]() -> std::vector<std::pair<uint32_t, uint32_t>> {
-                std::vector<std::pair<uint32_t, uint32_t>> localPairs;
-                const auto& fatAABB = m_BroadPhaseTree.GetFatAABB(proxyId);
-                
-                BroadPhaseCallback callback;
-                callback.system = this;
-                callback.entityId = entityId;
-                callback.localPairs = &localPairs;
-                
-                // Query will call QueryCallback which adds to localPairs
-                m_BroadPhaseTree.Query(fatAABB, &callback);
-                
-                return localPairs;
-            }));
+            const auto& packetPairs = m_BroadPhasePacketPairs[packet];
+            m_BroadPhasePairs.insert(m_BroadPhasePairs.end(), packetPairs.begin(), packetPairs.end());
         }
 
-        // Collect results
-        for (auto& future : futures)
+        if (m_Config.deterministic)
         {
-            auto localPairs = future.get();
-            m_BroadPhasePairs.insert(m_BroadPhasePairs.end(), localPairs.begin(), localPairs.end());
+            std::sort(m_BroadPhasePairs.begin(), m_BroadPhasePairs.end());
         }
 
         m_Stats.broadPhasePairs = m_BroadPhasePairs.size();
@@ -1240,25 +2275,22 @@ namespace Nyon::ECS
             world.contactManifolds.clear();
         }
 
-        // Process collision pairs in parallel
-        std::vector<std::future<ECS::ContactManifold>> futures;
-        std::mutex manifoldsMutex;
-
-        for (const auto& [entityIdA, entityIdB] : m_BroadPhasePairs)
-        {
-            futures.push_back(Utils::ThreadPool::Instance().Submit([this, entityIdA, entityIdB]() -> ECS::ContactManifold {
-                return GenerateManifold(entityIdA, entityIdB);
-            }));
-        }
+        // Process collision pairs in parallel; each pair writes its own slot so the
+        // manifold order matches the pair order whatever the thread count
+        std::vector<ECS::ContactManifold> results(m_BroadPhasePairs.size());
+        Utils::ThreadPool::Instance().ParallelFor(m_BroadPhasePairs.size(), [this, &results](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
+            {
+                results[i] = GenerateManifold(m_BroadPhasePairs[i].first, m_BroadPhasePairs[i].second);
+            }
+        });
 
-        // Collect results
-        for (auto& future : futures)
+        // Collect results in pair order
+        for (auto& manifold : results)
         {
-            ECS::ContactManifold manifold = future.get();
             if (!manifold.points.empty())
             {
-                std::lock_guard<std::mutex> lock(manifoldsMutex);
-                
+                manifold.touching = true;
                 uint64_t key = (static_cast<uint64_t>(std::min(manifold.entityIdA, manifold.entityIdB)) << 32) |
                     static_cast<uint64_t>(std::max(manifold.entityIdA, manifold.entityIdB));
                 m_ContactMap[key] = m_ContactManifolds.size();
@@ -1275,20 +2307,140 @@ namespace Nyon::ECS
         m_Stats.narrowPhaseContacts = m_ContactManifolds.size();
     }
 
-    void PhysicsPipelineSystem::ParallelVelocitySolving(float subStepDt)
+    void PhysicsPipelineSystem::BucketedNarrowPhase(bool parallel)
     {
-        // Apply gravity and integrate velocities (parallel)
-        std::vector<std::future<void>> futures;
-        size_t batchSize = (m_SolverBodies.size() + m_NumThreads - 1) / m_NumThreads;
+        using PairKind = Physics::ManifoldGenerator::PairKind;
+        const size_t pairCount = m_BroadPhasePairs.size();
+        auto& pool = Utils::ThreadPool::Instance();
+        auto run = [&pool, parallel](size_t count, const std::function<void(size_t, size_t)>& work) {
+            if (parallel && count > 1)
+                pool.ParallelFor(count, work);
+            else if (count > 0)
+                work(0, count);
+        };
+
+        // Look up each pair's components once and classify its shape pairing
+        m_NarrowPhasePairs.resize(pairCount);
+        run(pairCount, [this](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
+            {
+                auto [entityIdA, entityIdB] = m_BroadPhasePairs[i];
+                NarrowPhasePair& pair = m_NarrowPhasePairs[i];
+                pair = NarrowPhasePair();
+                if (!m_ComponentStore->HasComponent<ColliderComponent>(entityIdA) ||
+                        !m_ComponentStore->HasComponent<ColliderComponent>(entityIdB) ||
+                        !m_ComponentStore->HasComponent<TransformComponent>(entityIdA) ||
+                        !m_ComponentStore->HasComponent<TransformComponent>(entityIdB))
+                {
+                    continue;
+                }
+                pair.colliderA = &m_ComponentStore->GetComponent<ColliderComponent>(entityIdA);
+                pair.colliderB = &m_ComponentStore->GetComponent<ColliderComponent>(entityIdB);
+                pair.transformA = &m_ComponentStore->GetComponent<TransformComponent>(entityIdA);
+                pair.transformB = &m_ComponentStore->GetComponent<TransformComponent>(entityIdB);
+                pair.kind = Physics::ManifoldGenerator::ClassifyPair(*pair.colliderA, *pair.colliderB);
+            }
+        });
 
-        for (size_t t = 0; t < m_NumThreads; ++t)
+        // Group pair indices by pairing, keeping pair order inside each group. Every
+        // slot starts empty; pairs that are skipped or culled simply stay that way.
+        for (auto& bucket : m_PairBuckets)
+            bucket.clear();
+        m_NarrowPhaseSlots.resize(pairCount);
+        m_CirclePairBatch.Clear();
+        for (size_t i = 0; i < pairCount; ++i)
         {
-            size_t start = t * batchSize;
-            size_t end = std::min(start + batchSize, m_SolverBodies.size());
-            
-            if (start >= m_SolverBodies.size()) break;
+            m_NarrowPhaseSlots[i].points.clear();
+            const NarrowPhasePair& pair = m_NarrowPhasePairs[i];
+            if (!pair.colliderA)
+                continue;
+            m_PairBuckets[static_cast<size_t>(pair.kind)].push_back(static_cast<uint32_t>(i));
+            if (pair.kind == PairKind::CircleCircle)
+            {
+                const auto& circleA = pair.colliderA->GetCircle();
+                const auto& circleB = pair.colliderB->GetCircle();
+                m_CirclePairBatch.Push(pair.transformA->position + circleA.center, circleA.radius,
+                                       pair.transformB->position + circleB.center, circleB.radius);
+            }
+        }
+
+        // Most circle pairs from fattened AABBs do not touch; reject them in one pass
+        auto& circleBucket = m_PairBuckets[static_cast<size_t>(PairKind::CircleCircle)];
+        m_Stats.circleCirclePairs = circleBucket.size();
+        Physics::ManifoldGenerator::FindCircleOverlaps(m_CirclePairBatch, m_CircleOverlaps);
+        size_t kept = 0;
+        for (size_t i = 0; i < circleBucket.size(); ++i)
+        {
+            if (m_CircleOverlaps[i])
+                circleBucket[kept++] = circleBucket[i];
+        }
+        m_Stats.circlePairsCulled = circleBucket.size() - kept;
+        circleBucket.resize(kept);
+        m_Stats.circlePolygonPairs = m_PairBuckets[static_cast<size_t>(PairKind::CirclePolygon)].size();
+        m_Stats.polygonPolygonPairs = m_PairBuckets[static_cast<size_t>(PairKind::PolygonPolygon)].size();
+        m_Stats.otherShapePairs = m_PairBuckets[static_cast<size_t>(PairKind::Other)].size();
+
+        // One pass per pairing, so every batch runs the same kernel back to back
+        for (const auto& bucket : m_PairBuckets)
+        {
+            run(bucket.size(), [this, &bucket](size_t start, size_t end) {
+                for (size_t b = start; b < end; ++b)
+                {
+                    uint32_t i = bucket[b];
+                    const NarrowPhasePair& pair = m_NarrowPhasePairs[i];
+                    Physics::ManifoldGenerator::GenerateManifoldInto(
+                            m_BroadPhasePairs[i].first, m_BroadPhasePairs[i].second, 0, 0,
+                            *pair.colliderA, *pair.colliderB, *pair.transformA, *pair.transformB,
+                            m_NarrowPhaseSlots[i]);
+                }
+            });
+        }
+
+        // Collect results in pair order, copying into existing manifolds so their point
+        // storage is reused from the previous step
+        PhysicsWorldComponent* world = nullptr;
+        if (m_PhysicsWorldEntity != INVALID_ENTITY && m_ComponentStore) {
+            world = &m_ComponentStore->GetComponent<PhysicsWorldComponent>(m_PhysicsWorldEntity);
+        }
+        m_ContactMap.clear();
+        size_t contactCount = 0;
+        for (size_t i = 0; i < pairCount; ++i)
+        {
+            ECS::ContactManifold& manifold = m_NarrowPhaseSlots[i];
+            if (manifold.points.empty())
+                continue;
+
+            manifold.touching = true;
+            uint64_t key = (static_cast<uint64_t>(std::min(manifold.entityIdA, manifold.entityIdB)) << 32) |
+                static_cast<uint64_t>(std::max(manifold.entityIdA, manifold.entityIdB));
+            m_ContactMap[key] = contactCount;
+            if (contactCount < m_ContactManifolds.size())
+                m_ContactManifolds[contactCount] = manifold;
+            else
+                m_ContactManifolds.push_back(manifold);
+            if (world)
+            {
+                if (contactCount < world->contactManifolds.size())
+                    world->contactManifolds[contactCount] = manifold;
+                else
+                    world->contactManifolds.push_back(manifold);
+            }
+            ++contactCount;
+        }
+        m_ContactManifolds.resize(contactCount);
+        if (world)
+            world->contactManifolds.resize(contactCount);
+
+        m_Stats.narrowPhaseContacts = contactCount;
+    }
+
+    void PhysicsPipelineSystem::ParallelVelocitySolving(float subStepDt)
+    {
+        WithPolicy([this, subStepDt](auto policy) {
+            using Policy = decltype(policy);
 
-            futures.push_back(Utils::ThreadPool::Instance().Submit([this, start, end, subStepDt]() {
+            // Apply gravity and integrate velocities (parallel)
+            Utils::ThreadPool::Instance().ParallelFor(m_SolverBodies.size(), [this, subStepDt](size_t start, size_t end) {
                 for (size_t i = start; i < end; ++i)
                 {
                     auto& body = m_SolverBodies[i];
@@ -1299,36 +2451,39 @@ namespace Nyon::ECS
                         body.force += world.gravity * mass;
                     }
                 }
-                IntegrateVelocities(subStepDt, start, end);
-            }));
-        }
-
-        for (auto& future : futures)
-        {
-            future.get();
-        }
+                IntegrateVelocities<Policy>(subStepDt, start, end);
+            });
 
-        // Warm start
-        if (m_Config.warmStarting)
-        {
-            WarmStartConstraints();
-        }
+            // Warm start
+            if (m_Config.warmStarting)
+            {
+                WarmStartConstraints();
+            }
 
-        // Solve velocity constraints iteratively (parallel by constraint)
-        for (int i = 0; i < m_Config.velocityIterations; ++i)
-        {
-            SolveVelocityConstraints();
-        }
+            // Solve velocity constraints iteratively
+            SolveVelocityIterations<Policy>();
+        });
     }
 
     void PhysicsPipelineSystem::ParallelPositionSolving(float subStepDt)
     {
-        IntegratePositions(subStepDt);
-
-        // Solve position constraints iteratively
-        for (int i = 0; i < m_Config.positionIterations; ++i)
+        if (m_Config.adaptiveIterations)
         {
-            SolvePositionConstraints();
+            m_PositionSolveStart.resize(m_SolverBodies.size());
+            RunParallel(m_SolverBodies.size(), [this](size_t start, size_t end) {
+                for (size_t i = start; i < end; ++i)
+                {
+                    m_PositionSolveStart[i] = {m_SolverBodies[i].position, m_SolverBodies[i].angle};
+                }
+            });
         }
+
+        WithPolicy([this, subStepDt](auto policy) {
+            using Policy = decltype(policy);
+            IntegratePositions<Policy>(subStepDt);
+
+            // Solve position constraints iteratively
+            SolvePositionIterations<Policy>();
+        });
     }
 }
@@ -18,6 +18,7 @@
 
 #include "nyon/graphics/Renderer2D.h"
 #include "nyon/core/Application.h"
+#include "nyon/utils/MemoryTracker.h"
 
 #include <glad/glad.h>
 #include <glm/glm.hpp>
@@ -180,6 +181,7 @@ struct Renderer2D::Impl
     // -------------------------------------------------------------------------
     static constexpr int NUM_FRAMES = 3;
     int CurrentFrame = 0;
+    size_t PersistentBufferBytes = 0;  // charged to MemoryTag::Rendering until Shutdown
 
     // -------------------------------------------------------------------------
     // Quad pipeline
@@ -409,6 +411,8 @@ struct Renderer2D::Impl
         glBindBuffer(GL_ARRAY_BUFFER, vbo);
         glBufferStorage(GL_ARRAY_BUFFER, singleFrameBytes * NUM_FRAMES, nullptr, flags);
         void* ptr = glMapBufferRange(GL_ARRAY_BUFFER, 0, singleFrameBytes * NUM_FRAMES, flags);
+        PersistentBufferBytes += static_cast<size_t>(singleFrameBytes * NUM_FRAMES);
+        Utils::MemoryTracker::RecordAllocation(Utils::MemoryTag::Rendering, static_cast<size_t>(singleFrameBytes * NUM_FRAMES));
         if (!ptr)
             printf("Renderer2D: glMapBufferRange failed (size=%zu)\n",
                    static_cast<size_t>(singleFrameBytes * NUM_FRAMES));
@@ -935,6 +939,8 @@ void Renderer2D::Shutdown()
             s_Instance->PolyFillVBO,    s_Instance->PolyLineVBO
         };
         glDeleteBuffers(10, vbos);
+        Utils::MemoryTracker::RecordFree(Utils::MemoryTag::Rendering, s_Instance->PersistentBufferBytes);
+        s_Instance->PersistentBufferBytes = 0;
 
         // Delete VAOs
         GLuint vaos[] = {
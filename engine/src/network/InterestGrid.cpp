@@ -0,0 +1,296 @@
+#include "nyon/network/InterestGrid.h"
+#include "nyon/utils/ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+namespace Nyon::Network
+{
+    InterestGrid::InterestGrid(ECS::ComponentStore& componentStore, const InterestConfig& config)
+        : m_ComponentStore(componentStore)
+        , m_Config(config)
+    {
+        m_Config.cellSize = std::max(m_Config.cellSize, 1.0f);
+        m_Config.looseness = std::max(m_Config.looseness, 0.0f);
+        m_InverseCellSize = 1.0f / m_Config.cellSize;
+    }
+
+    int32_t InterestGrid::CellCoordinate(float value) const
+    {
+        double cell = std::floor(static_cast<double>(value) * m_InverseCellSize);
+        cell = std::clamp(cell, static_cast<double>(std::numeric_limits<int32_t>::min()),
+                          static_cast<double>(std::numeric_limits<int32_t>::max()));
+        return static_cast<int32_t>(cell);
+    }
+
+    bool InterestGrid::InsideLooseCell(const Cell& cell, const Math::Vector2& position) const
+    {
+        // Entities stay in [cell - margin, cell + 1 + margin); queries grow their region by the same margin
+        float margin = m_Config.looseness * m_Config.cellSize;
+        float minX = cell.x * m_Config.cellSize - margin;
+        float minY = cell.y * m_Config.cellSize - margin;
+        float maxX = (cell.x + 1) * m_Config.cellSize + margin;
+        float maxY = (cell.y + 1) * m_Config.cellSize + margin;
+        return position.x >= minX && position.x < maxX && position.y >= minY && position.y < maxY;
+    }
+
+    uint32_t InterestGrid::FindOrCreateCell(int32_t x, int32_t y)
+    {
+        auto [it, inserted] = m_CellIndex.try_emplace(CellKey(x, y), static_cast<uint32_t>(m_Cells.size()));
+        if (inserted)
+        {
+            Cell cell;
+            cell.x = x;
+            cell.y = y;
+            m_Cells.push_back(std::move(cell));
+        }
+        return it->second;
+    }
+
+    void InterestGrid::Insert(ECS::EntityID entityId, const Math::Vector2& position)
+    {
+        uint32_t cellIndex = FindOrCreateCell(CellCoordinate(position.x), CellCoordinate(position.y));
+        Cell& cell = m_Cells[cellIndex];
+        if (cell.entityIds.empty())
+            m_Stats.occupiedCells++;
+
+        EntityRecord& record = m_Entities[entityId];
+        record.cell = cellIndex;
+        record.slot = static_cast<uint32_t>(cell.entityIds.size());
+        cell.positionX.push_back(position.x);
+        cell.positionY.push_back(position.y);
+        cell.entityIds.push_back(entityId);
+        m_EntityCount++;
+    }
+
+    void InterestGrid::Remove(ECS::EntityID entityId)
+    {
+        EntityRecord& record = m_Entities[entityId];
+        Cell& cell = m_Cells[record.cell];
+
+        // Swap-remove; the entity moved into the hole takes over the slot
+        uint32_t last = static_cast<uint32_t>(cell.entityIds.size() - 1);
+        if (record.slot != last)
+        {
+            cell.positionX[record.slot] = cell.positionX[last];
+            cell.positionY[record.slot] = cell.positionY[last];
+            cell.entityIds[record.slot] = cell.entityIds[last];
+            m_Entities[cell.entityIds[record.slot]].slot = record.slot;
+        }
+        cell.positionX.pop_back();
+        cell.positionY.pop_back();
+        cell.entityIds.pop_back();
+        if (cell.entityIds.empty())
+            m_Stats.occupiedCells--;
+
+        record.cell = NO_CELL;
+        m_EntityCount--;
+    }
+
+    void InterestGrid::Update()
+    {
+        auto startTime = std::chrono::high_resolution_clock::now();
+        ++m_Stamp;
+        m_Stats.rebinnedEntities = 0;
+
+        // Most entities stay in their cell and only refresh their stored position
+        size_t seen = 0;
+        m_ComponentStore.ForEachComponent<ECS::TransformComponent>([&](ECS::EntityID entityId, const ECS::TransformComponent& transform) {
+            if (entityId >= m_Entities.size())
+                m_Entities.resize(entityId + 1);
+
+            EntityRecord& record = m_Entities[entityId];
+            record.stamp = m_Stamp;
+            ++seen;
+
+            if (record.cell != NO_CELL)
+            {
+                Cell& cell = m_Cells[record.cell];
+                if (InsideLooseCell(cell, transform.position))
+                {
+                    cell.positionX[record.slot] = transform.position.x;
+                    cell.positionY[record.slot] = transform.position.y;
+                    return;
+                }
+                Remove(entityId);
+            }
+            Insert(entityId, transform.position);
+            m_Stats.rebinnedEntities++;
+        });
+
+        // Every transform seen is in the grid now, so a shortfall means some were removed
+        if (seen < m_EntityCount)
+        {
+            for (ECS::EntityID entityId = 0; entityId < m_Entities.size(); ++entityId)
+            {
+                if (m_Entities[entityId].cell != NO_CELL && m_Entities[entityId].stamp != m_Stamp)
+                    Remove(entityId);
+            }
+        }
+
+        m_Stats.entities = m_EntityCount;
+        auto endTime = std::chrono::high_resolution_clock::now();
+        m_Stats.updateTime = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    }
+
+    template<typename Visit>
+    void InterestGrid::ForEachCell(const Math::Vector2& min, const Math::Vector2& max, Visit&& visit) const
+    {
+        float margin = m_Config.looseness * m_Config.cellSize;
+        int64_t minX = CellCoordinate(min.x - margin);
+        int64_t minY = CellCoordinate(min.y - margin);
+        int64_t maxX = CellCoordinate(max.x + margin);
+        int64_t maxY = CellCoordinate(max.y + margin);
+        if (maxX < minX || maxY < minY)
+            return;
+
+        // Regions covering more cells than exist walk the cells instead of the region
+        if (static_cast<double>(maxX - minX + 1) * static_cast<double>(maxY - minY + 1) > static_cast<double>(m_Cells.size()))
+        {
+            for (const Cell& cell : m_Cells)
+            {
+                if (cell.x >= minX && cell.x <= maxX && cell.y >= minY && cell.y <= maxY && !cell.entityIds.empty())
+                    visit(cell);
+            }
+            return;
+        }
+
+        for (int64_t y = minY; y <= maxY; ++y)
+        {
+            for (int64_t x = minX; x <= maxX; ++x)
+            {
+                auto it = m_CellIndex.find(CellKey(static_cast<int32_t>(x), static_cast<int32_t>(y)));
+                if (it != m_CellIndex.end() && !m_Cells[it->second].entityIds.empty())
+                    visit(m_Cells[it->second]);
+            }
+        }
+    }
+
+    void InterestGrid::QueryRadius(const Math::Vector2& center, float radius, std::vector<ECS::EntityID>& out) const
+    {
+        if (radius < 0.0f)
+            return;
+
+        const float radiusSq = radius * radius;
+        ForEachCell(center - Math::Vector2{radius, radius}, center + Math::Vector2{radius, radius}, [&](const Cell& cell) {
+            const size_t count = cell.entityIds.size();
+            for (size_t i = 0; i < count; ++i)
+            {
+                float dx = cell.positionX[i] - center.x;
+                float dy = cell.positionY[i] - center.y;
+                if (dx * dx + dy * dy <= radiusSq)
+                    out.push_back(cell.entityIds[i]);
+            }
+        });
+    }
+
+    void InterestGrid::QueryBox(const Math::Vector2& min, const Math::Vector2& max, std::vector<ECS::EntityID>& out) const
+    {
+        ForEachCell(min, max, [&](const Cell& cell) {
+            const size_t count = cell.entityIds.size();
+            for (size_t i = 0; i < count; ++i)
+            {
+                float x = cell.positionX[i];
+                float y = cell.positionY[i];
+                if (x >= min.x && x <= max.x && y >= min.y && y <= max.y)
+                    out.push_back(cell.entityIds[i]);
+            }
+        });
+    }
+
+    uint32_t InterestGrid::AddConsumer()
+    {
+        for (uint32_t consumerId = 0; consumerId < m_Consumers.size(); ++consumerId)
+        {
+            if (!m_Consumers[consumerId].active)
+            {
+                m_Consumers[consumerId] = Consumer{};
+                m_Consumers[consumerId].active = true;
+                return consumerId;
+            }
+        }
+
+        m_Consumers.emplace_back();
+        m_Consumers.back().active = true;
+        return static_cast<uint32_t>(m_Consumers.size() - 1);
+    }
+
+    void InterestGrid::RemoveConsumer(uint32_t consumerId)
+    {
+        if (consumerId < m_Consumers.size())
+            m_Consumers[consumerId] = Consumer{};
+    }
+
+    void InterestGrid::SetConsumerRadius(uint32_t consumerId, const Math::Vector2& center, float radius)
+    {
+        if (consumerId >= m_Consumers.size())
+            return;
+        Consumer& consumer = m_Consumers[consumerId];
+        consumer.box = false;
+        consumer.center = center;
+        consumer.radius = radius;
+    }
+
+    void InterestGrid::SetConsumerBox(uint32_t consumerId, const Math::Vector2& min, const Math::Vector2& max)
+    {
+        if (consumerId >= m_Consumers.size())
+            return;
+        Consumer& consumer = m_Consumers[consumerId];
+        consumer.box = true;
+        consumer.min = min;
+        consumer.max = max;
+    }
+
+    void InterestGrid::UpdateConsumers()
+    {
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        auto update = [this](size_t start, size_t end) {
+            for (size_t c = start; c < end; ++c)
+            {
+                Consumer& consumer = m_Consumers[c];
+                if (!consumer.active)
+                    continue;
+
+                consumer.scratch.clear();
+                if (consumer.box)
+                    QueryBox(consumer.min, consumer.max, consumer.scratch);
+                else
+                    QueryRadius(consumer.center, consumer.radius, consumer.scratch);
+                std::sort(consumer.scratch.begin(), consumer.scratch.end());
+
+                consumer.entered.clear();
+                consumer.left.clear();
+                std::set_difference(consumer.scratch.begin(), consumer.scratch.end(),
+                                    consumer.members.begin(), consumer.members.end(), std::back_inserter(consumer.entered));
+                std::set_difference(consumer.members.begin(), consumer.members.end(),
+                                    consumer.scratch.begin(), consumer.scratch.end(), std::back_inserter(consumer.left));
+                consumer.members.swap(consumer.scratch);
+            }
+        };
+
+        if (m_Config.multiThreading && m_Consumers.size() > 1)
+            Utils::ThreadPool::Instance().ParallelFor(m_Consumers.size(), update);
+        else
+            update(0, m_Consumers.size());
+
+        m_Stats.consumers = 0;
+        m_Stats.members = 0;
+        m_Stats.entered = 0;
+        m_Stats.left = 0;
+        for (const Consumer& consumer : m_Consumers)
+        {
+            if (!consumer.active)
+                continue;
+            m_Stats.consumers++;
+            m_Stats.members += consumer.members.size();
+            m_Stats.entered += consumer.entered.size();
+            m_Stats.left += consumer.left.size();
+        }
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        m_Stats.consumerTime = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    }
+}
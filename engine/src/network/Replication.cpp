@@ -0,0 +1,462 @@
+#include "nyon/network/Replication.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+namespace Nyon::Network
+{
+    namespace
+    {
+        constexpr float TWO_PI = 6.28318530717958647692f;
+        constexpr uint32_t ROTATION_STEPS = 65536;
+        constexpr uint32_t SEQUENCE_BITS = 32;
+        constexpr uint32_t BASELINE_OFFSET_BITS = 4;
+
+        static_assert((1u << BASELINE_OFFSET_BITS) == REPLICATION_BASELINE_WINDOW,
+                      "Baseline offsets must cover the whole window");
+
+        int32_t QuantizeValue(float value, float resolution)
+        {
+            double steps = std::round(static_cast<double>(value) / resolution);
+            steps = std::clamp(steps, static_cast<double>(std::numeric_limits<int32_t>::min()),
+                               static_cast<double>(std::numeric_limits<int32_t>::max()));
+            return static_cast<int32_t>(steps);
+        }
+
+        // Rotation wraps around a full turn, so its delta is taken modulo 2^16
+        int32_t FieldDelta(uint32_t field, int32_t value, int32_t baseline)
+        {
+            int32_t delta = static_cast<int32_t>(static_cast<uint32_t>(value) - static_cast<uint32_t>(baseline));
+            if (field == QuantizedState::Rotation)
+                delta = static_cast<int16_t>(static_cast<uint16_t>(delta));
+            return delta;
+        }
+
+        int32_t ApplyFieldDelta(uint32_t field, int32_t baseline, int32_t delta)
+        {
+            int32_t value = static_cast<int32_t>(static_cast<uint32_t>(baseline) + static_cast<uint32_t>(delta));
+            if (field == QuantizedState::Rotation)
+                value &= static_cast<int32_t>(ROTATION_STEPS - 1);
+            return value;
+        }
+    }
+
+    QuantizedState QuantizeState(const ECS::TransformComponent& transform, const ECS::PhysicsBodyComponent* body,
+                                 const ReplicationConfig& config)
+    {
+        QuantizedState state;
+        state.fields[QuantizedState::PositionX] = QuantizeValue(transform.position.x, config.positionResolution);
+        state.fields[QuantizedState::PositionY] = QuantizeValue(transform.position.y, config.positionResolution);
+
+        float turn = std::fmod(transform.rotation, TWO_PI);
+        if (turn < 0.0f)
+            turn += TWO_PI;
+        state.fields[QuantizedState::Rotation] =
+            static_cast<int32_t>(std::lround(turn / TWO_PI * ROTATION_STEPS)) & static_cast<int32_t>(ROTATION_STEPS - 1);
+
+        if (body)
+        {
+            state.fields[QuantizedState::VelocityX] = QuantizeValue(body->velocity.x, config.velocityResolution);
+            state.fields[QuantizedState::VelocityY] = QuantizeValue(body->velocity.y, config.velocityResolution);
+            state.fields[QuantizedState::AngularVelocity] = QuantizeValue(body->angularVelocity, config.angularVelocityResolution);
+        }
+        return state;
+    }
+
+    ReplicatedState DequantizeState(const QuantizedState& state, const ReplicationConfig& config)
+    {
+        ReplicatedState result;
+        result.position = { state.fields[QuantizedState::PositionX] * config.positionResolution,
+                            state.fields[QuantizedState::PositionY] * config.positionResolution };
+        result.rotation = state.fields[QuantizedState::Rotation] * (TWO_PI / ROTATION_STEPS);
+        result.velocity = { state.fields[QuantizedState::VelocityX] * config.velocityResolution,
+                            state.fields[QuantizedState::VelocityY] * config.velocityResolution };
+        result.angularVelocity = state.fields[QuantizedState::AngularVelocity] * config.angularVelocityResolution;
+        return result;
+    }
+
+    // ========================================================================
+    // SERVER
+    // ========================================================================
+
+    ReplicationServer::ReplicationServer(ECS::ComponentStore& componentStore, const ReplicationConfig& config)
+        : m_ComponentStore(componentStore)
+        , m_Config(config)
+    {
+    }
+
+    uint32_t ReplicationServer::AddClient()
+    {
+        for (uint32_t clientId = 0; clientId < m_Clients.size(); ++clientId)
+        {
+            if (!m_Clients[clientId].active)
+            {
+                m_Clients[clientId] = ClientState{};
+                m_Clients[clientId].active = true;
+                return clientId;
+            }
+        }
+
+        m_Clients.emplace_back();
+        m_Clients.back().active = true;
+        return static_cast<uint32_t>(m_Clients.size() - 1);
+    }
+
+    void ReplicationServer::RemoveClient(uint32_t clientId)
+    {
+        if (clientId < m_Clients.size())
+            m_Clients[clientId] = ClientState{};
+    }
+
+    void ReplicationServer::SetClientFocus(uint32_t clientId, const Math::Vector2& focus)
+    {
+        if (clientId < m_Clients.size())
+            m_Clients[clientId].focus = focus;
+    }
+
+    bool ReplicationServer::IsKnown(const ClientState& client, ECS::EntityID entityId)
+    {
+        return entityId < client.baselines.size() &&
+               (client.baselines[entityId].sequence != 0 || client.lastSent[entityId] != 0);
+    }
+
+    void ReplicationServer::CaptureSnapshot()
+    {
+        std::fill(m_Present.begin(), m_Present.end(), 0);
+        m_PreviousEntities.swap(m_SnapshotEntities);
+        m_SnapshotEntities.clear();
+
+        m_ComponentStore.ForEachComponent<ECS::TransformComponent>([&](ECS::EntityID entityId, const ECS::TransformComponent& transform) {
+            if (entityId > m_Config.maxEntityId)
+                return;
+            if (entityId >= m_Snapshot.size())
+            {
+                m_Snapshot.resize(entityId + 1);
+                m_Present.resize(entityId + 1, 0);
+            }
+
+            const ECS::PhysicsBodyComponent* body = m_ComponentStore.HasComponent<ECS::PhysicsBodyComponent>(entityId)
+                ? &m_ComponentStore.GetComponent<ECS::PhysicsBodyComponent>(entityId) : nullptr;
+            m_Snapshot[entityId] = QuantizeState(transform, body, m_Config);
+            m_Present[entityId] = 1;
+            m_SnapshotEntities.push_back(entityId);
+        });
+
+        // ID order keeps packets independent of component pool order
+        std::sort(m_SnapshotEntities.begin(), m_SnapshotEntities.end());
+        m_Stats.snapshotEntities = m_SnapshotEntities.size();
+
+        // Entities gone since the last capture become pending removals for the clients that know them
+        m_RemovedEntities.clear();
+        std::set_difference(m_PreviousEntities.begin(), m_PreviousEntities.end(),
+                            m_SnapshotEntities.begin(), m_SnapshotEntities.end(),
+                            std::back_inserter(m_RemovedEntities));
+        if (m_RemovedEntities.empty())
+            return;
+
+        for (ClientState& client : m_Clients)
+        {
+            if (!client.active)
+                continue;
+
+            auto& pending = client.pendingRemovals;
+            size_t previousCount = pending.size();
+            for (ECS::EntityID entityId : m_RemovedEntities)
+            {
+                if (IsKnown(client, entityId))
+                    pending.push_back(entityId);
+            }
+            std::inplace_merge(pending.begin(), pending.begin() + previousCount, pending.end());
+            pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+        }
+    }
+
+    uint32_t ReplicationServer::WritePacket(uint32_t clientId, std::vector<uint8_t>& out)
+    {
+        out.clear();
+        if (clientId >= m_Clients.size() || !m_Clients[clientId].active)
+            return 0;
+
+        ClientState& client = m_Clients[clientId];
+        if (client.baselines.size() < m_Snapshot.size())
+        {
+            client.baselines.resize(m_Snapshot.size());
+            client.lastSent.resize(m_Snapshot.size(), 0);
+            client.priority.resize(m_Snapshot.size(), 0.0f);
+        }
+
+        uint32_t sequence = client.nextSequence++;
+        SentPacket& record = client.history[sequence % REPLICATION_BASELINE_WINDOW];
+        record.sequence = sequence;
+        record.acknowledged = false;
+        record.entities.clear();
+        record.removals.clear();
+
+        m_Stats.changedEntities = 0;
+        m_Stats.sentEntities = 0;
+        m_Stats.deltaEntities = 0;
+        m_Stats.removedEntities = 0;
+
+        size_t budgetBits = m_Config.packetBudgetBytes > 0
+            ? m_Config.packetBudgetBytes * 8 : std::numeric_limits<size_t>::max();
+
+        m_Writer.Clear();
+        m_Writer.WriteBits(sequence, SEQUENCE_BITS);
+
+        // Removals first: a stale entity is worse than a late update. Each record is
+        // a continuation bit plus the ID delta; the final 0 bit ends the list.
+        // Acknowledged removals and reused IDs drop out of the pending list here.
+        auto& pending = client.pendingRemovals;
+        pending.erase(std::remove_if(pending.begin(), pending.end(), [&](ECS::EntityID entityId) {
+            return !IsKnown(client, entityId) || (entityId < m_Present.size() && m_Present[entityId]);
+        }), pending.end());
+
+        ECS::EntityID previousId = 0;
+        for (ECS::EntityID entityId : pending)
+        {
+            size_t mark = m_Writer.GetBitCount();
+            m_Writer.WriteBool(true);
+            m_Writer.WriteSigned(static_cast<int32_t>(entityId - previousId));
+            if (m_Writer.GetBitCount() + 2 > budgetBits)
+            {
+                m_Writer.Truncate(mark);
+                break;
+            }
+            record.removals.push_back(entityId);
+            previousId = entityId;
+        }
+        m_Writer.WriteBool(false);
+        m_Stats.removedEntities = record.removals.size();
+
+        // Entities that changed since the client's baseline, scored by accumulated relevance
+        m_Candidates.clear();
+        float inverseRadius = m_Config.relevanceRadius > 0.0f ? 1.0f / m_Config.relevanceRadius : 0.0f;
+        float cullDistanceSq = m_Config.cullDistance * m_Config.cullDistance;
+        for (ECS::EntityID entityId : m_SnapshotEntities)
+        {
+            const QuantizedState& state = m_Snapshot[entityId];
+            const Baseline& baseline = client.baselines[entityId];
+            if (baseline.sequence != 0 && baseline.state == state)
+            {
+                client.priority[entityId] = 0.0f;
+                continue;
+            }
+
+            Math::Vector2 position{ state.fields[QuantizedState::PositionX] * m_Config.positionResolution,
+                                    state.fields[QuantizedState::PositionY] * m_Config.positionResolution };
+            float distanceSq = (position - client.focus).LengthSquared();
+            if (cullDistanceSq > 0.0f && distanceSq > cullDistanceSq)
+                continue;
+
+            client.priority[entityId] += 1.0f / (1.0f + std::sqrt(distanceSq) * inverseRadius);
+            m_Candidates.push_back({ client.priority[entityId], entityId });
+        }
+        m_Stats.changedEntities = m_Candidates.size();
+
+        if (m_Config.packetBudgetBytes > 0)
+        {
+            std::sort(m_Candidates.begin(), m_Candidates.end(), [](const Candidate& a, const Candidate& b) {
+                return a.priority > b.priority || (a.priority == b.priority && a.entityId < b.entityId);
+            });
+        }
+
+        // Entity records: continuation bit, ID delta, baseline offset (if any), a
+        // changed-field mask and one zigzag delta per changed field
+        previousId = 0;
+        for (const Candidate& candidate : m_Candidates)
+        {
+            ECS::EntityID entityId = candidate.entityId;
+            const QuantizedState& state = m_Snapshot[entityId];
+            const Baseline& baseline = client.baselines[entityId];
+            bool hasBaseline = baseline.sequence != 0 && sequence - baseline.sequence < REPLICATION_BASELINE_WINDOW;
+            QuantizedState reference = hasBaseline ? baseline.state : QuantizedState{};
+
+            size_t mark = m_Writer.GetBitCount();
+            m_Writer.WriteBool(true);
+            m_Writer.WriteSigned(static_cast<int32_t>(entityId - previousId));
+            m_Writer.WriteBool(hasBaseline);
+            if (hasBaseline)
+                m_Writer.WriteBits(sequence - baseline.sequence, BASELINE_OFFSET_BITS);
+
+            uint32_t changedMask = 0;
+            for (uint32_t field = 0; field < QuantizedState::FIELD_COUNT; ++field)
+            {
+                if (state.fields[field] != reference.fields[field])
+                    changedMask |= 1u << field;
+            }
+            m_Writer.WriteBits(changedMask, QuantizedState::FIELD_COUNT);
+            for (uint32_t field = 0; field < QuantizedState::FIELD_COUNT; ++field)
+            {
+                if (changedMask & (1u << field))
+                    m_Writer.WriteSigned(FieldDelta(field, state.fields[field], reference.fields[field]));
+            }
+
+            if (m_Writer.GetBitCount() + 1 > budgetBits)
+            {
+                m_Writer.Truncate(mark);
+                break;
+            }
+
+            record.entities.emplace_back(entityId, state);
+            client.lastSent[entityId] = sequence;
+            client.priority[entityId] = 0.0f;
+            previousId = entityId;
+            if (hasBaseline)
+                m_Stats.deltaEntities++;
+        }
+        m_Writer.WriteBool(false);
+        m_Stats.sentEntities = record.entities.size();
+
+        out = m_Writer.Finish();
+        m_Stats.packetBytes = out.size();
+        return sequence;
+    }
+
+    void ReplicationServer::Acknowledge(uint32_t clientId, uint32_t sequence)
+    {
+        if (clientId >= m_Clients.size() || !m_Clients[clientId].active)
+            return;
+
+        ClientState& client = m_Clients[clientId];
+        SentPacket& record = client.history[sequence % REPLICATION_BASELINE_WINDOW];
+        if (record.sequence != sequence || record.acknowledged)
+            return;
+        record.acknowledged = true;
+
+        // Acks may arrive out of order; a baseline only ever moves forward
+        for (const auto& [entityId, state] : record.entities)
+        {
+            Baseline& baseline = client.baselines[entityId];
+            if (baseline.sequence < sequence)
+            {
+                baseline.state = state;
+                baseline.sequence = sequence;
+            }
+        }
+
+        for (ECS::EntityID entityId : record.removals)
+        {
+            if (client.baselines[entityId].sequence < sequence)
+                client.baselines[entityId].sequence = 0;
+            if (client.lastSent[entityId] <= sequence)
+                client.lastSent[entityId] = 0;
+        }
+    }
+
+    // ========================================================================
+    // CLIENT
+    // ========================================================================
+
+    ReplicationClient::ReplicationClient(const ReplicationConfig& config)
+        : m_Config(config)
+    {
+    }
+
+    bool ReplicationClient::ReadPacket(const uint8_t* data, size_t size)
+    {
+        BitReader reader(data, size);
+        uint32_t sequence = reader.ReadBits(SEQUENCE_BITS);
+        if (reader.IsOverflowed() || sequence <= m_LastSequence)
+            return false;
+
+        // Decode everything before touching entity state, so a malformed packet changes nothing.
+        // IDs come from untrusted deltas and size m_Entities, so they are bounded first
+        m_Removed.clear();
+        m_Decoded.clear();
+
+        ECS::EntityID entityId = 0;
+        while (reader.ReadBool() && !reader.IsOverflowed())
+        {
+            entityId += static_cast<ECS::EntityID>(reader.ReadSigned());
+            if (entityId > m_Config.maxEntityId)
+                return false;
+            m_Removed.push_back(entityId);
+        }
+
+        entityId = 0;
+        while (reader.ReadBool() && !reader.IsOverflowed())
+        {
+            entityId += static_cast<ECS::EntityID>(reader.ReadSigned());
+            if (entityId > m_Config.maxEntityId)
+                return false;
+
+            QuantizedState reference;
+            if (reader.ReadBool())
+            {
+                uint32_t baselineSequence = sequence - reader.ReadBits(BASELINE_OFFSET_BITS);
+                if (entityId >= m_Entities.size())
+                    return false;
+                const HistoryEntry& entry = m_Entities[entityId].history[baselineSequence % REPLICATION_BASELINE_WINDOW];
+                if (entry.sequence != baselineSequence)
+                    return false;
+                reference = entry.state;
+            }
+
+            uint32_t changedMask = reader.ReadBits(QuantizedState::FIELD_COUNT);
+            QuantizedState state = reference;
+            for (uint32_t field = 0; field < QuantizedState::FIELD_COUNT; ++field)
+            {
+                if (changedMask & (1u << field))
+                    state.fields[field] = ApplyFieldDelta(field, reference.fields[field], reader.ReadSigned());
+            }
+            m_Decoded.push_back({ entityId, state });
+        }
+
+        if (reader.IsOverflowed())
+            return false;
+
+        for (ECS::EntityID removedId : m_Removed)
+        {
+            // History is kept: the server may still delta against it if the ID is reused
+            if (removedId < m_Entities.size() && m_Entities[removedId].present)
+            {
+                m_Entities[removedId].present = false;
+                m_EntityCount--;
+            }
+        }
+
+        for (const auto& decoded : m_Decoded)
+        {
+            if (decoded.entityId >= m_Entities.size())
+                m_Entities.resize(decoded.entityId + 1);
+
+            EntityRecord& record = m_Entities[decoded.entityId];
+            record.history[sequence % REPLICATION_BASELINE_WINDOW] = { sequence, decoded.state };
+            record.latestSequence = sequence;
+            if (!record.present)
+            {
+                record.present = true;
+                m_EntityCount++;
+            }
+        }
+
+        m_LastSequence = sequence;
+        return true;
+    }
+
+    bool ReplicationClient::HasEntity(ECS::EntityID entityId) const
+    {
+        return entityId < m_Entities.size() && m_Entities[entityId].present;
+    }
+
+    bool ReplicationClient::GetQuantizedState(ECS::EntityID entityId, QuantizedState& state) const
+    {
+        if (!HasEntity(entityId))
+            return false;
+
+        const EntityRecord& record = m_Entities[entityId];
+        state = record.history[record.latestSequence % REPLICATION_BASELINE_WINDOW].state;
+        return true;
+    }
+
+    bool ReplicationClient::GetState(ECS::EntityID entityId, ReplicatedState& state) const
+    {
+        QuantizedState quantized;
+        if (!GetQuantizedState(entityId, quantized))
+            return false;
+
+        state = DequantizeState(quantized, m_Config);
+        return true;
+    }
+}
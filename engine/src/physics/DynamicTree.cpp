@@ -85,7 +85,10 @@ namespace Nyon::Physics
         assert(0 <= proxyId && proxyId < m_nodes.size());
         assert(m_nodes[proxyId].IsLeaf());
         
-        RemoveLeaf(proxyId);
+        if (m_nodes[proxyId].enabled)
+        {
+            RemoveLeaf(proxyId);
+        }
         FreeNode(proxyId);
         --m_proxyCount;
     }
@@ -94,6 +97,11 @@ namespace Nyon::Physics
     {
         assert(0 <= proxyId && proxyId < m_nodes.size());
         
+        if (!m_nodes[proxyId].enabled)
+        {
+            return false;
+        }
+        
         // Extended AABB
         Math::Vector2 r{AABB_EXTENSION, AABB_EXTENSION};
         AABB fatAABB;
@@ -129,6 +137,176 @@ namespace Nyon::Physics
         return true;
     }
     
+    void DynamicTree::DisableProxy(uint32_t proxyId)
+    {
+        assert(0 <= proxyId && proxyId < m_nodes.size());
+        assert(m_nodes[proxyId].IsLeaf());
+        
+        if (!m_nodes[proxyId].enabled)
+        {
+            return;
+        }
+        
+        RemoveLeaf(proxyId);
+        m_nodes[proxyId].parent = TreeNode::NULL_NODE;
+        m_nodes[proxyId].enabled = false;
+        m_nodes[proxyId].moved = false;
+        m_nodes[proxyId].frozen = false;
+    }
+    
+    void DynamicTree::EnableProxy(uint32_t proxyId, const AABB& aabb)
+    {
+        assert(0 <= proxyId && proxyId < m_nodes.size());
+        
+        if (m_nodes[proxyId].enabled)
+        {
+            return;
+        }
+        
+        Math::Vector2 r{AABB_EXTENSION, AABB_EXTENSION};
+        m_nodes[proxyId].aabb.lowerBound = aabb.lowerBound - r;
+        m_nodes[proxyId].aabb.upperBound = aabb.upperBound + r;
+        m_nodes[proxyId].height = 0;
+        m_nodes[proxyId].enabled = true;
+        m_nodes[proxyId].moved = true;
+        
+        InsertLeaf(proxyId);
+    }
+    
+    bool DynamicTree::IsProxyEnabled(uint32_t proxyId) const
+    {
+        assert(0 <= proxyId && proxyId < m_nodes.size());
+        return m_nodes[proxyId].enabled;
+    }
+    
+    void DynamicTree::SetProxyFrozen(uint32_t proxyId, bool frozen)
+    {
+        assert(0 <= proxyId && proxyId < m_nodes.size());
+        assert(m_nodes[proxyId].IsLeaf());
+        m_nodes[proxyId].frozen = frozen;
+    }
+    
+    bool DynamicTree::IsProxyFrozen(uint32_t proxyId) const
+    {
+        assert(0 <= proxyId && proxyId < m_nodes.size());
+        return m_nodes[proxyId].frozen;
+    }
+    
+    void DynamicTree::CreateProxies(const AABB* aabbs, const uint32_t* userData, size_t count, uint32_t* proxyIds)
+    {
+        if (count == 0)
+            return;
+        
+        // Leaves plus the internal nodes of their subtree, allocated without regrowing
+        ReserveNodes(static_cast<uint32_t>(2 * count - 1));
+        
+        std::vector<uint32_t> leaves(count);
+        Math::Vector2 r{AABB_EXTENSION, AABB_EXTENSION};
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint32_t proxyId = AllocateNode();
+            TreeNode& node = m_nodes[proxyId];
+            node.aabb.lowerBound = aabbs[i].lowerBound - r;
+            node.aabb.upperBound = aabbs[i].upperBound + r;
+            node.userData = userData[i];
+            node.height = 0;
+            node.moved = true;
+            leaves[i] = proxyId;
+            proxyIds[i] = proxyId;
+        }
+        m_proxyCount += static_cast<uint32_t>(count);
+        
+        InsertSubtree(leaves);
+    }
+    
+    void DynamicTree::EnableProxies(const uint32_t* proxyIds, const AABB* aabbs, size_t count)
+    {
+        std::vector<uint32_t> leaves;
+        leaves.reserve(count);
+        Math::Vector2 r{AABB_EXTENSION, AABB_EXTENSION};
+        for (size_t i = 0; i < count; ++i)
+        {
+            assert(proxyIds[i] < m_nodes.size());
+            TreeNode& node = m_nodes[proxyIds[i]];
+            if (node.enabled)
+                continue;
+            node.aabb.lowerBound = aabbs[i].lowerBound - r;
+            node.aabb.upperBound = aabbs[i].upperBound + r;
+            node.height = 0;
+            node.enabled = true;
+            node.moved = true;
+            leaves.push_back(proxyIds[i]);
+        }
+        if (leaves.empty())
+            return;
+        
+        ReserveNodes(static_cast<uint32_t>(leaves.size() - 1));
+        InsertSubtree(leaves);
+    }
+    
+    void DynamicTree::ReserveNodes(uint32_t count)
+    {
+        uint32_t freeNodes = static_cast<uint32_t>(m_nodes.size()) - m_nodeCount;
+        if (freeNodes >= count)
+            return;
+        
+        // One resize for the whole batch; the new nodes go in front of the free list
+        uint32_t oldSize = static_cast<uint32_t>(m_nodes.size());
+        uint32_t grow = count - freeNodes + NODE_CAPACITY_INCREMENT;
+        m_nodes.resize(oldSize + grow);
+        for (uint32_t i = oldSize; i < oldSize + grow - 1; ++i)
+        {
+            m_nodes[i].parent = i + 1;
+        }
+        m_nodes[oldSize + grow - 1].parent = m_freeList;
+        m_freeList = oldSize;
+    }
+    
+    uint32_t DynamicTree::BuildSubtree(uint32_t* leaves, size_t count)
+    {
+        if (count == 1)
+            return leaves[0];
+        
+        // Split at the median of the leaf centers along the wider axis
+        AABB centers(m_nodes[leaves[0]].aabb.GetCenter(), m_nodes[leaves[0]].aabb.GetCenter());
+        for (size_t i = 1; i < count; ++i)
+        {
+            centers.Combine(m_nodes[leaves[i]].aabb.GetCenter());
+        }
+        bool splitX = (centers.upperBound.x - centers.lowerBound.x) >= (centers.upperBound.y - centers.lowerBound.y);
+        
+        size_t half = count / 2;
+        std::nth_element(leaves, leaves + half, leaves + count, [&](uint32_t a, uint32_t b) {
+            Math::Vector2 ca = m_nodes[a].aabb.GetCenter();
+            Math::Vector2 cb = m_nodes[b].aabb.GetCenter();
+            return splitX ? ca.x < cb.x : ca.y < cb.y;
+        });
+        
+        uint32_t child1 = BuildSubtree(leaves, half);
+        uint32_t child2 = BuildSubtree(leaves + half, count - half);
+        
+        uint32_t parent = AllocateNode();
+        TreeNode& node = m_nodes[parent];
+        node.child1 = child1;
+        node.child2 = child2;
+        node.userData = 0;
+        node.aabb = m_nodes[child1].aabb;
+        node.aabb.Combine(m_nodes[child2].aabb);
+        node.height = 1 + std::max(m_nodes[child1].height, m_nodes[child2].height);
+        m_nodes[child1].parent = parent;
+        m_nodes[child2].parent = parent;
+        return parent;
+    }
+    
+    void DynamicTree::InsertSubtree(std::vector<uint32_t>& leaves)
+    {
+        uint32_t subtree = BuildSubtree(leaves.data(), leaves.size());
+        
+        // InsertLeaf only looks at the node's AABB and height, so a subtree root
+        // goes in like a single leaf and the walk back up rebalances around it
+        InsertLeaf(subtree);
+    }
+    
     void DynamicTree::InsertLeaf(uint32_t leaf)
     {
         if (m_root == TreeNode::NULL_NODE)
@@ -492,10 +670,10 @@ namespace Nyon::Physics
             f = m_nodes[f].parent;
         }
         
-        // Collect all proxies (nodes that are not in free list and are leaves)
+        // Collect all linked proxies (nodes that are not in free list, not parked, and are leaves)
         for (uint32_t i = 0; i < m_nodes.size(); ++i)
         {
-            if (freeSet.count(i) == 0 && m_nodes[i].IsLeaf())
+            if (freeSet.count(i) == 0 && m_nodes[i].IsLeaf() && m_nodes[i].enabled)
             {
                 proxies.push_back(i);
             }
@@ -0,0 +1,141 @@
+#include "nyon/physics/FracturePattern.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace Nyon::ECS;
+
+namespace Nyon::Physics
+{
+    namespace
+    {
+        // Cells smaller than this fraction of the source area are dropped as slivers
+        constexpr float MIN_PIECE_AREA_FRACTION = 1e-4f;
+        constexpr float WELD_DISTANCE = 1e-3f;
+
+        bool InsideConvex(const std::vector<Math::Vector2>& polygon, const Math::Vector2& point)
+        {
+            for (size_t i = 0; i < polygon.size(); ++i)
+            {
+                const Math::Vector2& a = polygon[i];
+                const Math::Vector2& b = polygon[(i + 1) % polygon.size()];
+                if (Math::Vector2::Cross(b - a, point - a) < 0.0f)
+                    return false;
+            }
+            return true;
+        }
+
+        // Sutherland-Hodgman step: keep the part of polygon where Dot(x, normal) <= offset
+        void ClipHalfPlane(const std::vector<Math::Vector2>& polygon, const Math::Vector2& normal, float offset,
+                           std::vector<Math::Vector2>& out)
+        {
+            out.clear();
+            for (size_t i = 0; i < polygon.size(); ++i)
+            {
+                const Math::Vector2& a = polygon[i];
+                const Math::Vector2& b = polygon[(i + 1) % polygon.size()];
+                float da = Math::Vector2::Dot(a, normal) - offset;
+                float db = Math::Vector2::Dot(b, normal) - offset;
+
+                if (da <= 0.0f)
+                    out.push_back(a);
+                if ((da < 0.0f && db > 0.0f) || (da > 0.0f && db < 0.0f))
+                    out.push_back(a + (b - a) * (da / (da - db)));
+            }
+        }
+
+        void WeldVertices(std::vector<Math::Vector2>& polygon)
+        {
+            std::vector<Math::Vector2> welded;
+            welded.reserve(polygon.size());
+            for (const Math::Vector2& v : polygon)
+            {
+                if (welded.empty() || (v - welded.back()).LengthSquared() > WELD_DISTANCE * WELD_DISTANCE)
+                    welded.push_back(v);
+            }
+            while (welded.size() > 1 && (welded.front() - welded.back()).LengthSquared() <= WELD_DISTANCE * WELD_DISTANCE)
+                welded.pop_back();
+            polygon.swap(welded);
+        }
+    }
+
+    FracturePattern FracturePattern::Generate(const ColliderComponent::PolygonShape& source, int pieceCount, uint32_t seed)
+    {
+        FracturePattern pattern;
+        if (source.vertices.size() < 3 || pieceCount < 1)
+            return pattern;
+
+        // Work on a counter-clockwise copy
+        ColliderComponent::PolygonShape outline(source.vertices);
+        const std::vector<Math::Vector2>& hull = outline.vertices;
+        float sourceArea = ColliderComponent(outline).CalculateArea();
+
+        AABB bounds(hull[0], hull[0]);
+        for (const Math::Vector2& v : hull)
+        {
+            bounds.Combine(v);
+        }
+
+        // Scatter seeds inside the polygon by rejection from its bounds
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> unitX(bounds.lowerBound.x, bounds.upperBound.x);
+        std::uniform_real_distribution<float> unitY(bounds.lowerBound.y, bounds.upperBound.y);
+        std::vector<Math::Vector2> seeds;
+        seeds.reserve(static_cast<size_t>(pieceCount));
+        for (int attempt = 0; attempt < pieceCount * 64 && static_cast<int>(seeds.size()) < pieceCount; ++attempt)
+        {
+            Math::Vector2 point{unitX(rng), unitY(rng)};
+            if (InsideConvex(hull, point))
+                seeds.push_back(point);
+        }
+        if (seeds.empty())
+            seeds.push_back(outline.centroid);
+
+        std::vector<Math::Vector2> cell, clipped;
+        pattern.m_Pieces.reserve(seeds.size());
+        for (size_t i = 0; i < seeds.size(); ++i)
+        {
+            // Points closer to seed i than to seed j: Dot(x, sj - si) <= (|sj|^2 - |si|^2) / 2
+            cell = hull;
+            for (size_t j = 0; j < seeds.size() && cell.size() >= 3; ++j)
+            {
+                if (j == i)
+                    continue;
+                Math::Vector2 normal = seeds[j] - seeds[i];
+                if (normal.LengthSquared() < 1e-12f)
+                    continue;
+                float offset = 0.5f * (seeds[j].LengthSquared() - seeds[i].LengthSquared());
+                ClipHalfPlane(cell, normal, offset, clipped);
+                cell.swap(clipped);
+            }
+
+            WeldVertices(cell);
+            if (cell.size() < 3)
+                continue;
+
+            Piece piece;
+            ColliderComponent::PolygonShape located(cell);
+            for (Math::Vector2& v : cell)
+            {
+                v = v - located.centroid;
+            }
+            piece.shape = ColliderComponent::PolygonShape(cell);
+            piece.offset = located.centroid;
+
+            ColliderComponent collider(piece.shape);
+            piece.area = collider.CalculateArea();
+            if (piece.area < sourceArea * MIN_PIECE_AREA_FRACTION)
+                continue;
+            piece.inertiaPerUnitMass = collider.CalculateInertiaPerUnitMass();
+
+            piece.localBounds = AABB(piece.shape.vertices[0], piece.shape.vertices[0]);
+            for (const Math::Vector2& v : piece.shape.vertices)
+            {
+                piece.localBounds.Combine(v);
+            }
+            pattern.m_Pieces.push_back(std::move(piece));
+        }
+        return pattern;
+    }
+}
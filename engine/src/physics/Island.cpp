@@ -1,7 +1,9 @@
 #include "nyon/physics/Island.h"
 #include "nyon/ecs/components/JointComponent.h"
+#include "nyon/ecs/components/ParticleComponent.h"
 #include "nyon/ecs/components/PhysicsWorldComponent.h"
 #include <algorithm>
+#include <limits>
 
 // Debug logging macro - only output in debug builds
 #ifdef _DEBUG
@@ -55,6 +57,11 @@ namespace Nyon::Physics
                 ECS::EntityID a = manifold.entityIdA;
                 ECS::EntityID b = manifold.entityIdB;
 
+                // Static bodies do not link islands: everything resting on the ground
+                // would otherwise form one island that can never sleep
+                if (IsStaticBody(a) || IsStaticBody(b))
+                    continue;
+
                 // Add bidirectional connections for touching contacts
                 m_ContactGraph[a].push_back(b);
                 m_ContactGraph[b].push_back(a);
@@ -142,8 +149,7 @@ namespace Nyon::Physics
         NYON_DEBUG_LOG("Combined graph has " << m_ConnectionGraph.size() << " bodies with connections");
         
         // Find all connected components (islands)
-        for (const auto& [bodyId, connections] : m_ConnectionGraph)
-        {
+        auto seedIsland = [this](ECS::EntityID bodyId) {
             if (m_VisitedBodies.find(bodyId) == m_VisitedBodies.end())
             {
                 Island newIsland;
@@ -156,12 +162,31 @@ namespace Nyon::Physics
                     m_AllIslands.push_back(std::move(newIsland));
                 }
             }
+        };
+        
+        if (m_Deterministic)
+        {
+            std::vector<ECS::EntityID> seeds;
+            seeds.reserve(m_ConnectionGraph.size());
+            for (const auto& entry : m_ConnectionGraph)
+                seeds.push_back(entry.first);
+            std::sort(seeds.begin(), seeds.end());
+            for (ECS::EntityID bodyId : seeds)
+                seedIsland(bodyId);
+        }
+        else
+        {
+            for (const auto& entry : m_ConnectionGraph)
+                seedIsland(entry.first);
         }
         
         // Also add isolated bodies (bodies with no connections) as individual islands
+        const bool hasParticles = m_ComponentStore.GetComponentCount<ECS::ParticleComponent>() > 0;
         m_ComponentStore.ForEachComponent<ECS::PhysicsBodyComponent>([&](ECS::EntityID entityId, const ECS::PhysicsBodyComponent& body) {
-            if (body.isStatic)
-                return; // Static bodies don't form islands
+            if (body.isStatic || !body.isEnabled)
+                return; // Static and disabled bodies don't form islands
+            if (hasParticles && m_ComponentStore.HasComponent<ECS::ParticleComponent>(entityId))
+                return; // Particles are simulated by ParticlePipelineSystem
                 
             if (m_VisitedBodies.find(entityId) == m_VisitedBodies.end())
             {
@@ -284,16 +309,11 @@ namespace Nyon::Physics
         {
             if (!island.isAwake)
             {
-                // Check if any body in this island has active contacts or was disturbed
+                // Touching an awake body merges the islands, which RestoreIslandSleepState
+                // already wakes; resting contacts within a sleeping island keep it asleep
                 bool shouldWake = false;
                 for (const auto& bodyId : island.bodyIds)
                 {
-                    // Wake if body has active contacts this frame
-                    if (m_ContactGraph.find(bodyId) != m_ContactGraph.end())
-                    {
-                        shouldWake = true;
-                        break;
-                    }
                     // Wake if body's previous state has been cleared (body newly created or state unknown)
                     if (m_BodySleepState.find(bodyId) == m_BodySleepState.end())
                     {
@@ -314,10 +334,13 @@ namespace Nyon::Physics
     void IslandManager::RestoreIslandSleepState(Island& island)
     {
         // Restore sleep timer and awake state from previous frame's per-body state.
-        // Take the maximum sleep timer from all bodies in the island (conservative),
-        // and wake if any body was awake.
+        // A sleeping island keeps the maximum timer of its bodies; an awake one keeps
+        // the minimum (conservative: every part must have been still that long), so
+        // islands rebuilt each step still reach TIME_TO_SLEEP. Wake if any body was awake.
         float maxSleepTimer = 0.0f;
+        float minSleepTimer = std::numeric_limits<float>::max();
         bool anyAwake = false;
+        bool anyAsleep = false;
         bool anyUnknown = false;
         
         for (const auto& bodyId : island.bodyIds)
@@ -326,8 +349,13 @@ namespace Nyon::Physics
             if (it != m_BodySleepState.end())
             {
                 maxSleepTimer = std::max(maxSleepTimer, it->second.first);
+                minSleepTimer = std::min(minSleepTimer, it->second.first);
                 if (it->second.second)
                     anyAwake = true;
+                else if (IsBodyMarkedAwake(bodyId))
+                    anyUnknown = true;  // Woken from outside (SetAwake, forces, impulses)
+                else
+                    anyAsleep = true;
             }
             else
             {
@@ -335,12 +363,18 @@ namespace Nyon::Physics
             }
         }
         
-        // If any body was awake or is newly created, the island is awake
-        if (anyAwake || anyUnknown)
+        // New or externally woken bodies, or an awake body touching a sleeping
+        // one, start the island's timer over
+        if (anyUnknown || (anyAwake && anyAsleep))
         {
             island.isAwake = true;
             island.sleepTimer = 0.0f;
         }
+        else if (anyAwake)
+        {
+            island.isAwake = true;
+            island.sleepTimer = minSleepTimer;
+        }
         else
         {
             island.isAwake = false;
@@ -362,6 +396,12 @@ namespace Nyon::Physics
         return true;
     }
 
+    size_t IslandManager::GetIslandIndex(ECS::EntityID bodyId) const
+    {
+        auto it = m_BodyIslandMap.find(bodyId);
+        return it != m_BodyIslandMap.end() ? it->second : SIZE_MAX;
+    }
+
     void IslandManager::WakeIslandContaining(ECS::EntityID bodyId)
     {
         auto it = m_BodyIslandMap.find(bodyId);
@@ -442,6 +482,18 @@ namespace Nyon::Physics
         return linearVelSq + tangentialVel * tangentialVel;
     }
 
+    bool IslandManager::IsStaticBody(ECS::EntityID bodyId) const
+    {
+        return m_ComponentStore.HasComponent<ECS::PhysicsBodyComponent>(bodyId) &&
+               m_ComponentStore.GetComponent<ECS::PhysicsBodyComponent>(bodyId).isStatic;
+    }
+
+    bool IslandManager::IsBodyMarkedAwake(ECS::EntityID bodyId) const
+    {
+        return m_ComponentStore.HasComponent<ECS::PhysicsBodyComponent>(bodyId) &&
+               m_ComponentStore.GetComponent<ECS::PhysicsBodyComponent>(bodyId).isAwake;
+    }
+
     bool IslandManager::IsBodyEligibleForSleeping(ECS::EntityID bodyId) const
     {
         if (!m_ComponentStore.HasComponent<ECS::PhysicsBodyComponent>(bodyId))
@@ -212,11 +212,50 @@ namespace Nyon::Physics
                                                              const TransformComponent& transformB)
     {
         ECS::ContactManifold manifold{};
+        GenerateManifoldInto(entityIdA, entityIdB, shapeIdA, shapeIdB,
+                             colliderA, colliderB, transformA, transformB, manifold);
+        return manifold;
+    }
+
+    ManifoldGenerator::PairKind ManifoldGenerator::ClassifyPair(const ColliderComponent& colliderA,
+                                                                const ColliderComponent& colliderB)
+    {
+        using ST = ColliderComponent::ShapeType;
+        ST tA = colliderA.GetType();
+        ST tB = colliderB.GetType();
+        if (tA == ST::Circle && tB == ST::Circle)
+            return PairKind::CircleCircle;
+        if ((tA == ST::Circle && tB == ST::Polygon) || (tA == ST::Polygon && tB == ST::Circle))
+            return PairKind::CirclePolygon;
+        if (tA == ST::Polygon && tB == ST::Polygon)
+            return PairKind::PolygonPolygon;
+        return PairKind::Other;
+    }
+
+    void ManifoldGenerator::GenerateManifoldInto(uint32_t entityIdA,
+                                                 uint32_t entityIdB,
+                                                 uint32_t shapeIdA,
+                                                 uint32_t shapeIdB,
+                                                 const ColliderComponent& colliderA,
+                                                 const ColliderComponent& colliderB,
+                                                 const TransformComponent& transformA,
+                                                 const TransformComponent& transformB,
+                                                 ECS::ContactManifold& manifold)
+    {
+        // Reset every field but keep the point storage
+        manifold.points.clear();
+        manifold.normal = {0.0f, 0.0f};
+        manifold.localNormal = {0.0f, 0.0f};
+        manifold.localPoint = {0.0f, 0.0f};
+        manifold.friction = 0.0f;
+        manifold.restitution = 0.0f;
+        manifold.tangentSpeed = 0.0f;
         manifold.entityIdA = entityIdA;
         manifold.entityIdB = entityIdB;
         manifold.shapeIdA = shapeIdA;
         manifold.shapeIdB = shapeIdB;
         manifold.touching = false;
+        manifold.persisted = false;
 
         COLLISION_DEBUG_LOG("GenerateManifold: entityA=" << entityIdA << " entityB=" << entityIdB);
 
@@ -236,23 +275,24 @@ namespace Nyon::Physics
         // This prevents capsule/circle from falling into CirclePolygon by mistake
         if (tA == ST::Capsule || tB == ST::Capsule)
         {
-            return CapsuleCollision(entityIdA, entityIdB, shapeIdA, shapeIdB,
-                                   colliderA, colliderB, transformA, transformB, manifold);
+            manifold = CapsuleCollision(entityIdA, entityIdB, shapeIdA, shapeIdB,
+                                        colliderA, colliderB, transformA, transformB, manifold);
+            return;
         }
         
         if (tA == ST::Segment || tB == ST::Segment)
         {
-            return SegmentCollision(entityIdA, entityIdB, shapeIdA, shapeIdB,
-                                   colliderA, colliderB, transformA, transformB, manifold);
+            manifold = SegmentCollision(entityIdA, entityIdB, shapeIdA, shapeIdB,
+                                        colliderA, colliderB, transformA, transformB, manifold);
+            return;
         }
         
         // Dispatch to appropriate collision function based on shape type pair
         if (tA == ST::Circle && tB == ST::Circle)
         {
             COLLISION_DEBUG_LOG("  -> Circle-Circle collision");
-            return CircleCircle(entityIdA, entityIdB, shapeIdA, shapeIdB,
-                               colliderA.GetCircle(), colliderB.GetCircle(),
-                               transformA, transformB, manifold);
+            CircleCircle(colliderA.GetCircle(), colliderB.GetCircle(), transformA, transformB, manifold);
+            return;
         }
         
         if (tA == ST::Circle && tB == ST::Polygon)
@@ -260,48 +300,58 @@ namespace Nyon::Physics
             COLLISION_DEBUG_LOG("  -> Circle-Polygon collision");
             if (swapped)
             {
-                auto result = CirclePolygon(entityIdB, entityIdA, shapeIdB, shapeIdA,
-                                           colliderB.GetCircle(), colliderA.GetPolygon(),
-                                           transformB, transformA, manifold);
+                CirclePolygon(colliderB.GetCircle(), colliderA.GetPolygon(), transformB, transformA, manifold);
                 // When swapped, the result has entityIdA=circle (original B) and entityIdB=polygon (original A),
                 // with normal pointing circle→polygon. The manifold must use the original entity order
                 // (polygon, circle) with normal pointing polygon→circle.
-                std::swap(result.entityIdA, result.entityIdB);
-                result.normal = -result.normal;
-                result.localNormal = -result.localNormal;
-                for (auto& cp : result.points) {
+                std::swap(manifold.entityIdA, manifold.entityIdB);
+                manifold.normal = -manifold.normal;
+                manifold.localNormal = -manifold.localNormal;
+                for (auto& cp : manifold.points) {
                     cp.normal = -cp.normal;
                 }
-                return result;
             }
             else
             {
-                return CirclePolygon(entityIdA, entityIdB, shapeIdA, shapeIdB,
-                                    colliderA.GetCircle(), colliderB.GetPolygon(),
-                                    transformA, transformB, manifold);
+                CirclePolygon(colliderA.GetCircle(), colliderB.GetPolygon(), transformA, transformB, manifold);
             }
+            return;
         }
         
         if (tA == ST::Polygon && tB == ST::Polygon)
         {
             COLLISION_DEBUG_LOG("  -> Polygon-Polygon collision");
-            return PolygonPolygon(entityIdA, entityIdB, shapeIdA, shapeIdB,
-                                 colliderA.GetPolygon(), colliderB.GetPolygon(),
-                                 transformA, transformB, manifold);
+            PolygonPolygon(colliderA.GetPolygon(), colliderB.GetPolygon(), transformA, transformB, manifold);
         }
+    }
 
-        return manifold;
+    void ManifoldGenerator::FindCircleOverlaps(const CirclePairBatch& batch, std::vector<uint8_t>& overlaps)
+    {
+        // Branch-free over contiguous arrays so the compiler can vectorize it; the
+        // comparison matches CircleCircle, which rejects distSq > radius^2
+        const size_t count = batch.Size();
+        overlaps.resize(count);
+        const float* ax = batch.ax.data();
+        const float* ay = batch.ay.data();
+        const float* ra = batch.ra.data();
+        const float* bx = batch.bx.data();
+        const float* by = batch.by.data();
+        const float* rb = batch.rb.data();
+        uint8_t* out = overlaps.data();
+        for (size_t i = 0; i < count; ++i)
+        {
+            float dx = bx[i] - ax[i];
+            float dy = by[i] - ay[i];
+            float radius = ra[i] + rb[i];
+            out[i] = static_cast<uint8_t>(dx * dx + dy * dy <= radius * radius);
+        }
     }
 
-    ECS::ContactManifold ManifoldGenerator::CircleCircle(uint32_t entityIdA,
-                                                         uint32_t entityIdB,
-                                                         uint32_t shapeIdA,
-                                                         uint32_t shapeIdB,
-                                                         const ColliderComponent::CircleShape& circleA,
-                                                         const ColliderComponent::CircleShape& circleB,
-                                                         const TransformComponent& transformA,
-                                                         const TransformComponent& transformB,
-                                                         ECS::ContactManifold& manifold)
+    void ManifoldGenerator::CircleCircle(const ColliderComponent::CircleShape& circleA,
+                                         const ColliderComponent::CircleShape& circleB,
+                                         const TransformComponent& transformA,
+                                         const TransformComponent& transformB,
+                                         ECS::ContactManifold& manifold)
     {
         manifold.touching = false;
 
@@ -315,7 +365,7 @@ namespace Nyon::Physics
 
         if (distSq > radius * radius)
         {
-            return manifold;
+            return;
         }
 
         float dist = std::sqrt(std::max(distSq, 1e-8f));
@@ -346,19 +396,13 @@ namespace Nyon::Physics
         manifold.localPoint = localContact;
         
         manifold.touching = true;
-
-        return manifold;
     }
 
-    ECS::ContactManifold ManifoldGenerator::CirclePolygon(uint32_t entityIdA,
-                                                           uint32_t entityIdB,
-                                                           uint32_t shapeIdA,
-                                                           uint32_t shapeIdB,
-                                                           const ColliderComponent::CircleShape& circle,
-                                                           const ColliderComponent::PolygonShape& polygon,
-                                                           const TransformComponent& circleTransform,
-                                                           const TransformComponent& polyTransform,
-                                                           ECS::ContactManifold& manifold)
+    void ManifoldGenerator::CirclePolygon(const ColliderComponent::CircleShape& circle,
+                                          const ColliderComponent::PolygonShape& polygon,
+                                          const TransformComponent& circleTransform,
+                                          const TransformComponent& polyTransform,
+                                          ECS::ContactManifold& manifold)
     {
         manifold.touching = false;
         // Entity IDs are set by GenerateManifold, do not overwrite them here.
@@ -366,39 +410,48 @@ namespace Nyon::Physics
         Math::Vector2 center;
         ComputeCircleCenters(circle, circleTransform, center);
 
-        std::vector<Math::Vector2> verts;
-        std::vector<Math::Vector2> normals;
-        ComputePolygonWorld(polygon, polyTransform, verts, normals);
+        // Faces are transformed one at a time, so a separating face exits before the
+        // rest of the polygon is touched and nothing is allocated
+        const float c = std::cos(polyTransform.rotation);
+        const float sn = std::sin(polyTransform.rotation);
+        auto toWorld = [c, sn](const Math::Vector2& v) {
+            return Math::Vector2{v.x * c - v.y * sn, v.x * sn + v.y * c};
+        };
 
         // Find the face with the largest separation along its normal.
         float maxSeparation = -std::numeric_limits<float>::infinity();
         int bestIndex = -1;
+        Math::Vector2 bestNormal;
 
-        for (size_t i = 0; i < normals.size(); ++i)
+        const size_t faceCount = std::min(polygon.normals.size(), polygon.vertices.size());
+        for (size_t i = 0; i < faceCount; ++i)
         {
-            float s = Dot(normals[i], center - verts[i]);
+            Math::Vector2 normal = toWorld(polygon.normals[i]);
+            Math::Vector2 vertex = polyTransform.position + toWorld(polygon.vertices[i]);
+            float s = Dot(normal, center - vertex);
             if (s > circle.radius)
             {
                 // No collision if circle center is outside this face by more than radius.
-                return manifold;
+                return;
             }
             if (s > maxSeparation)
             {
                 maxSeparation = s;
                 bestIndex = static_cast<int>(i);
+                bestNormal = normal;
             }
         }
 
         if (bestIndex < 0)
         {
-            return manifold;
+            return;
         }
         
         // Polygon face normals point outward from the polygon. In this helper the
         // circle is always entity A and the polygon is entity B, so the manifold
         // normal should point from A → B (circle → polygon). Flip the polygon
         // normal to enforce that convention.
-        Math::Vector2 polyNormal = normals[bestIndex];
+        Math::Vector2 polyNormal = bestNormal;
         Math::Vector2 normal = -polyNormal;
         
         float penetration = circle.radius - maxSeparation;
@@ -428,32 +481,23 @@ namespace Nyon::Physics
         manifold.localPoint = localContact;
         
         manifold.touching = true;
-
-        return manifold;
     }
 
-    ECS::ContactManifold ManifoldGenerator::PolygonPolygon(uint32_t entityIdA,
-                                                           uint32_t entityIdB,
-                                                           uint32_t shapeIdA,
-                                                           uint32_t shapeIdB,
-                                                           const ColliderComponent::PolygonShape& polyA,
-                                                           const ColliderComponent::PolygonShape& polyB,
-                                                           const TransformComponent& transformA,
-                                                           const TransformComponent& transformB,
-                                                           ECS::ContactManifold& manifold)
+    void ManifoldGenerator::PolygonPolygon(const ColliderComponent::PolygonShape& polyA,
+                                           const ColliderComponent::PolygonShape& polyB,
+                                           const TransformComponent& transformA,
+                                           const TransformComponent& transformB,
+                                           ECS::ContactManifold& manifold)
     {
         // Implement SAT-based polygon collision detection directly
         manifold.touching = false;
-        manifold.entityIdA = entityIdA;
-        manifold.entityIdB = entityIdB;
-        manifold.shapeIdA = shapeIdA;
-        manifold.shapeIdB = shapeIdB;
         
         COLLISION_DEBUG_LOG("  [PolygonPolygon] Testing collision");
         
-        // Get world-space vertices and normals for both polygons
-        std::vector<Math::Vector2> vertsA, normalsA;
-        std::vector<Math::Vector2> vertsB, normalsB;
+        // Get world-space vertices and normals for both polygons. Per-thread scratch
+        // buffers keep their capacity, so steady-state pairs allocate nothing here.
+        thread_local std::vector<Math::Vector2> vertsA, normalsA;
+        thread_local std::vector<Math::Vector2> vertsB, normalsB;
         ComputePolygonWorld(polyA, transformA, vertsA, normalsA);
         ComputePolygonWorld(polyB, transformB, vertsB, normalsB);
         
@@ -470,7 +514,7 @@ namespace Nyon::Physics
             ProjectPolygon(vertsB, axis, minB, maxB);
             
             float overlap = std::min(maxA, maxB) - std::max(minA, minB);
-            if (overlap < 0) return manifold; // Separating axis found
+            if (overlap < 0) return; // Separating axis found
 
             COLLISION_DEBUG_LOG("    SAT axis=A[" << i << "] (" << axis.x << "," << axis.y << ") overlap=" << overlap << " minA=" << minA << " maxA=" << maxA << " minB=" << minB << " maxB=" << maxB);
             
@@ -491,7 +535,7 @@ namespace Nyon::Physics
             ProjectPolygon(vertsB, axis, minB, maxB);
             
             float overlap = std::min(maxA, maxB) - std::max(minA, minB);
-            if (overlap < 0) return manifold; // Separating axis found
+            if (overlap < 0) return; // Separating axis found
             
             COLLISION_DEBUG_LOG("    SAT axis=B[" << i << "] (" << axis.x << "," << axis.y << ") overlap=" << overlap << " minA=" << minA << " maxA=" << maxA << " minB=" << minB << " maxB=" << maxB);
 
@@ -586,8 +630,6 @@ namespace Nyon::Physics
             manifold.points.push_back(cp);
             manifold.touching = true;
         }
-        
-        return manifold;
     }
     
     ECS::ContactManifold ManifoldGenerator::CircleCapsule(uint32_t entityIdA,
@@ -0,0 +1,384 @@
+#include "nyon/physics/ShapeCast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <variant>
+#include <vector>
+
+using namespace Nyon::ECS;
+
+namespace Nyon::Physics
+{
+    namespace
+    {
+        constexpr float EPSILON = 1e-6f;
+
+        struct WorldTransform
+        {
+            Math::Vector2 position;
+            float c;
+            float s;
+
+            WorldTransform(const Math::Vector2& p, float rotation)
+                : position(p), c(std::cos(rotation)), s(std::sin(rotation)) {}
+
+            Math::Vector2 Apply(const Math::Vector2& v) const
+            {
+                return position + Math::Vector2{v.x * c - v.y * s, v.x * s + v.y * c};
+            }
+        };
+
+        // Calls visitor.Segment(a, b, radius) for every rounded segment of the shape and
+        // visitor.Polygon(polygon) for polygons, all in local space
+        template<typename Visitor>
+        void VisitSubShape(const ColliderComponent::CircleShape& circle, Visitor& visitor)
+        {
+            visitor.Segment(circle.center, circle.center, circle.radius);
+        }
+
+        template<typename Visitor>
+        void VisitSubShape(const ColliderComponent::CapsuleShape& capsule, Visitor& visitor)
+        {
+            visitor.Segment(capsule.center1, capsule.center2, capsule.radius);
+        }
+
+        template<typename Visitor>
+        void VisitSubShape(const ColliderComponent::SegmentShape& segment, Visitor& visitor)
+        {
+            visitor.Segment(segment.point1, segment.point2, segment.radius);
+        }
+
+        template<typename Visitor>
+        void VisitSubShape(const ColliderComponent::PolygonShape& polygon, Visitor& visitor)
+        {
+            visitor.Polygon(polygon);
+        }
+
+        template<typename Visitor>
+        void VisitSubShape(const ColliderComponent::ChainShape& chain, Visitor& visitor)
+        {
+            size_t count = chain.vertices.size();
+            if (count == 1)
+                visitor.Segment(chain.vertices[0], chain.vertices[0], chain.radius);
+            for (size_t i = 0; i + 1 < count; ++i)
+                visitor.Segment(chain.vertices[i], chain.vertices[i + 1], chain.radius);
+            if (chain.isLoop && count > 2)
+                visitor.Segment(chain.vertices[count - 1], chain.vertices[0], chain.radius);
+        }
+
+        template<typename Visitor>
+        void VisitSubShape(const ColliderComponent::CompositeShape& composite, Visitor& visitor)
+        {
+            for (const auto& subShape : composite.subShapes)
+            {
+                std::visit([&visitor](const auto& shape) { VisitSubShape(shape, visitor); }, subShape);
+            }
+        }
+
+        template<typename Visitor>
+        void VisitShape(const ColliderComponent& collider, Visitor& visitor)
+        {
+            std::visit([&visitor](const auto& shape) { VisitSubShape(shape, visitor); }, collider.shape);
+        }
+
+        Math::Vector2 ClosestPointOnSegment(const Math::Vector2& p, const Math::Vector2& a, const Math::Vector2& b)
+        {
+            Math::Vector2 e = b - a;
+            float lengthSq = e.LengthSquared();
+            if (lengthSq < EPSILON)
+                return a;
+            float u = std::clamp(Math::Vector2::Dot(p - a, e) / lengthSq, 0.0f, 1.0f);
+            return a + e * u;
+        }
+
+        // Ray p + d*t, t in [0, 1], against a disk; a ray starting inside hits at t = 0
+        // only when it moves inward
+        bool RayCircle(const Math::Vector2& p, const Math::Vector2& d, const Math::Vector2& center, float radius,
+                       float& t, Math::Vector2& normal)
+        {
+            Math::Vector2 m = p - center;
+            float c = m.LengthSquared() - radius * radius;
+            if (c <= 0.0f)
+            {
+                float length = m.Length();
+                normal = length > EPSILON ? m / length : -d.Normalize();
+                if (Math::Vector2::Dot(d, normal) >= 0.0f)
+                    return false;
+                t = 0.0f;
+                return true;
+            }
+
+            float b = Math::Vector2::Dot(m, d);
+            float a = d.LengthSquared();
+            if (b >= 0.0f || a < EPSILON)
+                return false;
+            float discriminant = b * b - a * c;
+            if (discriminant < 0.0f)
+                return false;
+            t = (-b - std::sqrt(discriminant)) / a;
+            if (t > 1.0f)
+                return false;
+            normal = (m + d * t) / radius;
+            return true;
+        }
+
+        // Ray against the segment a-b inflated by radius
+        bool RayCapsule(const Math::Vector2& p, const Math::Vector2& d, const Math::Vector2& a, const Math::Vector2& b,
+                        float radius, float& t, Math::Vector2& normal)
+        {
+            Math::Vector2 e = b - a;
+            float lengthSq = e.LengthSquared();
+            if (lengthSq < EPSILON)
+                return RayCircle(p, d, a, radius, t, normal);
+
+            // Starting inside: same rule as RayCircle around the closest segment point
+            Math::Vector2 closest = ClosestPointOnSegment(p, a, b);
+            if ((p - closest).LengthSquared() <= radius * radius)
+                return RayCircle(p, d, closest, radius, t, normal);
+
+            // Flat side facing the ray origin
+            float length = std::sqrt(lengthSq);
+            Math::Vector2 axis = e / length;
+            Math::Vector2 side = {axis.y, -axis.x};
+            float distance = Math::Vector2::Dot(p - a, side);
+            if (distance < 0.0f)
+            {
+                side = -side;
+                distance = -distance;
+            }
+            float approach = Math::Vector2::Dot(d, side);
+            if (approach < 0.0f)
+            {
+                float sideT = (radius - distance) / approach;
+                if (sideT >= 0.0f && sideT <= 1.0f)
+                {
+                    float along = Math::Vector2::Dot(p + d * sideT - a, axis);
+                    if (along >= 0.0f && along <= length)
+                    {
+                        t = sideT;
+                        normal = side;
+                        return true;
+                    }
+                }
+            }
+
+            // Otherwise the first contact is on one of the rounded ends
+            float capT;
+            Math::Vector2 capNormal;
+            bool hit = false;
+            if (RayCircle(p, d, a, radius, capT, capNormal))
+            {
+                t = capT;
+                normal = capNormal;
+                hit = true;
+            }
+            if (RayCircle(p, d, b, radius, capT, capNormal) && (!hit || capT < t))
+            {
+                t = capT;
+                normal = capNormal;
+                hit = true;
+            }
+            return hit;
+        }
+
+        // Largest signed distance of p to the faces of a counter-clockwise polygon (negative inside)
+        float DeepestFace(const Math::Vector2* vertices, size_t count, const Math::Vector2& p, Math::Vector2& faceNormal)
+        {
+            float best = -std::numeric_limits<float>::infinity();
+            for (size_t i = 0; i < count; ++i)
+            {
+                Math::Vector2 e = vertices[(i + 1) % count] - vertices[i];
+                float length = e.Length();
+                if (length < EPSILON)
+                    continue;
+                Math::Vector2 n = {e.y / length, -e.x / length};
+                float distance = Math::Vector2::Dot(p - vertices[i], n);
+                if (distance > best)
+                {
+                    best = distance;
+                    faceNormal = n;
+                }
+            }
+            return best;
+        }
+
+        // Polygons are transformed into a small stack buffer; larger ones fall back to the heap
+        struct WorldPolygon
+        {
+            static constexpr size_t INLINE_VERTICES = 16;
+            Math::Vector2 inlineVertices[INLINE_VERTICES];
+            std::vector<Math::Vector2> heapVertices;
+            const Math::Vector2* vertices = nullptr;
+            size_t count = 0;
+
+            WorldPolygon(const ColliderComponent::PolygonShape& polygon, const WorldTransform& transform)
+            {
+                count = polygon.vertices.size();
+                Math::Vector2* out = inlineVertices;
+                if (count > INLINE_VERTICES)
+                {
+                    heapVertices.resize(count);
+                    out = heapVertices.data();
+                }
+                for (size_t i = 0; i < count; ++i)
+                    out[i] = transform.Apply(polygon.vertices[i]);
+                vertices = out;
+            }
+        };
+
+        struct CastVisitor
+        {
+            WorldTransform transform;
+            Math::Vector2 center;
+            float radius;
+            Math::Vector2 translation;
+            bool hit = false;
+            float t = 1.0f;
+            Math::Vector2 normal = {0.0f, 1.0f};
+
+            void Consider(float candidateT, const Math::Vector2& candidateNormal)
+            {
+                if (!hit || candidateT < t)
+                {
+                    hit = true;
+                    t = candidateT;
+                    normal = candidateNormal;
+                }
+            }
+
+            void Segment(const Math::Vector2& a, const Math::Vector2& b, float segmentRadius)
+            {
+                SegmentWorld(transform.Apply(a), transform.Apply(b), segmentRadius);
+            }
+
+            void Polygon(const ColliderComponent::PolygonShape& polygon)
+            {
+                WorldPolygon world(polygon, transform);
+                if (world.count < 3)
+                {
+                    for (size_t i = 0; i + 1 < world.count; ++i)
+                        SegmentWorld(world.vertices[i], world.vertices[i + 1], polygon.radius);
+                    return;
+                }
+
+                // Center inside the polygon core: blocked only while moving further in
+                Math::Vector2 faceNormal;
+                if (DeepestFace(world.vertices, world.count, center, faceNormal) < 0.0f)
+                {
+                    if (Math::Vector2::Dot(translation, faceNormal) < 0.0f)
+                        Consider(0.0f, faceNormal);
+                    return;
+                }
+
+                for (size_t i = 0; i < world.count; ++i)
+                    SegmentWorld(world.vertices[i], world.vertices[(i + 1) % world.count], polygon.radius);
+            }
+
+            void SegmentWorld(const Math::Vector2& a, const Math::Vector2& b, float segmentRadius)
+            {
+                float segmentT;
+                Math::Vector2 segmentNormal;
+                if (RayCapsule(center, translation, a, b, segmentRadius + radius, segmentT, segmentNormal))
+                {
+                    Consider(segmentT, segmentNormal);
+                }
+            }
+        };
+
+        struct OverlapVisitor
+        {
+            WorldTransform transform;
+            Math::Vector2 center;
+            float radius;
+            bool hit = false;
+            float depth = 0.0f;
+            Math::Vector2 normal = {0.0f, 1.0f};
+
+            void Consider(float candidateDepth, const Math::Vector2& candidateNormal)
+            {
+                if (candidateDepth > 0.0f && (!hit || candidateDepth > depth))
+                {
+                    hit = true;
+                    depth = candidateDepth;
+                    normal = candidateNormal;
+                }
+            }
+
+            void Segment(const Math::Vector2& a, const Math::Vector2& b, float segmentRadius)
+            {
+                SegmentWorld(transform.Apply(a), transform.Apply(b), segmentRadius);
+            }
+
+            void SegmentWorld(const Math::Vector2& a, const Math::Vector2& b, float segmentRadius)
+            {
+                float reach = segmentRadius + radius;
+                Math::Vector2 offset = center - ClosestPointOnSegment(center, a, b);
+                float distanceSq = offset.LengthSquared();
+                if (distanceSq >= reach * reach)
+                    return;
+
+                float distance = std::sqrt(distanceSq);
+                Math::Vector2 pushNormal = {0.0f, 1.0f};
+                if (distance > EPSILON)
+                {
+                    pushNormal = offset / distance;
+                }
+                else if ((b - a).LengthSquared() > EPSILON)
+                {
+                    Math::Vector2 axis = (b - a).Normalize();
+                    pushNormal = {-axis.y, axis.x};
+                }
+                Consider(reach - distance, pushNormal);
+            }
+
+            void Polygon(const ColliderComponent::PolygonShape& polygon)
+            {
+                WorldPolygon world(polygon, transform);
+                if (world.count < 3)
+                {
+                    for (size_t i = 0; i + 1 < world.count; ++i)
+                        SegmentWorld(world.vertices[i], world.vertices[i + 1], polygon.radius);
+                    return;
+                }
+
+                Math::Vector2 faceNormal;
+                float distance = DeepestFace(world.vertices, world.count, center, faceNormal);
+                if (distance < 0.0f)
+                {
+                    Consider(polygon.radius + radius - distance, faceNormal);
+                    return;
+                }
+                for (size_t i = 0; i < world.count; ++i)
+                    SegmentWorld(world.vertices[i], world.vertices[(i + 1) % world.count], polygon.radius);
+            }
+        };
+    }
+
+    bool ShapeCast::CastCircle(const ColliderComponent& collider, const Math::Vector2& position, float rotation,
+                               const Math::Vector2& center, float radius, const Math::Vector2& translation, Hit& hit)
+    {
+        CastVisitor visitor{WorldTransform(position, rotation), center, radius, translation};
+        VisitShape(collider, visitor);
+        if (!visitor.hit)
+            return false;
+
+        hit.fraction = visitor.t;
+        hit.normal = visitor.normal;
+        hit.point = center + translation * visitor.t - visitor.normal * radius;
+        return true;
+    }
+
+    bool ShapeCast::CircleOverlap(const ColliderComponent& collider, const Math::Vector2& position, float rotation,
+                                  const Math::Vector2& center, float radius, Math::Vector2& normal, float& depth)
+    {
+        OverlapVisitor visitor{WorldTransform(position, rotation), center, radius};
+        VisitShape(collider, visitor);
+        if (!visitor.hit)
+            return false;
+
+        normal = visitor.normal;
+        depth = visitor.depth;
+        return true;
+    }
+}
@@ -0,0 +1,383 @@
+#include "nyon/utils/FlightRecorder.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <type_traits>
+
+namespace Nyon::Utils {
+
+namespace {
+
+    // File layout: header, frame records, then snapshots. Records are written as raw
+    // structs, so the record sizes in the header reject dumps from a different layout.
+    constexpr char DUMP_MAGIC[8] = { 'N', 'Y', 'O', 'N', 'F', 'R', '0', '1' };
+    constexpr uint32_t DUMP_VERSION = 1;
+
+    static_assert(std::is_trivially_copyable<FlightRecorder::FrameRecord>::value, "FrameRecord is written raw");
+    static_assert(std::is_trivially_copyable<FlightRecorder::BodyState>::value, "BodyState is written raw");
+
+    template<typename T>
+    void WriteValue(std::ostream& out, const T& value)
+    {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool ReadValue(std::istream& in, T& value)
+    {
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    // Whether count records of recordSize bytes fit in what is left of the file, so a
+    // corrupt count is rejected before it is used to size a vector
+    bool Fits(std::istream& in, uint64_t fileSize, uint64_t count, uint64_t recordSize)
+    {
+        std::streamoff position = in.tellg();
+        if (position < 0 || static_cast<uint64_t>(position) > fileSize)
+            return false;
+        return count <= (fileSize - static_cast<uint64_t>(position)) / recordSize;
+    }
+
+    double Median(std::vector<double> values)
+    {
+        if (values.empty())
+            return 0.0;
+        size_t mid = values.size() / 2;
+        std::nth_element(values.begin(), values.begin() + mid, values.end());
+        return values[mid];
+    }
+
+    // Spike value next to the median of the frames before the spike
+    template<typename Getter>
+    void PrintRow(std::ostream& out, const char* name, const FlightRecorder::FrameRecord& spike,
+                  const std::vector<const FlightRecorder::FrameRecord*>& before, Getter get)
+    {
+        std::vector<double> values;
+        values.reserve(before.size());
+        for (const auto* record : before)
+            values.push_back(static_cast<double>(get(*record)));
+        out << "[FLIGHT]   " << std::left << std::setw(14) << name << std::right
+            << std::setw(12) << static_cast<double>(get(spike))
+            << std::setw(12) << Median(std::move(values)) << "\n";
+    }
+
+} // anonymous namespace
+
+FlightRecorder::FlightRecorder()
+{
+    SetConfig(Config());
+}
+
+void FlightRecorder::SetConfig(const Config& config)
+{
+    m_Config = config;
+    m_Config.capacityFrames = std::max<size_t>(1, m_Config.capacityFrames);
+
+    m_Frames.assign(m_Config.capacityFrames, FrameRecord());
+    m_Head = 0;
+    m_Count = 0;
+    m_Recorded = 0;
+
+    size_t snapshotSlots = 2;
+    if (m_Config.snapshotInterval > 0)
+        snapshotSlots += m_Config.capacityFrames / m_Config.snapshotInterval;
+    m_Snapshots.assign(snapshotSlots, Snapshot());
+    m_SnapshotHead = 0;
+    m_DumpPending = false;
+}
+
+bool FlightRecorder::WantsSnapshot(uint64_t frame) const
+{
+    if (!m_Config.enabled)
+        return false;
+    // The frame right after a spike shows the state the spike left behind
+    if (m_DumpPending && m_FramesSinceSpike == 0)
+        return true;
+    return m_Config.snapshotInterval > 0 && frame % m_Config.snapshotInterval == 0;
+}
+
+FlightRecorder::Snapshot& FlightRecorder::BeginSnapshot(uint64_t frame, uint32_t totalBodies)
+{
+    Snapshot& snapshot = m_Snapshots[m_SnapshotHead];
+    m_SnapshotHead = (m_SnapshotHead + 1) % m_Snapshots.size();
+
+    snapshot.frame = frame;
+    snapshot.totalBodies = totalBodies;
+    snapshot.bodies.clear();
+    snapshot.bodies.reserve(std::min<size_t>(totalBodies, m_Config.maxSnapshotBodies));
+    return snapshot;
+}
+
+void FlightRecorder::Record(const FrameRecord& record)
+{
+    if (!m_Config.enabled)
+        return;
+
+    m_Frames[m_Head] = record;
+    m_Head = (m_Head + 1) % m_Frames.size();
+    m_Count = std::min(m_Count + 1, m_Frames.size());
+    if (++m_Recorded <= m_Config.warmupFrames)
+        return;
+
+    if (m_DumpPending)
+    {
+        if (++m_FramesSinceSpike >= m_Config.postSpikeFrames)
+            WritePendingDump();
+        return;
+    }
+
+    if (m_Config.spikeThresholdMs > 0.0 && record.timing.frameMs > m_Config.spikeThresholdMs &&
+        m_DumpCount < m_Config.maxDumps)
+    {
+        m_DumpPending = true;
+        m_SpikeFrame = record.frame;
+        m_FramesSinceSpike = 0;
+        if (m_Config.postSpikeFrames == 0)
+            WritePendingDump();
+    }
+}
+
+void FlightRecorder::Flush()
+{
+    if (m_DumpPending)
+        WritePendingDump();
+}
+
+FlightRecorder::Dump FlightRecorder::Capture(uint64_t spikeFrame) const
+{
+    Dump dump;
+    dump.spikeFrame = spikeFrame;
+    dump.thresholdMs = m_Config.spikeThresholdMs;
+    dump.frames.reserve(m_Count);
+
+    size_t oldest = (m_Head + m_Frames.size() - m_Count) % m_Frames.size();
+    for (size_t i = 0; i < m_Count; ++i)
+        dump.frames.push_back(m_Frames[(oldest + i) % m_Frames.size()]);
+
+    if (dump.frames.empty())
+        return dump;
+
+    uint64_t firstFrame = dump.frames.front().frame;
+    uint64_t lastFrame = dump.frames.back().frame;
+    for (const Snapshot& snapshot : m_Snapshots)
+    {
+        if (snapshot.frame >= firstFrame && snapshot.frame <= lastFrame && snapshot.totalBodies > 0)
+            dump.snapshots.push_back(snapshot);
+    }
+    std::sort(dump.snapshots.begin(), dump.snapshots.end(),
+              [](const Snapshot& a, const Snapshot& b) { return a.frame < b.frame; });
+    return dump;
+}
+
+void FlightRecorder::WritePendingDump()
+{
+    m_DumpPending = false;
+    ++m_DumpCount;
+
+    std::string path = m_Config.directory + "/nyon-spike-" + std::to_string(m_SpikeFrame) + ".nfr";
+    if (WriteDump(path, Capture(m_SpikeFrame)))
+    {
+        m_LastDumpPath = path;
+        std::cerr << "[FLIGHT] Frame " << m_SpikeFrame << " exceeded " << m_Config.spikeThresholdMs
+                  << " ms; wrote " << path << std::endl;
+    }
+    else
+    {
+        std::cerr << "[FLIGHT] Failed to write " << path << std::endl;
+    }
+}
+
+bool FlightRecorder::WriteDump(const std::string& path, const Dump& dump)
+{
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+        return false;
+
+    out.write(DUMP_MAGIC, sizeof(DUMP_MAGIC));
+    WriteValue(out, DUMP_VERSION);
+    WriteValue(out, static_cast<uint32_t>(sizeof(FrameRecord)));
+    WriteValue(out, static_cast<uint32_t>(sizeof(BodyState)));
+    WriteValue(out, dump.spikeFrame);
+    WriteValue(out, dump.thresholdMs);
+
+    WriteValue(out, static_cast<uint64_t>(dump.frames.size()));
+    out.write(reinterpret_cast<const char*>(dump.frames.data()),
+              static_cast<std::streamsize>(dump.frames.size() * sizeof(FrameRecord)));
+
+    WriteValue(out, static_cast<uint64_t>(dump.snapshots.size()));
+    for (const Snapshot& snapshot : dump.snapshots)
+    {
+        WriteValue(out, snapshot.frame);
+        WriteValue(out, snapshot.totalBodies);
+        WriteValue(out, static_cast<uint32_t>(snapshot.bodies.size()));
+        out.write(reinterpret_cast<const char*>(snapshot.bodies.data()),
+                  static_cast<std::streamsize>(snapshot.bodies.size() * sizeof(BodyState)));
+    }
+    return static_cast<bool>(out);
+}
+
+bool FlightRecorder::ReadDump(const std::string& path, Dump& dump)
+{
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in)
+        return false;
+    std::streamoff fileSize = in.tellg();
+    if (fileSize < 0 || !in.seekg(0))
+        return false;
+
+    char magic[sizeof(DUMP_MAGIC)];
+    uint32_t version = 0, frameSize = 0, bodySize = 0;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, DUMP_MAGIC, sizeof(magic)) != 0)
+        return false;
+    if (!ReadValue(in, version) || !ReadValue(in, frameSize) || !ReadValue(in, bodySize))
+        return false;
+    if (version != DUMP_VERSION || frameSize != sizeof(FrameRecord) || bodySize != sizeof(BodyState))
+        return false;
+
+    dump = Dump();
+    uint64_t frameCount = 0;
+    if (!ReadValue(in, dump.spikeFrame) || !ReadValue(in, dump.thresholdMs) || !ReadValue(in, frameCount))
+        return false;
+    if (!Fits(in, static_cast<uint64_t>(fileSize), frameCount, sizeof(FrameRecord)))
+        return false;
+    dump.frames.resize(static_cast<size_t>(frameCount));
+    if (!in.read(reinterpret_cast<char*>(dump.frames.data()),
+                 static_cast<std::streamsize>(dump.frames.size() * sizeof(FrameRecord))))
+        return false;
+
+    uint64_t snapshotCount = 0;
+    // Each snapshot has at least its frame, total and kept count
+    constexpr uint64_t SNAPSHOT_HEADER_SIZE = sizeof(uint64_t) + 2 * sizeof(uint32_t);
+    if (!ReadValue(in, snapshotCount) || !Fits(in, static_cast<uint64_t>(fileSize), snapshotCount, SNAPSHOT_HEADER_SIZE))
+        return false;
+    dump.snapshots.resize(static_cast<size_t>(snapshotCount));
+    for (Snapshot& snapshot : dump.snapshots)
+    {
+        uint32_t kept = 0;
+        if (!ReadValue(in, snapshot.frame) || !ReadValue(in, snapshot.totalBodies) || !ReadValue(in, kept))
+            return false;
+        if (!Fits(in, static_cast<uint64_t>(fileSize), kept, sizeof(BodyState)))
+            return false;
+        snapshot.bodies.resize(kept);
+        if (!in.read(reinterpret_cast<char*>(snapshot.bodies.data()),
+                     static_cast<std::streamsize>(snapshot.bodies.size() * sizeof(BodyState))))
+            return false;
+    }
+    return true;
+}
+
+void FlightRecorder::PrintReport(const Dump& dump, std::ostream& out)
+{
+    auto spikeIt = std::find_if(dump.frames.begin(), dump.frames.end(),
+                                [&dump](const FrameRecord& r) { return r.frame == dump.spikeFrame; });
+    if (spikeIt == dump.frames.end())
+    {
+        out << "[FLIGHT] Spike frame " << dump.spikeFrame << " is not in the dump\n";
+        return;
+    }
+
+    const FrameRecord& spike = *spikeIt;
+    std::vector<const FrameRecord*> before;
+    for (auto it = dump.frames.begin(); it != spikeIt; ++it)
+        before.push_back(&*it);
+
+    std::ios_base::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(3);
+    out << "[FLIGHT] Spike at frame " << spike.frame << " (t=" << spike.time << " s): " << spike.timing.frameMs
+        << " ms, threshold " << dump.thresholdMs << " ms; " << dump.frames.size() << " frames recorded ("
+        << dump.frames.front().frame << ".." << dump.frames.back().frame << ")\n";
+
+    out << "[FLIGHT]   " << std::left << std::setw(14) << "ms" << std::right << std::setw(12) << "spike"
+        << std::setw(12) << "median" << "\n";
+    PrintRow(out, "frame", spike, before, [](const FrameRecord& r) { return r.timing.frameMs; });
+    PrintRow(out, "fixed", spike, before, [](const FrameRecord& r) { return r.timing.fixedMs; });
+    PrintRow(out, "update", spike, before, [](const FrameRecord& r) { return r.timing.updateMs; });
+    PrintRow(out, "render", spike, before, [](const FrameRecord& r) { return r.timing.renderMs; });
+    PrintRow(out, "wait", spike, before, [](const FrameRecord& r) { return r.timing.waitMs; });
+    PrintRow(out, "cpu", spike, before, [](const FrameRecord& r) { return r.timing.cpuMs; });
+    PrintRow(out, "physics", spike, before, [](const FrameRecord& r) { return r.physics.updateMs; });
+    PrintRow(out, " broad phase", spike, before, [](const FrameRecord& r) { return r.physics.broadPhaseMs; });
+    PrintRow(out, " narrow phase", spike, before, [](const FrameRecord& r) { return r.physics.narrowPhaseMs; });
+    PrintRow(out, " islands", spike, before, [](const FrameRecord& r) { return r.physics.islandMs; });
+    PrintRow(out, " constraints", spike, before, [](const FrameRecord& r) { return r.physics.constraintMs; });
+    PrintRow(out, " velocity", spike, before, [](const FrameRecord& r) { return r.physics.velocityMs; });
+    PrintRow(out, " position", spike, before, [](const FrameRecord& r) { return r.physics.positionMs; });
+    PrintRow(out, " finalize", spike, before, [](const FrameRecord& r) { return r.physics.finalizeMs; });
+
+    out << std::setprecision(1);
+    out << "[FLIGHT]   " << std::left << std::setw(14) << "count" << std::right << std::setw(12) << "spike"
+        << std::setw(12) << "median" << "\n";
+    PrintRow(out, "fixed steps", spike, before, [](const FrameRecord& r) { return r.timing.fixedSteps; });
+    PrintRow(out, "sub-steps", spike, before, [](const FrameRecord& r) { return r.physics.subSteps; });
+    PrintRow(out, "pairs", spike, before, [](const FrameRecord& r) { return r.physics.pairs; });
+    PrintRow(out, "contacts", spike, before, [](const FrameRecord& r) { return r.physics.contacts; });
+    PrintRow(out, "constraints", spike, before, [](const FrameRecord& r) { return r.physics.constraints; });
+    PrintRow(out, "islands", spike, before, [](const FrameRecord& r) { return r.physics.islands; });
+    PrintRow(out, "awake bodies", spike, before, [](const FrameRecord& r) { return r.physics.awakeBodies; });
+    PrintRow(out, "asleep bodies", spike, before, [](const FrameRecord& r) { return r.physics.sleepingBodies; });
+    PrintRow(out, "particles", spike, before, [](const FrameRecord& r) { return r.physics.particles; });
+    PrintRow(out, "input events", spike, before, [](const FrameRecord& r) { return r.timing.inputEvents; });
+    PrintRow(out, "allocations", spike, before, [](const FrameRecord& r) { return r.allocations; });
+    PrintRow(out, "tracked KB", spike, before, [](const FrameRecord& r) { return r.trackedBytes / 1024.0; });
+
+    // Frames around the spike
+    out << std::setprecision(3);
+    out << "[FLIGHT] frame      frame_ms  fixed_ms  phys_ms  pairs  contacts  awake  allocs\n";
+    size_t spikeIndex = static_cast<size_t>(spikeIt - dump.frames.begin());
+    size_t first = spikeIndex >= 5 ? spikeIndex - 5 : 0;
+    size_t last = std::min(dump.frames.size(), spikeIndex + 6);
+    for (size_t i = first; i < last; ++i)
+    {
+        const FrameRecord& r = dump.frames[i];
+        out << (i == spikeIndex ? "[FLIGHT] > " : "[FLIGHT]   ") << std::left << std::setw(8) << r.frame << std::right
+            << std::setw(10) << r.timing.frameMs << std::setw(10) << r.timing.fixedMs
+            << std::setw(9) << r.physics.updateMs << std::setw(7) << r.physics.pairs
+            << std::setw(10) << r.physics.contacts << std::setw(7) << r.physics.awakeBodies
+            << std::setw(8) << r.allocations << "\n";
+    }
+
+    // Nearest snapshot at or after the spike, else the last one before it
+    const Snapshot* snapshot = nullptr;
+    for (const Snapshot& s : dump.snapshots)
+    {
+        snapshot = &s;
+        if (s.frame >= spike.frame)
+            break;
+    }
+    if (snapshot != nullptr)
+    {
+        size_t awake = 0;
+        float maxSpeed = 0.0f;
+        uint32_t fastest = 0;
+        float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+        bool firstBody = true;
+        for (const BodyState& body : snapshot->bodies)
+        {
+            if (body.flags & FLAG_DISABLED)
+                continue;
+            if (body.flags & FLAG_AWAKE)
+                ++awake;
+            float speed = std::sqrt(body.vx * body.vx + body.vy * body.vy);
+            if (speed > maxSpeed)
+            {
+                maxSpeed = speed;
+                fastest = body.entityId;
+            }
+            minX = firstBody ? body.x : std::min(minX, body.x);
+            minY = firstBody ? body.y : std::min(minY, body.y);
+            maxX = firstBody ? body.x : std::max(maxX, body.x);
+            maxY = firstBody ? body.y : std::max(maxY, body.y);
+            firstBody = false;
+        }
+        out << std::setprecision(1);
+        out << "[FLIGHT] Snapshot at frame " << snapshot->frame << ": " << snapshot->totalBodies << " bodies ("
+            << snapshot->bodies.size() << " kept), " << awake << " awake, fastest entity " << fastest << " at "
+            << maxSpeed << " px/s, bounds (" << minX << ", " << minY << ")-(" << maxX << ", " << maxY << ")\n";
+    }
+    out.flags(flags);
+}
+
+} // namespace Nyon::Utils
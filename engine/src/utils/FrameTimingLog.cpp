@@ -0,0 +1,111 @@
+#include "nyon/utils/FrameTimingLog.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+namespace Nyon::Utils {
+
+namespace {
+
+    struct Distribution
+    {
+        double mean = 0.0;
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    Distribution Summarize(std::vector<double> values)
+    {
+        Distribution d;
+        if (values.empty())
+            return d;
+
+        std::sort(values.begin(), values.end());
+        auto percentile = [&values](double p) {
+            size_t index = static_cast<size_t>(p * static_cast<double>(values.size() - 1) + 0.5);
+            return values[std::min(index, values.size() - 1)];
+        };
+
+        double sum = 0.0;
+        for (double v : values)
+            sum += v;
+        d.mean = sum / static_cast<double>(values.size());
+        d.p50 = percentile(0.50);
+        d.p95 = percentile(0.95);
+        d.p99 = percentile(0.99);
+        d.max = values.back();
+        return d;
+    }
+
+    void PrintDistribution(std::ostream& out, const char* label, const char* name, const Distribution& d)
+    {
+        out << "[TIMING] " << label << " " << name << " ms: mean " << d.mean << ", p50 " << d.p50
+            << ", p95 " << d.p95 << ", p99 " << d.p99 << ", max " << d.max << "\n";
+    }
+
+} // anonymous namespace
+
+bool FrameTimingLog::WriteCsv(const std::string& path) const
+{
+    std::ofstream out(path);
+    if (!out)
+        return false;
+
+    out << "frame,frame_ms,fixed_ms,update_ms,render_ms,wait_ms,cpu_ms,fixed_steps,input_events,input_sim_ms,input_present_ms\n";
+    out << std::fixed << std::setprecision(4);
+    for (size_t i = 0; i < m_Frames.size(); ++i)
+    {
+        const Frame& f = m_Frames[i];
+        out << i << "," << f.frameMs << "," << f.fixedMs << "," << f.updateMs << ","
+            << f.renderMs << "," << f.waitMs << "," << f.cpuMs << "," << f.fixedSteps << "," << f.inputEvents << "," << f.inputToSimMs << ","
+            << f.inputToPresentMs << "\n";
+    }
+    return static_cast<bool>(out);
+}
+
+void FrameTimingLog::PrintSummary(std::ostream& out, const char* label) const
+{
+    std::vector<double> frameMs;
+    std::vector<double> fixedMs;
+    std::vector<double> cpuMs;
+    std::vector<double> inputToSimMs;
+    std::vector<double> inputToPresentMs;
+    frameMs.reserve(m_Frames.size());
+    fixedMs.reserve(m_Frames.size());
+    cpuMs.reserve(m_Frames.size());
+    double wallTotal = 0.0;
+    double cpuTotal = 0.0;
+    for (const Frame& f : m_Frames)
+    {
+        frameMs.push_back(f.frameMs);
+        fixedMs.push_back(f.fixedMs);
+        cpuMs.push_back(f.cpuMs);
+        wallTotal += f.frameMs;
+        cpuTotal += f.cpuMs;
+        if (f.inputEvents > 0)
+        {
+            inputToSimMs.push_back(f.inputToSimMs);
+            inputToPresentMs.push_back(f.inputToPresentMs);
+        }
+    }
+
+    std::ios_base::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(3);
+    out << "[TIMING] " << label << ": " << m_Frames.size() << " frames\n";
+    PrintDistribution(out, label, "frame", Summarize(std::move(frameMs)));
+    PrintDistribution(out, label, "fixed", Summarize(std::move(fixedMs)));
+    PrintDistribution(out, label, "cpu", Summarize(std::move(cpuMs)));
+    // Above 100% means worker threads were busy in parallel with the main thread
+    out << "[TIMING] " << label << " cpu/wall: " << (wallTotal > 0.0 ? 100.0 * cpuTotal / wallTotal : 0.0) << "%\n";
+    if (!inputToSimMs.empty())
+    {
+        out << "[TIMING] " << label << ": " << inputToSimMs.size() << " frames with input\n";
+        PrintDistribution(out, label, "input->sim", Summarize(std::move(inputToSimMs)));
+        PrintDistribution(out, label, "input->present", Summarize(std::move(inputToPresentMs)));
+    }
+    out.flags(flags);
+}
+
+} // namespace Nyon::Utils
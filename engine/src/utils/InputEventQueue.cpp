@@ -0,0 +1,50 @@
+#include "nyon/utils/InputEventQueue.h"
+
+namespace Nyon::Utils {
+
+bool InputEventQueue::Push(const InputEvent& event)
+{
+    size_t tail = m_Tail.load(std::memory_order_relaxed);
+    if (tail - m_Head.load(std::memory_order_acquire) >= CAPACITY)
+    {
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    m_Events[tail & MASK] = event;
+    m_Tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool InputEventQueue::Peek(InputEvent& event) const
+{
+    size_t head = m_Head.load(std::memory_order_relaxed);
+    if (head == m_Tail.load(std::memory_order_acquire))
+        return false;
+
+    event = m_Events[head & MASK];
+    return true;
+}
+
+bool InputEventQueue::Pop(InputEvent& event)
+{
+    if (!Peek(event))
+        return false;
+
+    m_Head.store(m_Head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    return true;
+}
+
+void InputEventQueue::Clear()
+{
+    m_Head.store(m_Tail.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+size_t InputEventQueue::Size() const
+{
+    // Head first: the tail only grows, so the difference cannot underflow
+    size_t head = m_Head.load(std::memory_order_acquire);
+    return m_Tail.load(std::memory_order_acquire) - head;
+}
+
+} // namespace Nyon::Utils
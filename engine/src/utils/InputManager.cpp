@@ -1,6 +1,8 @@
 #include "nyon/utils/InputManager.h"
+#include <algorithm>
 #include <cstring>
 #include <iostream>
+#include <limits>
 
 namespace Nyon::Utils
 {
@@ -10,10 +12,14 @@ namespace Nyon::Utils
     bool InputManager::s_CurrentMouseButtons[GLFW_MOUSE_BUTTON_LAST] = {};
     bool InputManager::s_PreviousMouseButtons[GLFW_MOUSE_BUTTON_LAST] = {};
     
-    // Callback-based input tracking
-    std::unordered_set<int> InputManager::s_ActiveKeys;
-    std::unordered_set<int> InputManager::s_ActiveMouseButtons;
-    bool InputManager::s_InputDirty = false;
+    // Callback-fed event queue
+    InputEventQueue InputManager::s_Events;
+    InputManager::LatencySample InputManager::s_Latency;
+    uint64_t InputManager::s_InputSerial = 0;
+    bool InputManager::s_Synthetic = false;
+    bool InputManager::s_HasSyntheticMouse = false;
+    double InputManager::s_SyntheticMouseX = 0.0;
+    double InputManager::s_SyntheticMouseY = 0.0;
 
     void InputManager::Init(GLFWwindow* window)
     {
@@ -30,18 +36,11 @@ namespace Nyon::Utils
         }
     }
     
-    // GLFW key callback - only called when key state changes
+    // GLFW key callback - only called when key state changes; applied by the fixed step
     void InputManager::KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
     {
-        if (key >= 0 && key < GLFW_KEY_LAST) {
-            if (action == GLFW_PRESS) {
-                s_ActiveKeys.insert(key);
-                s_CurrentKeys[key] = true;
-            } else if (action == GLFW_RELEASE) {
-                s_ActiveKeys.erase(key);
-                s_CurrentKeys[key] = false;
-            }
-            s_InputDirty = true;
+        if (key >= 0 && key < GLFW_KEY_LAST && action != GLFW_REPEAT) {
+            s_Events.Push({ InputEvent::Device::Key, key, action, glfwGetTime() });
         }
     }
     
@@ -49,20 +48,23 @@ namespace Nyon::Utils
     void InputManager::MouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
     {
         if (button >= 0 && button < GLFW_MOUSE_BUTTON_LAST) {
-            if (action == GLFW_PRESS) {
-                s_ActiveMouseButtons.insert(button);
-                s_CurrentMouseButtons[button] = true;
-            } else if (action == GLFW_RELEASE) {
-                s_ActiveMouseButtons.erase(button);
-                s_CurrentMouseButtons[button] = false;
-            }
-            s_InputDirty = true;
+            s_Events.Push({ InputEvent::Device::MouseButton, button, action, glfwGetTime() });
+        }
+    }
+
+    bool InputManager::QueueEvent(const InputEvent& event)
+    {
+        int limit = event.device == InputEvent::Device::Key ? GLFW_KEY_LAST : GLFW_MOUSE_BUTTON_LAST;
+        if (event.code < 0 || event.code >= limit) {
+            return false;
         }
+        s_Synthetic = true;
+        return s_Events.Push(event);
     }
 
     void InputManager::Update()
     {
-        if (s_Window == nullptr) {
+        if (!IsAvailable()) {
             return;
         }
         
@@ -71,16 +73,63 @@ namespace Nyon::Utils
         memcpy(s_PreviousKeys, s_CurrentKeys, sizeof(s_CurrentKeys));
         memcpy(s_PreviousMouseButtons, s_CurrentMouseButtons, sizeof(s_CurrentMouseButtons));
         
-        // Reset dirty flag after copying
-        s_InputDirty = false;
-        
         // Mouse position is still polled every frame as it can change without button events
         // This is acceptable since it's a single call vs 348 key checks
+        double now = s_Window != nullptr ? glfwGetTime() : 0.0;
+        ApplyEvents(std::numeric_limits<double>::infinity(), now);
+    }
+
+    void InputManager::BeginFixedStep(double stepEndTime, double now)
+    {
+        if (!IsAvailable()) {
+            return;
+        }
+        
+        memcpy(s_PreviousKeys, s_CurrentKeys, sizeof(s_CurrentKeys));
+        memcpy(s_PreviousMouseButtons, s_CurrentMouseButtons, sizeof(s_CurrentMouseButtons));
+        ApplyEvents(stepEndTime, now);
+    }
+
+    void InputManager::ApplyEvents(double untilTime, double now)
+    {
+        InputEvent event;
+        while (s_Events.Peek(event) && event.timestamp <= untilTime)
+        {
+            bool isKey = event.device == InputEvent::Device::Key;
+            bool* current = isKey ? s_CurrentKeys : s_CurrentMouseButtons;
+            const bool* previous = isKey ? s_PreviousKeys : s_PreviousMouseButtons;
+            
+            if (event.action == GLFW_PRESS || event.action == GLFW_RELEASE)
+            {
+                bool down = event.action == GLFW_PRESS;
+                // Reverting a transition made this step would hide it; keep the
+                // event (and everything after it, to preserve order) for the next step
+                if (down != current[event.code] && current[event.code] != previous[event.code])
+                    break;
+                if (current[event.code] != down)
+                    s_InputSerial++;
+                current[event.code] = down;
+            }
+            s_Events.Pop(event);
+            
+            double waitMs = std::max(0.0, (now - event.timestamp) * 1000.0);
+            if (s_Latency.events == 0 || event.timestamp < s_Latency.oldestTimestamp)
+                s_Latency.oldestTimestamp = event.timestamp;
+            s_Latency.maxToSimMs = std::max(s_Latency.maxToSimMs, waitMs);
+            s_Latency.events++;
+        }
+    }
+
+    InputManager::LatencySample InputManager::TakeLatencySample()
+    {
+        LatencySample sample = s_Latency;
+        s_Latency = LatencySample();
+        return sample;
     }
 
     bool InputManager::IsKeyPressed(int key)
     {
-        if (s_Window == nullptr || key < 0 || key >= GLFW_KEY_LAST) {
+        if (!IsAvailable() || key < 0 || key >= GLFW_KEY_LAST) {
             return false;
         }
         return s_CurrentKeys[key] && !s_PreviousKeys[key];
@@ -88,7 +137,7 @@ namespace Nyon::Utils
 
     bool InputManager::IsKeyDown(int key)
     {
-        if (s_Window == nullptr || key < 0 || key >= GLFW_KEY_LAST) {
+        if (!IsAvailable() || key < 0 || key >= GLFW_KEY_LAST) {
             return false;
         }
         return s_CurrentKeys[key];
@@ -100,7 +149,7 @@ namespace Nyon::Utils
             return false;
         }
         // When no window is available, treat all keys as up (not pressed)
-        if (s_Window == nullptr) {
+        if (!IsAvailable()) {
             return true;
         }
         return !s_CurrentKeys[key] && s_PreviousKeys[key];
@@ -108,7 +157,7 @@ namespace Nyon::Utils
 
     bool InputManager::IsMousePressed(int button)
     {
-        if (s_Window == nullptr || button < 0 || button >= GLFW_MOUSE_BUTTON_LAST) {
+        if (!IsAvailable() || button < 0 || button >= GLFW_MOUSE_BUTTON_LAST) {
             return false;
         }
         return s_CurrentMouseButtons[button] && !s_PreviousMouseButtons[button];
@@ -116,7 +165,7 @@ namespace Nyon::Utils
 
     bool InputManager::IsMouseDown(int button)
     {
-        if (s_Window == nullptr || button < 0 || button >= GLFW_MOUSE_BUTTON_LAST) {
+        if (!IsAvailable() || button < 0 || button >= GLFW_MOUSE_BUTTON_LAST) {
             return false;
         }
         return s_CurrentMouseButtons[button];
@@ -128,7 +177,7 @@ namespace Nyon::Utils
             return false;
         }
         // When no window is available, treat all buttons as up
-        if (s_Window == nullptr) {
+        if (!IsAvailable()) {
             return true;
         }
         return !s_CurrentMouseButtons[button] && s_PreviousMouseButtons[button];
@@ -136,6 +185,11 @@ namespace Nyon::Utils
 
     void InputManager::GetMousePosition(double& x, double& y)
     {
+        if (s_HasSyntheticMouse) {
+            x = s_SyntheticMouseX;
+            y = s_SyntheticMouseY;
+            return;
+        }
         if (s_Window == nullptr) {
             x = 0.0;
             y = 0.0;
@@ -143,4 +197,36 @@ namespace Nyon::Utils
         }
         glfwGetCursorPos(s_Window, &x, &y);
     }
+
+    void InputManager::SetKeyState(int key, bool down)
+    {
+        if (key < 0 || key >= GLFW_KEY_LAST) {
+            return;
+        }
+        s_Synthetic = true;
+        if (s_CurrentKeys[key] != down) {
+            s_InputSerial++;
+        }
+        s_CurrentKeys[key] = down;
+    }
+
+    void InputManager::SetMouseButtonState(int button, bool down)
+    {
+        if (button < 0 || button >= GLFW_MOUSE_BUTTON_LAST) {
+            return;
+        }
+        s_Synthetic = true;
+        if (s_CurrentMouseButtons[button] != down) {
+            s_InputSerial++;
+        }
+        s_CurrentMouseButtons[button] = down;
+    }
+
+    void InputManager::SetMousePosition(double x, double y)
+    {
+        s_Synthetic = true;
+        s_HasSyntheticMouse = true;
+        s_SyntheticMouseX = x;
+        s_SyntheticMouseY = y;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include "nyon/utils/MemoryTracker.h"
+#include <chrono>
+#include <iomanip>
+
+namespace Nyon::Utils {
+
+std::array<MemoryTracker::Counters, static_cast<size_t>(MemoryTag::COUNT)> MemoryTracker::s_Counters;
+std::array<MemoryTracker::RateSample, static_cast<size_t>(MemoryTag::COUNT)> MemoryTracker::s_Rates;
+double MemoryTracker::s_LastSampleTime = -1.0;
+
+namespace {
+
+    double NowSeconds()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+} // anonymous namespace
+
+const char* GetMemoryTagName(MemoryTag tag)
+{
+    switch (tag)
+    {
+        case MemoryTag::General:    return "General";
+        case MemoryTag::ECS:        return "ECS";
+        case MemoryTag::Physics:    return "Physics";
+        case MemoryTag::BroadPhase: return "BroadPhase";
+        case MemoryTag::Particles:  return "Particles";
+        case MemoryTag::Rendering:  return "Rendering";
+        default:                    return "Unknown";
+    }
+}
+
+void MemoryTracker::RecordAllocation(MemoryTag tag, size_t bytes)
+{
+    Counters& counters = s_Counters[static_cast<size_t>(tag)];
+    size_t current = counters.currentBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+
+    size_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+    while (current > peak && !counters.peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+    {
+    }
+}
+
+void MemoryTracker::RecordFree(MemoryTag tag, size_t bytes)
+{
+    s_Counters[static_cast<size_t>(tag)].currentBytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+MemoryTracker::TagStats MemoryTracker::GetStats(MemoryTag tag)
+{
+    const Counters& counters = s_Counters[static_cast<size_t>(tag)];
+    const RateSample& rate = s_Rates[static_cast<size_t>(tag)];
+
+    TagStats stats;
+    stats.currentBytes = counters.currentBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+    stats.bytesAllocated = counters.bytesAllocated.load(std::memory_order_relaxed);
+    stats.allocationsPerSecond = rate.allocationsPerSecond;
+    stats.bytesPerSecond = rate.bytesPerSecond;
+    return stats;
+}
+
+size_t MemoryTracker::GetTotalCurrentBytes()
+{
+    size_t total = 0;
+    for (const auto& counters : s_Counters)
+        total += counters.currentBytes.load(std::memory_order_relaxed);
+    return total;
+}
+
+void MemoryTracker::Sample()
+{
+    double now = NowSeconds();
+    double elapsed = s_LastSampleTime < 0.0 ? 0.0 : now - s_LastSampleTime;
+    s_LastSampleTime = now;
+
+    for (size_t i = 0; i < s_Counters.size(); ++i)
+    {
+        uint64_t allocations = s_Counters[i].allocations.load(std::memory_order_relaxed);
+        uint64_t bytes = s_Counters[i].bytesAllocated.load(std::memory_order_relaxed);
+        RateSample& rate = s_Rates[i];
+        if (elapsed > 0.0)
+        {
+            rate.allocationsPerSecond = static_cast<double>(allocations - rate.allocations) / elapsed;
+            rate.bytesPerSecond = static_cast<double>(bytes - rate.bytesAllocated) / elapsed;
+        }
+        rate.allocations = allocations;
+        rate.bytesAllocated = bytes;
+    }
+}
+
+void MemoryTracker::ResetPeaks()
+{
+    for (auto& counters : s_Counters)
+        counters.peakBytes.store(counters.currentBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void MemoryTracker::Report(std::ostream& out)
+{
+    auto kib = [](double bytes) { return bytes / 1024.0; };
+
+    std::ios_base::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(1);
+    out << "[MEMORY] " << std::left << std::setw(12) << "tag" << std::right
+        << std::setw(12) << "current KiB" << std::setw(12) << "peak KiB"
+        << std::setw(12) << "allocs/s" << std::setw(12) << "KiB/s" << "\n";
+    for (size_t i = 0; i < static_cast<size_t>(MemoryTag::COUNT); ++i)
+    {
+        TagStats stats = GetStats(static_cast<MemoryTag>(i));
+        out << "[MEMORY] " << std::left << std::setw(12) << GetMemoryTagName(static_cast<MemoryTag>(i)) << std::right
+            << std::setw(12) << kib(static_cast<double>(stats.currentBytes))
+            << std::setw(12) << kib(static_cast<double>(stats.peakBytes))
+            << std::setw(12) << stats.allocationsPerSecond
+            << std::setw(12) << kib(stats.bytesPerSecond) << "\n";
+    }
+    out << "[MEMORY] total " << kib(static_cast<double>(GetTotalCurrentBytes())) << " KiB\n";
+    out.flags(flags);
+}
+
+} // namespace Nyon::Utils
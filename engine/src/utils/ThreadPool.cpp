@@ -1,24 +1,106 @@
 #include "nyon/utils/ThreadPool.h"
 #include <iostream>
+#include <fstream>
+#include <map>
+#include <algorithm>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace Nyon::Utils {
 
 std::unique_ptr<ThreadPool> ThreadPool::s_Instance = nullptr;
 
-ThreadPool::ThreadPool(size_t numThreads) {
+namespace {
+
+#ifdef __linux__
+    // Read a single integer from a sysfs topology file, -1 if unavailable
+    int ReadTopologyValue(int cpu, const char* file)
+    {
+        std::ifstream in("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/" + file);
+        int value = -1;
+        if (!(in >> value)) {
+            return -1;
+        }
+        return value;
+    }
+#endif
+
+    ThreadPool::Config MakeConfig(size_t numThreads)
+    {
+        ThreadPool::Config config;
+        config.numThreads = numThreads;
+        return config;
+    }
+
+} // anonymous namespace
+
+ThreadPool::ThreadPool(size_t numThreads)
+    : ThreadPool(MakeConfig(numThreads))
+{
+}
+
+ThreadPool::ThreadPool(const Config& config)
+    : m_Config(config)
+    , m_Topology(DetectTopology())
+{
+    const auto& cores = m_Topology.physicalCores;
+    size_t reserved = std::min(m_Config.reservedCores, cores.empty() ? size_t(0) : cores.size() - 1);
+
+    size_t numThreads = m_Config.numThreads;
     if (numThreads == 0) {
-        // Use all available cores
-        numThreads = std::thread::hardware_concurrency();
+        // One worker per physical core (or per logical CPU when SMT is wanted),
+        // leaving the reserved cores to the main and render threads. Logical
+        // counts drop every SMT sibling of a reserved core, not one CPU per core.
+        size_t available = cores.size();
+        size_t unavailable = reserved;
+        if (!m_Config.physicalCoresOnly) {
+            available = m_Topology.logicalCount;
+            unavailable = 0;
+            for (size_t i = 0; i < reserved; ++i) {
+                unavailable += cores[i].size();
+            }
+        }
+        numThreads = available > unavailable ? available - unavailable : 1;
         if (numThreads == 0) {
             numThreads = 1; // Fallback
         }
     }
-    
+
+    for (size_t i = 0; i < reserved; ++i) {
+        m_ReservedCpus.push_back(cores[i].front());
+    }
+
+    // Assign workers to the remaining physical cores first, then spill onto
+    // SMT siblings, then wrap around if the pool is oversubscribed.
+    m_WorkerCpus.assign(numThreads, -1);
+    if (m_Config.pinWorkers && cores.size() > reserved) {
+        std::vector<int> order;
+        size_t maxSiblings = 0;
+        for (size_t c = reserved; c < cores.size(); ++c) {
+            maxSiblings = std::max(maxSiblings, cores[c].size());
+        }
+        for (size_t sibling = 0; sibling < maxSiblings; ++sibling) {
+            for (size_t c = reserved; c < cores.size(); ++c) {
+                if (sibling < cores[c].size()) {
+                    order.push_back(cores[c][sibling]);
+                }
+            }
+        }
+        for (size_t i = 0; i < numThreads; ++i) {
+            m_WorkerCpus[i] = order[i % order.size()];
+        }
+    }
+
     // Log thread count for debugging
-    std::cerr << "[ThreadPool] Initializing with " << numThreads << " threads\n";
+    std::cerr << "[ThreadPool] Initializing with " << numThreads << " threads ("
+              << cores.size() << " physical / " << m_Topology.logicalCount << " logical cores, "
+              << reserved << " reserved" << (m_Config.pinWorkers ? ", pinned" : "") << ")\n";
 
     for (size_t i = 0; i < numThreads; ++i) {
-        m_Workers.emplace_back(&ThreadPool::WorkerThread, this);
+        m_Workers.emplace_back(&ThreadPool::WorkerThread, this, i);
     }
 }
 
@@ -35,8 +117,13 @@ ThreadPool::~ThreadPool() {
     }
 }
 
-void ThreadPool::WorkerThread() {
+void ThreadPool::WorkerThread(size_t index) {
     tls_IsWorkerThread = true;
+
+    SetCurrentThreadName(m_Config.threadNamePrefix + "-" + std::to_string(index));
+    if (m_WorkerCpus[index] >= 0 && !SetCurrentThreadAffinity(m_WorkerCpus[index])) {
+        std::cerr << "[ThreadPool] Failed to pin worker " << index << " to CPU " << m_WorkerCpus[index] << "\n";
+    }
     
     while (true) {
         std::function<void()> task;
@@ -71,11 +158,93 @@ void ThreadPool::WaitAll() {
     });
 }
 
+size_t ThreadPool::ResolveGrain(size_t count, size_t grain) const {
+    if (grain == 0) {
+        // About four chunks per worker balances uneven chunk costs without
+        // drowning small loops in task overhead.
+        constexpr size_t MIN_AUTO_GRAIN = 64;
+        size_t targetChunks = std::max<size_t>(1, m_Workers.size() * 4);
+        grain = std::max(MIN_AUTO_GRAIN, (count + targetChunks - 1) / targetChunks);
+    }
+    return std::max<size_t>(grain, 1);
+}
+
 size_t ThreadPool::GetPendingTaskCount() const {
     std::lock_guard<std::mutex> lock(m_QueueMutex);
     return m_Tasks.size();
 }
 
+bool ThreadPool::PinCurrentThreadToReservedCore(size_t slot) const {
+    if (slot >= m_ReservedCpus.size()) {
+        return false;
+    }
+    return SetCurrentThreadAffinity(m_ReservedCpus[slot]);
+}
+
+ThreadPool::CpuTopology ThreadPool::DetectTopology() {
+    CpuTopology topology;
+
+#ifdef __linux__
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+        // (package, core) -> logical CPUs; std::map keeps the order stable
+        std::map<std::pair<int, int>, std::vector<int>> coreMap;
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (!CPU_ISSET(cpu, &allowed)) {
+                continue;
+            }
+            int package = ReadTopologyValue(cpu, "physical_package_id");
+            int core = ReadTopologyValue(cpu, "core_id");
+            if (core < 0) {
+                // No topology info (e.g. containers): treat as its own core
+                package = -1;
+                core = cpu;
+            }
+            coreMap[{package, core}].push_back(cpu);
+            topology.logicalCount++;
+        }
+        for (auto& entry : coreMap) {
+            topology.physicalCores.push_back(std::move(entry.second));
+        }
+    }
+#endif
+
+    if (topology.physicalCores.empty()) {
+        size_t count = std::max(1u, std::thread::hardware_concurrency());
+        for (size_t i = 0; i < count; ++i) {
+            topology.physicalCores.push_back({static_cast<int>(i)});
+        }
+        topology.logicalCount = count;
+    }
+
+    return topology;
+}
+
+bool ThreadPool::SetCurrentThreadAffinity(int cpu) {
+#ifdef __linux__
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+void ThreadPool::SetCurrentThreadName(const std::string& name) {
+#ifdef __linux__
+    // Linux limits thread names to 15 characters plus the terminator
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#else
+    (void)name;
+#endif
+}
+
 ThreadPool& ThreadPool::Instance() {
     if (!s_Instance) {
         s_Instance = std::make_unique<ThreadPool>();
@@ -89,6 +258,12 @@ void ThreadPool::Initialize(size_t numThreads) {
     }
 }
 
+void ThreadPool::Initialize(const Config& config) {
+    if (!s_Instance) {
+        s_Instance = std::make_unique<ThreadPool>(config);
+    }
+}
+
 void ThreadPool::Shutdown() {
     s_Instance.reset();
 }
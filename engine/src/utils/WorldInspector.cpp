@@ -0,0 +1,326 @@
+#include "nyon/utils/WorldInspector.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <new>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define NYON_HAS_SHM 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Nyon::Utils {
+
+namespace {
+
+    // Records are copied raw between processes; the sequence and latest index must not need a lock
+    static_assert(std::is_trivially_copyable<WorldInspector::BodyState>::value, "BodyState is published raw");
+    static_assert(std::is_trivially_copyable<WorldInspector::ContactRecord>::value, "ContactRecord is published raw");
+    static_assert(std::is_trivially_copyable<WorldInspector::PhysicsSample>::value, "PhysicsSample is published raw");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "FrameHeader::sequence must be address-free");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Header::latest must be address-free");
+
+    constexpr uint64_t ALIGNMENT = 64;
+
+    uint64_t AlignUp(uint64_t value)
+    {
+        return (value + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+
+    std::string SegmentName(const std::string& name)
+    {
+        return (!name.empty() && name[0] == '/') ? name : "/" + name;
+    }
+
+    // Copy the fields after the sequence counter, which the reader re-checks instead
+    void CopyFrameFields(const WorldInspector::FrameHeader& from, WorldInspector::Snapshot& to)
+    {
+        to.frame = from.frame;
+        to.time = from.time;
+        std::memcpy(&to.timing, &from.timing, sizeof(to.timing));
+        std::memcpy(&to.physics, &from.physics, sizeof(to.physics));
+        to.totalBodies = from.totalBodies;
+        to.totalContacts = from.totalContacts;
+    }
+
+} // namespace
+
+WorldInspector::~WorldInspector()
+{
+    Close();
+}
+
+bool WorldInspector::Open(const Config& config)
+{
+    Close();
+    m_Config = config;
+    m_Config.name = SegmentName(config.name);
+    m_Published = 0;
+#ifdef NYON_HAS_SHM
+    uint64_t bodiesOffset = AlignUp(sizeof(FrameHeader));
+    uint64_t contactsOffset = AlignUp(bodiesOffset + uint64_t(m_Config.maxBodies) * sizeof(BodyState));
+    uint64_t bufferSize = AlignUp(contactsOffset + uint64_t(m_Config.maxContacts) * sizeof(ContactRecord));
+    uint64_t firstBuffer = AlignUp(sizeof(Header));
+    uint64_t totalSize = firstBuffer + 2 * bufferSize;
+
+    int fd = shm_open(m_Config.name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+    if (fd < 0)
+        return false;
+    if (ftruncate(fd, static_cast<off_t>(totalSize)) != 0)
+    {
+        close(fd);
+        shm_unlink(m_Config.name.c_str());
+        return false;
+    }
+    void* memory = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        shm_unlink(m_Config.name.c_str());
+        return false;
+    }
+
+    auto* bytes = static_cast<unsigned char*>(memory);
+    Header* header = new (bytes) Header();
+    header->version = VERSION;
+    header->headerSize = sizeof(Header);
+    header->frameHeaderSize = sizeof(FrameHeader);
+    header->bodySize = sizeof(BodyState);
+    header->contactSize = sizeof(ContactRecord);
+    header->maxBodies = m_Config.maxBodies;
+    header->maxContacts = m_Config.maxContacts;
+    header->bodiesOffset = bodiesOffset;
+    header->contactsOffset = contactsOffset;
+    header->bufferOffset[0] = firstBuffer;
+    header->bufferOffset[1] = firstBuffer + bufferSize;
+    header->bufferSize = bufferSize;
+    header->totalSize = totalSize;
+    header->publisherPid = static_cast<uint64_t>(getpid());
+    for (uint64_t offset : header->bufferOffset)
+        new (bytes + offset) FrameHeader();
+
+    // Readers check the magic first, so it goes in last
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = MAGIC;
+
+    m_Header = header;
+    m_Size = static_cast<size_t>(totalSize);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void WorldInspector::Close()
+{
+#ifdef NYON_HAS_SHM
+    if (m_Header == nullptr)
+        return;
+    munmap(m_Header, m_Size);
+    shm_unlink(m_Config.name.c_str());
+#endif
+    m_Header = nullptr;
+    m_Size = 0;
+    m_Writing = NO_FRAME;
+}
+
+WorldInspector::Frame WorldInspector::BeginFrame(uint64_t frame, double time)
+{
+    Frame result;
+    if (m_Header == nullptr)
+        return result;
+
+    uint32_t latest = m_Header->latest.load(std::memory_order_relaxed);
+    m_Writing = latest == 0 ? 1 : 0;
+    auto* buffer = reinterpret_cast<unsigned char*>(m_Header) + m_Header->bufferOffset[m_Writing];
+    FrameHeader* header = reinterpret_cast<FrameHeader*>(buffer);
+
+    // Odd: readers that already hold this buffer see the change and retry
+    uint64_t sequence = header->sequence.load(std::memory_order_relaxed);
+    header->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    header->frame = frame;
+    header->time = time;
+    header->timing = FrameTimingLog::Frame();
+    header->physics = PhysicsSample();
+    header->bodyCount = 0;
+    header->totalBodies = 0;
+    header->contactCount = 0;
+    header->totalContacts = 0;
+
+    result.header = header;
+    result.bodies = reinterpret_cast<BodyState*>(buffer + m_Header->bodiesOffset);
+    result.contacts = reinterpret_cast<ContactRecord*>(buffer + m_Header->contactsOffset);
+    result.maxBodies = m_Config.publishBodies ? m_Config.maxBodies : 0;
+    result.maxContacts = m_Config.publishContacts ? m_Config.maxContacts : 0;
+    return result;
+}
+
+void WorldInspector::EndFrame()
+{
+    if (m_Header == nullptr || m_Writing == NO_FRAME)
+        return;
+
+    auto* buffer = reinterpret_cast<unsigned char*>(m_Header) + m_Header->bufferOffset[m_Writing];
+    FrameHeader* header = reinterpret_cast<FrameHeader*>(buffer);
+    uint64_t sequence = header->sequence.load(std::memory_order_relaxed);
+    header->sequence.store(sequence + 1, std::memory_order_release);
+    m_Header->latest.store(m_Writing, std::memory_order_release);
+    m_Writing = NO_FRAME;
+    m_Published++;
+}
+
+WorldInspector::Reader::~Reader()
+{
+    Detach();
+}
+
+bool WorldInspector::Reader::Attach(const std::string& name)
+{
+    Detach();
+#ifdef NYON_HAS_SHM
+    int fd = shm_open(SegmentName(name).c_str(), O_RDONLY, 0);
+    if (fd < 0)
+        return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<uint64_t>(info.st_size) < sizeof(Header))
+    {
+        close(fd);
+        return false;
+    }
+    size_t size = static_cast<size_t>(info.st_size);
+    void* memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+        return false;
+
+    const Header* header = static_cast<const Header*>(memory);
+    bool valid = header->magic == MAGIC && header->version == VERSION && header->headerSize == sizeof(Header) &&
+                 header->frameHeaderSize == sizeof(FrameHeader) && header->bodySize == sizeof(BodyState) &&
+                 header->contactSize == sizeof(ContactRecord) && header->totalSize <= size;
+    if (!valid)
+    {
+        munmap(memory, size);
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    m_Header = header;
+    m_Size = size;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void WorldInspector::Reader::Detach()
+{
+#ifdef NYON_HAS_SHM
+    if (m_Header != nullptr)
+        munmap(const_cast<Header*>(m_Header), m_Size);
+#endif
+    m_Header = nullptr;
+    m_Size = 0;
+}
+
+bool WorldInspector::Reader::ReadLatest(Snapshot& snapshot, uint32_t maxAttempts) const
+{
+    if (m_Header == nullptr)
+        return false;
+
+    for (uint32_t attempt = 1; attempt <= maxAttempts; ++attempt)
+    {
+        uint32_t latest = m_Header->latest.load(std::memory_order_acquire);
+        if (latest > 1)
+            return false;  // Nothing published yet
+
+        const auto* buffer = reinterpret_cast<const unsigned char*>(m_Header) + m_Header->bufferOffset[latest];
+        const FrameHeader* header = reinterpret_cast<const FrameHeader*>(buffer);
+        uint64_t before = header->sequence.load(std::memory_order_acquire);
+        if (before & 1)
+            continue;
+
+        CopyFrameFields(*header, snapshot);
+        uint32_t bodies = std::min(header->bodyCount, m_Header->maxBodies);
+        uint32_t contacts = std::min(header->contactCount, m_Header->maxContacts);
+        snapshot.bodies.resize(bodies);
+        snapshot.contacts.resize(contacts);
+        if (bodies > 0)
+            std::memcpy(snapshot.bodies.data(), buffer + m_Header->bodiesOffset, bodies * sizeof(BodyState));
+        if (contacts > 0)
+            std::memcpy(snapshot.contacts.data(), buffer + m_Header->contactsOffset, contacts * sizeof(ContactRecord));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (header->sequence.load(std::memory_order_relaxed) == before)
+        {
+            snapshot.attempts = attempt;
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorldInspector::PrintSnapshot(const Snapshot& snapshot, std::ostream& out)
+{
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    const PhysicsSample& p = snapshot.physics;
+    out << std::fixed << std::setprecision(2);
+    out << "[INSPECT] Frame " << snapshot.frame << " at " << snapshot.time << " s: " << snapshot.timing.frameMs
+        << " ms (fixed " << snapshot.timing.fixedMs << ", render " << snapshot.timing.renderMs << ")\n";
+    out << "[INSPECT] Physics " << p.updateMs << " ms over " << p.steps << " steps: broad " << p.broadPhaseMs
+        << ", narrow " << p.narrowPhaseMs << ", islands " << p.islandMs << ", constraints " << p.constraintMs
+        << ", velocity " << p.velocityMs << ", position " << p.positionMs << ", finalize " << p.finalizeMs << "\n";
+    out << "[INSPECT] " << p.pairs << " pairs, " << p.contacts << " contacts, " << p.constraints << " constraints, "
+        << p.islands << " islands, " << p.awakeBodies << " awake / " << p.sleepingBodies << " sleeping, "
+        << p.particles << " particles\n";
+
+    size_t awake = 0;
+    float maxSpeed = 0.0f;
+    uint32_t fastest = 0;
+    float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+    bool firstBody = true;
+    for (const BodyState& body : snapshot.bodies)
+    {
+        if (body.flags & FlightRecorder::FLAG_DISABLED)
+            continue;
+        if (body.flags & FlightRecorder::FLAG_AWAKE)
+            ++awake;
+        float speed = std::sqrt(body.vx * body.vx + body.vy * body.vy);
+        if (speed > maxSpeed)
+        {
+            maxSpeed = speed;
+            fastest = body.entityId;
+        }
+        minX = firstBody ? body.x : std::min(minX, body.x);
+        minY = firstBody ? body.y : std::min(minY, body.y);
+        maxX = firstBody ? body.x : std::max(maxX, body.x);
+        maxY = firstBody ? body.y : std::max(maxY, body.y);
+        firstBody = false;
+    }
+
+    float deepest = 0.0f;
+    float maxImpulse = 0.0f;
+    for (const ContactRecord& contact : snapshot.contacts)
+    {
+        deepest = std::min(deepest, contact.separation);
+        maxImpulse = std::max(maxImpulse, contact.normalImpulse);
+    }
+
+    out << std::setprecision(1);
+    out << "[INSPECT] " << snapshot.totalBodies << " bodies (" << snapshot.bodies.size() << " published), " << awake
+        << " awake, fastest entity " << fastest << " at " << maxSpeed << " px/s, bounds (" << minX << ", " << minY
+        << ")-(" << maxX << ", " << maxY << ")\n";
+    out << std::setprecision(3);
+    out << "[INSPECT] " << snapshot.totalContacts << " contact points (" << snapshot.contacts.size()
+        << " published), deepest " << deepest << " px, largest normal impulse " << maxImpulse << "\n";
+    out.flags(flags);
+    out.precision(precision);
+}
+
+} // namespace Nyon::Utils
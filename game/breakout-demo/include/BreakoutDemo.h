@@ -2,8 +2,11 @@
 
 #include "nyon/core/ECSApplication.h"
 #include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/EntityPool.h"
+#include "nyon/ecs/systems/FractureSystem.h"
 #include "nyon/math/Vector3.h"
 
+#include <memory>
 #include <vector>
 #include <random>
 #include <set>
@@ -15,11 +18,13 @@
 //    - Ball that bounces off walls, paddle, and bricks
 //    - Random cohesive brick formation of square bricks
 //    - Score tracking and game state management
+//  Stress mode: --scale N multiplies the brick count by N (the field grows by
+//  sqrt(N) in each direction); --bot tracks the ball with the paddle.
 // ============================================================================
 class BreakoutDemo : public Nyon::ECSApplication
 {
 public:
-    BreakoutDemo();
+    explicit BreakoutDemo(const Nyon::LaunchOptions& options = {});
 
 protected:
     void OnECSStart() override;
@@ -35,6 +40,7 @@ private:
     // ---------- brick generation --------------------------------------------
     void GenerateBricks();
     void CreateBrick(float x, float y, const Nyon::Math::Vector3& color);
+    void BuildBrick(Nyon::ECS::EntityID brickEntity);
     std::vector<Nyon::Math::Vector3> m_BrickColors;
 
     // ---------- game logic --------------------------------------------------
@@ -42,12 +48,24 @@ private:
     void CheckBrickCollisions();
     void ResetBall();
     void ResetGame();
+    void UpdateBot();
+    void SetupBrickFracture();
 
     // ---------- runtime state -----------------------------------------------
     Nyon::ECS::EntityID m_PaddleEntity { 0 };
     Nyon::ECS::EntityID m_BallEntity   { 0 };
 
     std::vector<Nyon::ECS::EntityID> m_Bricks;
+    std::unique_ptr<Nyon::ECS::EntityPool> m_BrickPool;  // Hit bricks are recycled, not destroyed
+
+    // Hit bricks shatter into debris from one precomputed pattern
+    Nyon::ECS::FractureSystem::PatternID m_BrickFracture { Nyon::ECS::FractureSystem::INVALID_PATTERN };
+    bool m_FractureReady { false };
+    std::vector<Nyon::ECS::EntityID> m_Debris;
+
+    // Play field, the window size scaled by sqrt(--scale)
+    float m_FieldWidth  { 1280.0f };
+    float m_FieldHeight { 720.0f };
 
     // Game configuration
     static constexpr float PADDLE_WIDTH      = 120.0f;
@@ -63,6 +81,11 @@ private:
     static constexpr float BRICK_GAP         = 4.0f;
     static constexpr float BRICK_START_Y     = 600.0f;
 
+    // Brick debris: pieces per brick, and a collision category of their own so they
+    // only hit each other, never the ball or paddle
+    static constexpr int      BRICK_PIECES      = 6;
+    static constexpr uint16_t DEBRIS_CATEGORY   = 0x8000;
+
     // Random shape generation
     static constexpr int   SHAPE_MAX_COLS    = 14;
     static constexpr int   SHAPE_MAX_ROWS    = 8;
@@ -11,15 +11,18 @@
 
 #include <iostream>
 #include <algorithm>
+#include <cmath>
 
 using namespace Nyon;
 
 // ============================================================================
 //  Constructor
 // ============================================================================
-BreakoutDemo::BreakoutDemo()
-    : ECSApplication("Nyon – Breakout Demo", 1280, 720)
+BreakoutDemo::BreakoutDemo(const LaunchOptions& options)
+    : ECSApplication("Nyon – Breakout Demo", 1280, 720, options)
 {
+    if (options.seed != 0)
+        m_Rng.seed(options.seed);
 }
 
 // ============================================================================
@@ -27,6 +30,14 @@ BreakoutDemo::BreakoutDemo()
 // ============================================================================
 void BreakoutDemo::OnECSStart()
 {
+    int width, height;
+    GetWindowSize(width, height);
+    float fieldScale = std::max(1.0f, std::sqrt(GetLaunchOptions().scale));
+    m_FieldWidth  = static_cast<float>(width) * fieldScale;
+    m_FieldHeight = static_cast<float>(height) * fieldScale;
+
+    m_BrickPool = std::make_unique<ECS::EntityPool>(GetEntityManager(), GetComponentStore(), "bricks");
+
     CreateWorld();
     CreateWalls();
     CreatePaddle();
@@ -42,6 +53,12 @@ void BreakoutDemo::OnECSStart()
 // ============================================================================
 void BreakoutDemo::OnECSFixedUpdate(float deltaTime)
 {
+    if (!m_FractureReady)
+        SetupBrickFracture();
+
+    if (GetLaunchOptions().bot)
+        UpdateBot();
+
     HandleInput(deltaTime);
     
     // Check for brick collisions and destroy them
@@ -101,8 +118,8 @@ void BreakoutDemo::CreateWalls()
     auto& entities = GetEntityManager();
     auto& cs       = GetComponentStore();
     
-    int width, height;
-    glfwGetWindowSize(GetWindow(), &width, &height);
+    const float width  = m_FieldWidth;
+    const float height = m_FieldHeight;
     
     // Wall thickness
     constexpr float wallThickness = 50.0f;
@@ -212,11 +229,8 @@ void BreakoutDemo::CreatePaddle()
     m_PaddleEntity = entities.CreateEntity();
 
     // Transform
-    int width, height;
-    glfwGetWindowSize(GetWindow(), &width, &height);
-    
     ECS::TransformComponent t;
-    t.position = { width / 2.0f, PADDLE_Y };
+    t.position = { m_FieldWidth / 2.0f, PADDLE_Y };
     t.previousPosition = t.position;  // CRITICAL: Set previousPosition to prevent rubberbanding
     t.rotation = 0.0f;
     t.previousRotation = 0.0f;
@@ -260,11 +274,8 @@ void BreakoutDemo::CreateBall()
     m_BallEntity = entities.CreateEntity();
 
     // Start floating below the bricks with initial velocity
-    int width, height;
-    glfwGetWindowSize(GetWindow(), &width, &height);
-    
     ECS::TransformComponent t;
-    t.position = { width / 2.0f, 100.0f };  // Start on paddle, near bottom
+    t.position = { m_FieldWidth / 2.0f, 100.0f };  // Start on paddle, near bottom
     t.previousPosition = t.position;
     t.rotation = 0.0f;
     t.previousRotation = 0.0f;
@@ -312,8 +323,9 @@ void BreakoutDemo::GenerateBricks()
 {
     m_Bricks.clear();
 
-    int width, height;
-    glfwGetWindowSize(GetWindow(), &width, &height);
+    // Stress scale multiplies the brick count; the grid grows by sqrt(scale) each way
+    const float scale = std::max(1.0f, GetLaunchOptions().scale);
+    const float gridScale = std::sqrt(scale);
 
     // Prepare color palette
     m_BrickColors = {
@@ -327,14 +339,16 @@ void BreakoutDemo::GenerateBricks()
     };
 
     const float cellSize = BRICK_SIZE + BRICK_GAP;
-    const int gridCols = SHAPE_MAX_COLS;
-    const int gridRows = SHAPE_MAX_ROWS;
+    const int gridCols = static_cast<int>(std::lround(SHAPE_MAX_COLS * gridScale));
+    const int gridRows = static_cast<int>(std::lround(SHAPE_MAX_ROWS * gridScale));
+    const float brickStartY = m_FieldHeight - (720.0f - BRICK_START_Y);
 
     // Grid of placed cells
     std::vector<std::vector<bool>> placed(gridRows, std::vector<bool>(gridCols, false));
 
     // Target number of bricks, random per game
-    std::uniform_int_distribution<int> countDist(TARGET_BRICK_MIN, TARGET_BRICK_MAX);
+    std::uniform_int_distribution<int> countDist(static_cast<int>(TARGET_BRICK_MIN * scale),
+                                                 static_cast<int>(TARGET_BRICK_MAX * scale));
     int targetCount = countDist(m_Rng);
 
     // Start from a random cell near the center
@@ -402,7 +416,7 @@ void BreakoutDemo::GenerateBricks()
 
     // Compute world position for each placed cell
     float totalWidth = static_cast<float>(gridCols) * cellSize;
-    float startX = (static_cast<float>(width) - totalWidth) / 2.0f;
+    float startX = (m_FieldWidth - totalWidth) / 2.0f;
 
     // Shuffle color assignment for visual variety
     std::vector<Math::Vector3> shuffledColors = m_BrickColors;
@@ -416,7 +430,7 @@ void BreakoutDemo::GenerateBricks()
             if (!placed[r][c]) continue;
 
             float x = startX + static_cast<float>(c) * cellSize + BRICK_SIZE / 2.0f;
-            float y = BRICK_START_Y - static_cast<float>(r) * cellSize + BRICK_SIZE / 2.0f;
+            float y = brickStartY - static_cast<float>(r) * cellSize + BRICK_SIZE / 2.0f;
             const auto& color = shuffledColors[brickIndex % shuffledColors.size()];
             CreateBrick(x, y, color);
             ++brickIndex;
@@ -431,19 +445,27 @@ void BreakoutDemo::GenerateBricks()
 // ============================================================================
 void BreakoutDemo::CreateBrick(float x, float y, const Math::Vector3& color)
 {
-    auto& entities = GetEntityManager();
-    auto& cs       = GetComponentStore();
+    auto& cs = GetComponentStore();
 
-    ECS::EntityID brickEntity = entities.CreateEntity();
+    ECS::EntityID brickEntity = m_BrickPool->Acquire([this](ECS::EntityID entity) { BuildBrick(entity); });
     m_Bricks.push_back(brickEntity);
 
-    // Transform
-    ECS::TransformComponent t;
+    auto& t = cs.GetComponent<ECS::TransformComponent>(brickEntity);
     t.position = { x, y };
     t.previousPosition = t.position;
     t.rotation = 0.0f;
     t.previousRotation = 0.0f;
 
+    cs.GetComponent<ECS::RenderComponent>(brickEntity).color = color;
+}
+
+// ============================================================================
+//  BuildBrick  –  components of a pooled brick; CreateBrick places and colours it
+// ============================================================================
+void BreakoutDemo::BuildBrick(ECS::EntityID brickEntity)
+{
+    auto& cs = GetComponentStore();
+
     // Physics body (static)
     ECS::PhysicsBodyComponent body;
     body.isStatic = true;
@@ -464,10 +486,10 @@ void BreakoutDemo::CreateBrick(float x, float y, const Math::Vector3& color)
     brickCollider.material.density = 0.0f;
 
     // Render
-    ECS::RenderComponent brickRender({ BRICK_SIZE, BRICK_SIZE }, color);
+    ECS::RenderComponent brickRender({ BRICK_SIZE, BRICK_SIZE }, { 1.0f, 1.0f, 1.0f });
     brickRender.origin = { half, half };
 
-    cs.AddComponent(brickEntity, std::move(t));
+    cs.AddComponent(brickEntity, ECS::TransformComponent());
     cs.AddComponent(brickEntity, std::move(body));
     cs.AddComponent(brickEntity, std::move(brickCollider));
     cs.AddComponent(brickEntity, std::move(brickRender));
@@ -485,9 +507,6 @@ void BreakoutDemo::HandleInput(float deltaTime)
     
     auto& paddleTransform = cs.GetComponent<ECS::TransformComponent>(m_PaddleEntity);
     
-    int width, height;
-    glfwGetWindowSize(GetWindow(), &width, &height);
-    
     // Paddle movement with arrow keys
     float moveX = 0.0f;
     if (Utils::InputManager::IsKeyDown(GLFW_KEY_LEFT) || Utils::InputManager::IsKeyDown(GLFW_KEY_A))
@@ -499,7 +518,7 @@ void BreakoutDemo::HandleInput(float deltaTime)
     
     // Clamp to screen bounds
     float halfWidth = PADDLE_WIDTH / 2.0f;
-    paddleTransform.position.x = std::max(halfWidth, std::min(paddleTransform.position.x, width - halfWidth));
+    paddleTransform.position.x = std::max(halfWidth, std::min(paddleTransform.position.x, m_FieldWidth - halfWidth));
     paddleTransform.previousPosition.x = paddleTransform.position.x;
     
     // If ball not launched, keep it on paddle
@@ -582,10 +601,21 @@ void BreakoutDemo::CheckBrickCollisions()
     // Destroy marked bricks AFTER iterating (avoid iterator invalidation)
     if (!bricksToDestroy.empty())
     {
-        auto& entities = GetEntityManager();
+        auto* fracture = GetSystemManager().GetSystem<ECS::FractureSystem>();
         for (auto brickId : bricksToDestroy)
         {
-            entities.DestroyEntity(brickId, cs);
+            if (fracture && m_BrickFracture != ECS::FractureSystem::INVALID_PATTERN)
+            {
+                m_Debris.clear();
+                fracture->Break(brickId, m_BrickFracture, &m_Debris);
+                for (ECS::EntityID piece : m_Debris)
+                {
+                    auto& filter = cs.GetComponent<ECS::ColliderComponent>(piece).filter;
+                    filter.categoryBits = DEBRIS_CATEGORY;
+                    filter.maskBits = DEBRIS_CATEGORY;
+                }
+            }
+            m_BrickPool->Release(brickId);
         }
         
         // Remove from tracking list
@@ -636,14 +666,12 @@ void BreakoutDemo::ResetBall()
 void BreakoutDemo::ResetGame()
 {
     std::cerr << "[BREAKOUT] Resetting game...\n";
+    m_BrickPool->Report(std::cerr);
     
-    auto& entities = GetEntityManager();
-    auto& cs = GetComponentStore();
-    
-    // Destroy all bricks
+    // Return the remaining bricks to the pool
     for (auto brickId : m_Bricks)
     {
-        entities.DestroyEntity(brickId, cs);
+        m_BrickPool->Release(brickId);
     }
     m_Bricks.clear();
     
@@ -659,3 +687,55 @@ void BreakoutDemo::ResetGame()
     
     std::cerr << "[BREAKOUT] Game reset! Press SPACE to launch ball.\n";
 }
+
+// ============================================================================
+//  SetupBrickFracture  –  precompute the brick debris pattern (systems exist
+//  only after OnECSStart, so this runs on the first fixed step)
+// ============================================================================
+void BreakoutDemo::SetupBrickFracture()
+{
+    m_FractureReady = true;
+    auto* fracture = GetSystemManager().GetSystem<ECS::FractureSystem>();
+    if (!fracture)
+        return;
+
+    auto config = fracture->GetConfig();
+    config.debrisLifetime = 1.5f;
+    config.burstSpeed = 60.0f;
+    fracture->SetConfig(config);
+
+    float half = BRICK_SIZE / 2.0f;
+    ECS::ColliderComponent::PolygonShape brickShape({
+        { -half, -half },
+        {  half, -half },
+        {  half,  half },
+        { -half,  half }
+    });
+    m_BrickFracture = fracture->CreatePattern(brickShape, BRICK_PIECES, static_cast<uint32_t>(m_Rng()));
+    fracture->Prewarm(static_cast<size_t>(BRICK_PIECES) * 8);
+}
+
+// ============================================================================
+//  UpdateBot  –  synthetic input: follow the ball, launch it, restart on win
+// ============================================================================
+void BreakoutDemo::UpdateBot()
+{
+    auto& cs = GetComponentStore();
+    if (!cs.HasComponent<ECS::TransformComponent>(m_PaddleEntity) ||
+        !cs.HasComponent<ECS::TransformComponent>(m_BallEntity))
+        return;
+
+    float paddleX = cs.GetComponent<ECS::TransformComponent>(m_PaddleEntity).position.x;
+    float ballX   = cs.GetComponent<ECS::TransformComponent>(m_BallEntity).position.x;
+
+    // Dead zone keeps the paddle from jittering under the ball
+    constexpr float deadZone = PADDLE_WIDTH * 0.2f;
+    Utils::InputManager::SetKeyState(GLFW_KEY_LEFT,  ballX < paddleX - deadZone);
+    Utils::InputManager::SetKeyState(GLFW_KEY_RIGHT, ballX > paddleX + deadZone);
+
+    // Edge-triggered keys: hold for one tick, release for the next
+    Utils::InputManager::SetKeyState(GLFW_KEY_SPACE,
+        !m_BallLaunched && !Utils::InputManager::IsKeyDown(GLFW_KEY_SPACE));
+    Utils::InputManager::SetKeyState(GLFW_KEY_R,
+        m_GameWon && !Utils::InputManager::IsKeyDown(GLFW_KEY_R));
+}
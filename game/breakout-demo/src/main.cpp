@@ -1,8 +1,8 @@
 #include "BreakoutDemo.h"
 
-int main()
+int main(int argc, char** argv)
 {
-    BreakoutDemo demo;
+    BreakoutDemo demo(Nyon::LaunchOptions::Parse(argc, argv));
     demo.Run();
     return 0;
 }
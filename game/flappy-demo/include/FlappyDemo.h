@@ -2,8 +2,10 @@
 
 #include "nyon/core/ECSApplication.h"
 #include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/EntityPool.h"
 #include "nyon/math/Vector3.h"
 
+#include <memory>
 #include <vector>
 #include <random>
 
@@ -14,11 +16,13 @@
 //    - Pipes scroll from right to left with random gaps
 //    - Collision with pipe or screen bottom = game over
 //    - Score is incremented each time the bird passes a pipe pair
+//  Stress mode: --scale N spawns pipes N times as often; --bot flaps towards
+//  the next gap and restarts after a crash.
 // ============================================================================
 class FlappyDemo : public Nyon::ECSApplication
 {
 public:
-    FlappyDemo();
+    explicit FlappyDemo(const Nyon::LaunchOptions& options = {});
 
 protected:
     void OnECSStart() override;
@@ -35,6 +39,7 @@ private:
     // ---------- pipes -------------------------------------------------------
     void SpawnPipePair();
     Nyon::ECS::EntityID CreatePipeSegment(float x, float centerY, float height);
+    void BuildPipeSegment(Nyon::ECS::EntityID entity);
     void DestroyOffscreenPipes();
 
     // ---------- game logic --------------------------------------------------
@@ -42,6 +47,7 @@ private:
     void CheckCollisions();
     void UpdateScore(float birdX);
     void ResetGame();
+    void UpdateBot();
 
     // ---------- runtime state -----------------------------------------------
     Nyon::ECS::EntityID m_WorldEntity  { 0 };
@@ -50,6 +56,7 @@ private:
 
     // Pipe tracking: store both top and bottom pipe entity IDs
     std::vector<Nyon::ECS::EntityID> m_Pipes;
+    std::unique_ptr<Nyon::ECS::EntityPool> m_PipePool;  // Off-screen pipes are recycled
     float m_PipeSpawnTimer { 0.0f };
 
     // Game state
@@ -10,14 +10,18 @@
 
 #include <iostream>
 #include <algorithm>
+#include <limits>
 
 using namespace Nyon;
 
 // ============================================================================
 //  Constructor
 // ============================================================================
-FlappyDemo::FlappyDemo() : ECSApplication("Flappy Bird", 1280, 720)
+FlappyDemo::FlappyDemo(const LaunchOptions& options)
+    : ECSApplication("Flappy Bird", 1280, 720, options)
 {
+    if (options.seed != 0)
+        m_Rng.seed(options.seed);
 }
 
 // ============================================================================
@@ -28,6 +32,8 @@ void FlappyDemo::OnECSStart()
     std::cerr << "\n=== FLAPPY BIRD ===\n";
     std::cerr << "Press SPACE to flap, R to restart after game over.\n\n";
 
+    m_PipePool = std::make_unique<ECS::EntityPool>(GetEntityManager(), GetComponentStore(), "pipes");
+
     CreateWorld();
     CreateCamera();
     CreateBird();
@@ -131,32 +137,56 @@ void FlappyDemo::CreateBird()
 // ============================================================================
 ECS::EntityID FlappyDemo::CreatePipeSegment(float x, float centerY, float height)
 {
-    auto& entities = GetEntityManager();
-    auto& cs       = GetComponentStore();
+    auto& cs = GetComponentStore();
 
-    ECS::EntityID entity = entities.CreateEntity();
+    ECS::EntityID entity = m_PipePool->Acquire([this](ECS::EntityID e) { BuildPipeSegment(e); });
 
     float halfW = PIPE_WIDTH / 2.0f;
     float halfH = height / 2.0f;
 
     // Transform
-    ECS::TransformComponent t;
+    auto& t = cs.GetComponent<ECS::TransformComponent>(entity);
     t.position = { x, centerY };
     t.previousPosition = t.position;
     t.rotation = 0.0f;
     t.previousRotation = 0.0f;
 
+    // Resize the rectangle in place; a recycled pipe keeps its vertex storage
+    auto& polygon = cs.GetComponent<ECS::ColliderComponent>(entity).GetPolygon();
+    polygon.vertices[0] = { -halfW, -halfH };
+    polygon.vertices[1] = {  halfW, -halfH };
+    polygon.vertices[2] = {  halfW,  halfH };
+    polygon.vertices[3] = { -halfW,  halfH };
+    polygon.CalculateProperties();
+
+    // Render
+    auto& render = cs.GetComponent<ECS::RenderComponent>(entity);
+    render.size = { PIPE_WIDTH, height };
+    render.origin = { halfW, halfH };
+
+    return entity;
+}
+
+// ============================================================================
+//  BuildPipeSegment  –  components of a pooled pipe; CreatePipeSegment sizes it
+// ============================================================================
+void FlappyDemo::BuildPipeSegment(ECS::EntityID entity)
+{
+    auto& cs = GetComponentStore();
+
+    float halfW = PIPE_WIDTH / 2.0f;
+
     // Static body
     ECS::PhysicsBodyComponent body;
     body.isStatic = true;
     body.UpdateMassProperties();
 
-    // Polygon collider (rectangle)
+    // Polygon collider (rectangle, resized per spawn)
     ECS::ColliderComponent::PolygonShape shape({
-        { -halfW, -halfH },
-        {  halfW, -halfH },
-        {  halfW,  halfH },
-        { -halfW,  halfH }
+        { -halfW, -halfW },
+        {  halfW, -halfW },
+        {  halfW,  halfW },
+        { -halfW,  halfW }
     });
 
     ECS::ColliderComponent collider(shape);
@@ -165,15 +195,12 @@ ECS::EntityID FlappyDemo::CreatePipeSegment(float x, float centerY, float height
     collider.material.density = 0.0f;
 
     // Render
-    ECS::RenderComponent render({ PIPE_WIDTH, height }, { 0.2f, 0.8f, 0.2f });
-    render.origin = { halfW, halfH };
+    ECS::RenderComponent render({ PIPE_WIDTH, PIPE_WIDTH }, { 0.2f, 0.8f, 0.2f });
 
-    cs.AddComponent(entity, std::move(t));
+    cs.AddComponent(entity, ECS::TransformComponent());
     cs.AddComponent(entity, std::move(body));
     cs.AddComponent(entity, std::move(collider));
     cs.AddComponent(entity, std::move(render));
-
-    return entity;
 }
 
 // ============================================================================
@@ -182,7 +209,7 @@ ECS::EntityID FlappyDemo::CreatePipeSegment(float x, float centerY, float height
 void FlappyDemo::SpawnPipePair()
 {
     int width, height;
-    glfwGetWindowSize(GetWindow(), &width, &height);
+    GetWindowSize(width, height);
     float screenH = static_cast<float>(height);
 
     // Random gap vertical position
@@ -221,8 +248,7 @@ void FlappyDemo::SpawnPipePair()
 // ============================================================================
 void FlappyDemo::DestroyOffscreenPipes()
 {
-    auto& entities = GetEntityManager();
-    auto& cs       = GetComponentStore();
+    auto& cs = GetComponentStore();
 
     auto it = m_Pipes.begin();
     while (it != m_Pipes.end())
@@ -232,7 +258,7 @@ void FlappyDemo::DestroyOffscreenPipes()
             const auto& t = cs.GetComponent<ECS::TransformComponent>(*it);
             if (t.position.x < -PIPE_WIDTH)
             {
-                entities.DestroyEntity(*it, cs);
+                m_PipePool->Release(*it);
                 it = m_Pipes.erase(it);
                 continue;
             }
@@ -337,13 +363,14 @@ void FlappyDemo::UpdateScore(float birdX)
 // ============================================================================
 void FlappyDemo::ResetGame()
 {
-    auto& entities = GetEntityManager();
-    auto& cs       = GetComponentStore();
+    auto& cs = GetComponentStore();
+
+    m_PipePool->Report(std::cerr);
 
-    // Destroy all pipes
+    // Return all pipes to the pool
     for (auto pipeId : m_Pipes)
     {
-        entities.DestroyEntity(pipeId, cs);
+        m_PipePool->Release(pipeId);
     }
     m_Pipes.clear();
 
@@ -380,6 +407,9 @@ void FlappyDemo::OnECSFixedUpdate(float deltaTime)
 {
     auto& cs = GetComponentStore();
 
+    if (GetLaunchOptions().bot)
+        UpdateBot();
+
     HandleInput();
 
     if (m_State == GameState::MENU)
@@ -394,7 +424,7 @@ void FlappyDemo::OnECSFixedUpdate(float deltaTime)
         if (cs.HasComponent<ECS::TransformComponent>(m_BirdEntity))
         {
             auto& t = cs.GetComponent<ECS::TransformComponent>(m_BirdEntity);
-            t.position.y = 500.0f + std::sin(static_cast<float>(glfwGetTime()) * 2.0f) * 15.0f;
+            t.position.y = 500.0f + std::sin(static_cast<float>(GetTime()) * 2.0f) * 15.0f;
             t.previousPosition = t.position;
             t.rotation = 0.0f;
             t.previousRotation = 0.0f;
@@ -407,9 +437,6 @@ void FlappyDemo::OnECSFixedUpdate(float deltaTime)
 
     // --- PLAYING state ---
 
-    int width, height;
-    glfwGetWindowSize(GetWindow(), &width, &height);
-
     // 1. Scroll pipes leftward
     for (auto pipeId : m_Pipes)
     {
@@ -422,10 +449,11 @@ void FlappyDemo::OnECSFixedUpdate(float deltaTime)
     }
 
     // 2. Spawn pipes at interval
+    const float spawnInterval = PIPE_SPAWN_INTERVAL / std::max(1.0f, GetLaunchOptions().scale);
     m_PipeSpawnTimer += deltaTime;
-    if (m_PipeSpawnTimer >= PIPE_SPAWN_INTERVAL)
+    if (m_PipeSpawnTimer >= spawnInterval)
     {
-        m_PipeSpawnTimer -= PIPE_SPAWN_INTERVAL;
+        m_PipeSpawnTimer -= spawnInterval;
         SpawnPipePair();
     }
 
@@ -470,3 +498,49 @@ void FlappyDemo::OnECSFixedUpdate(float deltaTime)
         UpdateScore(t.position.x);
     }
 }
+
+// ============================================================================
+//  UpdateBot  –  synthetic input: start, flap towards the next gap, restart
+// ============================================================================
+void FlappyDemo::UpdateBot()
+{
+    auto& cs = GetComponentStore();
+    bool flap = false;
+
+    if (m_State == GameState::PLAYING &&
+        cs.HasComponent<ECS::TransformComponent>(m_BirdEntity) &&
+        cs.HasComponent<ECS::PhysicsBodyComponent>(m_BirdEntity))
+    {
+        const auto& bird = cs.GetComponent<ECS::TransformComponent>(m_BirdEntity);
+        const auto& body = cs.GetComponent<ECS::PhysicsBodyComponent>(m_BirdEntity);
+
+        // Nearest bottom pipe not yet passed; its top edge is the gap bottom
+        float targetY = 360.0f;
+        float nearestX = std::numeric_limits<float>::max();
+        for (auto pipeId : m_Pipes)
+        {
+            if (!cs.HasComponent<ECS::TransformComponent>(pipeId))
+                continue;
+            const auto& t = cs.GetComponent<ECS::TransformComponent>(pipeId);
+            if (t.position.y >= 360.0f || t.position.x + PIPE_WIDTH / 2.0f < bird.position.x - BIRD_RADIUS)
+                continue;
+            if (t.position.x < nearestX)
+            {
+                nearestX = t.position.x;
+                targetY = t.position.y * 2.0f + PIPE_GAP / 2.0f;
+            }
+        }
+
+        flap = bird.position.y < targetY - 20.0f && body.velocity.y < 0.0f;
+    }
+    else if (m_State != GameState::PLAYING)
+    {
+        flap = true;
+    }
+
+    // Edge-triggered keys: hold for one tick, release for the next
+    bool space = flap && m_State != GameState::GAME_OVER;
+    Utils::InputManager::SetKeyState(GLFW_KEY_SPACE, space && !Utils::InputManager::IsKeyDown(GLFW_KEY_SPACE));
+    Utils::InputManager::SetKeyState(GLFW_KEY_R,
+        m_State == GameState::GAME_OVER && !Utils::InputManager::IsKeyDown(GLFW_KEY_R));
+}
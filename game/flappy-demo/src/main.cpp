@@ -1,8 +1,8 @@
 #include "FlappyDemo.h"
 
-int main()
+int main(int argc, char** argv)
 {
-    FlappyDemo game;
+    FlappyDemo game(Nyon::LaunchOptions::Parse(argc, argv));
     game.Run();
     return 0;
 }
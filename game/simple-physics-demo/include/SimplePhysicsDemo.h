@@ -14,11 +14,13 @@
 //    - Impulse-based velocity resolution
 //    - Baumgarte position correction
 //    - Interpolated rendering vs. physics positions
+//  Stress mode: --scale N spawns circles N times as often; --bot strafes,
+//  jumps and clicks to spawn extra circles.
 // ============================================================================
 class SimplePhysicsDemo : public Nyon::ECSApplication
 {
 public:
-    SimplePhysicsDemo();
+    explicit SimplePhysicsDemo(const Nyon::LaunchOptions& options = {});
 
 protected:
     // Called once before the first physics tick (world + entities set up here).
@@ -40,6 +42,7 @@ private:
     void HandlePlayerInput(float deltaTime);
     bool IsPlayerGrounded();
     void SpawnQuadAtMousePosition();
+    void UpdateBot();
     
     // ---------- cleanup -----------------------------------------------------
     void DespawnOutOfBoundsObjects();
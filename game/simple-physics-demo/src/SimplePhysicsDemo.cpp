@@ -13,15 +13,23 @@
 #include <vector>
 #include <random>
 #include <algorithm>
+#include <cmath>
 
 using namespace Nyon;
 
 // ============================================================================
 //  Constructor
 // ============================================================================
-SimplePhysicsDemo::SimplePhysicsDemo()
-    : ECSApplication("Nyon – Simple Physics Demo", 1280, 720)
+SimplePhysicsDemo::SimplePhysicsDemo(const LaunchOptions& options)
+    : ECSApplication("Nyon – Simple Physics Demo", 1280, 720, options)
 {
+    if (options.seed != 0)
+        m_Rng.seed(options.seed);
+
+    // Stress scale shortens the auto-spawn interval
+    float scale = std::max(1.0f, options.scale);
+    m_SpawnIntervalMin /= scale;
+    m_SpawnIntervalMax /= scale;
 }
 
 // ============================================================================
@@ -69,6 +77,9 @@ void SimplePhysicsDemo::OnECSFixedUpdate(float deltaTime)
         }
     }
 
+    if (GetLaunchOptions().bot)
+        UpdateBot();
+
     // Handle player input
     HandlePlayerInput(deltaTime);
 
@@ -76,7 +87,7 @@ void SimplePhysicsDemo::OnECSFixedUpdate(float deltaTime)
     while (m_SimTime >= m_NextAutoSpawnTime)
     {
         int width, height;
-        glfwGetWindowSize(GetWindow(), &width, &height);
+        GetWindowSize(width, height);
 
         // Random X position within screen bounds
         std::uniform_real_distribution<float> xDist(100.0f, float(width - 100));
@@ -603,7 +614,7 @@ void SimplePhysicsDemo::SpawnQuadAtMousePosition()
     // Our rendering uses Y-up convention, so we need to flip Y
     // The renderer uses glm::ortho(0, width, 0, height)
     int width, height;
-    glfwGetWindowSize(GetWindow(), &width, &height);
+    GetWindowSize(width, height);
     
     float worldX = static_cast<float>(mouseX);
     float worldY = static_cast<float>(height - mouseY);  // Flip Y for Y-up convention
@@ -656,4 +667,33 @@ void SimplePhysicsDemo::DespawnOutOfBoundsObjects()
     {
         std::cerr << "[DEMO] Despawned " << entitiesToDespawn.size() << " out-of-bounds entities\n";
     }
-}
\ No newline at end of file
+}
+
+// ============================================================================
+//  UpdateBot  –  synthetic input: strafe, jump and click-spawn on a schedule
+// ============================================================================
+void SimplePhysicsDemo::UpdateBot()
+{
+    using Nyon::Utils::InputManager;
+
+    // Strafe direction flips every 2 s
+    bool right = static_cast<int>(m_SimTime / 2.0f) % 2 == 0;
+    InputManager::SetKeyState(GLFW_KEY_A, !right);
+    InputManager::SetKeyState(GLFW_KEY_D, right);
+
+    // Jump once a second, click once every half second (one-tick presses)
+    InputManager::SetKeyState(GLFW_KEY_W, std::fmod(m_SimTime, 1.0f) < FIXED_TIMESTEP);
+
+    bool click = std::fmod(m_SimTime, 0.5f) < FIXED_TIMESTEP;
+    if (click)
+    {
+        int width, height;
+        GetWindowSize(width, height);
+
+        // Screen coordinates: origin top-left, so the upper half of the window
+        std::uniform_real_distribution<double> xDist(100.0, width - 100.0);
+        std::uniform_real_distribution<double> yDist(0.0, height * 0.5);
+        InputManager::SetMousePosition(xDist(m_Rng), yDist(m_Rng));
+    }
+    InputManager::SetMouseButtonState(GLFW_MOUSE_BUTTON_LEFT, click);
+}
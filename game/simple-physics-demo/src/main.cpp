@@ -1,8 +1,8 @@
 #include "SimplePhysicsDemo.h"
 
-int main()
+int main(int argc, char** argv)
 {
-    SimplePhysicsDemo demo;
+    SimplePhysicsDemo demo(Nyon::LaunchOptions::Parse(argc, argv));
     demo.Run();
     return 0;
 }
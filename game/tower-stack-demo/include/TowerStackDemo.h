@@ -2,8 +2,10 @@
 
 #include "nyon/core/ECSApplication.h"
 #include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/EntityPool.h"
 #include "nyon/math/Vector3.h"
 
+#include <memory>
 #include <vector>
 #include <random>
 
@@ -14,11 +16,13 @@
 //    - Press SPACE to drop the block onto the tower
 //    - If the tower is unbalanced, it tips over and collapses
 //    - Camera follows the tower upward, zooms out on collapse
+//  Stress mode: --scale N drops a row of N blocks per press on a widened
+//  platform; --bot drops when the block is centred and restarts on collapse.
 // ============================================================================
 class TowerStackDemo : public Nyon::ECSApplication
 {
 public:
-    TowerStackDemo();
+    explicit TowerStackDemo(const Nyon::LaunchOptions& options = {});
 
 protected:
     void OnECSStart() override;
@@ -35,10 +39,12 @@ private:
 
     // ---------- game logic --------------------------------------------------
     void DropActiveBlock();
+    void BuildBlock(Nyon::ECS::EntityID block);
     void UpdateCamera(float deltaTime);
     void CheckGameOver();
     void CleanupFallenBlocks();
     void ResetGame();
+    void UpdateBot();
 
     // ---------- runtime state -----------------------------------------------
     Nyon::ECS::EntityID m_WorldEntity  { 0 };
@@ -47,6 +53,7 @@ private:
     Nyon::ECS::EntityID m_ActiveBlock  { 0 };
 
     std::vector<Nyon::ECS::EntityID> m_Blocks;
+    std::unique_ptr<Nyon::ECS::EntityPool> m_BlockPool;  // Fallen blocks are recycled
 
     // Game state
     GameState m_State           { GameState::PLAYING };
@@ -55,6 +62,10 @@ private:
     float m_HighestBlockY       { 0.0f };
     float m_FallTimer           { 0.0f };
 
+    // Blocks per dropped row (--scale) and the platform width that fits them
+    int m_RowBlocks             { 1 };
+    float m_PlatformWidth       { PLATFORM_WIDTH };
+
     // Camera animation
     float m_StartCamZoom        { 1.0f };
     float m_StartCamY           { 0.0f };
@@ -76,6 +87,7 @@ private:
 
     static constexpr float BLOCK_WIDTH       = 120.0f;
     static constexpr float BLOCK_HEIGHT      = 30.0f;
+    static constexpr float ROW_BLOCK_GAP     = 4.0f;
     static constexpr float SLIDE_SPEED       = 350.0f;
     static constexpr float BLOCK_DENSITY     = 0.5f;
     static constexpr float FRICTION          = 0.6f;
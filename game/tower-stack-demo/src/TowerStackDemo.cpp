@@ -17,9 +17,12 @@ using namespace Nyon;
 // ============================================================================
 //  Constructor
 // ============================================================================
-TowerStackDemo::TowerStackDemo()
-    : ECSApplication("Tower Stack", 1280, 720)
+TowerStackDemo::TowerStackDemo(const LaunchOptions& options)
+    : ECSApplication("Tower Stack", 1280, 720, options)
 {
+    if (options.seed != 0)
+        m_Rng.seed(options.seed);
+
     m_BlockColors = {
         { 0.2f, 0.6f, 1.0f },   // blue
         { 0.2f, 0.8f, 0.3f },   // green
@@ -40,6 +43,11 @@ void TowerStackDemo::OnECSStart()
     std::cerr << "Press SPACE to drop the block. Try to stack as high as you can!\n";
     std::cerr << "Press R to restart after game over.\n\n";
 
+    m_RowBlocks = std::max(1, static_cast<int>(std::lround(GetLaunchOptions().scale)));
+    m_PlatformWidth = std::max(PLATFORM_WIDTH,
+                               m_RowBlocks * (BLOCK_WIDTH + ROW_BLOCK_GAP) + BLOCK_WIDTH);
+    m_BlockPool = std::make_unique<ECS::EntityPool>(GetEntityManager(), GetComponentStore(), "blocks");
+
     CreateWorld();
     CreateCamera();
     CreatePlatform();
@@ -101,7 +109,7 @@ void TowerStackDemo::CreatePlatform()
 
     m_PlatformEntity = entities.CreateEntity();
 
-    float halfW = PLATFORM_WIDTH / 2.0f;
+    float halfW = m_PlatformWidth / 2.0f;
     float halfH = PLATFORM_HEIGHT / 2.0f;
 
     // Transform
@@ -128,7 +136,7 @@ void TowerStackDemo::CreatePlatform()
     collider.material.density = 0.0f;
 
     // Render
-    ECS::RenderComponent render({ PLATFORM_WIDTH, PLATFORM_HEIGHT }, { 0.4f, 0.4f, 0.4f });
+    ECS::RenderComponent render({ m_PlatformWidth, PLATFORM_HEIGHT }, { 0.4f, 0.4f, 0.4f });
     render.origin = { halfW, halfH };
 
     cs.AddComponent(m_PlatformEntity, std::move(t));
@@ -145,19 +153,28 @@ void TowerStackDemo::SpawnActiveBlock()
     auto& entities = GetEntityManager();
     auto& cs       = GetComponentStore();
 
-    m_ActiveBlock = entities.CreateEntity();
-
     float spawnY = m_HighestBlockY + BLOCK_HEIGHT + 1.0f;
+    const auto& color = m_BlockColors[m_ColorIndex % m_BlockColors.size()];
+    m_ColorIndex++;
+
+    // The sliding block is a render-only preview that is reused for every drop
+    if (m_ActiveBlock != 0 && cs.HasComponent<ECS::TransformComponent>(m_ActiveBlock))
+    {
+        auto& t = cs.GetComponent<ECS::TransformComponent>(m_ActiveBlock);
+        t.position = { 640.0f, spawnY };
+        t.previousPosition = t.position;
+        cs.GetComponent<ECS::RenderComponent>(m_ActiveBlock).color = color;
+        return;
+    }
+
+    m_ActiveBlock = entities.CreateEntity();
 
     // Transform
     ECS::TransformComponent t;
     t.position = { 640.0f, spawnY };
     t.previousPosition = t.position;
 
-    // Render only (no physics yet - added on drop)
-    const auto& color = m_BlockColors[m_ColorIndex % m_BlockColors.size()];
-    m_ColorIndex++;
-
+    // Render only (dropped blocks are separate physics entities)
     ECS::RenderComponent render({ BLOCK_WIDTH, BLOCK_HEIGHT }, color);
     render.origin = { BLOCK_WIDTH / 2.0f, BLOCK_HEIGHT / 2.0f };
 
@@ -166,7 +183,7 @@ void TowerStackDemo::SpawnActiveBlock()
 }
 
 // ============================================================================
-//  DropActiveBlock  –  release the block as a dynamic physics body
+//  DropActiveBlock  –  place a dynamic physics block where the preview is
 // ============================================================================
 void TowerStackDemo::DropActiveBlock()
 {
@@ -176,9 +193,52 @@ void TowerStackDemo::DropActiveBlock()
         return;
 
     // Get the current position (where the block was sliding)
-    const auto& t = cs.GetComponent<ECS::TransformComponent>(m_ActiveBlock);
-    float dropX = t.position.x;
-    float dropY = t.position.y;
+    const auto& preview = cs.GetComponent<ECS::TransformComponent>(m_ActiveBlock);
+    float dropX = preview.position.x;
+    float dropY = preview.position.y;
+    const Math::Vector3 color = cs.GetComponent<ECS::RenderComponent>(m_ActiveBlock).color;
+
+    // In stress mode one press drops a centred row of blocks
+    const float rowPitch = BLOCK_WIDTH + ROW_BLOCK_GAP;
+    const float rowStartX = dropX - (m_RowBlocks - 1) * rowPitch / 2.0f;
+
+    for (int i = 0; i < m_RowBlocks; ++i)
+    {
+        ECS::EntityID block = m_BlockPool->Acquire([this](ECS::EntityID e) { BuildBlock(e); });
+
+        auto& t = cs.GetComponent<ECS::TransformComponent>(block);
+        t.position = { rowStartX + i * rowPitch, dropY };
+        t.previousPosition = t.position;
+        t.rotation = 0.0f;
+        t.previousRotation = 0.0f;
+
+        cs.GetComponent<ECS::RenderComponent>(block).color = color;
+        m_Blocks.push_back(block);
+    }
+
+    // Update highest block Y
+    if (dropY > m_HighestBlockY)
+        m_HighestBlockY = dropY;
+
+    // Increment score
+    m_Score++;
+
+    // Spawn next block
+    SpawnActiveBlock();
+}
+
+// ============================================================================
+//  BuildBlock  –  components of a pooled block; DropActiveBlock places it
+// ============================================================================
+void TowerStackDemo::BuildBlock(ECS::EntityID block)
+{
+    auto& cs = GetComponentStore();
+
+    ECS::RenderComponent render({ BLOCK_WIDTH, BLOCK_HEIGHT }, { 1.0f, 1.0f, 1.0f });
+    render.origin = { BLOCK_WIDTH / 2.0f, BLOCK_HEIGHT / 2.0f };
+
+    cs.AddComponent(block, ECS::TransformComponent());
+    cs.AddComponent(block, std::move(render));
 
     // Add physics body
     ECS::PhysicsBodyComponent body;
@@ -211,21 +271,8 @@ void TowerStackDemo::DropActiveBlock()
     collider.material.restitution = RESTITUTION;
     collider.material.density = BLOCK_DENSITY;
 
-    cs.AddComponent(m_ActiveBlock, std::move(body));
-    cs.AddComponent(m_ActiveBlock, std::move(collider));
-
-    // Track this block
-    m_Blocks.push_back(m_ActiveBlock);
-
-    // Update highest block Y
-    if (dropY > m_HighestBlockY)
-        m_HighestBlockY = dropY;
-
-    // Increment score
-    m_Score++;
-
-    // Spawn next block
-    SpawnActiveBlock();
+    cs.AddComponent(block, std::move(body));
+    cs.AddComponent(block, std::move(collider));
 }
 
 // ============================================================================
@@ -295,11 +342,10 @@ void TowerStackDemo::CheckGameOver()
 }
 
 // ============================================================================
-//  CleanupFallenBlocks  –  destroy blocks far below the play area
+//  CleanupFallenBlocks  –  recycle blocks far below the play area
 // ============================================================================
 void TowerStackDemo::CleanupFallenBlocks()
 {
-    auto& entities = GetEntityManager();
     auto& cs       = GetComponentStore();
 
     auto it = m_Blocks.begin();
@@ -310,7 +356,7 @@ void TowerStackDemo::CleanupFallenBlocks()
             const auto& t = cs.GetComponent<ECS::TransformComponent>(*it);
             if (t.position.y < -1500.0f)
             {
-                entities.DestroyEntity(*it, cs);
+                m_BlockPool->Release(*it);
                 it = m_Blocks.erase(it);
                 continue;
             }
@@ -324,23 +370,17 @@ void TowerStackDemo::CleanupFallenBlocks()
 // ============================================================================
 void TowerStackDemo::ResetGame()
 {
-    auto& entities = GetEntityManager();
     auto& cs       = GetComponentStore();
 
-    // Destroy all placed blocks
+    m_BlockPool->Report(std::cerr);
+
+    // Return all placed blocks to the pool
     for (auto blockId : m_Blocks)
     {
-        entities.DestroyEntity(blockId, cs);
+        m_BlockPool->Release(blockId);
     }
     m_Blocks.clear();
 
-    // Destroy the current active block
-    if (m_ActiveBlock != 0)
-    {
-        entities.DestroyEntity(m_ActiveBlock, cs);
-        m_ActiveBlock = 0;
-    }
-
     // Reset camera
     if (cs.HasComponent<ECS::CameraComponent>(m_CameraEntity))
     {
@@ -370,6 +410,9 @@ void TowerStackDemo::OnECSFixedUpdate(float deltaTime)
 {
     auto& cs = GetComponentStore();
 
+    if (GetLaunchOptions().bot)
+        UpdateBot();
+
     // --- State-independent logic ---
     CleanupFallenBlocks();
     UpdateCamera(deltaTime);
@@ -448,3 +491,25 @@ void TowerStackDemo::OnECSFixedUpdate(float deltaTime)
         ResetGame();
     }
 }
+
+// ============================================================================
+//  UpdateBot  –  synthetic input: drop when centred, restart after collapse
+// ============================================================================
+void TowerStackDemo::UpdateBot()
+{
+    auto& cs = GetComponentStore();
+
+    // The block moves SLIDE_SPEED / 60 per tick, so a half-step window
+    // around the centre is hit exactly once per pass
+    bool drop = false;
+    if (m_State == GameState::PLAYING && cs.HasComponent<ECS::TransformComponent>(m_ActiveBlock))
+    {
+        float x = cs.GetComponent<ECS::TransformComponent>(m_ActiveBlock).position.x;
+        drop = std::abs(x - 640.0f) <= SLIDE_SPEED * Nyon::FIXED_TIMESTEP * 0.5f;
+    }
+    bool restart = m_State == GameState::GAME_OVER || m_State == GameState::FALLING;
+
+    // Edge-triggered keys: hold for one tick, release for the next
+    Utils::InputManager::SetKeyState(GLFW_KEY_SPACE, drop && !Utils::InputManager::IsKeyDown(GLFW_KEY_SPACE));
+    Utils::InputManager::SetKeyState(GLFW_KEY_R, restart && !Utils::InputManager::IsKeyDown(GLFW_KEY_R));
+}
@@ -1,8 +1,8 @@
 #include "TowerStackDemo.h"
 
-int main()
+int main(int argc, char** argv)
 {
-    TowerStackDemo game;
+    TowerStackDemo game(Nyon::LaunchOptions::Parse(argc, argv));
     game.Run();
     return 0;
 }
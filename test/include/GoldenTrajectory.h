@@ -0,0 +1,241 @@
+#pragma once
+
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/systems/PhysicsPipelineSystem.h"
+#include "nyon/EngineConstants.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Golden-trajectory harness for differential testing of the physics pipeline.
+ *
+ * A standard scene is stepped under one pipeline configuration and every dynamic
+ * body's state is recorded per step, together with the contact count. Trajectories
+ * are saved to a compact binary file and compared against runs under alternate
+ * configurations (threading, deterministic mode, spatial sorting, ...), producing
+ * divergence metrics that are checked against tolerances.
+ */
+namespace NyonTest
+{
+    // Builds a scene into an empty world (PhysicsWorldComponent included)
+    using SceneBuilder = std::function<void(Nyon::ECS::EntityManager&, Nyon::ECS::ComponentStore&)>;
+
+    // Adjusts the pipeline before the first step (config, LOD focus, ...)
+    using PipelineSetup = std::function<void(Nyon::ECS::PhysicsPipelineSystem&)>;
+
+    struct BodySample
+    {
+        float positionX = 0.0f;
+        float positionY = 0.0f;
+        float rotation = 0.0f;
+        float velocityX = 0.0f;
+        float velocityY = 0.0f;
+        float angularVelocity = 0.0f;
+    };
+
+    struct TrajectoryFrame
+    {
+        uint32_t contactCount = 0;
+        std::vector<BodySample> bodies; // Parallel to Trajectory::bodyIds
+    };
+
+    struct Trajectory
+    {
+        std::vector<Nyon::ECS::EntityID> bodyIds; // Dynamic bodies in entity ID order
+        std::vector<TrajectoryFrame> frames;
+
+        static constexpr uint32_t FILE_MAGIC = 0x5447594Eu; // "NYGT"
+        static constexpr uint32_t FILE_VERSION = 1;
+
+        /**
+         * @brief Write the trajectory as little-endian binary
+         *
+         * Layout: magic, version, body count, frame count, body IDs, then per frame the
+         * contact count followed by six floats per body.
+         */
+        bool Save(const std::string& path) const
+        {
+            std::ofstream out(path, std::ios::binary);
+            if (!out)
+                return false;
+
+            uint32_t header[4] = { FILE_MAGIC, FILE_VERSION,
+                                   static_cast<uint32_t>(bodyIds.size()), static_cast<uint32_t>(frames.size()) };
+            out.write(reinterpret_cast<const char*>(header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(bodyIds.data()), bodyIds.size() * sizeof(Nyon::ECS::EntityID));
+            for (const auto& frame : frames)
+            {
+                out.write(reinterpret_cast<const char*>(&frame.contactCount), sizeof(frame.contactCount));
+                out.write(reinterpret_cast<const char*>(frame.bodies.data()), frame.bodies.size() * sizeof(BodySample));
+            }
+            return static_cast<bool>(out);
+        }
+
+        bool Load(const std::string& path)
+        {
+            std::ifstream in(path, std::ios::binary);
+            if (!in)
+                return false;
+
+            uint32_t header[4] = {};
+            in.read(reinterpret_cast<char*>(header), sizeof(header));
+            if (!in || header[0] != FILE_MAGIC || header[1] != FILE_VERSION)
+                return false;
+
+            bodyIds.resize(header[2]);
+            frames.resize(header[3]);
+            in.read(reinterpret_cast<char*>(bodyIds.data()), bodyIds.size() * sizeof(Nyon::ECS::EntityID));
+            for (auto& frame : frames)
+            {
+                frame.bodies.resize(bodyIds.size());
+                in.read(reinterpret_cast<char*>(&frame.contactCount), sizeof(frame.contactCount));
+                in.read(reinterpret_cast<char*>(frame.bodies.data()), frame.bodies.size() * sizeof(BodySample));
+            }
+            return static_cast<bool>(in);
+        }
+    };
+
+    struct DivergenceTolerance
+    {
+        float position = 1e-3f;          // px
+        float rotation = 1e-4f;          // rad
+        float velocity = 1e-2f;          // px/s
+        float angularVelocity = 1e-3f;   // rad/s
+        uint32_t contactCountSteps = 0;  // Steps allowed to report a different contact count
+    };
+
+    struct DivergenceReport
+    {
+        bool comparable = true;          // False when body sets or step counts differ
+        float maxPositionError = 0.0f;
+        float rmsPositionError = 0.0f;
+        float maxRotationError = 0.0f;
+        float maxVelocityError = 0.0f;
+        float maxAngularVelocityError = 0.0f;
+        uint32_t contactCountMismatches = 0;
+        int firstDivergentStep = -1;     // First step whose position error exceeds the tolerance
+        Nyon::ECS::EntityID worstBody = Nyon::ECS::INVALID_ENTITY;
+
+        bool Within(const DivergenceTolerance& tolerance) const
+        {
+            return comparable &&
+                   maxPositionError <= tolerance.position &&
+                   maxRotationError <= tolerance.rotation &&
+                   maxVelocityError <= tolerance.velocity &&
+                   maxAngularVelocityError <= tolerance.angularVelocity &&
+                   contactCountMismatches <= tolerance.contactCountSteps;
+        }
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, const DivergenceReport& report)
+    {
+        if (!report.comparable)
+            return os << "not comparable (body set or step count differs)";
+
+        return os << "max pos " << report.maxPositionError << " px (body " << report.worstBody
+                  << "), rms pos " << report.rmsPositionError << " px, max rot " << report.maxRotationError
+                  << " rad, max vel " << report.maxVelocityError << " px/s, max ang vel "
+                  << report.maxAngularVelocityError << " rad/s, contact mismatches "
+                  << report.contactCountMismatches << ", first divergent step " << report.firstDivergentStep;
+    }
+
+    /**
+     * @brief Step a freshly built scene and record every dynamic body after each step
+     */
+    inline Trajectory RecordTrajectory(const SceneBuilder& buildScene, const PipelineSetup& setup, int steps)
+    {
+        using namespace Nyon::ECS;
+
+        EntityManager entities;
+        ComponentStore cs(entities);
+        buildScene(entities, cs);
+
+        PhysicsPipelineSystem physics;
+        physics.Initialize(entities, cs);
+        if (setup)
+            setup(physics);
+
+        Trajectory trajectory;
+        cs.ForEachComponent<PhysicsBodyComponent>([&](EntityID entityId, const PhysicsBodyComponent& body) {
+            if (!body.isStatic)
+                trajectory.bodyIds.push_back(entityId);
+        });
+        std::sort(trajectory.bodyIds.begin(), trajectory.bodyIds.end());
+
+        trajectory.frames.reserve(steps);
+        for (int step = 0; step < steps; ++step)
+        {
+            physics.Update(Nyon::FIXED_TIMESTEP);
+
+            TrajectoryFrame frame;
+            frame.contactCount = static_cast<uint32_t>(physics.GetStatistics().narrowPhaseContacts);
+            frame.bodies.reserve(trajectory.bodyIds.size());
+            for (EntityID entityId : trajectory.bodyIds)
+            {
+                const auto& transform = cs.GetComponent<TransformComponent>(entityId);
+                const auto& body = cs.GetComponent<PhysicsBodyComponent>(entityId);
+                frame.bodies.push_back({ transform.position.x, transform.position.y, transform.rotation,
+                                         body.velocity.x, body.velocity.y, body.angularVelocity });
+            }
+            trajectory.frames.push_back(std::move(frame));
+        }
+        return trajectory;
+    }
+
+    inline DivergenceReport CompareTrajectories(const Trajectory& reference, const Trajectory& candidate,
+                                                const DivergenceTolerance& tolerance = {})
+    {
+        DivergenceReport report;
+        if (reference.bodyIds != candidate.bodyIds || reference.frames.size() != candidate.frames.size())
+        {
+            report.comparable = false;
+            return report;
+        }
+
+        double squaredPositionSum = 0.0;
+        size_t samples = 0;
+        for (size_t step = 0; step < reference.frames.size(); ++step)
+        {
+            const auto& expected = reference.frames[step];
+            const auto& actual = candidate.frames[step];
+            if (expected.contactCount != actual.contactCount)
+                report.contactCountMismatches++;
+
+            for (size_t i = 0; i < expected.bodies.size(); ++i)
+            {
+                const auto& a = expected.bodies[i];
+                const auto& b = actual.bodies[i];
+                float dx = b.positionX - a.positionX;
+                float dy = b.positionY - a.positionY;
+                float positionError = std::sqrt(dx * dx + dy * dy);
+                float velocityError = std::hypot(b.velocityX - a.velocityX, b.velocityY - a.velocityY);
+
+                if (positionError > report.maxPositionError)
+                {
+                    report.maxPositionError = positionError;
+                    report.worstBody = reference.bodyIds[i];
+                }
+                if (positionError > tolerance.position && report.firstDivergentStep < 0)
+                    report.firstDivergentStep = static_cast<int>(step);
+
+                report.maxRotationError = std::max(report.maxRotationError, std::abs(b.rotation - a.rotation));
+                report.maxVelocityError = std::max(report.maxVelocityError, velocityError);
+                report.maxAngularVelocityError = std::max(report.maxAngularVelocityError,
+                                                          std::abs(b.angularVelocity - a.angularVelocity));
+                squaredPositionSum += static_cast<double>(positionError) * positionError;
+                samples++;
+            }
+        }
+
+        if (samples > 0)
+            report.rmsPositionError = static_cast<float>(std::sqrt(squaredPositionSum / samples));
+        return report;
+    }
+}
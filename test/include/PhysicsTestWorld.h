@@ -0,0 +1,70 @@
+#pragma once
+
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/components/ColliderComponent.h"
+#include "nyon/ecs/components/PhysicsBodyComponent.h"
+#include "nyon/ecs/components/PhysicsWorldComponent.h"
+#include "nyon/ecs/components/TransformComponent.h"
+#include "nyon/ecs/systems/PhysicsPipelineSystem.h"
+#include "nyon/EngineConstants.h"
+#include <utility>
+
+/**
+ * @brief Small physics scene shared by system tests.
+ *
+ * Owns the entity manager, component store and pipeline and adds the
+ * PhysicsWorldComponent. Systems that run after the physics step and query it
+ * (character controllers, fracture) are passed to Start() and Step().
+ */
+namespace NyonTest
+{
+    struct PhysicsTestWorld
+    {
+        Nyon::ECS::EntityManager entities;
+        Nyon::ECS::ComponentStore cs{entities};
+        Nyon::ECS::PhysicsPipelineSystem physics;
+
+        explicit PhysicsTestWorld(const Nyon::Math::Vector2& gravity = { 0.0f, -980.0f })
+        {
+            Nyon::ECS::PhysicsWorldComponent world;
+            world.gravity = gravity;
+            cs.AddComponent(entities.CreateEntity(), std::move(world));
+        }
+
+        // Initialize the pipeline, then each system against it
+        template<typename... Systems>
+        void Start(Systems&... systems)
+        {
+            physics.Initialize(entities, cs);
+            ((systems.Initialize(entities, cs), systems.SetPhysicsSystem(&physics)), ...);
+        }
+
+        // One fixed step of the pipeline, then of each system
+        template<typename... Systems>
+        void Step(Systems&... systems)
+        {
+            physics.Update(Nyon::FIXED_TIMESTEP);
+            (systems.Update(Nyon::FIXED_TIMESTEP), ...);
+        }
+
+        Nyon::ECS::EntityID AddBody(Nyon::ECS::ColliderComponent collider, const Nyon::Math::Vector2& position, bool isStatic)
+        {
+            Nyon::ECS::EntityID e = entities.CreateEntity();
+            Nyon::ECS::PhysicsBodyComponent body;
+            body.isStatic = isStatic;
+            body.UpdateMassProperties();
+            cs.AddComponent(e, Nyon::ECS::TransformComponent(position));
+            cs.AddComponent(e, std::move(body));
+            cs.AddComponent(e, std::move(collider));
+            return e;
+        }
+
+        Nyon::ECS::EntityID AddCircle(const Nyon::Math::Vector2& position, float radius = 5.0f, float density = 1.0f)
+        {
+            Nyon::ECS::ColliderComponent collider(radius);
+            collider.material.density = density;
+            return AddBody(std::move(collider), position, false);
+        }
+    };
+}
@@ -0,0 +1,284 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "PhysicsTestWorld.h"
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/systems/CharacterControllerSystem.h"
+#include "nyon/ecs/systems/PhysicsPipelineSystem.h"
+#include "nyon/physics/ShapeCast.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+using namespace Nyon;
+using namespace Nyon::ECS;
+using NyonTest::PhysicsTestWorld;
+
+/**
+ * @brief Unit tests for kinematic character controllers.
+ *
+ * Tests cover:
+ * - Circle casts and overlaps against polygons and circles
+ * - Walking, wall stops, step-up onto low ledges and staying grounded on slopes
+ * - Reuse of cached broad-phase queries until nearby proxies change
+ * - A 500-character crowd against the same number of dynamic bodies
+ */
+
+namespace
+{
+    // Static polygon with vertices given in world space
+    EntityID AddStatic(PhysicsTestWorld& world, const std::vector<Math::Vector2>& vertices)
+    {
+        return world.AddBody(ColliderComponent(ColliderComponent::PolygonShape(vertices)), { 0.0f, 0.0f }, true);
+    }
+
+    EntityID AddBox(PhysicsTestWorld& world, float minX, float minY, float maxX, float maxY)
+    {
+        return AddStatic(world, { { minX, minY }, { maxX, minY }, { maxX, maxY }, { minX, maxY } });
+    }
+
+    EntityID AddCharacter(PhysicsTestWorld& world, const Math::Vector2& position)
+    {
+        EntityID e = world.entities.CreateEntity();
+        world.cs.AddComponent(e, TransformComponent(position));
+        world.cs.AddComponent(e, CharacterControllerComponent());
+        return e;
+    }
+
+    Math::Vector2 Position(PhysicsTestWorld& world, EntityID e) { return world.cs.GetComponent<TransformComponent>(e).position; }
+}
+
+// ============================================================================
+// SHAPE CAST TESTS
+// ============================================================================
+
+TEST(CharacterControllerTest, CircleCastHitsPolygonFaceAndCorner)
+{
+    LOG_FUNC_ENTER();
+    ColliderComponent box(ColliderComponent::PolygonShape({ { -10.0f, -10.0f }, { 10.0f, -10.0f }, { 10.0f, 10.0f }, { -10.0f, 10.0f } }));
+    Physics::ShapeCast::Hit hit;
+
+    // Face: a radius 5 circle from x = -50 touches the left face (x = -10) at center x = -15
+    ASSERT_TRUE(Physics::ShapeCast::CastCircle(box, { 0.0f, 0.0f }, 0.0f, { -50.0f, 0.0f }, 5.0f, { 100.0f, 0.0f }, hit));
+    EXPECT_NEAR(hit.fraction, 0.35f, 1e-5f);
+    EXPECT_NEAR(hit.normal.x, -1.0f, 1e-5f);
+    EXPECT_NEAR(hit.point.x, -10.0f, 1e-4f);
+
+    // Corner: rotated 45 degrees the box's corner points left, at x = -10 * sqrt(2)
+    ASSERT_TRUE(Physics::ShapeCast::CastCircle(box, { 0.0f, 0.0f }, 0.7853982f, { -50.0f, 0.0f }, 5.0f, { 100.0f, 0.0f }, hit));
+    EXPECT_NEAR(hit.fraction, (50.0f - 10.0f * std::sqrt(2.0f) - 5.0f) / 100.0f, 1e-4f);
+
+    // A miss, and a circle already touching that moves away
+    EXPECT_FALSE(Physics::ShapeCast::CastCircle(box, { 0.0f, 0.0f }, 0.0f, { -50.0f, 30.0f }, 5.0f, { 100.0f, 0.0f }, hit));
+    EXPECT_FALSE(Physics::ShapeCast::CastCircle(box, { 0.0f, 0.0f }, 0.0f, { -14.0f, 0.0f }, 5.0f, { -10.0f, 0.0f }, hit));
+    EXPECT_TRUE(Physics::ShapeCast::CastCircle(box, { 0.0f, 0.0f }, 0.0f, { -14.0f, 0.0f }, 5.0f, { 10.0f, 0.0f }, hit));
+    EXPECT_FLOAT_EQ(hit.fraction, 0.0f);
+
+    Math::Vector2 normal;
+    float depth = 0.0f;
+    ASSERT_TRUE(Physics::ShapeCast::CircleOverlap(box, { 0.0f, 0.0f }, 0.0f, { 0.0f, 12.0f }, 5.0f, normal, depth));
+    EXPECT_NEAR(depth, 3.0f, 1e-5f);
+    EXPECT_NEAR(normal.y, 1.0f, 1e-5f);
+
+    ColliderComponent circle(8.0f);
+    ASSERT_TRUE(Physics::ShapeCast::CastCircle(circle, { 100.0f, 0.0f }, 0.0f, { 0.0f, 0.0f }, 2.0f, { 200.0f, 0.0f }, hit));
+    EXPECT_NEAR(hit.fraction, 0.45f, 1e-5f);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// MOVEMENT TESTS
+// ============================================================================
+
+TEST(CharacterControllerTest, WalksUntilBlockedByWall)
+{
+    LOG_FUNC_ENTER();
+    PhysicsTestWorld world;
+    CharacterControllerSystem characters;
+    AddBox(world, -1000.0f, -20.0f, 1000.0f, 0.0f);
+    AddBox(world, 200.0f, 0.0f, 220.0f, 200.0f);
+    EntityID player = AddCharacter(world, { 0.0f, 40.0f });
+    world.Start(characters);
+
+    // Falls onto the ground and lands a skin width above it
+    for (int i = 0; i < 60; ++i)
+        world.Step(characters);
+    auto& controller = world.cs.GetComponent<CharacterControllerComponent>(player);
+    EXPECT_TRUE(controller.isGrounded);
+    EXPECT_NEAR(Position(world, player).y, controller.radius + controller.skinWidth, 0.05f);
+    EXPECT_FLOAT_EQ(controller.velocity.y, 0.0f);
+
+    for (int i = 0; i < 120; ++i)
+    {
+        controller.velocity.x = 300.0f;
+        world.Step(characters);
+    }
+    EXPECT_TRUE(controller.hitWall);
+    EXPECT_TRUE(controller.isGrounded);
+    EXPECT_NEAR(Position(world, player).x, 200.0f - controller.radius - controller.skinWidth, 0.05f);
+    EXPECT_NEAR(Position(world, player).y, controller.radius + controller.skinWidth, 0.05f);
+    EXPECT_FLOAT_EQ(controller.velocity.x, 0.0f);
+    LOG_FUNC_EXIT();
+}
+
+TEST(CharacterControllerTest, StepsOntoLowLedgesOnly)
+{
+    LOG_FUNC_ENTER();
+    PhysicsTestWorld world;
+    CharacterControllerSystem characters;
+    AddBox(world, -1000.0f, -20.0f, 1000.0f, 0.0f);
+    AddBox(world, 100.0f, 0.0f, 1000.0f, 7.0f);    // Low ledge
+    AddBox(world, 300.0f, 7.0f, 1000.0f, 37.0f);   // Wall on top of it
+    EntityID player = AddCharacter(world, { 0.0f, 16.5f });
+    world.Start(characters);
+
+    auto& controller = world.cs.GetComponent<CharacterControllerComponent>(player);
+    bool everAirborne = false;
+    for (int i = 0; i < 120; ++i)
+    {
+        controller.velocity.x = 240.0f;
+        world.Step(characters);
+        everAirborne |= i > 0 && !controller.isGrounded;
+    }
+    EXPECT_FALSE(everAirborne);
+    EXPECT_NEAR(Position(world, player).y, 7.0f + controller.radius + controller.skinWidth, 0.05f);
+    EXPECT_NEAR(Position(world, player).x, 300.0f - controller.radius - controller.skinWidth, 0.05f);
+    EXPECT_TRUE(controller.hitWall);
+    LOG_FUNC_EXIT();
+}
+
+TEST(CharacterControllerTest, StaysGroundedWalkingUpAndDownSlopes)
+{
+    LOG_FUNC_ENTER();
+    PhysicsTestWorld world;
+    CharacterControllerSystem characters;
+    AddBox(world, -1000.0f, -20.0f, 1000.0f, 0.0f);
+    float rise = 400.0f * std::tan(0.5236f);  // 30 degree ramp from x = 0 to 400
+    AddStatic(world, { { 0.0f, 0.0f }, { 400.0f, 0.0f }, { 400.0f, rise } });
+    AddBox(world, 400.0f, 0.0f, 1000.0f, rise);
+    EntityID player = AddCharacter(world, { -100.0f, 16.5f });
+    world.Start(characters);
+
+    auto& controller = world.cs.GetComponent<CharacterControllerComponent>(player);
+    world.Step(characters);
+    int airborneFrames = 0;
+    for (int i = 0; i < 150; ++i)
+    {
+        controller.velocity.x = 300.0f;
+        world.Step(characters);
+        airborneFrames += controller.isGrounded ? 0 : 1;
+    }
+    EXPECT_EQ(airborneFrames, 0);
+    EXPECT_GT(Position(world, player).x, 400.0f);
+    EXPECT_NEAR(Position(world, player).y, rise + controller.radius + controller.skinWidth, 0.5f);
+
+    for (int i = 0; i < 150; ++i)
+    {
+        controller.velocity.x = -300.0f;
+        world.Step(characters);
+        airborneFrames += controller.isGrounded ? 0 : 1;
+    }
+    EXPECT_EQ(airborneFrames, 0);
+    EXPECT_LT(Position(world, player).x, 0.0f);
+    EXPECT_NEAR(Position(world, player).y, controller.radius + controller.skinWidth, 0.5f);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// QUERY CACHE TESTS
+// ============================================================================
+
+TEST(CharacterControllerTest, CachedQueriesRefreshOnlyForNearbyChanges)
+{
+    LOG_FUNC_ENTER();
+    PhysicsTestWorld world;
+    CharacterControllerSystem characters;
+    AddBox(world, -1000.0f, -20.0f, 1000.0f, 0.0f);
+    EntityID nearBox = AddBox(world, 40.0f, 0.0f, 60.0f, 20.0f);
+    EntityID farBox = AddBox(world, 800.0f, 0.0f, 820.0f, 20.0f);
+    AddCharacter(world, { 0.0f, 16.5f });
+    world.Start(characters);
+
+    world.Step(characters);
+    EXPECT_EQ(characters.GetStatistics().cacheRefreshes, 1u);
+    for (int i = 0; i < 10; ++i)
+    {
+        world.Step(characters);
+        EXPECT_EQ(characters.GetStatistics().cacheRefreshes, 0u);
+    }
+
+    // Moving a collider far away leaves the cache alone; moving one nearby refreshes it
+    world.cs.GetComponent<TransformComponent>(farBox).position = { 100.0f, 0.0f };
+    world.Step(characters);
+    EXPECT_EQ(characters.GetStatistics().cacheRefreshes, 0u);
+    world.cs.GetComponent<TransformComponent>(nearBox).position = { -200.0f, 0.0f };
+    world.Step(characters);
+    EXPECT_EQ(characters.GetStatistics().cacheRefreshes, 1u);
+    world.Step(characters);
+    EXPECT_EQ(characters.GetStatistics().cacheRefreshes, 0u);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PERFORMANCE TESTS
+// ============================================================================
+
+TEST(CharacterControllerPerformanceTest, CrowdCostsLessThanDynamicBodies)
+{
+    LOG_FUNC_ENTER();
+    constexpr int COUNT = 500;
+    constexpr int STEPS = 60;
+
+    // Characters walking back and forth on the ground
+    PhysicsTestWorld crowd;
+    CharacterControllerSystem controllers;
+    AddBox(crowd, -10000.0f, -20.0f, 10000.0f, 0.0f);
+    std::vector<EntityID> characters;
+    for (int i = 0; i < COUNT; ++i)
+        characters.push_back(AddCharacter(crowd, { (i - COUNT / 2) * 40.0f, 16.5f }));
+    crowd.Start(controllers);
+    crowd.Step(controllers);
+
+    double crowdMs = 0.0;
+    for (int step = 0; step < STEPS; ++step)
+    {
+        for (int i = 0; i < COUNT; ++i)
+            crowd.cs.GetComponent<CharacterControllerComponent>(characters[i]).velocity.x = ((step / 20 + i) % 2 == 0) ? 120.0f : -120.0f;
+        crowd.Step(controllers);
+        crowdMs += controllers.GetStatistics().updateTime + crowd.physics.GetStatistics().updateTime;
+    }
+    EXPECT_EQ(controllers.GetStatistics().groundedCharacters, static_cast<size_t>(COUNT));
+
+    // The same crowd as rotation-locked dynamic circles
+    PhysicsTestWorld bodies;
+    AddBox(bodies, -10000.0f, -20.0f, 10000.0f, 0.0f);
+    std::vector<EntityID> dynamicBodies;
+    for (int i = 0; i < COUNT; ++i)
+    {
+        EntityID e = bodies.entities.CreateEntity();
+        PhysicsBodyComponent body;
+        body.SetMass(1.0f);
+        body.allowSleep = false;
+        body.motionLocks.lockRotation = true;
+        bodies.cs.AddComponent(e, TransformComponent({ (i - COUNT / 2) * 40.0f, 16.0f }));
+        bodies.cs.AddComponent(e, std::move(body));
+        bodies.cs.AddComponent(e, ColliderComponent(16.0f));
+        dynamicBodies.push_back(e);
+    }
+    bodies.Start();
+    bodies.Step();
+
+    double bodiesMs = 0.0;
+    for (int step = 0; step < STEPS; ++step)
+    {
+        for (int i = 0; i < COUNT; ++i)
+            bodies.cs.GetComponent<PhysicsBodyComponent>(dynamicBodies[i]).velocity.x = ((step / 20 + i) % 2 == 0) ? 120.0f : -120.0f;
+        bodies.Step();
+        bodiesMs += bodies.physics.GetStatistics().updateTime;
+    }
+
+    std::cout << "[CharacterControllerPerformanceTest] " << COUNT << " characters: " << crowdMs / STEPS << " ms/step, "
+              << COUNT << " dynamic bodies: " << bodiesMs / STEPS << " ms/step\n";
+    EXPECT_LT(crowdMs, bodiesMs);
+    LOG_FUNC_EXIT();
+}
@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/components/TransformComponent.h"
+#include "nyon/ecs/components/PhysicsBodyComponent.h"
+#include <atomic>
+
+using namespace Nyon::ECS;
+
+/**
+ * @brief Unit tests for ComponentStore dense storage.
+ *
+ * Tests cover:
+ * - Adding, querying and removing components
+ * - Dense pool reordering
+ * - Chunked and parallel iteration
+ * - Debug check against structural changes during parallel iteration
+ */
+
+// ============================================================================
+// BASIC STORAGE TESTS
+// ============================================================================
+
+TEST(ComponentStoreTest, AddGetRemove)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    EntityID a = entities.CreateEntity();
+    EntityID b = entities.CreateEntity();
+
+    TransformComponent ta;
+    ta.position = { 1.0f, 2.0f };
+    cs.AddComponent(a, std::move(ta));
+    TransformComponent tb;
+    tb.position = { 3.0f, 4.0f };
+    cs.AddComponent(b, std::move(tb));
+
+    EXPECT_EQ(cs.GetComponentCount<TransformComponent>(), 2u);
+    EXPECT_VECTOR2_NEAR(cs.GetComponent<TransformComponent>(a).position, Nyon::Math::Vector2(1.0f, 2.0f), 1e-5f);
+
+    cs.RemoveComponent<TransformComponent>(a);
+    EXPECT_FALSE(cs.HasComponent<TransformComponent>(a));
+    EXPECT_TRUE(cs.HasComponent<TransformComponent>(b));
+    EXPECT_VECTOR2_NEAR(cs.GetComponent<TransformComponent>(b).position, Nyon::Math::Vector2(3.0f, 4.0f), 1e-5f);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// REORDER TESTS
+// ============================================================================
+
+TEST(ComponentStoreTest, ReorderComponentsMovesListedEntitiesFirst)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    std::vector<EntityID> ids;
+    for (int i = 0; i < 5; ++i)
+    {
+        EntityID e = entities.CreateEntity();
+        TransformComponent t;
+        t.position = { static_cast<float>(i), 0.0f };
+        cs.AddComponent(e, std::move(t));
+        ids.push_back(e);
+    }
+
+    // Unknown IDs and duplicates are ignored
+    cs.ReorderComponents<TransformComponent>({ ids[4], ids[2], ids[4], 999u });
+
+    const auto& order = cs.GetEntitiesWithComponent<TransformComponent>();
+    ASSERT_EQ(order.size(), 5u);
+    EXPECT_EQ(order[0], ids[4]);
+    EXPECT_EQ(order[1], ids[2]);
+    EXPECT_EQ(order[2], ids[0]);
+    EXPECT_EQ(order[3], ids[1]);
+    EXPECT_EQ(order[4], ids[3]);
+
+    // Lookups still resolve to the right component
+    for (int i = 0; i < 5; ++i)
+        EXPECT_FLOAT_NEAR(cs.GetComponent<TransformComponent>(ids[i]).position.x, static_cast<float>(i), 1e-5f);
+
+    // Iteration follows the new dense order
+    std::vector<EntityID> visited;
+    cs.ForEachComponent<TransformComponent>([&](EntityID e, TransformComponent&) { visited.push_back(e); });
+    EXPECT_EQ(visited, order);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PARALLEL ITERATION TESTS
+// ============================================================================
+
+TEST(ComponentStoreTest, GetChunksCoverPoolInOrder)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        TransformComponent t;
+        t.position = { static_cast<float>(i), 0.0f };
+        cs.AddComponent(entities.CreateEntity(), std::move(t));
+    }
+
+    auto chunks = cs.GetChunks<TransformComponent>(128);
+    ASSERT_EQ(chunks.size(), 8u);
+
+    size_t expectedOffset = 0;
+    for (const auto& chunk : chunks)
+    {
+        EXPECT_EQ(chunk.offset, expectedOffset);
+        for (size_t i = 0; i < chunk.size(); ++i)
+            EXPECT_FLOAT_NEAR(chunk[i].position.x, static_cast<float>(chunk.offset + i), 1e-5f);
+        expectedOffset += chunk.size();
+    }
+    EXPECT_EQ(expectedOffset, 1000u);
+    EXPECT_TRUE(cs.GetChunks<PhysicsBodyComponent>().empty());
+    LOG_FUNC_EXIT();
+}
+
+TEST(ComponentStoreTest, ForEachChunkVisitsEveryComponentOnce)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    for (int i = 0; i < 5000; ++i)
+        cs.AddComponent(entities.CreateEntity(), TransformComponent{});
+
+    std::atomic<size_t> visited{0};
+    cs.ForEachChunk<TransformComponent>([&](ComponentChunk<TransformComponent>& chunk) {
+        for (size_t i = 0; i < chunk.size(); ++i)
+            chunk[i].rotation += 1.0f;
+        visited += chunk.size();
+    }, 100);
+
+    EXPECT_EQ(visited.load(), 5000u);
+    cs.ForEachComponent<TransformComponent>([](EntityID, const TransformComponent& t) {
+        EXPECT_FLOAT_NEAR(t.rotation, 1.0f, 1e-5f);
+    });
+    LOG_FUNC_EXIT();
+}
+
+TEST(ComponentStoreTest, ParallelForEachRequiresAllComponents)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    // Every third entity also has a physics body
+    for (int i = 0; i < 3000; ++i)
+    {
+        EntityID e = entities.CreateEntity();
+        cs.AddComponent(e, TransformComponent{});
+        if (i % 3 == 0)
+        {
+            PhysicsBodyComponent body;
+            body.velocity = { 2.0f, 0.0f };
+            cs.AddComponent(e, std::move(body));
+        }
+    }
+
+    std::atomic<size_t> singleVisits{0};
+    cs.ParallelForEach<TransformComponent>([&](EntityID, TransformComponent&) {
+        singleVisits++;
+    });
+    EXPECT_EQ(singleVisits.load(), 3000u);
+
+    std::atomic<size_t> pairVisits{0};
+    cs.ParallelForEach<TransformComponent, PhysicsBodyComponent>([&](EntityID, TransformComponent& t, PhysicsBodyComponent& body) {
+        t.position += body.velocity;
+        pairVisits++;
+    }, 64);
+    EXPECT_EQ(pairVisits.load(), 1000u);
+
+    cs.ForEachComponent<PhysicsBodyComponent>([&](EntityID e, const PhysicsBodyComponent&) {
+        EXPECT_FLOAT_NEAR(cs.GetComponent<TransformComponent>(e).position.x, 2.0f, 1e-5f);
+    });
+    LOG_FUNC_EXIT();
+}
+
+TEST(ComponentStoreTest, StructuralChangesDuringParallelIterationAssert)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+    EntityID first = entities.CreateEntity();
+    cs.AddComponent(first, TransformComponent{});
+    cs.AddComponent(first, PhysicsBodyComponent{});
+
+#ifndef NDEBUG
+    // Both the iterated pool and the other required pools are guarded
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    auto addToIterated = [&]() {
+        cs.ParallelForEach<TransformComponent>([&](EntityID, TransformComponent&) {
+            cs.AddComponent(entities.CreateEntity(), TransformComponent{});
+        });
+    };
+    auto removeFromOther = [&]() {
+        cs.ParallelForEach<TransformComponent, PhysicsBodyComponent>([&](EntityID e, TransformComponent&, PhysicsBodyComponent&) {
+            cs.RemoveComponent<PhysicsBodyComponent>(e);
+        });
+    };
+    EXPECT_DEATH(addToIterated(), "parallel iteration");
+    EXPECT_DEATH(removeFromOther(), "parallel iteration");
+#endif
+
+    // The guards are released once the iteration returns
+    cs.ParallelForEach<TransformComponent, PhysicsBodyComponent>([](EntityID, TransformComponent&, PhysicsBodyComponent&) {});
+    cs.AddComponent(entities.CreateEntity(), TransformComponent{});
+    cs.RemoveComponent<PhysicsBodyComponent>(first);
+    EXPECT_EQ(cs.GetComponentCount<TransformComponent>(), 2u);
+    EXPECT_FALSE(cs.HasComponent<PhysicsBodyComponent>(first));
+    LOG_FUNC_EXIT();
+}
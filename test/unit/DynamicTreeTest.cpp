@@ -0,0 +1,270 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "nyon/physics/DynamicTree.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Nyon;
+
+/**
+ * @brief Unit tests for DynamicTree traversal.
+ *
+ * Tests cover:
+ * - Query(): depth-first leaf order and early termination
+ * - QueryBatch(): per-query results identical to separate Query() calls
+ * - RayCast(): closest-hit clipping with nearest-child-first traversal
+ * - RayCastBatch(): per-ray results identical to separate RayCast() calls
+ * - Cost of batched vs. separate queries over a populated tree
+ */
+
+namespace
+{
+    // A grid of 10x10 boxes, 20 apart, as proxies with userData = index
+    void FillGrid(Physics::DynamicTree& tree, int side = 10, float spacing = 20.0f)
+    {
+        for (int i = 0; i < side * side; ++i)
+        {
+            Math::Vector2 lower{ (i % side) * spacing, (i / side) * spacing };
+            tree.CreateProxy(Physics::AABB(lower, { lower.x + 5.0f, lower.y + 5.0f }), static_cast<uint32_t>(i));
+        }
+    }
+
+    struct QueryHits
+    {
+        std::vector<uint32_t> userData;
+        size_t limit = ~size_t(0);
+        bool QueryCallback(uint32_t, uint32_t data)
+        {
+            userData.push_back(data);
+            return userData.size() < limit;
+        }
+    };
+
+    struct BatchHits
+    {
+        std::vector<std::vector<uint32_t>> perQuery;
+        bool QueryCallback(size_t query, uint32_t, uint32_t data)
+        {
+            perQuery[query].push_back(data);
+            return true;
+        }
+    };
+
+    // Closest hit against the fat AABBs themselves
+    struct ClosestHit
+    {
+        uint32_t userData = 0xFFFFFFFF;
+        float fraction = 1.0f;
+        int calls = 0;
+        float RayCastCallback(float hitFraction, uint32_t, uint32_t data)
+        {
+            ++calls;
+            if (hitFraction < fraction)
+            {
+                fraction = hitFraction;
+                userData = data;
+            }
+            return hitFraction;
+        }
+    };
+
+    struct BatchClosestHits
+    {
+        std::vector<ClosestHit> rays;
+        float RayCastCallback(size_t ray, float hitFraction, uint32_t nodeId, uint32_t data)
+        {
+            return rays[ray].RayCastCallback(hitFraction, nodeId, data);
+        }
+    };
+}
+
+// ============================================================================
+// QUERY TESTS
+// ============================================================================
+
+TEST(DynamicTreeTest, QueryStopsWhenTheCallbackSaysSo)
+{
+    LOG_FUNC_ENTER();
+    Physics::DynamicTree tree;
+    FillGrid(tree);
+
+    QueryHits all;
+    tree.Query(Physics::AABB({ -1.0f, -1.0f }, { 1000.0f, 1000.0f }), &all);
+    EXPECT_EQ(all.userData.size(), 100u);
+
+    QueryHits three;
+    three.limit = 3;
+    tree.Query(Physics::AABB({ -1.0f, -1.0f }, { 1000.0f, 1000.0f }), &three);
+    ASSERT_EQ(three.userData.size(), 3u);
+    EXPECT_TRUE(std::equal(three.userData.begin(), three.userData.end(), all.userData.begin()));
+    LOG_FUNC_EXIT();
+}
+
+TEST(DynamicTreeTest, QueryBatchMatchesSeparateQueries)
+{
+    LOG_FUNC_ENTER();
+    Physics::DynamicTree tree;
+    FillGrid(tree);
+
+    // More boxes than one packet, some overlapping nothing
+    std::vector<Physics::AABB> boxes;
+    for (int i = 0; i < 150; ++i)
+    {
+        Math::Vector2 lower{ (i % 15) * 15.0f - 10.0f, (i / 15) * 22.0f - 10.0f };
+        boxes.push_back(Physics::AABB(lower, { lower.x + 12.0f + (i % 4) * 10.0f, lower.y + 12.0f }));
+    }
+
+    BatchHits batch;
+    batch.perQuery.resize(boxes.size());
+    tree.QueryBatch(boxes.data(), boxes.size(), &batch);
+    size_t total = 0;
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        QueryHits single;
+        tree.Query(boxes[i], &single);
+        EXPECT_EQ(batch.perQuery[i], single.userData) << "query " << i;
+        total += single.userData.size();
+    }
+    EXPECT_GT(total, 0u);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// RAY CAST TESTS
+// ============================================================================
+
+TEST(DynamicTreeTest, ClosestHitRayCastClipsEarly)
+{
+    LOG_FUNC_ENTER();
+    Physics::DynamicTree tree;
+    FillGrid(tree);
+
+    // Along the row y = 42.5 from the right: the first box met is column 9
+    ClosestHit closest;
+    tree.RayCast({ 400.0f, 42.5f }, { -400.0f, 0.0f }, 1.0f, &closest);
+    EXPECT_EQ(closest.userData, 29u);
+    EXPECT_LT(closest.calls, 10);
+
+    // A negative result keeps the ray: every box of the row is reported
+    struct AllHits
+    {
+        std::vector<uint32_t> userData;
+        float RayCastCallback(float, uint32_t, uint32_t data)
+        {
+            userData.push_back(data);
+            return -1.0f;
+        }
+    } all;
+    tree.RayCast({ 400.0f, 42.5f }, { -400.0f, 0.0f }, 1.0f, &all);
+    std::sort(all.userData.begin(), all.userData.end());
+    std::vector<uint32_t> row{ 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 };
+    EXPECT_EQ(all.userData, row);
+
+    // Zero stops the cast at the first report
+    struct FirstHit
+    {
+        int calls = 0;
+        float RayCastCallback(float, uint32_t, uint32_t) { ++calls; return 0.0f; }
+    } first;
+    tree.RayCast({ 400.0f, 42.5f }, { -400.0f, 0.0f }, 1.0f, &first);
+    EXPECT_EQ(first.calls, 1);
+    LOG_FUNC_EXIT();
+}
+
+TEST(DynamicTreeTest, RayCastBatchMatchesSeparateCasts)
+{
+    LOG_FUNC_ENTER();
+    Physics::DynamicTree tree;
+    FillGrid(tree);
+
+    std::vector<Physics::DynamicTree::RayCastInput> rays;
+    for (int i = 0; i < 100; ++i)
+    {
+        float angle = i * 0.07f;
+        Physics::DynamicTree::RayCastInput ray;
+        ray.origin = { 95.0f + (i % 5), 95.0f - (i % 3) };
+        ray.direction = { std::cos(angle) * 300.0f, std::sin(angle) * 300.0f };
+        ray.maxFraction = (i % 7 == 0) ? 0.1f : 1.0f;
+        rays.push_back(ray);
+    }
+
+    BatchClosestHits batch;
+    batch.rays.resize(rays.size());
+    tree.RayCastBatch(rays.data(), rays.size(), &batch);
+    for (size_t i = 0; i < rays.size(); ++i)
+    {
+        // Rays starting inside several fat AABBs tie at 0, so compare the fractions
+        ClosestHit single;
+        tree.RayCast(rays[i].origin, rays[i].direction, rays[i].maxFraction, &single);
+        EXPECT_EQ(batch.rays[i].fraction, single.fraction) << "ray " << i;
+        EXPECT_EQ(batch.rays[i].userData == 0xFFFFFFFF, single.userData == 0xFFFFFFFF) << "ray " << i;
+    }
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PERFORMANCE TESTS
+// ============================================================================
+
+TEST(DynamicTreePerformanceTest, BatchedQueriesOverPopulatedTree)
+{
+    LOG_FUNC_ENTER();
+    constexpr int SIDE = 200;
+    Physics::DynamicTree tree;
+    FillGrid(tree, SIDE, 12.0f);
+
+    // One query per proxy in grid order, as the broad phase does for spatially sorted bodies
+    std::vector<Physics::AABB> boxes;
+    for (int i = 0; i < SIDE * SIDE; ++i)
+    {
+        Math::Vector2 lower{ (i % SIDE) * 12.0f - 4.0f, (i / SIDE) * 12.0f - 4.0f };
+        boxes.push_back(Physics::AABB(lower, { lower.x + 13.0f, lower.y + 13.0f }));
+    }
+
+    struct Counter
+    {
+        size_t hits = 0;
+        bool QueryCallback(uint32_t, uint32_t) { ++hits; return true; }
+        bool QueryCallback(size_t, uint32_t, uint32_t) { ++hits; return true; }
+    };
+
+    Counter separate;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (const Physics::AABB& box : boxes)
+        tree.Query(box, &separate);
+    double separateMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+    Counter batched;
+    start = std::chrono::high_resolution_clock::now();
+    tree.QueryBatch(boxes.data(), boxes.size(), &batched);
+    double batchedMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    EXPECT_EQ(batched.hits, separate.hits);
+
+    // Closest-hit rays across the grid
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> coordinate(0.0f, SIDE * 12.0f);
+    std::vector<Physics::DynamicTree::RayCastInput> rays(4096);
+    for (auto& ray : rays)
+    {
+        ray.origin = { coordinate(rng), coordinate(rng) };
+        ray.direction = { coordinate(rng) - ray.origin.x, coordinate(rng) - ray.origin.y };
+    }
+    start = std::chrono::high_resolution_clock::now();
+    int calls = 0;
+    for (const auto& ray : rays)
+    {
+        ClosestHit closest;
+        tree.RayCast(ray.origin, ray.direction, ray.maxFraction, &closest);
+        calls += closest.calls;
+    }
+    double rayMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+    std::cout << "[DynamicTreePerformanceTest] " << boxes.size() << " queries: " << separateMs << " ms separate, " << batchedMs
+              << " ms batched; " << rays.size() << " closest-hit rays: " << rayMs << " ms, "
+              << static_cast<double>(calls) / rays.size() << " leaf reports per ray\n";
+    LOG_FUNC_EXIT();
+}
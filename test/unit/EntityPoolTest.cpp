@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "nyon/ecs/EntityPool.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/components/RenderComponent.h"
+#include "nyon/ecs/systems/PhysicsPipelineSystem.h"
+#include "nyon/physics/DynamicTree.h"
+#include <algorithm>
+#include <sstream>
+
+using namespace Nyon;
+using namespace Nyon::ECS;
+
+/**
+ * @brief Unit tests for entity recycling pools.
+ *
+ * Tests cover:
+ * - Hit/miss accounting and reuse of released entities
+ * - Disabled bodies leaving the physics pipeline and coming back on reuse
+ * - Parking and re-inserting DynamicTree proxies
+ */
+
+namespace
+{
+    struct TreeHits
+    {
+        std::vector<uint32_t> userData;
+        bool QueryCallback(uint32_t, uint32_t data)
+        {
+            userData.push_back(data);
+            return true;
+        }
+    };
+
+    EntityPool::Factory CircleFactory(ComponentStore& cs)
+    {
+        return [&cs](EntityID entity) {
+            TransformComponent t;
+            ColliderComponent::CircleShape circle;
+            circle.radius = 10.0f;
+
+            PhysicsBodyComponent body;
+            body.SetMass(1.0f);
+            body.allowSleep = false;
+
+            cs.AddComponent(entity, std::move(t));
+            cs.AddComponent(entity, std::move(body));
+            cs.AddComponent(entity, ColliderComponent(circle));
+            cs.AddComponent(entity, RenderComponent({ 20.0f, 20.0f }));
+        };
+    }
+
+    void PlaceAt(ComponentStore& cs, EntityID entity, Math::Vector2 position)
+    {
+        auto& t = cs.GetComponent<TransformComponent>(entity);
+        t.position = position;
+        t.previousPosition = position;
+    }
+}
+
+// ============================================================================
+// POOL ACCOUNTING TESTS
+// ============================================================================
+
+TEST(EntityPoolTest, AcquireRecyclesReleasedEntities)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+    EntityPool pool(entities, cs, "circles");
+    auto factory = CircleFactory(cs);
+
+    EntityID a = pool.Acquire(factory);
+    EntityID b = pool.Acquire(factory);
+    EXPECT_EQ(pool.GetStats().misses, 2u);
+    EXPECT_EQ(pool.GetStats().hits, 0u);
+
+    pool.Release(a);
+    pool.Release(a);  // Second release is ignored
+    EXPECT_TRUE(pool.IsPooled(a));
+    EXPECT_EQ(pool.GetStats().releases, 1u);
+    EXPECT_FALSE(cs.GetComponent<PhysicsBodyComponent>(a).isEnabled);
+    EXPECT_FALSE(cs.GetComponent<RenderComponent>(a).visible);
+
+    EntityID c = pool.Acquire(factory);
+    EXPECT_EQ(c, a);
+    EXPECT_NE(c, b);
+    EXPECT_FALSE(pool.IsPooled(c));
+    EXPECT_TRUE(cs.GetComponent<PhysicsBodyComponent>(c).isEnabled);
+    EXPECT_TRUE(cs.GetComponent<RenderComponent>(c).visible);
+    EXPECT_EQ(pool.GetStats().hits, 1u);
+    EXPECT_EQ(entities.GetActiveEntityCount(), 2u);
+
+    pool.Prewarm(3, factory);
+    EXPECT_EQ(pool.GetStats().available, 3u);
+    pool.Clear();
+    EXPECT_EQ(pool.GetStats().available, 0u);
+    EXPECT_EQ(entities.GetActiveEntityCount(), 2u);
+
+    std::ostringstream report;
+    pool.Report(report);
+    EXPECT_NE(report.str().find("circles: 1 hits, 2 misses"), std::string::npos);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PIPELINE INTEGRATION TESTS
+// ============================================================================
+
+TEST(EntityPoolTest, ReleasedBodiesLeaveThePipeline)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    EntityID worldEntity = entities.CreateEntity();
+    PhysicsWorldComponent world;
+    world.gravity = { 0.0f, 0.0f };
+    cs.AddComponent(worldEntity, std::move(world));
+
+    EntityPool pool(entities, cs, "circles");
+    auto factory = CircleFactory(cs);
+    EntityID a = pool.Acquire(factory);
+    EntityID b = pool.Acquire(factory);
+    PlaceAt(cs, a, { 0.0f, 0.0f });
+    PlaceAt(cs, b, { 15.0f, 0.0f });
+
+    PhysicsPipelineSystem physics;
+    physics.Initialize(entities, cs);
+    physics.Update(FIXED_TIMESTEP);
+    EXPECT_GT(physics.GetStatistics().broadPhasePairs, 0u);
+
+    // A released body neither collides nor integrates
+    pool.Release(b);
+    float releasedX = cs.GetComponent<TransformComponent>(b).position.x;
+    cs.GetComponent<PhysicsBodyComponent>(b).velocity = { 100.0f, 0.0f };
+    physics.Update(FIXED_TIMESTEP);
+    EXPECT_EQ(physics.GetStatistics().broadPhasePairs, 0u);
+    EXPECT_FLOAT_EQ(cs.GetComponent<TransformComponent>(b).position.x, releasedX);
+
+    // Reacquired, it overlaps again at its new spawn point
+    EXPECT_EQ(pool.Acquire(factory), b);
+    PlaceAt(cs, b, { 5.0f, 5.0f });
+    physics.Update(FIXED_TIMESTEP);
+    EXPECT_GT(physics.GetStatistics().broadPhasePairs, 0u);
+    LOG_FUNC_EXIT();
+}
+
+TEST(EntityPoolTest, DisabledTreeProxiesAreParked)
+{
+    LOG_FUNC_ENTER();
+    Physics::DynamicTree tree;
+    std::vector<uint32_t> proxies;
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        Physics::AABB box{ { i * 30.0f, 0.0f }, { i * 30.0f + 10.0f, 10.0f } };
+        proxies.push_back(tree.CreateProxy(box, i));
+    }
+    int nodesBefore = tree.GetNodeCount();
+
+    tree.DisableProxy(proxies[3]);
+    EXPECT_FALSE(tree.IsProxyEnabled(proxies[3]));
+    EXPECT_EQ(tree.GetProxyCount(), 8);
+
+    Physics::AABB everything{ { -100.0f, -100.0f }, { 1000.0f, 100.0f } };
+    TreeHits hits;
+    tree.Query(everything, &hits);
+    EXPECT_EQ(hits.userData.size(), 7u);
+    EXPECT_EQ(std::count(hits.userData.begin(), hits.userData.end(), 3u), 0);
+
+    tree.Rebuild();
+    tree.EnableProxy(proxies[3], Physics::AABB{ { 500.0f, 0.0f }, { 510.0f, 10.0f } });
+    tree.Validate();
+    EXPECT_EQ(tree.GetNodeCount(), nodesBefore);
+
+    TreeHits moved;
+    tree.Query(Physics::AABB{ { 495.0f, 0.0f }, { 515.0f, 10.0f } }, &moved);
+    ASSERT_EQ(moved.userData.size(), 1u);
+    EXPECT_EQ(moved.userData[0], 3u);
+
+    tree.DestroyProxy(proxies[5]);
+    tree.DisableProxy(proxies[6]);
+    tree.DestroyProxy(proxies[6]);
+    EXPECT_EQ(tree.GetProxyCount(), 6);
+    tree.Validate();
+    LOG_FUNC_EXIT();
+}
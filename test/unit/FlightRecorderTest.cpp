@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "nyon/utils/FlightRecorder.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+using namespace Nyon::Utils;
+
+/**
+ * @brief Unit tests for the frame spike flight recorder.
+ *
+ * Tests cover:
+ * - Ring buffer wrap-around keeping the newest frames
+ * - Spike detection, post-spike frames and the dump limit
+ * - Dump file round trip with snapshots and the offline report
+ * - Rejecting foreign, truncated and corrupt dump files
+ */
+
+namespace
+{
+    FlightRecorder::FrameRecord MakeFrame(uint64_t frame, double frameMs)
+    {
+        FlightRecorder::FrameRecord record;
+        record.frame = frame;
+        record.time = frame / 60.0;
+        record.timing.frameMs = frameMs;
+        record.physics.updateMs = static_cast<float>(frameMs * 0.5);
+        record.physics.pairs = 10;
+        return record;
+    }
+
+    std::string TempDirectory()
+    {
+        const char* dir = std::getenv("TMPDIR");
+        return dir != nullptr ? dir : "/tmp";
+    }
+}
+
+// ============================================================================
+// RING BUFFER TESTS
+// ============================================================================
+
+TEST(FlightRecorderTest, RingKeepsNewestFrames)
+{
+    LOG_FUNC_ENTER();
+    FlightRecorder recorder;
+    FlightRecorder::Config config;
+    config.capacityFrames = 8;
+    config.spikeThresholdMs = 0.0;
+    recorder.SetConfig(config);
+
+    for (uint64_t i = 0; i < 20; ++i)
+        recorder.Record(MakeFrame(i, 16.0));
+
+    FlightRecorder::Dump dump = recorder.Capture(19);
+    ASSERT_EQ(dump.frames.size(), 8u);
+    EXPECT_EQ(dump.frames.front().frame, 12u);
+    EXPECT_EQ(dump.frames.back().frame, 19u);
+    EXPECT_EQ(recorder.GetDumpCount(), 0u);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// SPIKE DUMP TESTS
+// ============================================================================
+
+TEST(FlightRecorderTest, SpikeWritesDumpAfterPostSpikeFrames)
+{
+    LOG_FUNC_ENTER();
+    FlightRecorder recorder;
+    FlightRecorder::Config config;
+    config.capacityFrames = 64;
+    config.spikeThresholdMs = 30.0;
+    config.postSpikeFrames = 4;
+    config.warmupFrames = 2;
+    config.snapshotInterval = 10;
+    config.maxDumps = 1;
+    config.directory = TempDirectory();
+    recorder.SetConfig(config);
+
+    auto recordFrame = [&recorder](uint64_t frame, double frameMs) {
+        if (recorder.WantsSnapshot(frame))
+        {
+            auto& snapshot = recorder.BeginSnapshot(frame, 2);
+            FlightRecorder::BodyState body;
+            body.entityId = 7;
+            body.flags = FlightRecorder::FLAG_AWAKE;
+            body.vx = 300.0f;
+            snapshot.bodies.push_back(body);
+            body.entityId = 8;
+            body.flags = FlightRecorder::FLAG_STATIC;
+            body.vx = 0.0f;
+            snapshot.bodies.push_back(body);
+        }
+        recorder.Record(MakeFrame(frame, frameMs));
+    };
+
+    // Slow startup frames are not spikes
+    recordFrame(0, 200.0);
+    recordFrame(1, 200.0);
+    for (uint64_t i = 2; i < 25; ++i)
+        recordFrame(i, 16.0);
+    EXPECT_EQ(recorder.GetDumpCount(), 0u);
+
+    recordFrame(25, 90.0);
+    EXPECT_TRUE(recorder.WantsSnapshot(26));  // State right after the spike
+    for (uint64_t i = 26; i < 29; ++i)
+        recordFrame(i, 16.0);
+    EXPECT_EQ(recorder.GetDumpCount(), 0u);
+    recordFrame(29, 16.0);
+    ASSERT_EQ(recorder.GetDumpCount(), 1u);
+
+    // The dump limit stops further files
+    recordFrame(30, 120.0);
+    recorder.Flush();
+    EXPECT_EQ(recorder.GetDumpCount(), 1u);
+
+    FlightRecorder::Dump dump;
+    ASSERT_TRUE(FlightRecorder::ReadDump(recorder.GetLastDumpPath(), dump));
+    std::remove(recorder.GetLastDumpPath().c_str());
+    EXPECT_EQ(dump.spikeFrame, 25u);
+    EXPECT_DOUBLE_EQ(dump.thresholdMs, 30.0);
+    ASSERT_EQ(dump.frames.size(), 30u);
+    EXPECT_EQ(dump.frames.back().frame, 29u);
+    EXPECT_DOUBLE_EQ(dump.frames[25].timing.frameMs, 90.0);
+
+    // Interval snapshots at 0, 10, 20 plus the post-spike one at 26
+    ASSERT_EQ(dump.snapshots.size(), 4u);
+    EXPECT_EQ(dump.snapshots.back().frame, 26u);
+    EXPECT_EQ(dump.snapshots.back().bodies.size(), 2u);
+
+    std::ostringstream report;
+    FlightRecorder::PrintReport(dump, report);
+    EXPECT_NE(report.str().find("Spike at frame 25"), std::string::npos);
+    EXPECT_NE(report.str().find("Snapshot at frame 26: 2 bodies (2 kept), 1 awake, fastest entity 7"), std::string::npos);
+    LOG_FUNC_EXIT();
+}
+
+TEST(FlightRecorderTest, ReadDumpRejectsOtherFiles)
+{
+    LOG_FUNC_ENTER();
+    std::string path = TempDirectory() + "/nyon-not-a-dump.nfr";
+    {
+        std::ofstream out(path);
+        out << "frame,frame_ms\n0,16.0\n";
+    }
+    FlightRecorder::Dump dump;
+    EXPECT_FALSE(FlightRecorder::ReadDump(path, dump));
+    EXPECT_FALSE(FlightRecorder::ReadDump(path + ".missing", dump));
+
+    // A valid dump with a snapshot, then truncated or with a corrupt frame count
+    FlightRecorder::Dump original;
+    original.spikeFrame = 1;
+    original.frames = { MakeFrame(0, 16.0), MakeFrame(1, 80.0) };
+    original.snapshots.resize(1);
+    original.snapshots[0].totalBodies = 3;
+    original.snapshots[0].bodies.resize(3);
+    ASSERT_TRUE(FlightRecorder::WriteDump(path, original));
+    ASSERT_TRUE(FlightRecorder::ReadDump(path, dump));
+    std::string bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    auto writeBytes = [&path](const std::string& contents) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    };
+    for (size_t cut : { bytes.size() - 1, bytes.size() - sizeof(FlightRecorder::BodyState) * 3, size_t(40) })
+    {
+        writeBytes(bytes.substr(0, cut));
+        EXPECT_FALSE(FlightRecorder::ReadDump(path, dump)) << "truncated to " << cut << " bytes";
+    }
+
+    // Frame count after magic, version, record sizes, spike frame and threshold
+    std::string corrupt = bytes;
+    uint64_t hugeCount = uint64_t(1) << 60;
+    std::memcpy(&corrupt[8 + 3 * sizeof(uint32_t) + sizeof(uint64_t) + sizeof(double)], &hugeCount, sizeof(hugeCount));
+    writeBytes(corrupt);
+    EXPECT_FALSE(FlightRecorder::ReadDump(path, dump));
+    std::remove(path.c_str());
+    LOG_FUNC_EXIT();
+}
@@ -0,0 +1,277 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "PhysicsTestWorld.h"
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/components/ForceFieldComponent.h"
+#include "nyon/ecs/systems/PhysicsPipelineSystem.h"
+#include "nyon/ecs/systems/ParticlePipelineSystem.h"
+#include "nyon/physics/ForceField.h"
+#include <cmath>
+#include <iostream>
+
+using namespace Nyon;
+using namespace Nyon::ECS;
+using NyonTest::PhysicsTestWorld;
+
+/**
+ * @brief Unit tests for force fields applied by the physics pipeline.
+ *
+ * Tests cover:
+ * - Radial, directional and vortex directions, volumes and falloff
+ * - Collider category masks, mass-independent vs. force fields, timed fields
+ * - Waking sleeping bodies inside a field
+ * - Particles pushed by the particle system, and affectsParticles
+ * - Cost of an explosion field over a crowded scene
+ */
+
+namespace
+{
+    EntityID AddField(PhysicsTestWorld& world, const ForceFieldComponent& field, const Math::Vector2& position)
+    {
+        EntityID e = world.entities.CreateEntity();
+        world.cs.AddComponent(e, TransformComponent(position));
+        world.cs.AddComponent(e, ForceFieldComponent(field));
+        return e;
+    }
+
+    const Math::Vector2& Velocity(PhysicsTestWorld& world, EntityID e) { return world.cs.GetComponent<PhysicsBodyComponent>(e).velocity; }
+}
+
+// ============================================================================
+// FIELD SHAPE TESTS
+// ============================================================================
+
+TEST(ForceFieldTest, RadialFieldPushesAwayFromItsCenter)
+{
+    LOG_FUNC_ENTER();
+    PhysicsTestWorld world({ 0.0f, 0.0f });
+    EntityID left = world.AddCircle({ -50.0f, 0.0f });
+    EntityID right = world.AddCircle({ 50.0f, 0.0f });
+    EntityID above = world.AddCircle({ 0.0f, 80.0f });
+    EntityID outside = world.AddCircle({ 300.0f, 0.0f });
+
+    ForceFieldComponent blast;
+    blast.radius = 100.0f;
+    blast.strength = 600.0f;
+    blast.falloff = ForceFieldComponent::Falloff::Linear;
+    AddField(world, blast, { 0.0f, 0.0f });
+    world.Start();
+    world.Step();
+
+    // Acceleration strength * (1 - distance / radius), independent of mass
+    EXPECT_NEAR(Velocity(world, left).x, -300.0f * FIXED_TIMESTEP, 1e-2f);
+    EXPECT_NEAR(Velocity(world, right).x, 300.0f * FIXED_TIMESTEP, 1e-2f);
+    EXPECT_NEAR(Velocity(world, left).y, 0.0f, 1e-4f);
+    EXPECT_NEAR(Velocity(world, above).y, 120.0f * FIXED_TIMESTEP, 1e-2f);
+    EXPECT_EQ(Velocity(world, outside).x, 0.0f);
+    EXPECT_EQ(world.physics.GetStatistics().forceFields, 1u);
+    EXPECT_EQ(world.physics.GetStatistics().forceFieldBodies, 3u);
+    LOG_FUNC_EXIT();
+}
+
+TEST(ForceFieldTest, DirectionalBoxAndVortexFields)
+{
+    LOG_FUNC_ENTER();
+    PhysicsTestWorld world({ 0.0f, 0.0f });
+    EntityID inWind = world.AddCircle({ 90.0f, 10.0f });
+    EntityID pastWind = world.AddCircle({ 90.0f, 60.0f });
+    EntityID orbiting = world.AddCircle({ 1000.0f, 0.0f });
+
+    ForceFieldComponent wind;
+    wind.type = ForceFieldComponent::Type::Directional;
+    wind.volume = ForceFieldComponent::Volume::Box;
+    wind.halfExtents = { 100.0f, 20.0f };
+    wind.falloff = ForceFieldComponent::Falloff::None;
+    wind.direction = { 0.0f, -2.0f };
+    wind.strength = 300.0f;
+    AddField(world, wind, { 0.0f, 0.0f });
+
+    ForceFieldComponent vortex;
+    vortex.type = ForceFieldComponent::Type::Vortex;
+    vortex.falloff = ForceFieldComponent::Falloff::None;
+    vortex.radius = 200.0f;
+    vortex.strength = 400.0f;
+    vortex.offset = { -50.0f, 0.0f };
+    AddField(world, vortex, { 1000.0f, 0.0f });
+
+    world.Start();
+    world.Step();
+
+    EXPECT_NEAR(Velocity(world, inWind).x, 0.0f, 1e-4f);
+    EXPECT_NEAR(Velocity(world, inWind).y, -300.0f * FIXED_TIMESTEP, 1e-2f);
+    EXPECT_EQ(Velocity(world, pastWind).y, 0.0f);
+
+    // Counter-clockwise around (950, 0): a body on the +x side is pushed up
+    EXPECT_NEAR(Velocity(world, orbiting).x, 0.0f, 1e-4f);
+    EXPECT_NEAR(Velocity(world, orbiting).y, 400.0f * FIXED_TIMESTEP, 1e-2f);
+
+    // The batch kernel on its own: quadratic falloff halfway out is a quarter strength
+    ForceFieldComponent component;
+    component.falloff = ForceFieldComponent::Falloff::Quadratic;
+    component.strength = 100.0f;
+    component.radius = 10.0f;
+    Physics::ForceField field = Physics::ForceField::FromComponent(component, { 0.0f, 0.0f });
+    Physics::ForceField::Batch batch;
+    batch.Push({ 5.0f, 0.0f }, 2.0f);
+    batch.Push({ 0.0f, 0.0f }, 2.0f);
+    batch.Push({ 11.0f, 0.0f }, 2.0f);
+    field.Accumulate(batch, 0, batch.Size());
+    EXPECT_NEAR(batch.forceX[0], 100.0f * 0.25f * 2.0f, 1e-3f);
+    EXPECT_EQ(batch.forceX[1], 0.0f);
+    EXPECT_EQ(batch.forceY[1], 0.0f);
+    EXPECT_EQ(batch.forceX[2], 0.0f);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// FILTERING AND LIFETIME TESTS
+// ============================================================================
+
+TEST(ForceFieldTest, MasksForceModeAndDuration)
+{
+    LOG_FUNC_ENTER();
+    PhysicsTestWorld world({ 0.0f, 0.0f });
+    EntityID light = world.AddCircle({ 20.0f, 0.0f }, 5.0f, 1.0f);
+    EntityID heavy = world.AddCircle({ 0.0f, 20.0f }, 5.0f, 4.0f);
+    EntityID ignored = world.AddCircle({ -20.0f, 0.0f });
+    world.cs.GetComponent<ColliderComponent>(ignored).filter.categoryBits = 0x0004;
+
+    ForceFieldComponent push;
+    push.falloff = ForceFieldComponent::Falloff::None;
+    push.massIndependent = false;
+    push.strength = 5000.0f;
+    push.maskBits = 0x0001;
+    push.duration = 2.5f * FIXED_TIMESTEP;
+    EntityID fieldEntity = AddField(world, push, { 0.0f, 0.0f });
+    world.Start();
+    world.Step();
+
+    // A force: four times the mass, a quarter of the acceleration
+    float lightSpeed = Velocity(world, light).x;
+    float heavySpeed = Velocity(world, heavy).y;
+    EXPECT_GT(lightSpeed, 0.0f);
+    EXPECT_NEAR(heavySpeed, lightSpeed * 0.25f, lightSpeed * 1e-3f);
+    EXPECT_EQ(Velocity(world, ignored).x, 0.0f);
+
+    // Applied for three steps, then disabled
+    world.Step();
+    world.Step();
+    EXPECT_TRUE(world.cs.GetComponent<ForceFieldComponent>(fieldEntity).enabled);
+    world.Step();
+    EXPECT_FALSE(world.cs.GetComponent<ForceFieldComponent>(fieldEntity).enabled);
+    EXPECT_EQ(world.physics.GetStatistics().forceFields, 0u);
+    EXPECT_NEAR(Velocity(world, light).x, lightSpeed * 3.0f, lightSpeed * 1e-2f);
+    LOG_FUNC_EXIT();
+}
+
+TEST(ForceFieldTest, ExplosionWakesSleepingBodies)
+{
+    LOG_FUNC_ENTER();
+    PhysicsTestWorld world;
+    world.AddBody(ColliderComponent(ColliderComponent::PolygonShape(
+        { { -500.0f, -10.0f }, { 500.0f, -10.0f }, { 500.0f, 10.0f }, { -500.0f, 10.0f } })), { 0.0f, -10.0f }, true);
+    EntityID crate = world.AddCircle({ 0.0f, 5.0f });
+
+    world.Start();
+    for (int i = 0; i < 180; ++i)
+        world.Step();
+    ASSERT_FALSE(world.cs.GetComponent<PhysicsBodyComponent>(crate).isAwake);
+    float restY = world.cs.GetComponent<TransformComponent>(crate).position.y;
+
+    ForceFieldComponent blast;
+    blast.radius = 50.0f;
+    blast.strength = 20000.0f;
+    blast.duration = 0.05f;
+    AddField(world, blast, { 0.0f, -20.0f });
+    for (int i = 0; i < 5; ++i)
+        world.Step();
+    EXPECT_TRUE(world.cs.GetComponent<PhysicsBodyComponent>(crate).isAwake);
+    EXPECT_GT(world.cs.GetComponent<TransformComponent>(crate).position.y, restY + 1.0f);
+    LOG_FUNC_EXIT();
+}
+
+TEST(ForceFieldTest, ParticleSystemAppliesFieldsToParticles)
+{
+    LOG_FUNC_ENTER();
+    constexpr int STEPS = 10;
+    auto particleVelocity = [](bool affectsParticles) {
+        PhysicsTestWorld world({ 0.0f, 0.0f });
+        EntityID emitterEntity = world.entities.CreateEntity();
+        world.cs.AddComponent(emitterEntity, TransformComponent({ 0.0f, 0.0f }));
+        ParticleEmitterComponent emitter;
+        emitter.spawnRate = 0.0f;
+        emitter.burstCount = 1;
+        emitter.emissionShape = ParticleEmitterComponent::EmissionShape::Point;
+        emitter.spawnParams.minSpeed = 0.0f;
+        emitter.spawnParams.maxSpeed = 0.0f;
+        emitter.spawnParams.minLifetime = -1.0f;
+        emitter.spawnParams.maxLifetime = -1.0f;
+        emitter.spawnParams.minDrag = 0.0f;
+        emitter.spawnParams.maxDrag = 0.0f;
+        world.cs.AddComponent(emitterEntity, std::move(emitter));
+
+        ForceFieldComponent wind;
+        wind.type = ForceFieldComponent::Type::Directional;
+        wind.volume = ForceFieldComponent::Volume::Box;
+        wind.falloff = ForceFieldComponent::Falloff::None;
+        wind.strength = 500.0f;
+        wind.affectsParticles = affectsParticles;
+        AddField(world, wind, { 0.0f, 0.0f });
+
+        ParticlePipelineSystem particles;
+        particles.Initialize(world.entities, world.cs);
+        world.Start();
+        for (int i = 0; i < STEPS; ++i)
+        {
+            world.Step();
+            particles.Update(FIXED_TIMESTEP);
+        }
+        return Velocity(world, particles.GetActiveParticles().at(0));
+    };
+
+    // Pushed once per step by the particle system; the pipeline leaves particles alone
+    Math::Vector2 pushed = particleVelocity(true);
+    EXPECT_NEAR(pushed.x, 500.0f * STEPS * FIXED_TIMESTEP, 1.0f);
+    EXPECT_FLOAT_EQ(pushed.y, 0.0f);
+    EXPECT_FLOAT_EQ(particleVelocity(false).x, 0.0f);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PERFORMANCE TESTS
+// ============================================================================
+
+TEST(ForceFieldPerformanceTest, ExplosionInCrowdedScene)
+{
+    LOG_FUNC_ENTER();
+    constexpr int BODIES = 4000;
+    PhysicsTestWorld world({ 0.0f, 0.0f });
+    for (int i = 0; i < BODIES; ++i)
+        world.AddCircle({ (i % 80) * 12.0f - 480.0f, (i / 80) * 12.0f - 300.0f }, 4.0f);
+    world.Start();
+    world.Step();
+    float quietMs = world.physics.GetStatistics().updateTime;
+
+    // One blast over most of the crowd, plus wind over all of it
+    ForceFieldComponent blast;
+    blast.radius = 400.0f;
+    blast.strength = 5000.0f;
+    blast.duration = 0.1f;
+    AddField(world, blast, { 0.0f, 0.0f });
+    ForceFieldComponent wind;
+    wind.type = ForceFieldComponent::Type::Directional;
+    wind.volume = ForceFieldComponent::Volume::Box;
+    wind.halfExtents = { 600.0f, 400.0f };
+    AddField(world, wind, { 0.0f, 0.0f });
+    world.Step();
+
+    const auto& stats = world.physics.GetStatistics();
+    EXPECT_EQ(stats.forceFields, 2u);
+    EXPECT_GE(stats.forceFieldBodies, static_cast<size_t>(BODIES));
+    std::cout << "[ForceFieldPerformanceTest] " << stats.forceFieldBodies << " field pushes over " << BODIES << " bodies: "
+              << stats.forceFieldTime << " ms (step " << stats.updateTime << " ms, " << quietMs
+              << " ms before the blast)\n";
+    EXPECT_LT(stats.forceFieldTime, 10.0f);
+    LOG_FUNC_EXIT();
+}
@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "PhysicsTestWorld.h"
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/systems/FractureSystem.h"
+#include "nyon/ecs/systems/PhysicsPipelineSystem.h"
+#include "nyon/ecs/components/RenderComponent.h"
+#include "nyon/physics/FracturePattern.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+using namespace Nyon;
+using namespace Nyon::ECS;
+using NyonTest::PhysicsTestWorld;
+
+/**
+ * @brief Unit tests for precomputed fracture patterns and bulk debris spawning.
+ *
+ * Tests cover:
+ * - Voronoi pieces tiling the source polygon, reproducibly per seed
+ * - Break(): inherited rigid motion, cached mass, batched broad-phase insertion
+ * - Debris returning to its pool after the lifetime and being reused
+ * - Cost of spawning 200 fragments into a populated world
+ */
+
+namespace
+{
+    ColliderComponent::PolygonShape Box(float halfWidth, float halfHeight)
+    {
+        return ColliderComponent::PolygonShape({ { -halfWidth, -halfHeight }, { halfWidth, -halfHeight },
+                                                 { halfWidth, halfHeight }, { -halfWidth, halfHeight } });
+    }
+
+    // Broken bodies pass their RenderComponent on to the pieces
+    EntityID AddRenderedBody(PhysicsTestWorld& world, const ColliderComponent::PolygonShape& shape, const Math::Vector2& position, bool isStatic)
+    {
+        EntityID e = world.AddBody(ColliderComponent(shape), position, isStatic);
+        world.cs.AddComponent(e, RenderComponent({ 10.0f, 10.0f }, { 0.8f, 0.2f, 0.1f }));
+        return e;
+    }
+
+    size_t ProxiesIn(PhysicsTestWorld& world, const Physics::AABB& region)
+    {
+        std::vector<EntityID> found;
+        world.physics.QueryBroadPhase(region, found);
+        return found.size();
+    }
+}
+
+// ============================================================================
+// PATTERN TESTS
+// ============================================================================
+
+TEST(FractureTest, PatternPiecesTileTheSourceShape)
+{
+    LOG_FUNC_ENTER();
+    const auto source = Box(50.0f, 30.0f);
+    Physics::FracturePattern pattern = Physics::FracturePattern::Generate(source, 12, 7);
+    ASSERT_EQ(pattern.GetPieceCount(), 12u);
+
+    float area = 0.0f;
+    for (const auto& piece : pattern.GetPieces())
+    {
+        EXPECT_GE(piece.shape.vertices.size(), 3u);
+        EXPECT_GT(piece.inertiaPerUnitMass, 0.0f);
+        EXPECT_NEAR(piece.shape.centroid.x, 0.0f, 1e-3f);
+        EXPECT_NEAR(piece.shape.centroid.y, 0.0f, 1e-3f);
+
+        // Every piece lies inside the source box
+        EXPECT_GE(piece.offset.x + piece.localBounds.lowerBound.x, -50.001f);
+        EXPECT_LE(piece.offset.x + piece.localBounds.upperBound.x, 50.001f);
+        EXPECT_GE(piece.offset.y + piece.localBounds.lowerBound.y, -30.001f);
+        EXPECT_LE(piece.offset.y + piece.localBounds.upperBound.y, 30.001f);
+        area += piece.area;
+    }
+    EXPECT_NEAR(area, 100.0f * 60.0f, 1.0f);
+
+    // Same seed, same pieces; another seed scatters differently
+    Physics::FracturePattern again = Physics::FracturePattern::Generate(source, 12, 7);
+    Physics::FracturePattern other = Physics::FracturePattern::Generate(source, 12, 8);
+    ASSERT_EQ(again.GetPieceCount(), pattern.GetPieceCount());
+    for (size_t i = 0; i < pattern.GetPieceCount(); ++i)
+    {
+        EXPECT_EQ(again.GetPieces()[i].offset.x, pattern.GetPieces()[i].offset.x);
+        EXPECT_EQ(again.GetPieces()[i].offset.y, pattern.GetPieces()[i].offset.y);
+    }
+    EXPECT_NE(other.GetPieces()[0].offset.x, pattern.GetPieces()[0].offset.x);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// BREAK TESTS
+// ============================================================================
+
+TEST(FractureTest, BreakSpawnsPiecesWithInheritedMotion)
+{
+    LOG_FUNC_ENTER();
+    PhysicsTestWorld world;
+    FractureSystem fracture;
+    AddRenderedBody(world, Box(1000.0f, 10.0f), { 0.0f, -200.0f }, true);
+    EntityID crate = AddRenderedBody(world, Box(20.0f, 20.0f), { 0.0f, 100.0f }, false);
+    world.Start(fracture);
+    world.Step(fracture);
+
+    auto& crateBody = world.cs.GetComponent<PhysicsBodyComponent>(crate);
+    crateBody.velocity = { 50.0f, 0.0f };
+    crateBody.angularVelocity = 2.0f;
+    world.cs.GetComponent<TransformComponent>(crate).rotation = 0.5f;
+    const Math::Vector2 center = world.cs.GetComponent<TransformComponent>(crate).position;
+
+    FractureSystem::PatternID pattern = fracture.CreatePattern(Box(20.0f, 20.0f), 8, 3);
+    ASSERT_NE(pattern, FractureSystem::INVALID_PATTERN);
+
+    std::vector<EntityID> pieces;
+    ASSERT_EQ(fracture.Break(crate, pattern, &pieces), 8u);
+    ASSERT_EQ(pieces.size(), 8u);
+    EXPECT_FALSE(world.cs.GetComponent<PhysicsBodyComponent>(crate).isEnabled);
+
+    float mass = 0.0f;
+    for (EntityID piece : pieces)
+    {
+        const auto& body = world.cs.GetComponent<PhysicsBodyComponent>(piece);
+        const auto& transform = world.cs.GetComponent<TransformComponent>(piece);
+        Math::Vector2 arm = transform.position - center;
+        EXPECT_TRUE(body.massIsExplicit);
+        EXPECT_TRUE(body.inertiaIsExplicit);
+        EXPECT_NEAR(body.velocity.x, 50.0f - 2.0f * arm.y, 1e-3f);
+        EXPECT_NEAR(body.velocity.y, 2.0f * arm.x, 1e-3f);
+        EXPECT_FLOAT_EQ(transform.rotation, 0.5f);
+        EXPECT_NEAR(world.cs.GetComponent<RenderComponent>(piece).color.x, 0.8f, 1e-6f);
+        mass += body.mass;
+    }
+    EXPECT_NEAR(mass, 40.0f * 40.0f, 0.5f);
+
+    // Proxies exist straight after Break(), before the next step
+    EXPECT_EQ(ProxiesIn(world, { { -60.0f, 40.0f }, { 60.0f, 160.0f } }), 8u + 1u);
+
+    // The next step reports the inserted proxies and simulates the pieces
+    world.Step(fracture);
+    EXPECT_GE(world.physics.GetBroadPhaseChanges().size(), 8u);
+    for (int i = 0; i < 30; ++i)
+        world.Step(fracture);
+    for (EntityID piece : pieces)
+        EXPECT_LT(world.cs.GetComponent<TransformComponent>(piece).position.y, 100.0f);
+    LOG_FUNC_EXIT();
+}
+
+TEST(FractureTest, DebrisReturnsToPoolAndIsReused)
+{
+    LOG_FUNC_ENTER();
+    PhysicsTestWorld world;
+    FractureSystem fracture;
+    AddRenderedBody(world, Box(1000.0f, 10.0f), { 0.0f, -200.0f }, true);
+    EntityID first = AddRenderedBody(world, Box(20.0f, 20.0f), { 0.0f, 0.0f }, true);
+    EntityID second = AddRenderedBody(world, Box(20.0f, 20.0f), { 200.0f, 0.0f }, true);
+    world.Start(fracture);
+
+    auto config = fracture.GetConfig();
+    config.debrisLifetime = 0.25f;
+    fracture.SetConfig(config);
+    FractureSystem::PatternID pattern = fracture.CreatePattern(Box(20.0f, 20.0f), 6);
+    world.Step(fracture);
+
+    std::vector<EntityID> firstPieces;
+    fracture.Break(first, pattern, &firstPieces);
+    EXPECT_EQ(fracture.GetStatistics().activeDebris, 6u);
+    for (int i = 0; i < 20; ++i)
+        world.Step(fracture);
+    EXPECT_EQ(fracture.GetStatistics().activeDebris, 0u);
+    for (EntityID piece : firstPieces)
+        EXPECT_FALSE(world.cs.GetComponent<PhysicsBodyComponent>(piece).isEnabled);
+
+    // The second break reuses the same entities, re-linked at their new place
+    size_t entityCount = world.entities.GetActiveEntityCount();
+    std::vector<EntityID> secondPieces;
+    fracture.Break(second, pattern, &secondPieces);
+    EXPECT_EQ(world.entities.GetActiveEntityCount(), entityCount);
+    std::sort(firstPieces.begin(), firstPieces.end());
+    std::sort(secondPieces.begin(), secondPieces.end());
+    EXPECT_EQ(firstPieces, secondPieces);
+    world.Step(fracture);
+    EXPECT_EQ(ProxiesIn(world, { { 170.0f, -30.0f }, { 230.0f, 30.0f } }), 6u);
+    EXPECT_EQ(ProxiesIn(world, { { -30.0f, -30.0f }, { 30.0f, 30.0f } }), 0u);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PERFORMANCE TESTS
+// ============================================================================
+
+TEST(FracturePerformanceTest, SpawnTwoHundredFragments)
+{
+    LOG_FUNC_ENTER();
+    constexpr int PIECES = 200;
+
+    // A populated world, so the batch goes into a tree of realistic depth
+    PhysicsTestWorld world;
+    FractureSystem fracture;
+    AddRenderedBody(world, Box(5000.0f, 10.0f), { 0.0f, -20.0f }, true);
+    for (int i = 0; i < 1000; ++i)
+        AddRenderedBody(world, Box(8.0f, 8.0f), { (i % 100) * 40.0f - 2000.0f, 40.0f + (i / 100) * 40.0f }, true);
+    EntityID coldWall = AddRenderedBody(world, Box(100.0f, 100.0f), { 0.0f, 800.0f }, true);
+    EntityID warmWall = AddRenderedBody(world, Box(100.0f, 100.0f), { 600.0f, 800.0f }, true);
+    world.Start(fracture);
+    world.Step(fracture);
+
+    auto setupStart = std::chrono::high_resolution_clock::now();
+    FractureSystem::PatternID pattern = fracture.CreatePattern(Box(100.0f, 100.0f), PIECES, 11);
+    double setupMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - setupStart).count();
+    ASSERT_EQ(fracture.GetPattern(pattern)->GetPieceCount(), static_cast<size_t>(PIECES));
+
+    // Cold: every piece is a new entity
+    ASSERT_EQ(fracture.Break(coldWall, pattern), static_cast<size_t>(PIECES));
+    float coldMs = fracture.GetStatistics().lastBreakTime;
+
+    // Warm: the pool was prewarmed, pieces are recycled entities
+    fracture.Prewarm(PIECES);
+    ASSERT_EQ(fracture.Break(warmWall, pattern), static_cast<size_t>(PIECES));
+    float warmMs = fracture.GetStatistics().lastBreakTime;
+    EXPECT_EQ(ProxiesIn(world, { { 480.0f, 680.0f }, { 720.0f, 920.0f } }), static_cast<size_t>(PIECES) + 1u);
+
+    std::cout << "[FracturePerformanceTest] pattern of " << PIECES << " pieces: " << setupMs << " ms at load, break: "
+              << coldMs << " ms cold, " << warmMs << " ms prewarmed\n";
+    EXPECT_LT(warmMs, 1.0f);
+
+    world.Step(fracture);
+    LOG_FUNC_EXIT();
+}
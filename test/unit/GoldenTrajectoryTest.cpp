@@ -0,0 +1,304 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "GoldenTrajectory.h"
+#include "nyon/utils/ThreadPool.h"
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+
+using namespace Nyon;
+using namespace Nyon::ECS;
+using namespace NyonTest;
+
+/**
+ * @brief Differential tests of PhysicsPipelineSystem configurations against golden trajectories.
+ *
+ * Tests cover:
+ * - Trajectory file round trip
+ * - Multi-threaded pipeline vs the serial reference
+ * - Deterministic mode with spatial sorting vs deterministic mode without it
+ * - Shape-pair bucketed narrow phase vs per-pair manifold generation
+ * - Divergence report for non-deterministic spatial sorting (informational)
+ *
+ * Set NYON_GOLDEN_DIR to compare the serial reference against trajectories saved
+ * by an earlier build; missing files (or NYON_GOLDEN_UPDATE=1) are (re)written.
+ */
+
+namespace
+{
+    constexpr int STEPS = 180;
+
+    void AddWorld(EntityManager& entities, ComponentStore& cs)
+    {
+        EntityID worldEntity = entities.CreateEntity();
+        PhysicsWorldComponent world;
+        world.gravity = { 0.0f, -980.0f };
+        cs.AddComponent(worldEntity, std::move(world));
+    }
+
+    void AddBox(EntityManager& entities, ComponentStore& cs, const Math::Vector2& center,
+                float halfWidth, float halfHeight, bool isStatic, float rotation = 0.0f)
+    {
+        EntityID e = entities.CreateEntity();
+        TransformComponent t(center);
+        t.rotation = rotation;
+        t.previousRotation = rotation;
+        ColliderComponent collider(ColliderComponent::PolygonShape({
+            { -halfWidth, -halfHeight }, { halfWidth, -halfHeight }, { halfWidth, halfHeight }, { -halfWidth, halfHeight } }));
+        PhysicsBodyComponent body;
+        body.isStatic = isStatic;
+        if (!isStatic)
+        {
+            body.SetMass(1.0f);
+            body.SetInertia(collider.CalculateInertiaPerUnitMass() * body.mass);
+        }
+        body.UpdateMassProperties();
+        cs.AddComponent(e, std::move(t));
+        cs.AddComponent(e, std::move(body));
+        cs.AddComponent(e, std::move(collider));
+    }
+
+    void AddCircle(EntityManager& entities, ComponentStore& cs, const Math::Vector2& center, float radius)
+    {
+        EntityID e = entities.CreateEntity();
+        ColliderComponent::CircleShape circle;
+        circle.radius = radius;
+        ColliderComponent collider(circle);
+        PhysicsBodyComponent body;
+        body.SetMass(1.0f);
+        body.SetInertia(collider.CalculateInertiaPerUnitMass() * body.mass);
+        cs.AddComponent(e, TransformComponent(center));
+        cs.AddComponent(e, std::move(body));
+        cs.AddComponent(e, std::move(collider));
+    }
+
+    // Small box pyramid on the ground: polygon stacking exercises contact persistence,
+    // warm starting and the position solver
+    void BuildBoxPyramid(EntityManager& entities, ComponentStore& cs)
+    {
+        AddWorld(entities, cs);
+        AddBox(entities, cs, { 0.0f, -25.0f }, 400.0f, 25.0f, true);
+        constexpr int BASE = 4;
+        for (int row = 0; row < BASE; ++row)
+        {
+            for (int i = 0; i < BASE - row; ++i)
+            {
+                float x = (i - (BASE - row - 1) * 0.5f) * 21.0f;
+                AddBox(entities, cs, { x, 10.0f + row * 20.5f }, 10.0f, 10.0f, false);
+            }
+        }
+    }
+
+    // Circles dropped into an open container
+    void BuildCircleRain(EntityManager& entities, ComponentStore& cs)
+    {
+        AddWorld(entities, cs);
+        AddBox(entities, cs, { 0.0f, -25.0f }, 250.0f, 25.0f, true);
+        AddBox(entities, cs, { -225.0f, 200.0f }, 25.0f, 200.0f, true);
+        AddBox(entities, cs, { 225.0f, 200.0f }, 25.0f, 200.0f, true);
+        for (int y = 0; y < 10; ++y)
+        {
+            for (int x = 0; x < 12; ++x)
+            {
+                float jitter = ((x * 7 + y * 3) % 5) * 0.8f;
+                AddCircle(entities, cs, { -165.0f + x * 30.0f + jitter, 60.0f + y * 30.0f }, 10.0f + (x + y) % 3);
+            }
+        }
+    }
+
+    // Circles and rotated boxes sliding down a static ramp
+    void BuildMixedRamp(EntityManager& entities, ComponentStore& cs)
+    {
+        AddWorld(entities, cs);
+        AddBox(entities, cs, { 0.0f, -25.0f }, 600.0f, 25.0f, true);
+        AddBox(entities, cs, { -150.0f, 150.0f }, 250.0f, 10.0f, true, -0.35f);
+        for (int i = 0; i < 30; ++i)
+        {
+            Math::Vector2 position{ -330.0f + (i % 10) * 28.0f, 320.0f + (i / 10) * 40.0f };
+            if (i % 2 == 0)
+                AddCircle(entities, cs, position, 11.0f);
+            else
+                AddBox(entities, cs, position, 10.0f, 8.0f, false, 0.1f * i);
+        }
+    }
+
+    struct Scene
+    {
+        const char* name;
+        SceneBuilder build;
+    };
+
+    const std::vector<Scene>& StandardScenes()
+    {
+        static const std::vector<Scene> scenes = {
+            { "box_pyramid", BuildBoxPyramid },
+            { "circle_rain", BuildCircleRain },
+            { "mixed_ramp", BuildMixedRamp },
+        };
+        return scenes;
+    }
+
+    PipelineSetup WithConfig(const std::function<void(PhysicsPipelineSystem::Config&)>& edit)
+    {
+        return [edit](PhysicsPipelineSystem& physics) {
+            auto config = physics.GetConfig();
+            edit(config);
+            physics.SetConfig(config);
+        };
+    }
+
+    // Records with the singleton pool rebuilt at the given size (0 = topology default)
+    Trajectory RecordWithThreads(const Scene& scene, const PipelineSetup& setup, size_t threadCount)
+    {
+        Utils::ThreadPool::Shutdown();
+        Utils::ThreadPool::Initialize(threadCount);
+        Trajectory trajectory = RecordTrajectory(scene.build, setup, STEPS);
+        Utils::ThreadPool::Shutdown();
+        return trajectory;
+    }
+
+    const PipelineSetup SERIAL = WithConfig([](PhysicsPipelineSystem::Config& c) { c.multiThreading = false; });
+}
+
+// ============================================================================
+// FILE FORMAT TESTS
+// ============================================================================
+
+TEST(GoldenTrajectoryTest, SaveLoadRoundTrip)
+{
+    LOG_FUNC_ENTER();
+    Trajectory recorded = RecordTrajectory(BuildMixedRamp, SERIAL, 30);
+    ASSERT_EQ(recorded.frames.size(), 30u);
+    ASSERT_FALSE(recorded.bodyIds.empty());
+
+    auto path = (std::filesystem::temp_directory_path() / "nyon_golden_roundtrip.traj").string();
+    ASSERT_TRUE(recorded.Save(path));
+
+    Trajectory loaded;
+    ASSERT_TRUE(loaded.Load(path));
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(loaded.bodyIds, recorded.bodyIds);
+    DivergenceTolerance exact{ 0.0f, 0.0f, 0.0f, 0.0f, 0 };
+    EXPECT_TRUE(CompareTrajectories(recorded, loaded, exact).Within(exact));
+
+    // Bodies fell and touched the ramp, so the trajectory is not trivially static
+    EXPECT_GT(recorded.frames.back().contactCount, 0u);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// DIFFERENTIAL TESTS
+// ============================================================================
+
+TEST(GoldenTrajectoryTest, SerialReferenceMatchesGoldenFiles)
+{
+    LOG_FUNC_ENTER();
+    const char* goldenDir = std::getenv("NYON_GOLDEN_DIR");
+    if (!goldenDir)
+        GTEST_SKIP() << "Set NYON_GOLDEN_DIR to compare against saved trajectories";
+
+    const char* update = std::getenv("NYON_GOLDEN_UPDATE");
+    bool forceUpdate = update && std::string(update) == "1";
+    std::filesystem::create_directories(goldenDir);
+
+    for (const auto& scene : StandardScenes())
+    {
+        Trajectory current = RecordTrajectory(scene.build, SERIAL, STEPS);
+        auto path = (std::filesystem::path(goldenDir) / (std::string(scene.name) + ".traj")).string();
+
+        Trajectory golden;
+        if (forceUpdate || !golden.Load(path))
+        {
+            ASSERT_TRUE(current.Save(path)) << path;
+            std::cout << "[GoldenTrajectoryTest] wrote " << path << "\n";
+            continue;
+        }
+
+        DivergenceReport report = CompareTrajectories(golden, current);
+        std::cout << "[GoldenTrajectoryTest] " << scene.name << " vs golden: " << report << "\n";
+        EXPECT_TRUE(report.Within(DivergenceTolerance{})) << scene.name << ": " << report;
+    }
+    LOG_FUNC_EXIT();
+}
+
+TEST(GoldenTrajectoryTest, MultiThreadedMatchesSerial)
+{
+    LOG_FUNC_ENTER();
+    const auto parallel = WithConfig([](PhysicsPipelineSystem::Config& c) { c.multiThreading = true; });
+
+    for (const auto& scene : StandardScenes())
+    {
+        Trajectory reference = RecordWithThreads(scene, SERIAL, 1);
+        for (size_t threads : { 1u, 4u })
+        {
+            DivergenceReport report = CompareTrajectories(reference, RecordWithThreads(scene, parallel, threads));
+            std::cout << "[GoldenTrajectoryTest] " << scene.name << " serial vs " << threads << " threads: " << report << "\n";
+            EXPECT_TRUE(report.Within(DivergenceTolerance{})) << scene.name << ": " << report;
+        }
+    }
+    LOG_FUNC_EXIT();
+}
+
+TEST(GoldenTrajectoryTest, DeterministicSpatialSortMatchesUnsorted)
+{
+    LOG_FUNC_ENTER();
+    const auto deterministic = WithConfig([](PhysicsPipelineSystem::Config& c) { c.deterministic = true; });
+    const auto sorted = WithConfig([](PhysicsPipelineSystem::Config& c) {
+        c.deterministic = true;
+        c.spatialSorting = true;
+        c.spatialSortInterval = 10;
+    });
+
+    for (const auto& scene : StandardScenes())
+    {
+        DivergenceReport report = CompareTrajectories(RecordWithThreads(scene, deterministic, 4),
+                                                      RecordWithThreads(scene, sorted, 4));
+        std::cout << "[GoldenTrajectoryTest] " << scene.name << " deterministic, sorted vs unsorted: " << report << "\n";
+        EXPECT_TRUE(report.Within(DivergenceTolerance{})) << scene.name << ": " << report;
+    }
+    LOG_FUNC_EXIT();
+}
+
+TEST(GoldenTrajectoryTest, BucketedNarrowPhaseMatchesPerPair)
+{
+    LOG_FUNC_ENTER();
+    const auto perPair = WithConfig([](PhysicsPipelineSystem::Config& c) {
+        c.multiThreading = false;
+        c.bucketedNarrowPhase = false;
+    });
+    const auto bucketed = WithConfig([](PhysicsPipelineSystem::Config& c) {
+        c.multiThreading = false;
+        c.bucketedNarrowPhase = true;
+    });
+
+    // Same kernels, same pair order: the trajectories must agree to the bit
+    for (const auto& scene : StandardScenes())
+    {
+        DivergenceReport report = CompareTrajectories(RecordWithThreads(scene, perPair, 1),
+                                                      RecordWithThreads(scene, bucketed, 1));
+        std::cout << "[GoldenTrajectoryTest] " << scene.name << " bucketed vs per-pair narrow phase: " << report << "\n";
+        EXPECT_TRUE(report.Within(DivergenceTolerance{ 0.0f, 0.0f, 0.0f, 0.0f, 0 })) << scene.name << ": " << report;
+    }
+    LOG_FUNC_EXIT();
+}
+
+TEST(GoldenTrajectoryTest, ReportsSpatialSortDivergence)
+{
+    LOG_FUNC_ENTER();
+    // Without deterministic mode, re-sorting the pools reorders constraints, so stacked
+    // scenes drift apart; the report quantifies it but only the scene setup is checked
+    const auto sorted = WithConfig([](PhysicsPipelineSystem::Config& c) {
+        c.spatialSorting = true;
+        c.spatialSortInterval = 10;
+    });
+
+    for (const auto& scene : StandardScenes())
+    {
+        DivergenceReport report = CompareTrajectories(RecordWithThreads(scene, SERIAL, 1),
+                                                      RecordWithThreads(scene, sorted, 1));
+        std::cout << "[GoldenTrajectoryTest] " << scene.name << " unsorted vs sorted: " << report << "\n";
+        EXPECT_TRUE(report.comparable);
+    }
+    LOG_FUNC_EXIT();
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "nyon/EngineConstants.h"
+#include "nyon/utils/InputEventQueue.h"
+#include "nyon/utils/InputManager.h"
+#include <thread>
+
+using namespace Nyon;
+using namespace Nyon::Utils;
+
+/**
+ * @brief Unit tests for timestamped input events.
+ *
+ * Tests cover:
+ * - FIFO order, overflow accounting and cross-thread handoff of the event ring
+ * - Events applied by the fixed step whose time span covers them
+ * - Taps shorter than a step being seen for exactly one step
+ */
+
+namespace
+{
+    InputEvent KeyEvent(int key, int action, double timestamp)
+    {
+        return { InputEvent::Device::Key, key, action, timestamp };
+    }
+}
+
+// ============================================================================
+// QUEUE TESTS
+// ============================================================================
+
+TEST(InputEventQueueTest, KeepsOrderAndCountsOverflow)
+{
+    LOG_FUNC_ENTER();
+    InputEventQueue queue;
+    for (size_t i = 0; i < InputEventQueue::CAPACITY; ++i)
+        EXPECT_TRUE(queue.Push(KeyEvent(static_cast<int>(i), GLFW_PRESS, static_cast<double>(i))));
+
+    EXPECT_FALSE(queue.Push(KeyEvent(999, GLFW_PRESS, 0.0)));
+    EXPECT_EQ(queue.GetDroppedCount(), 1u);
+    EXPECT_EQ(queue.Size(), InputEventQueue::CAPACITY);
+
+    InputEvent event;
+    ASSERT_TRUE(queue.Peek(event));
+    EXPECT_EQ(event.code, 0);
+    for (size_t i = 0; i < InputEventQueue::CAPACITY; ++i)
+    {
+        ASSERT_TRUE(queue.Pop(event));
+        EXPECT_EQ(event.code, static_cast<int>(i));
+    }
+    EXPECT_FALSE(queue.Pop(event));
+    EXPECT_TRUE(queue.Empty());
+    LOG_FUNC_EXIT();
+}
+
+TEST(InputEventQueueTest, ProducerThreadHandsOffEveryEvent)
+{
+    LOG_FUNC_ENTER();
+    InputEventQueue queue;
+    const int count = 20000;
+
+    std::thread producer([&queue, count]() {
+        for (int i = 0; i < count; ++i)
+        {
+            while (!queue.Push(KeyEvent(i % GLFW_KEY_LAST, GLFW_PRESS, static_cast<double>(i))))
+                std::this_thread::yield();
+        }
+    });
+
+    int received = 0;
+    bool ordered = true;
+    InputEvent event;
+    while (received < count)
+    {
+        if (queue.Pop(event))
+        {
+            ordered = ordered && event.timestamp == static_cast<double>(received);
+            ++received;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(queue.Empty());
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// FIXED-STEP CONSUMPTION TESTS
+// ============================================================================
+
+TEST(InputEventQueueTest, StepsApplyOnlyTheEventsTheyCover)
+{
+    LOG_FUNC_ENTER();
+    const double dt = FIXED_TIMESTEP_D;
+    InputManager::Update();
+    InputManager::TakeLatencySample();
+
+    // Two steps in one frame, the press lands in the second
+    ASSERT_TRUE(InputManager::QueueEvent(KeyEvent(GLFW_KEY_A, GLFW_PRESS, 10.0 + 1.5 * dt)));
+
+    InputManager::BeginFixedStep(10.0 + dt, 10.0 + 2.0 * dt);
+    EXPECT_FALSE(InputManager::IsKeyDown(GLFW_KEY_A));
+
+    InputManager::BeginFixedStep(10.0 + 2.0 * dt, 10.0 + 2.0 * dt);
+    EXPECT_TRUE(InputManager::IsKeyPressed(GLFW_KEY_A));
+
+    auto sample = InputManager::TakeLatencySample();
+    EXPECT_EQ(sample.events, 1u);
+    EXPECT_DOUBLE_EQ(sample.oldestTimestamp, 10.0 + 1.5 * dt);
+    EXPECT_NEAR(sample.maxToSimMs, 0.5 * dt * 1000.0, 1e-6);
+
+    // Held: down but no longer a fresh press
+    InputManager::BeginFixedStep(10.0 + 3.0 * dt, 10.0 + 3.0 * dt);
+    EXPECT_TRUE(InputManager::IsKeyDown(GLFW_KEY_A));
+    EXPECT_FALSE(InputManager::IsKeyPressed(GLFW_KEY_A));
+
+    InputManager::QueueEvent(KeyEvent(GLFW_KEY_A, GLFW_RELEASE, 10.0 + 3.5 * dt));
+    InputManager::BeginFixedStep(10.0 + 4.0 * dt, 10.0 + 4.0 * dt);
+    EXPECT_TRUE(InputManager::IsKeyUp(GLFW_KEY_A));
+    LOG_FUNC_EXIT();
+}
+
+TEST(InputEventQueueTest, TapShorterThanAStepIsNotMissed)
+{
+    LOG_FUNC_ENTER();
+    const double dt = FIXED_TIMESTEP_D;
+    InputManager::Update();
+
+    // Press and release 2 ms apart, both inside one step
+    InputManager::QueueEvent(KeyEvent(GLFW_KEY_SPACE, GLFW_PRESS, 20.0 + 0.2 * dt));
+    InputManager::QueueEvent(KeyEvent(GLFW_KEY_SPACE, GLFW_RELEASE, 20.0 + 0.2 * dt + 0.002));
+
+    InputManager::BeginFixedStep(20.0 + dt, 20.0 + dt);
+    EXPECT_TRUE(InputManager::IsKeyPressed(GLFW_KEY_SPACE));
+
+    InputManager::BeginFixedStep(20.0 + 2.0 * dt, 20.0 + 2.0 * dt);
+    EXPECT_FALSE(InputManager::IsKeyDown(GLFW_KEY_SPACE));
+    EXPECT_TRUE(InputManager::IsKeyUp(GLFW_KEY_SPACE));
+
+    EXPECT_FALSE(InputManager::QueueEvent(KeyEvent(GLFW_KEY_LAST, GLFW_PRESS, 0.0)));
+    InputManager::TakeLatencySample();
+    LOG_FUNC_EXIT();
+}
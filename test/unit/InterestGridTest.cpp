@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/network/InterestGrid.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+using namespace Nyon;
+using namespace Nyon::ECS;
+using namespace Nyon::Network;
+
+/**
+ * @brief Tests for the interest-management grid.
+ *
+ * Tests cover:
+ * - Radius and box queries against a brute-force scan, across moves and removals
+ * - Consumer enter and leave sets
+ * - Cost of 200 consumers over 10k entities per tick vs. scanning the pool
+ */
+
+namespace
+{
+    std::vector<EntityID> SpawnScattered(EntityManager& entities, ComponentStore& cs, int count, float extent, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> coordinate(-extent, extent);
+        std::vector<EntityID> ids;
+        for (int i = 0; i < count; ++i)
+        {
+            EntityID e = entities.CreateEntity();
+            cs.AddComponent(e, TransformComponent({ coordinate(rng), coordinate(rng) }));
+            ids.push_back(e);
+        }
+        return ids;
+    }
+
+    std::vector<EntityID> ScanRadius(ComponentStore& cs, const Math::Vector2& center, float radius)
+    {
+        std::vector<EntityID> result;
+        cs.ForEachComponent<TransformComponent>([&](EntityID entityId, const TransformComponent& transform) {
+            if ((transform.position - center).LengthSquared() <= radius * radius)
+                result.push_back(entityId);
+        });
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    std::vector<EntityID> Sorted(std::vector<EntityID> ids)
+    {
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+}
+
+// ============================================================================
+// QUERY TESTS
+// ============================================================================
+
+TEST(InterestGridTest, QueriesMatchBruteForceAcrossMovesAndRemovals)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+    std::vector<EntityID> ids = SpawnScattered(entities, cs, 2000, 1500.0f, 3u);
+
+    InterestConfig config;
+    config.cellSize = 100.0f;
+    InterestGrid grid(cs, config);
+    grid.Update();
+    EXPECT_EQ(grid.GetStatistics().entities, ids.size());
+    EXPECT_EQ(grid.GetStatistics().rebinnedEntities, ids.size());
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> coordinate(-1600.0f, 1600.0f);
+    std::uniform_real_distribution<float> step(-60.0f, 60.0f);
+    std::uniform_real_distribution<float> size(0.0f, 400.0f);
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int q = 0; q < 50; ++q)
+        {
+            Math::Vector2 center{ coordinate(rng), coordinate(rng) };
+            float radius = size(rng);
+            std::vector<EntityID> found;
+            grid.QueryRadius(center, radius, found);
+            EXPECT_EQ(Sorted(found), ScanRadius(cs, center, radius)) << "round " << round << " query " << q;
+
+            Math::Vector2 min{ center.x - size(rng), center.y - size(rng) };
+            Math::Vector2 max{ center.x + size(rng), center.y + size(rng) };
+            std::vector<EntityID> inBox;
+            grid.QueryBox(min, max, inBox);
+            std::vector<EntityID> expected;
+            cs.ForEachComponent<TransformComponent>([&](EntityID entityId, const TransformComponent& transform) {
+                const Math::Vector2& p = transform.position;
+                if (p.x >= min.x && p.x <= max.x && p.y >= min.y && p.y <= max.y)
+                    expected.push_back(entityId);
+            });
+            EXPECT_EQ(Sorted(inBox), Sorted(expected));
+        }
+
+        // Jitter everyone, teleport a few and destroy a few
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            if (!cs.HasComponent<TransformComponent>(ids[i]))
+                continue;
+            auto& position = cs.GetComponent<TransformComponent>(ids[i]).position;
+            if (i % 97 == static_cast<size_t>(round))
+                cs.RemoveComponent<TransformComponent>(ids[i]);
+            else if (i % 13 == 0)
+                position = { coordinate(rng), coordinate(rng) };
+            else
+                position += { step(rng), step(rng) };
+        }
+        grid.Update();
+        EXPECT_EQ(grid.GetStatistics().entities, cs.GetComponentCount<TransformComponent>());
+        EXPECT_LT(grid.GetStatistics().rebinnedEntities, ids.size() / 2);
+    }
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// CONSUMER TESTS
+// ============================================================================
+
+TEST(InterestGridTest, ConsumersReportEnterAndLeave)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+    EntityID near = entities.CreateEntity();
+    EntityID far = entities.CreateEntity();
+    EntityID walker = entities.CreateEntity();
+    cs.AddComponent(near, TransformComponent({ 10.0f, 0.0f }));
+    cs.AddComponent(far, TransformComponent({ 900.0f, 0.0f }));
+    cs.AddComponent(walker, TransformComponent({ 0.0f, 300.0f }));
+
+    InterestGrid grid(cs);
+    uint32_t agent = grid.AddConsumer();
+    grid.SetConsumerRadius(agent, { 0.0f, 0.0f }, 200.0f);
+    uint32_t client = grid.AddConsumer();
+    grid.SetConsumerBox(client, { 800.0f, -50.0f }, { 1000.0f, 50.0f });
+
+    grid.Update();
+    grid.UpdateConsumers();
+    EXPECT_EQ(grid.GetMembers(agent), std::vector<EntityID>({ near }));
+    EXPECT_EQ(grid.GetEntered(agent), std::vector<EntityID>({ near }));
+    EXPECT_EQ(grid.GetMembers(client), std::vector<EntityID>({ far }));
+
+    // The walker comes into range, the near entity is destroyed
+    cs.GetComponent<TransformComponent>(walker).position = { 0.0f, 150.0f };
+    cs.RemoveComponent<TransformComponent>(near);
+    grid.Update();
+    grid.UpdateConsumers();
+    EXPECT_EQ(grid.GetMembers(agent), std::vector<EntityID>({ walker }));
+    EXPECT_EQ(grid.GetEntered(agent), std::vector<EntityID>({ walker }));
+    EXPECT_EQ(grid.GetLeft(agent), std::vector<EntityID>({ near }));
+    EXPECT_TRUE(grid.GetEntered(client).empty());
+    EXPECT_TRUE(grid.GetLeft(client).empty());
+
+    // Nothing changed: no deltas
+    grid.Update();
+    grid.UpdateConsumers();
+    EXPECT_TRUE(grid.GetEntered(agent).empty());
+    EXPECT_TRUE(grid.GetLeft(agent).empty());
+    EXPECT_EQ(grid.GetStatistics().consumers, 2u);
+    EXPECT_EQ(grid.GetStatistics().members, 2u);
+
+    // A freed slot is reused with empty sets
+    grid.RemoveConsumer(agent);
+    EXPECT_EQ(grid.AddConsumer(), agent);
+    EXPECT_TRUE(grid.GetMembers(agent).empty());
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PERFORMANCE TESTS
+// ============================================================================
+
+TEST(InterestGridPerformanceTest, TwoHundredConsumersOverTenThousandEntities)
+{
+    LOG_FUNC_ENTER();
+    constexpr int ENTITIES = 10000;
+    constexpr int CONSUMERS = 200;
+    constexpr int TICKS = 30;
+    constexpr float RADIUS = 300.0f;
+    EntityManager entities;
+    ComponentStore cs(entities);
+    std::vector<EntityID> ids = SpawnScattered(entities, cs, ENTITIES, 4000.0f, 7u);
+
+    InterestGrid grid(cs);
+    std::mt19937 rng(21);
+    std::uniform_real_distribution<float> coordinate(-4000.0f, 4000.0f);
+    std::vector<Math::Vector2> focus(CONSUMERS);
+    for (int c = 0; c < CONSUMERS; ++c)
+    {
+        focus[c] = { coordinate(rng), coordinate(rng) };
+        grid.SetConsumerRadius(grid.AddConsumer(), focus[c], RADIUS);
+    }
+    grid.Update();
+    grid.UpdateConsumers();
+
+    // A fifth of the entities and every consumer move each tick
+    double gridMs = 0.0;
+    double scanMs = 0.0;
+    size_t scanned = 0;
+    size_t members = 0;
+    for (int tick = 0; tick < TICKS; ++tick)
+    {
+        for (size_t i = tick % 5; i < ids.size(); i += 5)
+            cs.GetComponent<TransformComponent>(ids[i]).position += { 3.0f, -2.0f };
+        for (int c = 0; c < CONSUMERS; ++c)
+        {
+            focus[c] += { 2.0f, 1.0f };
+            grid.SetConsumerRadius(static_cast<uint32_t>(c), focus[c], RADIUS);
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        grid.Update();
+        grid.UpdateConsumers();
+        gridMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        members += grid.GetStatistics().members;
+
+        // What every consumer did before: scan the pool and filter by distance
+        start = std::chrono::high_resolution_clock::now();
+        for (int c = 0; c < CONSUMERS; ++c)
+            scanned += ScanRadius(cs, focus[c], RADIUS).size();
+        scanMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    const auto& stats = grid.GetStatistics();
+    EXPECT_EQ(members, scanned);
+    std::cout << "[InterestGridPerformanceTest] " << CONSUMERS << " consumers x " << ENTITIES << " entities: " << gridMs / TICKS
+              << " ms per tick (update " << stats.updateTime << " ms, consumers " << stats.consumerTime << " ms, "
+              << stats.rebinnedEntities << " rebinned), pool scan " << scanMs / TICKS << " ms; "
+              << stats.members << " members, " << stats.entered << " entered, " << stats.left << " left\n";
+    EXPECT_LT(gridMs / TICKS, scanMs / TICKS);
+    LOG_FUNC_EXIT();
+}
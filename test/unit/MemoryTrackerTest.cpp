@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "nyon/utils/MemoryTracker.h"
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/components/TransformComponent.h"
+#include "nyon/physics/DynamicTree.h"
+#include <sstream>
+
+using namespace Nyon;
+using namespace Nyon::ECS;
+using namespace Nyon::Utils;
+
+/**
+ * @brief Unit tests for tagged memory accounting.
+ *
+ * Tests cover:
+ * - Tracked container allocation, free and peak counters
+ * - Engine containers charging their tags
+ * - Component pool size versus capacity reporting
+ */
+
+// ============================================================================
+// COUNTER TESTS
+// ============================================================================
+
+TEST(MemoryTrackerTest, TrackedVectorChargesItsTag)
+{
+    LOG_FUNC_ENTER();
+    MemoryTracker::ResetPeaks();
+    auto before = MemoryTracker::GetStats(MemoryTag::General);
+
+    {
+        TrackedVector<uint64_t, MemoryTag::General> values;
+        values.reserve(1000);
+        auto during = MemoryTracker::GetStats(MemoryTag::General);
+        EXPECT_EQ(during.currentBytes - before.currentBytes, 1000 * sizeof(uint64_t));
+        EXPECT_EQ(during.allocations - before.allocations, 1u);
+        EXPECT_GE(during.peakBytes, during.currentBytes);
+    }
+
+    auto after = MemoryTracker::GetStats(MemoryTag::General);
+    EXPECT_EQ(after.currentBytes, before.currentBytes);
+    EXPECT_GE(after.peakBytes, before.currentBytes + 1000 * sizeof(uint64_t));
+    EXPECT_EQ(after.bytesAllocated - before.bytesAllocated, 1000 * sizeof(uint64_t));
+
+    MemoryTracker::ResetPeaks();
+    EXPECT_EQ(MemoryTracker::GetStats(MemoryTag::General).peakBytes, after.currentBytes);
+
+    std::ostringstream report;
+    MemoryTracker::Sample();
+    MemoryTracker::Report(report);
+    EXPECT_NE(report.str().find("BroadPhase"), std::string::npos);
+    LOG_FUNC_EXIT();
+}
+
+TEST(MemoryTrackerTest, EngineContainersChargeTheirTags)
+{
+    LOG_FUNC_ENTER();
+    size_t broadPhaseBefore = MemoryTracker::GetStats(MemoryTag::BroadPhase).currentBytes;
+    size_t ecsBefore = MemoryTracker::GetStats(MemoryTag::ECS).currentBytes;
+    {
+        Physics::DynamicTree tree;
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            Physics::AABB box{ { i * 10.0f, 0.0f }, { i * 10.0f + 5.0f, 5.0f } };
+            tree.CreateProxy(box, i);
+        }
+        EXPECT_GT(MemoryTracker::GetStats(MemoryTag::BroadPhase).currentBytes, broadPhaseBefore);
+
+        EntityManager entities;
+        ComponentStore cs(entities);
+        for (int i = 0; i < 100; ++i)
+            cs.AddComponent(entities.CreateEntity(), TransformComponent({ 0.0f, 0.0f }));
+        EXPECT_GE(MemoryTracker::GetStats(MemoryTag::ECS).currentBytes - ecsBefore, 100 * sizeof(TransformComponent));
+    }
+
+    // Everything is returned when the owners are destroyed
+    EXPECT_EQ(MemoryTracker::GetStats(MemoryTag::BroadPhase).currentBytes, broadPhaseBefore);
+    EXPECT_EQ(MemoryTracker::GetStats(MemoryTag::ECS).currentBytes, ecsBefore);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// POOL REPORTING TESTS
+// ============================================================================
+
+TEST(MemoryTrackerTest, PoolStatsReportCapacityAgainstSize)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    std::vector<EntityID> ids;
+    for (int i = 0; i < 1000; ++i)
+    {
+        ids.push_back(entities.CreateEntity());
+        cs.AddComponent(ids.back(), TransformComponent({ 0.0f, 0.0f }));
+    }
+    for (int i = 0; i < 900; ++i)
+        cs.RemoveComponent<TransformComponent>(ids[i]);
+
+    auto pools = cs.GetPoolMemoryStats();
+    ASSERT_EQ(pools.size(), 1u);
+    EXPECT_EQ(pools[0].count, 100u);
+    EXPECT_GE(pools[0].capacity, 1000u);
+    EXPECT_EQ(pools[0].componentSize, sizeof(TransformComponent));
+    EXPECT_LT(pools[0].usedBytes, pools[0].reservedBytes);
+
+    std::ostringstream report;
+    cs.ReportPoolMemory(report);
+    EXPECT_NE(report.str().find("under half used"), std::string::npos);
+    LOG_FUNC_EXIT();
+}
@@ -0,0 +1,305 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "PhysicsTestWorld.h"
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/systems/ParticlePipelineSystem.h"
+#include "nyon/ecs/systems/PhysicsPipelineSystem.h"
+#include "nyon/EngineConstants.h"
+#include "nyon/ecs/components/TransformComponent.h"
+#include "nyon/ecs/components/PhysicsBodyComponent.h"
+#include <chrono>
+#include <iostream>
+
+using namespace Nyon;
+using namespace Nyon::ECS;
+using NyonTest::PhysicsTestWorld;
+
+/**
+ * @brief Tests for ParticlePipelineSystem emitters and the position-based fluid mode.
+ *
+ * Tests cover:
+ * - Emitter bursts creating particle entities
+ * - Expired particles destroyed with their components
+ * - Particles moved once when the physics pipeline runs alongside
+ * - Fluid particles settling inside a static container
+ * - Fluid throughput (particles per millisecond)
+ */
+
+namespace
+{
+    constexpr float FLUID_SPACING = 8.0f;
+
+    void AddStaticBox(EntityManager& entities, ComponentStore& cs, const Math::Vector2& center, float halfWidth, float halfHeight)
+    {
+        EntityID e = entities.CreateEntity();
+        TransformComponent t(center);
+        PhysicsBodyComponent body;
+        body.isStatic = true;
+        body.UpdateMassProperties();
+        ColliderComponent collider(ColliderComponent::PolygonShape({
+            { -halfWidth, -halfHeight }, { halfWidth, -halfHeight }, { halfWidth, halfHeight }, { -halfWidth, halfHeight } }));
+        cs.AddComponent(e, std::move(t));
+        cs.AddComponent(e, std::move(body));
+        cs.AddComponent(e, std::move(collider));
+    }
+
+    // Open-topped container: floor at y = 0, walls at x = +-halfWidth
+    void BuildContainer(EntityManager& entities, ComponentStore& cs, float halfWidth)
+    {
+        EntityID worldEntity = entities.CreateEntity();
+        PhysicsWorldComponent world;
+        world.gravity = { 0.0f, -980.0f };
+        cs.AddComponent(worldEntity, std::move(world));
+
+        AddStaticBox(entities, cs, { 0.0f, -50.0f }, halfWidth + 100.0f, 50.0f);
+        AddStaticBox(entities, cs, { -halfWidth - 50.0f, 500.0f }, 50.0f, 500.0f);
+        AddStaticBox(entities, cs, { halfWidth + 50.0f, 500.0f }, 50.0f, 500.0f);
+    }
+
+    EntityID AddFluidEmitter(EntityManager& entities, ComponentStore& cs, const Math::Vector2& center,
+                             const Math::Vector2& size, uint32_t count)
+    {
+        EntityID e = entities.CreateEntity();
+        cs.AddComponent(e, TransformComponent(center));
+
+        ParticleEmitterComponent emitter;
+        emitter.simulationMode = ParticleEmitterComponent::SimulationMode::Fluid;
+        emitter.fluid.particleSpacing = FLUID_SPACING;
+        emitter.fluid.smoothingRadius = FLUID_SPACING * 2.5f;
+        emitter.spawnRate = 0.0f;
+        emitter.burstCount = count;
+        emitter.maxParticles = count;
+        emitter.emissionShape = ParticleEmitterComponent::EmissionShape::Rectangle;
+        emitter.emissionSize = size;
+        emitter.spawnParams.minSpeed = 0.0f;
+        emitter.spawnParams.maxSpeed = 0.0f;
+        emitter.spawnParams.minLifetime = -1.0f;
+        emitter.spawnParams.maxLifetime = -1.0f;
+        emitter.spawnParams.minDrag = 0.0f;
+        emitter.spawnParams.maxDrag = 0.0f;
+        emitter.collidesWithBodies = true;
+        cs.AddComponent(e, std::move(emitter));
+        return e;
+    }
+
+    // Burst of identical particles fired up and to the right from one point
+    EntityID AddBallisticBurst(EntityManager& entities, ComponentStore& cs, const Math::Vector2& position, uint32_t count)
+    {
+        EntityID e = entities.CreateEntity();
+        cs.AddComponent(e, TransformComponent(position));
+
+        ParticleEmitterComponent emitter;
+        emitter.spawnRate = 0.0f;
+        emitter.burstCount = count;
+        emitter.emissionShape = ParticleEmitterComponent::EmissionShape::Point;
+        emitter.spawnParams.minSpeed = 300.0f;
+        emitter.spawnParams.maxSpeed = 300.0f;
+        emitter.spawnParams.minAngleDeg = 60.0f;
+        emitter.spawnParams.maxAngleDeg = 60.0f;
+        emitter.spawnParams.minLifetime = -1.0f;
+        emitter.spawnParams.maxLifetime = -1.0f;
+        emitter.spawnParams.minDrag = 0.0f;
+        emitter.spawnParams.maxDrag = 0.0f;
+        cs.AddComponent(e, std::move(emitter));
+        return e;
+    }
+}
+
+// ============================================================================
+// EMITTER TESTS
+// ============================================================================
+
+TEST(ParticlePipelineTest, BurstCreatesParticleEntities)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+    EntityID emitterEntity = AddFluidEmitter(entities, cs, { 100.0f, 200.0f }, { 40.0f, 40.0f }, 25);
+
+    ParticlePipelineSystem particles;
+    particles.Initialize(entities, cs);
+    particles.Update(FIXED_TIMESTEP);
+
+    ASSERT_EQ(particles.GetActiveParticles().size(), 25u);
+    EXPECT_EQ(cs.GetComponent<ParticleEmitterComponent>(emitterEntity).currentCount, 25u);
+    for (EntityID id : particles.GetActiveParticles())
+    {
+        EXPECT_EQ(cs.GetComponent<ParticleComponent>(id).emitterEntityId, emitterEntity);
+        EXPECT_FLOAT_NEAR(cs.GetComponent<ColliderComponent>(id).GetCircle().radius, FLUID_SPACING * 0.5f, 1e-5f);
+
+        // Spawned inside the emission rectangle around the emitter transform
+        const auto& position = cs.GetComponent<TransformComponent>(id).previousPosition;
+        EXPECT_NEAR(position.x, 100.0f, 21.0f);
+        EXPECT_NEAR(position.y, 200.0f, 21.0f);
+    }
+    LOG_FUNC_EXIT();
+}
+
+TEST(ParticlePipelineTest, ExpiredParticlesAreDestroyed)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+    EntityID emitterEntity = entities.CreateEntity();
+    cs.AddComponent(emitterEntity, TransformComponent({ 0.0f, 0.0f }));
+    ParticleEmitterComponent emitter;
+    emitter.spawnRate = 240.0f;
+    emitter.spawnParams.minLifetime = 0.25f;
+    emitter.spawnParams.maxLifetime = 0.25f;
+    cs.AddComponent(emitterEntity, std::move(emitter));
+
+    ParticlePipelineSystem particles;
+    particles.Initialize(entities, cs);
+
+    // Past the first lifetime the emitter spawns as many particles as expire
+    auto runSeconds = [&](float seconds) {
+        for (int i = 0; i < static_cast<int>(seconds / FIXED_TIMESTEP); ++i)
+            particles.Update(FIXED_TIMESTEP);
+    };
+    runSeconds(0.5f);
+    size_t entityCount = entities.GetActiveEntityCount();
+    size_t bodyCount = cs.GetComponentCount<PhysicsBodyComponent>();
+    ASSERT_GT(bodyCount, 0u);
+    EXPECT_LE(bodyCount, 64u);
+
+    runSeconds(2.0f);
+    EXPECT_LE(entities.GetActiveEntityCount(), entityCount + 4);
+    EXPECT_LE(cs.GetComponentCount<PhysicsBodyComponent>(), bodyCount + 4);
+    EXPECT_EQ(cs.GetComponentCount<ParticleComponent>(), particles.GetActiveParticles().size());
+    EXPECT_EQ(cs.GetComponentCount<ColliderComponent>(), particles.GetActiveParticles().size());
+    EXPECT_EQ(entities.GetActiveEntityCount(), particles.GetActiveParticles().size() + 1);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PHYSICS PIPELINE TESTS
+// ============================================================================
+
+TEST(ParticlePipelineTest, PhysicsPipelineLeavesParticlesToTheParticleSystem)
+{
+    LOG_FUNC_ENTER();
+    constexpr uint32_t COUNT = 20;
+    constexpr int STEPS = 30;
+
+    // The same burst with and without the rigid-body pipeline stepping alongside
+    PhysicsTestWorld alone;
+    PhysicsTestWorld both;
+    AddBallisticBurst(alone.entities, alone.cs, { 0.0f, 100.0f }, COUNT);
+    AddBallisticBurst(both.entities, both.cs, { 0.0f, 100.0f }, COUNT);
+    EntityID ball = both.AddCircle({ 500.0f, 100.0f });
+
+    ParticlePipelineSystem aloneParticles;
+    ParticlePipelineSystem bothParticles;
+    aloneParticles.Initialize(alone.entities, alone.cs);
+    bothParticles.Initialize(both.entities, both.cs);
+    both.Start();
+    for (int i = 0; i < STEPS; ++i)
+    {
+        aloneParticles.Update(FIXED_TIMESTEP);
+        both.Step();
+        bothParticles.Update(FIXED_TIMESTEP);
+    }
+
+    // Integrated once per step, not once by each system
+    const auto& aloneIds = aloneParticles.GetActiveParticles();
+    const auto& bothIds = bothParticles.GetActiveParticles();
+    ASSERT_EQ(aloneIds.size(), COUNT);
+    ASSERT_EQ(bothIds.size(), COUNT);
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        const auto& expected = alone.cs.GetComponent<TransformComponent>(aloneIds[i]).position;
+        const auto& actual = both.cs.GetComponent<TransformComponent>(bothIds[i]).position;
+        EXPECT_FLOAT_EQ(actual.x, expected.x);
+        EXPECT_FLOAT_EQ(actual.y, expected.y);
+    }
+
+    // Ordinary bodies still fall, and only they are in the pipeline's broad phase
+    EXPECT_LT(both.cs.GetComponent<TransformComponent>(ball).position.y, 100.0f);
+    std::vector<EntityID> proxies;
+    both.physics.QueryBroadPhase(Physics::AABB({ -10000.0f, -10000.0f }, { 10000.0f, 10000.0f }), proxies);
+    ASSERT_EQ(proxies.size(), 1u);
+    EXPECT_EQ(proxies[0], ball);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// FLUID TESTS
+// ============================================================================
+
+TEST(ParticlePipelineTest, FluidSettlesInContainer)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+    constexpr float HALF_WIDTH = 80.0f;
+    constexpr uint32_t COUNT = 400;
+    BuildContainer(entities, cs, HALF_WIDTH);
+    AddFluidEmitter(entities, cs, { 0.0f, 120.0f }, { 150.0f, 150.0f }, COUNT);
+
+    ParticlePipelineSystem particles;
+    particles.Initialize(entities, cs);
+    for (int i = 0; i < 240; ++i)
+        particles.Update(FIXED_TIMESTEP);
+
+    const auto& ids = particles.GetActiveParticles();
+    ASSERT_EQ(ids.size(), COUNT);
+
+    float maxHeight = 0.0f;
+    float totalSpeed = 0.0f;
+    for (EntityID id : ids)
+    {
+        const auto& position = cs.GetComponent<TransformComponent>(id).position;
+        EXPECT_GT(position.y, 0.0f);
+        EXPECT_GT(position.x, -HALF_WIDTH);
+        EXPECT_LT(position.x, HALF_WIDTH);
+        maxHeight = std::max(maxHeight, position.y);
+        totalSpeed += cs.GetComponent<PhysicsBodyComponent>(id).velocity.Length();
+    }
+
+    // Incompressibility: the column is about as tall as the particles' rest area
+    // allows, rather than collapsed into a thin layer on the floor
+    float restHeight = COUNT * FLUID_SPACING * FLUID_SPACING / (2.0f * HALF_WIDTH);
+    float meanSpeed = totalSpeed / COUNT;
+    std::cout << "[ParticlePipelineTest] fluid column height " << maxHeight << " px (rest estimate "
+              << restHeight << " px), mean speed " << meanSpeed << " px/s\n";
+    EXPECT_GT(maxHeight, restHeight * 0.6f);
+    EXPECT_LT(maxHeight, restHeight * 1.6f);
+    EXPECT_LT(meanSpeed, 40.0f);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PERFORMANCE TESTS
+// ============================================================================
+
+TEST(ParticlePipelinePerformanceTest, FluidParticlesPerMillisecond)
+{
+    LOG_FUNC_ENTER();
+    constexpr uint32_t COUNT = 20000;
+    constexpr int WARMUP_STEPS = 5;
+    constexpr int STEPS = 20;
+
+    EntityManager entities;
+    ComponentStore cs(entities);
+    BuildContainer(entities, cs, 600.0f);
+    AddFluidEmitter(entities, cs, { 0.0f, 600.0f }, { 1150.0f, 1100.0f }, COUNT);
+
+    ParticlePipelineSystem particles;
+    particles.Initialize(entities, cs);
+    for (int i = 0; i < WARMUP_STEPS; ++i)
+        particles.Update(FIXED_TIMESTEP);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < STEPS; ++i)
+        particles.Update(FIXED_TIMESTEP);
+    auto end = std::chrono::steady_clock::now();
+
+    double msPerStep = std::chrono::duration<double, std::milli>(end - start).count() / STEPS;
+    std::cout << "[ParticlePipelinePerformanceTest] " << COUNT << " fluid particles: " << msPerStep
+              << " ms/step, " << (COUNT / msPerStep) << " particles/ms\n";
+
+    EXPECT_EQ(particles.GetActiveParticles().size(), COUNT);
+    EXPECT_GT(msPerStep, 0.0);
+    LOG_FUNC_EXIT();
+}
@@ -0,0 +1,737 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/systems/PhysicsPipelineSystem.h"
+#include "nyon/physics/MortonCode.h"
+#include "nyon/utils/ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace Nyon;
+using namespace Nyon::ECS;
+
+/**
+ * @brief Benchmarks and behaviour tests for PhysicsPipelineSystem optimizations.
+ *
+ * Tests cover:
+ * - Morton (Z-order) key generation
+ * - Spatial sorting of the body pools
+ * - Reduced-rate stepping of distant islands (simulation LOD)
+ * - Skipping steps while every body sleeps (idle skipping)
+ * - Bodies resting on static ground falling asleep and waking on contact
+ * - Sleeping bodies' proxies frozen out of the broad phase with their contacts kept
+ * - Per-island adaptive solver iterations stopping once converged
+ * - Motion locks holding once a locked body joins a lock-free world
+ * - Deterministic mode state hashes across runs and thread counts
+ * - Step time and last-level cache misses with and without spatial sorting
+ */
+
+namespace
+{
+    // Counts last-level cache misses of this thread and its children; reports
+    // -1 when hardware counters are unavailable (containers, non-Linux).
+    class CacheMissCounter
+    {
+    public:
+        CacheMissCounter()
+        {
+#ifdef __linux__
+            perf_event_attr attr{};
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            attr.disabled = 1;
+            attr.inherit = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            m_Fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+        }
+
+        ~CacheMissCounter()
+        {
+#ifdef __linux__
+            if (m_Fd >= 0)
+                close(m_Fd);
+#endif
+        }
+
+        void Start()
+        {
+#ifdef __linux__
+            if (m_Fd >= 0)
+            {
+                ioctl(m_Fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(m_Fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+        }
+
+        long long Stop()
+        {
+#ifdef __linux__
+            if (m_Fd >= 0)
+            {
+                ioctl(m_Fd, PERF_EVENT_IOC_DISABLE, 0);
+                long long count = 0;
+                if (read(m_Fd, &count, sizeof(count)) == sizeof(count))
+                    return count;
+            }
+#endif
+            return -1;
+        }
+
+    private:
+        int m_Fd = -1;
+    };
+
+    struct StepResult
+    {
+        double msPerStep = 0.0;
+        long long cacheMisses = -1;
+        size_t spatialSorts = 0;   // Sorts performed by the warm-up and measured steps
+    };
+
+    // Grid of drifting circles inserted in shuffled order, so dense pool order is
+    // unrelated to spatial position (like bodies spawned over a long session)
+    void BuildShuffledScene(EntityManager& entities, ComponentStore& cs, int bodyCount, uint32_t seed)
+    {
+        EntityID worldEntity = entities.CreateEntity();
+        PhysicsWorldComponent world;
+        world.gravity = { 0.0f, 0.0f };
+        cs.AddComponent(worldEntity, std::move(world));
+
+        int columns = static_cast<int>(std::sqrt(static_cast<float>(bodyCount)));
+        std::vector<int> cells(bodyCount);
+        for (int i = 0; i < bodyCount; ++i)
+            cells[i] = i;
+
+        std::mt19937 rng(seed);
+        std::shuffle(cells.begin(), cells.end(), rng);
+        std::uniform_real_distribution<float> velocity(-20.0f, 20.0f);
+
+        for (int cell : cells)
+        {
+            EntityID e = entities.CreateEntity();
+            TransformComponent t;
+            t.position = { (cell % columns) * 21.0f, (cell / columns) * 21.0f };
+            t.previousPosition = t.position;
+
+            ColliderComponent::CircleShape circle;
+            circle.radius = 10.0f;
+            ColliderComponent collider(circle);
+
+            PhysicsBodyComponent body;
+            body.SetMass(1.0f);
+            body.SetInertia(collider.CalculateInertiaPerUnitMass() * body.mass);
+            body.allowSleep = false;
+            body.velocity = { velocity(rng), velocity(rng) };
+
+            cs.AddComponent(e, std::move(t));
+            cs.AddComponent(e, std::move(body));
+            cs.AddComponent(e, std::move(collider));
+        }
+    }
+
+    StepResult MeasureSpatialSort(bool spatialSorting, int bodyCount, int steps)
+    {
+        EntityManager entities;
+        ComponentStore cs(entities);
+        BuildShuffledScene(entities, cs, bodyCount, 1234u);
+
+        PhysicsPipelineSystem physics;
+        physics.Initialize(entities, cs);
+        auto config = physics.GetConfig();
+        config.spatialSorting = spatialSorting;
+        config.spatialSortInterval = 1;
+        physics.SetConfig(config);
+
+        // Warm up: builds the broad-phase tree and performs the first sort, then keeps
+        // that order through the measured steps as a 30-step interval would
+        physics.Update(FIXED_TIMESTEP);
+        config.spatialSortInterval = 30;
+        physics.SetConfig(config);
+
+        CacheMissCounter counter;
+        counter.Start();
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < steps; ++i)
+            physics.Update(FIXED_TIMESTEP);
+        auto end = std::chrono::steady_clock::now();
+
+        StepResult result;
+        result.cacheMisses = counter.Stop();
+        result.msPerStep = std::chrono::duration<double, std::milli>(end - start).count() / steps;
+        result.spatialSorts = physics.GetStatistics().spatialSorts;
+        return result;
+    }
+
+    // Per-step state hashes of the shuffled scene in deterministic mode on a pool of the given size
+    std::vector<uint64_t> RecordStateHashes(size_t threadCount, int bodyCount, int steps)
+    {
+        Utils::ThreadPool::Shutdown();
+        Utils::ThreadPool::Initialize(threadCount);
+
+        EntityManager entities;
+        ComponentStore cs(entities);
+        BuildShuffledScene(entities, cs, bodyCount, 99u);
+
+        PhysicsPipelineSystem physics;
+        physics.Initialize(entities, cs);
+        auto config = physics.GetConfig();
+        config.deterministic = true;
+        config.stateHashing = true;
+        config.spatialSorting = true;
+        config.spatialSortInterval = 20;
+        physics.SetConfig(config);
+
+        std::vector<uint64_t> hashes;
+        for (int i = 0; i < steps; ++i)
+        {
+            physics.Update(FIXED_TIMESTEP);
+            hashes.push_back(physics.GetStatistics().stateHash);
+        }
+
+        Utils::ThreadPool::Shutdown();
+        return hashes;
+    }
+}
+
+// ============================================================================
+// MORTON CODE TESTS
+// ============================================================================
+
+TEST(PhysicsPipelineTest, MortonEncodeInterleavesBits)
+{
+    LOG_FUNC_ENTER();
+    EXPECT_EQ(Physics::MortonEncode(0u, 0u), 0u);
+    EXPECT_EQ(Physics::MortonEncode(1u, 0u), 1u);
+    EXPECT_EQ(Physics::MortonEncode(0u, 1u), 2u);
+    EXPECT_EQ(Physics::MortonEncode(3u, 3u), 15u);
+    EXPECT_EQ(Physics::MortonEncode(0xFFFFu, 0xFFFFu), 0xFFFFFFFFu);
+
+    Math::Vector2 min{ 0.0f, 0.0f };
+    Math::Vector2 max{ 100.0f, 100.0f };
+    EXPECT_EQ(Physics::MortonEncode(Math::Vector2{ -50.0f, -50.0f }, min, max), 0u);
+    EXPECT_EQ(Physics::MortonEncode(Math::Vector2{ 500.0f, 500.0f }, min, max), 0xFFFFFFFFu);
+    EXPECT_LT(Physics::MortonEncode(Math::Vector2{ 10.0f, 10.0f }, min, max),
+              Physics::MortonEncode(Math::Vector2{ 90.0f, 90.0f }, min, max));
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// SPATIAL SORT TESTS
+// ============================================================================
+
+TEST(PhysicsPipelineTest, SpatialSortOrdersBodyPoolByMortonKey)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+    BuildShuffledScene(entities, cs, 64, 42u);
+
+    PhysicsPipelineSystem physics;
+    physics.Initialize(entities, cs);
+    auto config = physics.GetConfig();
+    config.spatialSorting = true;
+    config.spatialSortInterval = 1;
+    physics.SetConfig(config);
+    physics.Update(FIXED_TIMESTEP);
+
+    EXPECT_EQ(physics.GetStatistics().spatialSorts, 1u);
+
+    // Pools stay consistent: every body still resolves its own transform and collider
+    const auto& bodies = cs.GetEntitiesWithComponent<PhysicsBodyComponent>();
+    const auto& transforms = cs.GetEntitiesWithComponent<TransformComponent>();
+    ASSERT_EQ(bodies.size(), 64u);
+    for (EntityID e : bodies)
+    {
+        EXPECT_TRUE(cs.HasComponent<TransformComponent>(e));
+        EXPECT_TRUE(cs.HasComponent<ColliderComponent>(e));
+    }
+
+    // Body and transform pools share the same dense order after sorting
+    for (size_t i = 0; i < bodies.size(); ++i)
+        EXPECT_EQ(bodies[i], transforms[i]);
+
+    // The second half of the sorted pool lies (on average) further along the
+    // Z-curve than the first; a shuffled pool would not show a clear split.
+    auto centroid = [&](size_t begin, size_t end) {
+        Math::Vector2 sum{ 0.0f, 0.0f };
+        for (size_t i = begin; i < end; ++i)
+            sum += cs.GetComponent<TransformComponent>(bodies[i]).position;
+        return sum * (1.0f / static_cast<float>(end - begin));
+    };
+    Math::Vector2 firstQuarter = centroid(0, 16);
+    Math::Vector2 lastQuarter = centroid(48, 64);
+    EXPECT_LT(firstQuarter.x + firstQuarter.y, lastQuarter.x + lastQuarter.y);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// SIMULATION LOD TESTS
+// ============================================================================
+
+TEST(PhysicsPipelineTest, SimulationLODDefersDistantIslands)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    EntityID worldEntity = entities.CreateEntity();
+    PhysicsWorldComponent world;
+    world.gravity = { 0.0f, 0.0f };
+    cs.AddComponent(worldEntity, std::move(world));
+
+    // Two drifting circles: one at the focus, one well past the eighth-rate distance
+    auto addBody = [&](const Math::Vector2& position) {
+        EntityID e = entities.CreateEntity();
+        TransformComponent t;
+        t.position = position;
+        t.previousPosition = position;
+        ColliderComponent::CircleShape circle;
+        circle.radius = 10.0f;
+        ColliderComponent collider(circle);
+        PhysicsBodyComponent body;
+        body.SetMass(1.0f);
+        body.SetInertia(collider.CalculateInertiaPerUnitMass() * body.mass);
+        body.allowSleep = false;
+        body.velocity = { 60.0f, 0.0f };
+        cs.AddComponent(e, std::move(t));
+        cs.AddComponent(e, std::move(body));
+        cs.AddComponent(e, std::move(collider));
+        return e;
+    };
+    EntityID nearBody = addBody({ 0.0f, 0.0f });
+    EntityID farBody = addBody({ 20000.0f, 0.0f });
+
+    PhysicsPipelineSystem physics;
+    physics.Initialize(entities, cs);
+    auto config = physics.GetConfig();
+    config.simulationLOD = true;
+    physics.SetConfig(config);
+    physics.SetLODFocus({ 0.0f, 0.0f });
+
+    size_t deferredSteps = 0;
+    for (int i = 0; i < 13; ++i)
+    {
+        physics.Update(FIXED_TIMESTEP);
+        if (physics.GetStatistics().lodDeferredBodies > 0)
+            deferredSteps++;
+        EXPECT_LE(physics.GetStatistics().lodDeferredBodies, 1u);
+    }
+    EXPECT_GT(deferredSteps, 8u);
+    EXPECT_EQ(physics.GetStatistics().lodReducedRateBodies, 1u);
+
+    float nearTravel = cs.GetComponent<TransformComponent>(nearBody).position.x;
+    float farTravel = cs.GetComponent<TransformComponent>(farBody).position.x - 20000.0f;
+    EXPECT_FLOAT_NEAR(nearTravel, 13 * 60.0f * FIXED_TIMESTEP, 1e-3f);
+    EXPECT_LT(farTravel, nearTravel - 1e-3f);
+
+    // Moving the focus onto the far body flushes its accumulated time at once
+    physics.SetLODFocus({ 20000.0f, 0.0f });
+    physics.Update(FIXED_TIMESTEP);
+    nearTravel = cs.GetComponent<TransformComponent>(nearBody).position.x;
+    farTravel = cs.GetComponent<TransformComponent>(farBody).position.x - 20000.0f;
+    EXPECT_FLOAT_NEAR(farTravel, 14 * 60.0f * FIXED_TIMESTEP, 1e-2f);
+    EXPECT_GE(nearTravel, 12 * 60.0f * FIXED_TIMESTEP);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// IDLE SKIPPING TESTS
+// ============================================================================
+
+TEST(PhysicsPipelineTest, IdleSkippingSkipsSleepingWorldsUntilWoken)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    EntityID worldEntity = entities.CreateEntity();
+    PhysicsWorldComponent world;
+    world.gravity = { 0.0f, 0.0f };
+    cs.AddComponent(worldEntity, std::move(world));
+
+    EntityID ball = entities.CreateEntity();
+    ColliderComponent::CircleShape circle;
+    circle.radius = 10.0f;
+    PhysicsBodyComponent body;
+    body.SetMass(1.0f);
+    cs.AddComponent(ball, TransformComponent());
+    cs.AddComponent(ball, std::move(body));
+    cs.AddComponent(ball, ColliderComponent(circle));
+
+    PhysicsPipelineSystem physics;
+    physics.Initialize(entities, cs);
+    auto config = physics.GetConfig();
+    config.idleSkipping = true;
+    physics.SetConfig(config);
+
+    // A body at rest falls asleep after TIME_TO_SLEEP, then steps are skipped
+    for (int i = 0; i < 120 && !physics.IsIdle(); ++i)
+        physics.Update(FIXED_TIMESTEP);
+    ASSERT_TRUE(physics.IsIdle());
+    uint64_t skipped = physics.GetStatistics().idleSkippedSteps;
+    physics.Update(FIXED_TIMESTEP);
+    EXPECT_EQ(physics.GetStatistics().idleSkippedSteps, skipped + 1);
+
+    // RequestStep forces one full step
+    physics.RequestStep();
+    physics.Update(FIXED_TIMESTEP);
+    EXPECT_FALSE(physics.IsIdle());
+    EXPECT_EQ(physics.GetStatistics().idleSkippedSteps, skipped + 1);
+
+    // Impulses wake the body, which then moves again
+    cs.GetComponent<PhysicsBodyComponent>(ball).ApplyLinearImpulse({ 60.0f, 0.0f });
+    physics.Update(FIXED_TIMESTEP);
+    EXPECT_FALSE(physics.IsIdle());
+    EXPECT_GT(cs.GetComponent<TransformComponent>(ball).position.x, 0.5f);
+
+    // A new body is stepped even if it was created asleep
+    EntityID added = entities.CreateEntity();
+    PhysicsBodyComponent sleeper;
+    sleeper.SetMass(1.0f);
+    sleeper.isAwake = false;
+    cs.AddComponent(added, TransformComponent());
+    cs.AddComponent(added, std::move(sleeper));
+    cs.GetComponent<PhysicsBodyComponent>(ball).SetAwake(false);
+    physics.Update(FIXED_TIMESTEP);
+    EXPECT_FALSE(physics.IsIdle());
+    LOG_FUNC_EXIT();
+}
+
+TEST(PhysicsPipelineTest, RestingStacksSleepAndWakeOnContact)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    EntityID worldEntity = entities.CreateEntity();
+    PhysicsWorldComponent world;
+    world.gravity = { 0.0f, -980.0f };
+    cs.AddComponent(worldEntity, std::move(world));
+
+    EntityID ground = entities.CreateEntity();
+    PhysicsBodyComponent groundBody;
+    groundBody.isStatic = true;
+    groundBody.UpdateMassProperties();
+    cs.AddComponent(ground, TransformComponent({ 0.0f, -10.0f }));
+    cs.AddComponent(ground, std::move(groundBody));
+    cs.AddComponent(ground, ColliderComponent(ColliderComponent::PolygonShape({
+        { -500.0f, -10.0f }, { 500.0f, -10.0f }, { 500.0f, 10.0f }, { -500.0f, 10.0f } })));
+
+    auto addBall = [&](const Math::Vector2& position) {
+        EntityID e = entities.CreateEntity();
+        ColliderComponent::CircleShape circle;
+        circle.radius = 10.0f;
+        PhysicsBodyComponent body;
+        body.SetMass(1.0f);
+        cs.AddComponent(e, TransformComponent(position));
+        cs.AddComponent(e, std::move(body));
+        cs.AddComponent(e, ColliderComponent(circle));
+        return e;
+    };
+    EntityID left = addBall({ -100.0f, 15.0f });
+    addBall({ 100.0f, 15.0f });
+
+    PhysicsPipelineSystem physics;
+    physics.Initialize(entities, cs);
+
+    // The shared static ground must not join both balls into one unsleepable island
+    for (int i = 0; i < 120; ++i)
+        physics.Update(FIXED_TIMESTEP);
+    EXPECT_EQ(physics.GetStatistics().awakeBodies, 0u);
+    EXPECT_EQ(physics.GetStatistics().sleepingBodies, 2u);
+    EXPECT_FALSE(cs.GetComponent<PhysicsBodyComponent>(left).isAwake);
+
+    // A falling body that lands on a sleeper wakes it
+    addBall({ -97.0f, 80.0f });
+    bool woke = false;
+    for (int i = 0; i < 40 && !woke; ++i)
+    {
+        physics.Update(FIXED_TIMESTEP);
+        woke = cs.GetComponent<PhysicsBodyComponent>(left).isAwake;
+    }
+    EXPECT_TRUE(woke);
+    LOG_FUNC_EXIT();
+}
+
+TEST(PhysicsPipelineTest, SleepingProxiesFreezeAndKeepTheirContacts)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    EntityID worldEntity = entities.CreateEntity();
+    PhysicsWorldComponent world;
+    world.gravity = { 0.0f, -980.0f };
+    cs.AddComponent(worldEntity, std::move(world));
+
+    EntityID ground = entities.CreateEntity();
+    PhysicsBodyComponent groundBody;
+    groundBody.isStatic = true;
+    groundBody.UpdateMassProperties();
+    cs.AddComponent(ground, TransformComponent({ 0.0f, -10.0f }));
+    cs.AddComponent(ground, std::move(groundBody));
+    cs.AddComponent(ground, ColliderComponent(ColliderComponent::PolygonShape({
+        { -500.0f, -10.0f }, { 500.0f, -10.0f }, { 500.0f, 10.0f }, { -500.0f, 10.0f } })));
+
+    // Two rows of three touching balls: each row is one island resting on the ground
+    auto addBall = [&](const Math::Vector2& position) {
+        EntityID e = entities.CreateEntity();
+        PhysicsBodyComponent body;
+        body.SetMass(1.0f);
+        cs.AddComponent(e, TransformComponent(position));
+        cs.AddComponent(e, std::move(body));
+        cs.AddComponent(e, ColliderComponent(10.0f));
+        return e;
+    };
+    std::vector<EntityID> row;
+    for (int i = 0; i < 3; ++i)
+    {
+        row.push_back(addBall({ -100.0f + i * 19.9f, 10.0f }));
+        addBall({ 100.0f + i * 19.9f, 10.0f });
+    }
+
+    PhysicsPipelineSystem physics;
+    physics.Initialize(entities, cs);
+    for (int i = 0; i < 240 && physics.GetStatistics().sleepingBodies < 6; ++i)
+        physics.Update(FIXED_TIMESTEP);
+    ASSERT_EQ(physics.GetStatistics().sleepingBodies, 6u);
+    physics.Update(FIXED_TIMESTEP);
+    size_t restingContacts = physics.GetStatistics().narrowPhaseContacts;
+    Math::Vector2 lastRest = cs.GetComponent<TransformComponent>(row.back()).position;
+
+    // Asleep: nothing is refit or queried, and the contacts (ball-ball and ball-ground) carry over
+    physics.Update(FIXED_TIMESTEP);
+    const auto& stats = physics.GetStatistics();
+    EXPECT_EQ(stats.frozenProxies, 6u);
+    EXPECT_EQ(stats.broadPhasePairs, 0u);
+    EXPECT_EQ(stats.retainedContacts, restingContacts);
+    EXPECT_EQ(stats.narrowPhaseContacts, restingContacts);
+    EXPECT_EQ(restingContacts, 10u);
+    EXPECT_EQ(stats.islandStats.totalIslands, 2u);
+    EXPECT_EQ(cs.GetComponent<TransformComponent>(row.back()).position.x, lastRest.x);
+
+    // A ball landing on one end of a row wakes the whole row through the retained
+    // contacts; the other row stays frozen
+    addBall({ -103.0f, 80.0f });
+    bool woke = false;
+    for (int i = 0; i < 40 && !woke; ++i)
+    {
+        physics.Update(FIXED_TIMESTEP);
+        woke = cs.GetComponent<PhysicsBodyComponent>(row.front()).isAwake;
+    }
+    EXPECT_TRUE(woke);
+    EXPECT_TRUE(cs.GetComponent<PhysicsBodyComponent>(row.back()).isAwake);
+    physics.Update(FIXED_TIMESTEP);
+    EXPECT_EQ(physics.GetStatistics().frozenProxies, 3u);
+
+    // Without freezing, the sleepers query the tree again
+    auto config = physics.GetConfig();
+    config.freezeSleepingProxies = false;
+    physics.SetConfig(config);
+    physics.Update(FIXED_TIMESTEP);
+    EXPECT_EQ(physics.GetStatistics().frozenProxies, 0u);
+    EXPECT_EQ(physics.GetStatistics().retainedContacts, 0u);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// ADAPTIVE ITERATION TESTS
+// ============================================================================
+
+TEST(PhysicsPipelineTest, AdaptiveIterationsStopConvergedIslands)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    EntityID worldEntity = entities.CreateEntity();
+    PhysicsWorldComponent world;
+    world.gravity = { 0.0f, -980.0f };
+    cs.AddComponent(worldEntity, std::move(world));
+
+    EntityID ground = entities.CreateEntity();
+    PhysicsBodyComponent groundBody;
+    groundBody.isStatic = true;
+    groundBody.UpdateMassProperties();
+    cs.AddComponent(ground, TransformComponent({ 0.0f, -10.0f }));
+    cs.AddComponent(ground, std::move(groundBody));
+    cs.AddComponent(ground, ColliderComponent(ColliderComponent::PolygonShape({
+        { -500.0f, -10.0f }, { 500.0f, -10.0f }, { 500.0f, 10.0f }, { -500.0f, 10.0f } })));
+
+    auto addBall = [&](const Math::Vector2& position) {
+        EntityID e = entities.CreateEntity();
+        ColliderComponent::CircleShape circle;
+        circle.radius = 10.0f;
+        PhysicsBodyComponent body;
+        body.SetMass(1.0f);
+        body.allowSleep = false;
+        cs.AddComponent(e, TransformComponent(position));
+        cs.AddComponent(e, std::move(body));
+        cs.AddComponent(e, ColliderComponent(circle));
+        return e;
+    };
+    EntityID target = addBall({ -200.0f, 10.0f });
+    addBall({ 0.0f, 10.0f });
+    EntityID resting = addBall({ 200.0f, 10.0f });
+
+    PhysicsPipelineSystem physics;
+    physics.Initialize(entities, cs);
+    auto config = physics.GetConfig();
+    config.adaptiveIterations = true;
+    config.maxVelocityIterations = 12;
+    physics.SetConfig(config);
+
+    // Balls resting alone on the ground converge in the minimum iteration count
+    for (int i = 0; i < 60; ++i)
+        physics.Update(FIXED_TIMESTEP);
+    const auto& stats = physics.GetStatistics();
+    EXPECT_EQ(stats.solverIslands, 3u);
+    EXPECT_EQ(stats.velocityIterationsTotal, 3u);
+    EXPECT_EQ(stats.velocityIterationsMax, 1u);
+    EXPECT_EQ(stats.positionIterationsMax, 1u);
+    EXPECT_NEAR(cs.GetComponent<TransformComponent>(resting).position.y, 10.0f, 0.5f);
+
+    // An impact makes only the struck island iterate longer, within the cap
+    addBall({ -195.0f, 80.0f });
+    size_t busiest = 0;
+    for (int i = 0; i < 40; ++i)
+    {
+        physics.Update(FIXED_TIMESTEP);
+        busiest = std::max(busiest, stats.velocityIterationsMax);
+        EXPECT_LE(stats.velocityIterationsMax, 12u);
+        EXPECT_LE(stats.velocityIterationsTotal, stats.velocityIterationsMax + stats.solverIslands - 1);
+    }
+    EXPECT_GT(busiest, 1u);
+    EXPECT_TRUE(cs.GetComponent<PhysicsBodyComponent>(target).isAwake);
+    EXPECT_NEAR(cs.GetComponent<TransformComponent>(resting).position.y, 10.0f, 0.5f);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// MOTION LOCK TESTS
+// ============================================================================
+
+TEST(PhysicsPipelineTest, MotionLocksHoldAfterLockFreeSteps)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+
+    EntityID worldEntity = entities.CreateEntity();
+    PhysicsWorldComponent world;
+    world.gravity = { 0.0f, -980.0f };
+    cs.AddComponent(worldEntity, std::move(world));
+
+    EntityID ground = entities.CreateEntity();
+    PhysicsBodyComponent groundBody;
+    groundBody.isStatic = true;
+    groundBody.UpdateMassProperties();
+    cs.AddComponent(ground, TransformComponent({ 0.0f, -10.0f }));
+    cs.AddComponent(ground, std::move(groundBody));
+    cs.AddComponent(ground, ColliderComponent(ColliderComponent::PolygonShape({
+        { -500.0f, -10.0f }, { 500.0f, -10.0f }, { 500.0f, 10.0f }, { -500.0f, 10.0f } })));
+
+    auto addBall = [&](const Math::Vector2& position, bool locked) {
+        EntityID e = entities.CreateEntity();
+        ColliderComponent::CircleShape circle;
+        circle.radius = 10.0f;
+        PhysicsBodyComponent body;
+        body.SetMass(1.0f);
+        body.allowSleep = false;
+        body.velocity = { 200.0f, 0.0f };
+        body.angularVelocity = 3.0f;
+        body.motionLocks.lockTranslationX = locked;
+        body.motionLocks.lockRotation = locked;
+        cs.AddComponent(e, TransformComponent(position));
+        cs.AddComponent(e, std::move(body));
+        cs.AddComponent(e, ColliderComponent(circle));
+        return e;
+    };
+    EntityID free = addBall({ -200.0f, 40.0f }, false);
+
+    PhysicsPipelineSystem physics;
+    physics.Initialize(entities, cs);
+
+    // Lock-free steps run the specialization without lock handling
+    for (int i = 0; i < 10; ++i)
+        physics.Update(FIXED_TIMESTEP);
+
+    EntityID locked = addBall({ 200.0f, 40.0f }, true);
+    float freeStartX = cs.GetComponent<TransformComponent>(free).position.x;
+    for (int i = 0; i < 60; ++i)
+        physics.Update(FIXED_TIMESTEP);
+
+    const auto& lockedTransform = cs.GetComponent<TransformComponent>(locked);
+    EXPECT_FLOAT_EQ(lockedTransform.position.x, 200.0f);
+    EXPECT_FLOAT_EQ(lockedTransform.rotation, 0.0f);
+    EXPECT_NEAR(lockedTransform.position.y, 10.0f, 1.0f);  // Still falls onto the ground
+    EXPECT_FLOAT_EQ(cs.GetComponent<PhysicsBodyComponent>(locked).velocity.x, 0.0f);
+    EXPECT_GT(cs.GetComponent<TransformComponent>(free).position.x, freeStartX + 50.0f);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// DETERMINISM TESTS
+// ============================================================================
+
+TEST(PhysicsPipelineTest, DeterministicModeHashesMatchAcrossThreadCounts)
+{
+    LOG_FUNC_ENTER();
+    constexpr int BODIES = 400;
+    constexpr int STEPS = 90;
+
+    auto serial = RecordStateHashes(1, BODIES, STEPS);
+    auto serialRepeat = RecordStateHashes(1, BODIES, STEPS);
+    auto parallel = RecordStateHashes(4, BODIES, STEPS);
+
+    ASSERT_EQ(serial.size(), static_cast<size_t>(STEPS));
+    EXPECT_EQ(serial, serialRepeat);
+    for (int i = 0; i < STEPS; ++i)
+    {
+        ASSERT_EQ(serial[i], parallel[i]) << "State diverged at step " << i;
+    }
+
+    // The hash tracks the state: drifting bodies change it every step
+    EXPECT_NE(serial.front(), serial.back());
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PERFORMANCE TESTS
+// ============================================================================
+
+TEST(PhysicsPipelinePerformanceTest, SpatialSortCacheMisses)
+{
+    LOG_FUNC_ENTER();
+    constexpr int BODY_COUNT = 50000;
+    constexpr int STEPS = 5;
+
+    StepResult unsorted = MeasureSpatialSort(false, BODY_COUNT, STEPS);
+    StepResult sorted = MeasureSpatialSort(true, BODY_COUNT, STEPS);
+
+    std::cout << "[PhysicsPipelinePerformanceTest] " << BODY_COUNT << " bodies, " << STEPS << " steps\n"
+              << "  insertion order: " << unsorted.msPerStep << " ms/step, LLC misses "
+              << (unsorted.cacheMisses >= 0 ? std::to_string(unsorted.cacheMisses) : std::string("n/a")) << "\n"
+              << "  morton order:    " << sorted.msPerStep << " ms/step, LLC misses "
+              << (sorted.cacheMisses >= 0 ? std::to_string(sorted.cacheMisses) : std::string("n/a")) << "\n";
+
+    EXPECT_GT(unsorted.msPerStep, 0.0);
+    EXPECT_GT(sorted.msPerStep, 0.0);
+    EXPECT_EQ(unsorted.spatialSorts, 0u);
+    EXPECT_GE(sorted.spatialSorts, 1u);
+    LOG_FUNC_EXIT();
+}
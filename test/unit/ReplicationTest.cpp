@@ -0,0 +1,364 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/network/BitStream.h"
+#include "nyon/network/Replication.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+using namespace Nyon;
+using namespace Nyon::ECS;
+using namespace Nyon::Network;
+
+/**
+ * @brief Tests for bit-packed, delta-compressed state replication.
+ *
+ * Tests cover:
+ * - BitWriter/BitReader round trip and truncation
+ * - Loopback server/client convergence with and without packet loss
+ * - Entity removal
+ * - Packets naming entity IDs above the configured maximum
+ * - Packet budget and relevance prioritization
+ * - Bytes per tick and encode/decode time at 10k entities
+ */
+
+namespace
+{
+    std::vector<EntityID> SpawnGrid(EntityManager& entities, ComponentStore& cs, int count, float spacing)
+    {
+        std::vector<EntityID> ids;
+        int columns = static_cast<int>(std::sqrt(static_cast<float>(count)));
+        for (int i = 0; i < count; ++i)
+        {
+            EntityID e = entities.CreateEntity();
+            TransformComponent t({ (i % columns) * spacing, (i / columns) * spacing });
+            cs.AddComponent(e, std::move(t));
+            cs.AddComponent(e, PhysicsBodyComponent{});
+            ids.push_back(e);
+        }
+        return ids;
+    }
+
+    // Moves every stride-th entity as a simple ballistic body
+    void StepWorld(ComponentStore& cs, const std::vector<EntityID>& ids, int stride, int tick)
+    {
+        for (size_t i = static_cast<size_t>(tick % stride); i < ids.size(); i += stride)
+        {
+            auto& transform = cs.GetComponent<TransformComponent>(ids[i]);
+            auto& body = cs.GetComponent<PhysicsBodyComponent>(ids[i]);
+            body.velocity = { 30.0f * std::sin(0.05f * tick + i), -20.0f + 5.0f * std::cos(0.1f * tick) };
+            body.angularVelocity = 0.5f * std::sin(0.02f * tick * i);
+            transform.position += body.velocity * (1.0f / 60.0f);
+            transform.rotation += body.angularVelocity * (1.0f / 60.0f);
+        }
+    }
+
+    void ExpectClientMatchesServer(const ComponentStore& cs, const ReplicationClient& client,
+                                   const std::vector<EntityID>& ids, const ReplicationConfig& config)
+    {
+        for (EntityID id : ids)
+        {
+            QuantizedState received;
+            ASSERT_TRUE(client.GetQuantizedState(id, received)) << "entity " << id;
+            const PhysicsBodyComponent* body = &cs.GetComponent<PhysicsBodyComponent>(id);
+            EXPECT_EQ(received, QuantizeState(cs.GetComponent<TransformComponent>(id), body, config)) << "entity " << id;
+        }
+    }
+}
+
+// ============================================================================
+// BIT STREAM TESTS
+// ============================================================================
+
+TEST(ReplicationTest, BitStreamRoundTrip)
+{
+    LOG_FUNC_ENTER();
+    BitWriter writer;
+    writer.WriteBits(5, 3);
+    writer.WriteBool(true);
+    writer.WriteBits(0xDEADBEEFu, 32);
+    writer.WriteSigned(-1234567);
+    writer.WriteVarBits(0);
+
+    // A record that does not fit is rolled back without disturbing earlier bits
+    size_t mark = writer.GetBitCount();
+    writer.WriteSigned(99999);
+    writer.Truncate(mark);
+    writer.WriteSigned(-7);
+
+    const auto& bytes = writer.Finish();
+    BitReader reader(bytes.data(), bytes.size());
+    EXPECT_EQ(reader.ReadBits(3), 5u);
+    EXPECT_TRUE(reader.ReadBool());
+    EXPECT_EQ(reader.ReadBits(32), 0xDEADBEEFu);
+    EXPECT_EQ(reader.ReadSigned(), -1234567);
+    EXPECT_EQ(reader.ReadVarBits(), 0u);
+    EXPECT_EQ(reader.ReadSigned(), -7);
+    EXPECT_FALSE(reader.IsOverflowed());
+
+    reader.ReadBits(32);
+    EXPECT_TRUE(reader.IsOverflowed());
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// LOOPBACK TESTS
+// ============================================================================
+
+TEST(ReplicationTest, LoopbackConvergesWithPacketLoss)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+    auto ids = SpawnGrid(entities, cs, 300, 40.0f);
+
+    ReplicationConfig config;
+    config.packetBudgetBytes = 0;
+    ReplicationServer server(cs, config);
+    ReplicationClient client(config);
+    uint32_t clientId = server.AddClient();
+
+    std::vector<uint8_t> packet;
+    std::vector<uint8_t> delivered;
+    size_t deltaEntities = 0;
+    for (int tick = 0; tick < 120; ++tick)
+    {
+        StepWorld(cs, ids, 3, tick);
+        server.CaptureSnapshot();
+        server.WritePacket(clientId, packet);
+        deltaEntities += server.GetStatistics().deltaEntities;
+
+        // Every fourth packet is lost; the rest arrive and are acknowledged
+        if (tick % 4 == 3)
+            continue;
+        ASSERT_TRUE(client.ReadPacket(packet.data(), packet.size())) << "tick " << tick;
+        delivered = packet;
+        server.Acknowledge(clientId, client.GetLastSequence());
+        ExpectClientMatchesServer(cs, client, ids, config);
+    }
+
+    EXPECT_EQ(client.GetEntityCount(), ids.size());
+    EXPECT_GT(deltaEntities, 0u);
+
+    // Duplicated packets are rejected
+    EXPECT_FALSE(client.ReadPacket(delivered.data(), delivered.size()));
+    LOG_FUNC_EXIT();
+}
+
+TEST(ReplicationTest, RemovedEntitiesAreReplicated)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+    auto ids = SpawnGrid(entities, cs, 20, 40.0f);
+
+    ReplicationConfig config;
+    ReplicationServer server(cs, config);
+    ReplicationClient client(config);
+    uint32_t clientId = server.AddClient();
+
+    std::vector<uint8_t> packet;
+    auto tick = [&] {
+        server.CaptureSnapshot();
+        server.WritePacket(clientId, packet);
+        ASSERT_TRUE(client.ReadPacket(packet.data(), packet.size()));
+        server.Acknowledge(clientId, client.GetLastSequence());
+    };
+
+    tick();
+    EXPECT_EQ(client.GetEntityCount(), 20u);
+
+    entities.DestroyEntity(ids[5], cs);
+    tick();
+    EXPECT_EQ(client.GetEntityCount(), 19u);
+    EXPECT_FALSE(client.HasEntity(ids[5]));
+
+    // Once the removal is acknowledged it is not repeated, and unchanged entities cost nothing
+    tick();
+    EXPECT_EQ(server.GetStatistics().removedEntities, 0u);
+    EXPECT_EQ(server.GetStatistics().sentEntities, 0u);
+    EXPECT_LE(server.GetStatistics().packetBytes, 5u);
+
+    // A removal in a lost packet is sent again on later ticks
+    entities.DestroyEntity(ids[12], cs);
+    server.CaptureSnapshot();
+    server.WritePacket(clientId, packet);
+    EXPECT_EQ(server.GetStatistics().removedEntities, 1u);
+    tick();
+    EXPECT_EQ(server.GetStatistics().removedEntities, 1u);
+    EXPECT_EQ(client.GetEntityCount(), 18u);
+    EXPECT_FALSE(client.HasEntity(ids[12]));
+    tick();
+    EXPECT_EQ(server.GetStatistics().removedEntities, 0u);
+    LOG_FUNC_EXIT();
+}
+
+TEST(ReplicationTest, RejectsPacketsWithOutOfRangeEntityIds)
+{
+    LOG_FUNC_ENTER();
+    ReplicationConfig config;
+    config.maxEntityId = 1000;
+    ReplicationClient client(config);
+
+    // Sequence, removal list, then one full entity record (or an empty list)
+    auto buildPacket = [](uint32_t sequence, int32_t removedDelta, int32_t entityDelta) {
+        BitWriter writer;
+        writer.WriteBits(sequence, 32);
+        if (removedDelta >= 0)
+        {
+            writer.WriteBool(true);
+            writer.WriteSigned(removedDelta);
+        }
+        writer.WriteBool(false);
+        if (entityDelta >= 0)
+        {
+            writer.WriteBool(true);
+            writer.WriteSigned(entityDelta);
+            writer.WriteBool(false);
+            writer.WriteBits(1u << QuantizedState::PositionX, QuantizedState::FIELD_COUNT);
+            writer.WriteSigned(64);
+        }
+        writer.WriteBool(false);
+        return writer.Finish();
+    };
+
+    // A delta near 2^31 would otherwise size the client's entity table from the packet
+    std::vector<uint8_t> packet = buildPacket(1, -1, 0x7FFFFFF0);
+    EXPECT_FALSE(client.ReadPacket(packet.data(), packet.size()));
+    packet = buildPacket(1, 0x7FFFFFF0, -1);
+    EXPECT_FALSE(client.ReadPacket(packet.data(), packet.size()));
+    packet = buildPacket(1, 3, 1001);
+    EXPECT_FALSE(client.ReadPacket(packet.data(), packet.size()));
+    EXPECT_EQ(client.GetLastSequence(), 0u);
+    EXPECT_EQ(client.GetEntityCount(), 0u);
+
+    // The largest allowed ID is still accepted
+    packet = buildPacket(1, -1, 1000);
+    ASSERT_TRUE(client.ReadPacket(packet.data(), packet.size()));
+    ReplicatedState state;
+    ASSERT_TRUE(client.GetState(1000, state));
+    EXPECT_FLOAT_EQ(state.position.x, 64 * config.positionResolution);
+    LOG_FUNC_EXIT();
+}
+
+TEST(ReplicationTest, BudgetPrioritizesEntitiesNearFocus)
+{
+    LOG_FUNC_ENTER();
+    EntityManager entities;
+    ComponentStore cs(entities);
+    auto ids = SpawnGrid(entities, cs, 2500, 100.0f);
+
+    ReplicationConfig config;
+    config.packetBudgetBytes = 600;
+    config.relevanceRadius = 500.0f;
+    ReplicationServer server(cs, config);
+    ReplicationClient client(config);
+    uint32_t clientId = server.AddClient();
+    server.SetClientFocus(clientId, { 0.0f, 0.0f });
+
+    std::vector<uint8_t> packet;
+    std::vector<int> updates(ids.size(), 0);
+    for (int tick = 0; tick < 300; ++tick)
+    {
+        StepWorld(cs, ids, 1, tick);
+        server.CaptureSnapshot();
+        server.WritePacket(clientId, packet);
+        EXPECT_LE(packet.size(), config.packetBudgetBytes);
+        ASSERT_TRUE(client.ReadPacket(packet.data(), packet.size()));
+        server.Acknowledge(clientId, client.GetLastSequence());
+
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            QuantizedState state;
+            if (client.GetQuantizedState(ids[i], state) &&
+                state == QuantizeState(cs.GetComponent<TransformComponent>(ids[i]), &cs.GetComponent<PhysicsBodyComponent>(ids[i]), config))
+                updates[i]++;
+        }
+    }
+
+    // Corner at the focus vs the far corner of the 5000 x 5000 grid
+    int nearUpdates = updates.front();
+    int farUpdates = updates.back();
+    std::cout << "[ReplicationTest] fresh ticks: near " << nearUpdates << ", far " << farUpdates << " of 300\n";
+    EXPECT_GT(nearUpdates, farUpdates);
+    // Accumulated priority still lets far entities through eventually
+    EXPECT_TRUE(client.HasEntity(ids.back()));
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PERFORMANCE TESTS
+// ============================================================================
+
+TEST(ReplicationPerformanceTest, LoopbackTenThousandEntities)
+{
+    LOG_FUNC_ENTER();
+    constexpr int ENTITIES = 10000;
+    constexpr int TICKS = 120;
+    constexpr int MOVING_STRIDE = 5; // a fifth of the world moves each tick
+
+    for (size_t budget : { size_t(0), size_t(1200) })
+    {
+        EntityManager entities;
+        ComponentStore cs(entities);
+        auto ids = SpawnGrid(entities, cs, ENTITIES, 30.0f);
+
+        ReplicationConfig config;
+        config.packetBudgetBytes = budget;
+        ReplicationServer server(cs, config);
+        ReplicationClient client(config);
+        uint32_t clientId = server.AddClient();
+        server.SetClientFocus(clientId, { 1500.0f, 1500.0f });
+
+        // First tick sends the whole world in full; measure steady state after it
+        std::vector<uint8_t> packet;
+        server.CaptureSnapshot();
+        server.WritePacket(clientId, packet);
+        size_t initialBytes = packet.size();
+        client.ReadPacket(packet.data(), packet.size());
+        server.Acknowledge(clientId, client.GetLastSequence());
+
+        double encodeMs = 0.0;
+        double decodeMs = 0.0;
+        size_t totalBytes = 0;
+        for (int tick = 0; tick < TICKS; ++tick)
+        {
+            for (size_t i = 0; i < ids.size(); i += MOVING_STRIDE)
+            {
+                auto& transform = cs.GetComponent<TransformComponent>(ids[i]);
+                auto& body = cs.GetComponent<PhysicsBodyComponent>(ids[i]);
+                body.velocity = { 40.0f * std::sin(0.03f * (tick + i)), -30.0f };
+                transform.position += body.velocity * (1.0f / 60.0f);
+            }
+
+            auto encodeStart = std::chrono::steady_clock::now();
+            server.CaptureSnapshot();
+            server.WritePacket(clientId, packet);
+            auto encodeEnd = std::chrono::steady_clock::now();
+            ASSERT_TRUE(client.ReadPacket(packet.data(), packet.size()));
+            auto decodeEnd = std::chrono::steady_clock::now();
+            server.Acknowledge(clientId, client.GetLastSequence());
+
+            encodeMs += std::chrono::duration<double, std::milli>(encodeEnd - encodeStart).count();
+            decodeMs += std::chrono::duration<double, std::milli>(decodeEnd - encodeEnd).count();
+            totalBytes += packet.size();
+        }
+
+        // Naive scheme: position, rotation, velocity and angular velocity as floats plus a 32-bit ID
+        size_t naiveBytes = ENTITIES * (6 * sizeof(float) + sizeof(EntityID));
+        std::cout << "[ReplicationPerformanceTest] " << ENTITIES << " entities, budget "
+                  << (budget ? std::to_string(budget) + " B" : std::string("unlimited"))
+                  << ": initial " << initialBytes << " B, " << (totalBytes / TICKS) << " B/tick (naive "
+                  << naiveBytes << " B), encode " << (encodeMs / TICKS) << " ms, decode "
+                  << (decodeMs / TICKS) << " ms\n";
+
+        if (budget == 0)
+        {
+            EXPECT_EQ(client.GetEntityCount(), static_cast<size_t>(ENTITIES));
+        }
+        EXPECT_LT(totalBytes / TICKS, naiveBytes / 4);
+    }
+    LOG_FUNC_EXIT();
+}
@@ -0,0 +1,341 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "nyon/utils/ThreadPool.h"
+#include "nyon/ecs/EntityManager.h"
+#include "nyon/ecs/ComponentStore.h"
+#include "nyon/ecs/systems/PhysicsPipelineSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+using namespace Nyon;
+using namespace Nyon::ECS;
+using Nyon::Utils::ThreadPool;
+
+/**
+ * @brief Tests for ThreadPool topology detection and worker placement.
+ *
+ * Tests cover:
+ * - CPU topology detection
+ * - SMT-aware default thread counts and reserved cores
+ * - Worker pinning assignments
+ * - ParallelFor coverage, nesting and exceptions
+ * - Pinned vs unpinned physics step benchmark
+ * - Physics step scaling from 1 to N threads, with identical results at every count
+ */
+
+namespace
+{
+    // Static ground plus a grid of dynamic circles resting on it
+    void BuildCircleScene(EntityManager& entities, ComponentStore& cs, int columns, int rows)
+    {
+        EntityID worldEntity = entities.CreateEntity();
+        PhysicsWorldComponent world;
+        world.gravity = { 0.0f, -980.0f };
+        cs.AddComponent(worldEntity, std::move(world));
+
+        EntityID ground = entities.CreateEntity();
+        TransformComponent groundTransform;
+        groundTransform.position = { 0.0f, -25.0f };
+        groundTransform.previousPosition = groundTransform.position;
+        PhysicsBodyComponent groundBody;
+        groundBody.isStatic = true;
+        groundBody.UpdateMassProperties();
+        float halfWidth = columns * 12.0f + 100.0f;
+        ColliderComponent groundCollider(ColliderComponent::PolygonShape({
+            { -halfWidth, -25.0f }, { halfWidth, -25.0f }, { halfWidth, 25.0f }, { -halfWidth, 25.0f } }));
+        cs.AddComponent(ground, std::move(groundTransform));
+        cs.AddComponent(ground, std::move(groundBody));
+        cs.AddComponent(ground, std::move(groundCollider));
+
+        for (int y = 0; y < rows; ++y)
+        {
+            for (int x = 0; x < columns; ++x)
+            {
+                EntityID e = entities.CreateEntity();
+                TransformComponent t;
+                t.position = { (x - columns * 0.5f) * 24.0f, 20.0f + y * 24.0f };
+                t.previousPosition = t.position;
+
+                ColliderComponent::CircleShape circle;
+                circle.radius = 10.0f;
+                ColliderComponent collider(circle);
+
+                PhysicsBodyComponent body;
+                body.SetMass(1.0f);
+                body.SetInertia(collider.CalculateInertiaPerUnitMass() * body.mass);
+
+                cs.AddComponent(e, std::move(t));
+                cs.AddComponent(e, std::move(body));
+                cs.AddComponent(e, std::move(collider));
+            }
+        }
+    }
+
+    // Average physics step time (ms) with the singleton pool built from config. With
+    // stateHash the pipeline runs deterministically and reports its final state hash.
+    double MeasurePhysicsStep(const ThreadPool::Config& config, int steps, uint64_t* stateHash = nullptr)
+    {
+        ThreadPool::Shutdown();
+        ThreadPool::Initialize(config);
+
+        EntityManager entities;
+        ComponentStore cs(entities);
+        BuildCircleScene(entities, cs, 40, 25);
+
+        PhysicsPipelineSystem physics;
+        physics.Initialize(entities, cs);
+        if (stateHash)
+        {
+            auto pipelineConfig = physics.GetConfig();
+            pipelineConfig.deterministic = true;
+            pipelineConfig.stateHashing = true;
+            physics.SetConfig(pipelineConfig);
+        }
+
+        // Warm up so the broad-phase tree and contact cache are populated
+        for (int i = 0; i < 10; ++i)
+            physics.Update(FIXED_TIMESTEP);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < steps; ++i)
+            physics.Update(FIXED_TIMESTEP);
+        auto end = std::chrono::steady_clock::now();
+
+        if (stateHash)
+            *stateHash = physics.GetStatistics().stateHash;
+        ThreadPool::Shutdown();
+        return std::chrono::duration<double, std::milli>(end - start).count() / steps;
+    }
+}
+
+// ============================================================================
+// TOPOLOGY TESTS
+// ============================================================================
+
+TEST(ThreadPoolTest, DetectTopology)
+{
+    LOG_FUNC_ENTER();
+    auto topology = ThreadPool::DetectTopology();
+
+    ASSERT_FALSE(topology.physicalCores.empty());
+    EXPECT_GE(topology.logicalCount, topology.physicalCores.size());
+
+    std::set<int> seen;
+    size_t logical = 0;
+    for (const auto& core : topology.physicalCores)
+    {
+        EXPECT_FALSE(core.empty());
+        for (int cpu : core)
+        {
+            EXPECT_TRUE(seen.insert(cpu).second) << "CPU " << cpu << " listed twice";
+            logical++;
+        }
+    }
+    EXPECT_EQ(logical, topology.logicalCount);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// THREAD COUNT TESTS
+// ============================================================================
+
+TEST(ThreadPoolTest, DefaultCountUsesPhysicalCores)
+{
+    LOG_FUNC_ENTER();
+    auto topology = ThreadPool::DetectTopology();
+
+    ThreadPool::Config config;
+    ThreadPool pool(config);
+    EXPECT_EQ(pool.GetThreadCount(), topology.physicalCores.size());
+
+    config.physicalCoresOnly = false;
+    ThreadPool smtPool(config);
+    EXPECT_EQ(smtPool.GetThreadCount(), topology.logicalCount);
+    LOG_FUNC_EXIT();
+}
+
+TEST(ThreadPoolTest, ReservedCoresReduceDefaultCount)
+{
+    LOG_FUNC_ENTER();
+    auto topology = ThreadPool::DetectTopology();
+
+    ThreadPool::Config config;
+    config.reservedCores = 1;
+    ThreadPool pool(config);
+
+    size_t expected = topology.physicalCores.size() > 1 ? topology.physicalCores.size() - 1 : 1;
+    EXPECT_EQ(pool.GetThreadCount(), expected);
+
+    // Counting logical CPUs, a reserved core takes all of its SMT siblings with it
+    config.physicalCoresOnly = false;
+    ThreadPool smtPool(config);
+    size_t reservedLogical = topology.physicalCores.size() > 1 ? topology.physicalCores[0].size() : 0;
+    size_t expectedLogical = topology.logicalCount > reservedLogical ? topology.logicalCount - reservedLogical : 1;
+    EXPECT_EQ(smtPool.GetThreadCount(), expectedLogical);
+    config.physicalCoresOnly = true;
+
+    // Reserving every core still leaves one worker
+    config.reservedCores = 1000;
+    ThreadPool clamped(config);
+    EXPECT_GE(clamped.GetThreadCount(), 1u);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PINNING TESTS
+// ============================================================================
+
+TEST(ThreadPoolTest, UnpinnedWorkersHaveNoCpu)
+{
+    LOG_FUNC_ENTER();
+    ThreadPool pool(2);
+    ASSERT_EQ(pool.GetWorkerCpus().size(), 2u);
+    for (int cpu : pool.GetWorkerCpus())
+        EXPECT_EQ(cpu, -1);
+    LOG_FUNC_EXIT();
+}
+
+TEST(ThreadPoolTest, PinnedWorkersAvoidReservedCores)
+{
+    LOG_FUNC_ENTER();
+    auto topology = ThreadPool::DetectTopology();
+    if (topology.physicalCores.size() < 2)
+        GTEST_SKIP() << "Needs at least two physical cores";
+
+    ThreadPool::Config config;
+    config.pinWorkers = true;
+    config.reservedCores = 1;
+    ThreadPool pool(config);
+
+    const auto& reserved = topology.physicalCores.front();
+    for (int cpu : pool.GetWorkerCpus())
+    {
+        EXPECT_GE(cpu, 0);
+        EXPECT_EQ(std::count(reserved.begin(), reserved.end(), cpu), 0);
+    }
+
+    // Tasks still run on pinned workers
+    auto result = pool.Submit([] { return 42; });
+    EXPECT_EQ(result.get(), 42);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PARALLEL FOR TESTS
+// ============================================================================
+
+TEST(ThreadPoolTest, ParallelForCoversRangeOnce)
+{
+    LOG_FUNC_ENTER();
+    ThreadPool pool(4);
+    std::vector<int> hits(10007, 0);
+
+    pool.ParallelFor(hits.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+            hits[i]++;
+    }, 100);
+
+    EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), static_cast<long>(hits.size()));
+    EXPECT_EQ(pool.ResolveGrain(hits.size(), 100), 100u);
+    EXPECT_GE(pool.ResolveGrain(hits.size(), 0), 1u);
+    LOG_FUNC_EXIT();
+}
+
+TEST(ThreadPoolTest, NestedParallelForRunsInline)
+{
+    LOG_FUNC_ENTER();
+    ThreadPool pool(2);
+    std::atomic<size_t> total{0};
+
+    pool.ParallelFor(8, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            // Would deadlock if inner chunks waited on a saturated pool
+            pool.ParallelFor(100, [&](size_t b, size_t e) { total += e - b; }, 10);
+        }
+    }, 1);
+
+    EXPECT_EQ(total.load(), 800u);
+    LOG_FUNC_EXIT();
+}
+
+TEST(ThreadPoolTest, ParallelForWaitsForAllChunksWhenOneThrows)
+{
+    LOG_FUNC_ENTER();
+    ThreadPool pool(4);
+    std::atomic<int> finished{0};
+
+    // The second chunk throws at once; later chunks still use func and must finish first
+    EXPECT_THROW(pool.ParallelFor(16, [&](size_t begin, size_t) {
+        if (begin == 1)
+            throw std::runtime_error("chunk failed");
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        finished++;
+    }, 1), std::runtime_error);
+
+    EXPECT_EQ(finished.load(), 15);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PERFORMANCE TESTS
+// ============================================================================
+
+TEST(ThreadPoolPerformanceTest, PinnedVsUnpinnedPhysicsStep)
+{
+    LOG_FUNC_ENTER();
+    constexpr int STEPS = 60;
+
+    ThreadPool::Config unpinned;
+    ThreadPool::Config pinned;
+    pinned.pinWorkers = true;
+    pinned.reservedCores = 1;
+
+    double unpinnedMs = MeasurePhysicsStep(unpinned, STEPS);
+    double pinnedMs = MeasurePhysicsStep(pinned, STEPS);
+
+    std::cout << "[ThreadPoolPerformanceTest] 1000 bodies, " << STEPS << " steps: unpinned "
+              << unpinnedMs << " ms/step, pinned " << pinnedMs << " ms/step\n";
+
+    EXPECT_GT(unpinnedMs, 0.0);
+    EXPECT_GT(pinnedMs, 0.0);
+    LOG_FUNC_EXIT();
+}
+
+TEST(ThreadPoolPerformanceTest, PhysicsStepThreadScaling)
+{
+    LOG_FUNC_ENTER();
+    constexpr int STEPS = 60;
+    // At least 4 so the result check runs with several workers even on small machines
+    size_t maxThreads = std::max<size_t>(4, ThreadPool::DetectTopology().physicalCores.size());
+    std::vector<size_t> threadCounts;
+    for (size_t threads = 1; threads < maxThreads; threads *= 2)
+        threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    double baselineMs = 0.0;
+    uint64_t baselineHash = 0;
+    for (size_t threads : threadCounts)
+    {
+        ThreadPool::Config config;
+        config.numThreads = threads;
+        uint64_t hash = 0;
+        double ms = MeasurePhysicsStep(config, STEPS, &hash);
+        if (threads == 1)
+        {
+            baselineMs = ms;
+            baselineHash = hash;
+        }
+
+        std::cout << "[ThreadPoolPerformanceTest] 1000 bodies, " << threads << " threads: " << ms
+                  << " ms/step, speedup " << (ms > 0.0 ? baselineMs / ms : 0.0) << "x\n";
+        EXPECT_GT(ms, 0.0);
+        // Every phase partitions its work without reordering results
+        EXPECT_EQ(hash, baselineHash) << threads << " threads";
+    }
+    LOG_FUNC_EXIT();
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include "nyon/utils/WorldInspector.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+using namespace Nyon;
+using Utils::WorldInspector;
+
+/**
+ * @brief Tests for the shared-memory world inspector.
+ *
+ * Tests cover:
+ * - Publishing a frame and reading it back through a separate mapping
+ * - Capped sections, layout checks and missing segments
+ * - Consistent reads while the writer publishes continuously
+ * - Cost of publishing a frame of bodies and contacts
+ */
+
+namespace
+{
+    // Unique per process so parallel test runs do not share a segment
+    std::string SegmentName(const char* suffix)
+    {
+        return "/nyon-inspector-test-" + std::to_string(getpid()) + "-" + suffix;
+    }
+
+    // Every field of every record carries the frame number, so a torn copy shows up
+    void PublishStamped(WorldInspector& inspector, uint64_t frame, uint32_t bodies, uint32_t contacts)
+    {
+        WorldInspector::Frame published = inspector.BeginFrame(frame, frame * 0.5);
+        float value = static_cast<float>(frame);
+        published.header->physics.steps = static_cast<uint32_t>(frame);
+        for (uint32_t i = 0; i < bodies; ++i)
+        {
+            WorldInspector::BodyState body;
+            body.entityId = i;
+            body.x = body.y = body.rotation = body.vx = body.vy = body.angularVelocity = value;
+            published.AddBody(body);
+        }
+        for (uint32_t i = 0; i < contacts; ++i)
+        {
+            WorldInspector::ContactRecord contact;
+            contact.entityIdA = static_cast<uint32_t>(frame);
+            contact.x = contact.y = contact.separation = value;
+            published.AddContact(contact);
+        }
+        inspector.EndFrame();
+    }
+}
+
+// ============================================================================
+// PUBLISH / READ TESTS
+// ============================================================================
+
+TEST(WorldInspectorTest, PublishedFramesReadBackThroughASecondMapping)
+{
+    LOG_FUNC_ENTER();
+    WorldInspector::Config config;
+    config.name = SegmentName("basic");
+    config.maxBodies = 4;
+    config.maxContacts = 16;
+    WorldInspector inspector;
+    if (!inspector.Open(config))
+        GTEST_SKIP() << "POSIX shared memory unavailable";
+
+    WorldInspector::Reader reader;
+    ASSERT_TRUE(reader.Attach(config.name));
+    WorldInspector::Snapshot snapshot;
+    EXPECT_FALSE(reader.ReadLatest(snapshot));  // Nothing published yet
+
+    // Bodies beyond the cap are counted but not stored
+    PublishStamped(inspector, 7, 6, 3);
+    ASSERT_TRUE(reader.ReadLatest(snapshot));
+    EXPECT_EQ(snapshot.frame, 7u);
+    EXPECT_DOUBLE_EQ(snapshot.time, 3.5);
+    EXPECT_EQ(snapshot.physics.steps, 7u);
+    EXPECT_EQ(snapshot.totalBodies, 6u);
+    ASSERT_EQ(snapshot.bodies.size(), 4u);
+    EXPECT_EQ(snapshot.bodies[3].entityId, 3u);
+    EXPECT_EQ(snapshot.bodies[3].vy, 7.0f);
+    ASSERT_EQ(snapshot.contacts.size(), 3u);
+    EXPECT_EQ(snapshot.contacts[2].separation, 7.0f);
+    EXPECT_EQ(snapshot.attempts, 1u);
+
+    // The next frame goes to the other buffer and becomes the latest
+    PublishStamped(inspector, 8, 1, 0);
+    ASSERT_TRUE(reader.ReadLatest(snapshot));
+    EXPECT_EQ(snapshot.frame, 8u);
+    EXPECT_EQ(snapshot.bodies.size(), 1u);
+    EXPECT_TRUE(snapshot.contacts.empty());
+    EXPECT_EQ(inspector.GetPublishedFrames(), 2u);
+
+    std::ostringstream report;
+    WorldInspector::PrintSnapshot(snapshot, report);
+    EXPECT_NE(report.str().find("[INSPECT] Frame 8"), std::string::npos);
+
+    // Unlinked on close: new readers fail, attached ones keep the last frame
+    inspector.Close();
+    WorldInspector::Reader late;
+    EXPECT_FALSE(late.Attach(config.name));
+    ASSERT_TRUE(reader.ReadLatest(snapshot));
+    EXPECT_EQ(snapshot.frame, 8u);
+    LOG_FUNC_EXIT();
+}
+
+TEST(WorldInspectorTest, ReadsStayConsistentWhileTheWriterPublishes)
+{
+    LOG_FUNC_ENTER();
+    constexpr uint32_t BODIES = 2000;
+    WorldInspector::Config config;
+    config.name = SegmentName("race");
+    config.maxBodies = BODIES;
+    config.maxContacts = BODIES;
+    WorldInspector inspector;
+    if (!inspector.Open(config))
+        GTEST_SKIP() << "POSIX shared memory unavailable";
+
+    std::atomic<bool> done{false};
+    std::thread writer([&]() {
+        for (uint64_t frame = 1; !done.load(); ++frame)
+            PublishStamped(inspector, frame, BODIES, BODIES / 2);
+    });
+
+    WorldInspector::Reader reader;
+    ASSERT_TRUE(reader.Attach(config.name));
+    WorldInspector::Snapshot snapshot;
+    int reads = 0;
+    int torn = 0;
+    uint64_t lastFrame = 0;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        if (!reader.ReadLatest(snapshot, 64))
+            continue;
+        ++reads;
+        float value = static_cast<float>(snapshot.frame);
+        EXPECT_GE(snapshot.frame, lastFrame);
+        lastFrame = snapshot.frame;
+        EXPECT_EQ(snapshot.bodies.size(), BODIES);
+        for (const auto& body : snapshot.bodies)
+            torn += (body.x != value || body.angularVelocity != value) ? 1 : 0;
+        for (const auto& contact : snapshot.contacts)
+            torn += (contact.entityIdA != snapshot.frame || contact.separation != value) ? 1 : 0;
+    }
+    done = true;
+    writer.join();
+
+    EXPECT_GT(reads, 0);
+    EXPECT_EQ(torn, 0);
+    LOG_FUNC_EXIT();
+}
+
+// ============================================================================
+// PERFORMANCE TESTS
+// ============================================================================
+
+TEST(WorldInspectorPerformanceTest, PublishTenThousandBodies)
+{
+    LOG_FUNC_ENTER();
+    constexpr uint32_t BODIES = 10000;
+    constexpr uint32_t CONTACTS = 8000;
+    constexpr int FRAMES = 200;
+    WorldInspector::Config config;
+    config.name = SegmentName("perf");
+    config.maxBodies = BODIES;
+    config.maxContacts = CONTACTS;
+    WorldInspector inspector;
+    if (!inspector.Open(config))
+        GTEST_SKIP() << "POSIX shared memory unavailable";
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < FRAMES; ++frame)
+        PublishStamped(inspector, static_cast<uint64_t>(frame), BODIES, CONTACTS);
+    double publishMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / FRAMES;
+
+    WorldInspector::Reader reader;
+    ASSERT_TRUE(reader.Attach(config.name));
+    WorldInspector::Snapshot snapshot;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < FRAMES; ++i)
+        ASSERT_TRUE(reader.ReadLatest(snapshot));
+    double readMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / FRAMES;
+
+    std::cout << "[WorldInspectorPerformanceTest] Publishing " << BODIES << " bodies and " << CONTACTS << " contact points: " << publishMs
+              << " ms per frame; reader copy " << readMs << " ms\n";
+    EXPECT_LT(publishMs, 2.0);
+    LOG_FUNC_EXIT();
+}
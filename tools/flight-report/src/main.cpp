@@ -0,0 +1,27 @@
+#include "nyon/utils/FlightRecorder.h"
+#include <iostream>
+
+// Prints the spike breakdown of flight recorder dumps (nyon-spike-<frame>.nfr)
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <dump.nfr> [more dumps...]" << std::endl;
+        return 1;
+    }
+
+    int failures = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        Nyon::Utils::FlightRecorder::Dump dump;
+        if (!Nyon::Utils::FlightRecorder::ReadDump(argv[i], dump))
+        {
+            std::cerr << "Failed to read " << argv[i] << " (missing, truncated or from a different build)" << std::endl;
+            failures++;
+            continue;
+        }
+        std::cout << "[FLIGHT] " << argv[i] << "\n";
+        Nyon::Utils::FlightRecorder::PrintReport(dump, std::cout);
+    }
+    return failures == 0 ? 0 : 1;
+}
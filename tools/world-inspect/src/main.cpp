@@ -0,0 +1,43 @@
+#include "nyon/utils/WorldInspector.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+// Prints frames a running game publishes with --inspect NAME
+int main(int argc, char** argv)
+{
+    if (argc > 4)
+    {
+        std::cerr << "Usage: " << argv[0] << " [name=/nyon-inspector] [samples=1] [interval-ms=500]" << std::endl;
+        return 1;
+    }
+    std::string name = argc > 1 ? argv[1] : "/nyon-inspector";
+    int samples = argc > 2 ? std::max(1, std::atoi(argv[2])) : 1;
+    int intervalMs = argc > 3 ? std::max(0, std::atoi(argv[3])) : 500;
+
+    Nyon::Utils::WorldInspector::Reader reader;
+    if (!reader.Attach(name))
+    {
+        std::cerr << "Failed to attach to " << name << " (no game publishing, or from a different build)" << std::endl;
+        return 1;
+    }
+
+    int failures = 0;
+    Nyon::Utils::WorldInspector::Snapshot snapshot;
+    for (int i = 0; i < samples; ++i)
+    {
+        if (i > 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+        if (!reader.ReadLatest(snapshot))
+        {
+            std::cerr << "No consistent frame in " << name << " yet" << std::endl;
+            failures++;
+            continue;
+        }
+        Nyon::Utils::WorldInspector::PrintSnapshot(snapshot, std::cout);
+    }
+    return failures == 0 ? 0 : 1;
+}